@@ -326,6 +326,7 @@ const struct riscv_opcode riscv_opcodes[] =
 {"pq.set_inv_ntt",     "I", "d,s,t", MATCH_PQ_SET_INV_NTT, MASK_PQ_SET_INV_NTT, match_opcode, 0},
 {"pq.set_first_rounds","I", "d,s,t", MATCH_PQ_SET_FIRST_ROUNDS, MASK_PQ_SET_FIRST_ROUNDS, match_opcode, 0},
 {"pq.set_last_round",  "I", "d,s,t", MATCH_PQ_SET_LAST_ROUND, MASK_PQ_SET_LAST_ROUND, match_opcode, 0},
+{"pq.set_dilithium",   "I", "d,s,t", MATCH_PQ_SET_DILITHIUM, MASK_PQ_SET_DILITHIUM, match_opcode, 0},
 
 {"pq.ntt_multiple_bf", "I", "d,s,t", MATCH_PQ_NTT_MULTIPLE_BF, MASK_PQ_NTT_MULTIPLE_BF, match_opcode, 0},
 {"pq.ntt_single_bf",   "I", "d,s,t", MATCH_PQ_NTT_SINGLE_BF, MASK_PQ_NTT_SINGLE_BF, match_opcode, 0},
@@ -334,6 +335,7 @@ const struct riscv_opcode riscv_opcodes[] =
 {"pq.mul_gamma1",      "I", "d,s,t", MATCH_PQ_MUL_GAMMA1, MASK_PQ_MUL_GAMMA1, match_opcode, 0},
 {"pq.mul_gamma2",      "I", "d,s,t", MATCH_PQ_MUL_GAMMA2, MASK_PQ_MUL_GAMMA2, match_opcode, 0},
 {"pq.update_gamma",    "I", "d,s,t", MATCH_PQ_UPDATE_GAMMA, MASK_PQ_UPDATE_GAMMA, match_opcode, 0},
+{"pq.set_modulus",     "I", "d,s,t", MATCH_PQ_SET_MODULUS, MASK_PQ_SET_MODULUS, match_opcode, 0},
 
 {"pq.mod_mul_r",       "I", "d,s,t", MATCH_MOD_MUL_R, MASK_MOD_MUL_R, match_opcode, 0},
 {"pq.mod_add_r",       "I", "d,s,t", MATCH_MOD_ADD_R, MASK_MOD_ADD_R, match_opcode, 0},
@@ -358,6 +360,9 @@ const struct riscv_opcode riscv_opcodes[] =
 {"pq.bs_k8",           "I", "d,s,t", MATCH_PQ_BINOM_SAMPLE_4, MASK_PQ_BINOM_SAMPLE_3, match_opcode, 0},
 
 {"pq.mac",             "I", "d,s,t", MATCH_PQ_MAC, MASK_PQ_MAC, match_opcode, 0},
+{"pq.wmac",            "I", "d,s,t", MATCH_PQ_WMAC, MASK_PQ_WMAC, match_opcode, 0},
+{"pq.wmacs",           "I", "d,s,t", MATCH_PQ_WMACS, MASK_PQ_WMACS, match_opcode, 0},
+{"pq.wmacr",           "I", "d,s,t", MATCH_PQ_WMACR, MASK_PQ_WMACR, match_opcode, 0},
 
 {"multer.write",       "I", "d,s,t", MATCH_PQ_MULTER_WRITE, MASK_PQ_MULTER_WRITE, match_opcode, 0},
 {"multer.calc",        "I", "d,s,t", MATCH_PQ_MULTER_CALC, MASK_PQ_MULTER_CALC, match_opcode, 0},
@@ -366,6 +371,8 @@ const struct riscv_opcode riscv_opcodes[] =
 {"gf.mul",             "I", "d,s,t", MATCH_PQ_GFMUL, MASK_PQ_GFMUL, match_opcode, 0},
 {"gf.mulsyn",          "I", "d,s,t", MATCH_PQ_GFSYN, MASK_PQ_GFSYN, match_opcode, 0},
 {"gf.mula",            "I", "d,s,t", MATCH_PQ_GFMULA, MASK_PQ_GFMULA, match_opcode, 0},
+{"gf.clmul",           "I", "d,s,t", MATCH_PQ_GFCLMUL, MASK_PQ_GFCLMUL, match_opcode, 0},
+{"gf.clmulh",          "I", "d,s,t", MATCH_PQ_GFCLMULH, MASK_PQ_GFCLMULH, match_opcode, 0},
 
 {"mod.barrett",        "I", "d,s,t", MATCH_PQ_MOD_BARRETT, MASK_PQ_MOD_BARRETT, match_opcode, 0},
 
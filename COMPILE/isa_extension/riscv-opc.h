@@ -1410,6 +1410,9 @@
 #define MATCH_PQ_SET_LAST_ROUND   0x00006077
 #define MASK_PQ_SET_LAST_ROUND    0xfe00707f
 
+#define MATCH_PQ_SET_DILITHIUM    0x00007077
+#define MASK_PQ_SET_DILITHIUM     0xfe00707f
+
 // NTT Operation
 #define MATCH_PQ_NTT_MULTIPLE_BF  0x02000077
 #define MASK_PQ_NTT_MULTIPLE_BF   0xfe00707f
@@ -1432,6 +1435,9 @@
 #define MATCH_PQ_UPDATE_GAMMA     0x02006077
 #define MASK_PQ_UPDATE_GAMMA      0xfe00707f
 
+#define MATCH_PQ_SET_MODULUS      0x02007077
+#define MASK_PQ_SET_MODULUS       0xfe00707f
+
 // Modular Arithmetic Unit
 #define MATCH_MOD_MUL_R           0x04000077
 #define MASK_MOD_MUL_R            0xfe00707f
@@ -1494,6 +1500,16 @@
 #define MATCH_PQ_MAC              0x0c000077
 #define MASK_PQ_MAC               0xfe00707f
 
+// Wide Mul Acc
+#define MATCH_PQ_WMAC             0x0c001077
+#define MASK_PQ_WMAC              0xfe00707f
+
+#define MATCH_PQ_WMACS            0x0c002077
+#define MASK_PQ_WMACS             0xfe00707f
+
+#define MATCH_PQ_WMACR            0x0c003077
+#define MASK_PQ_WMACR             0xfe00707f
+
 // Mul Ter
 #define MATCH_PQ_MULTER_WRITE     0x0e000077
 #define MASK_PQ_MULTER_WRITE      0xfe00707f
@@ -1514,6 +1530,12 @@
 #define MATCH_PQ_GFMULA           0x10002077
 #define MASK_PQ_GFMULA            0xfe00707f
 
+#define MATCH_PQ_GFCLMUL          0x10003077
+#define MASK_PQ_GFCLMUL           0xfe00707f
+
+#define MATCH_PQ_GFCLMULH         0x10004077
+#define MASK_PQ_GFCLMULH          0xfe00707f
+
 // Barrett
 #define MATCH_PQ_MOD_BARRETT      0x12000077
 #define MASK_PQ_MOD_BARRETT       0xfe00707f
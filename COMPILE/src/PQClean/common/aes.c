@@ -338,10 +338,11 @@ static uint32_t sub_word(uint32_t x) {
     return (uint32_t)q[0];
 }
 
-static void br_aes_ct64_keysched(uint64_t *comp_skey, const unsigned char *key, unsigned int key_len) {
+/* FIPS-197 key expansion into (nrounds + 1) * 4 little-endian words */
+static void aes_keysched_words(uint32_t *skey, const unsigned char *key, unsigned int key_len,
+                               uint32_t (*sub)(uint32_t)) {
     unsigned int i, j, k, nk, nkf;
     uint32_t tmp;
-    uint32_t skey[60];
     unsigned nrounds = 10 + ((key_len - 16) >> 2);
 
     nk = (key_len >> 2);
@@ -351,9 +352,9 @@ static void br_aes_ct64_keysched(uint64_t *comp_skey, const unsigned char *key,
     for (i = nk, j = 0, k = 0; i < nkf; i ++) {
         if (j == 0) {
             tmp = (tmp << 24) | (tmp >> 8);
-            tmp = sub_word(tmp) ^ Rcon[k];
+            tmp = sub(tmp) ^ Rcon[k];
         } else if (nk > 6 && j == 4) {
-            tmp = sub_word(tmp);
+            tmp = sub(tmp);
         }
         tmp ^= skey[i - nk];
         skey[i] = tmp;
@@ -362,7 +363,15 @@ static void br_aes_ct64_keysched(uint64_t *comp_skey, const unsigned char *key,
             k ++;
         }
     }
+}
+
+static void br_aes_ct64_keysched(uint64_t *comp_skey, const unsigned char *key, unsigned int key_len) {
+    unsigned int i, j;
+    uint32_t skey[60];
+    unsigned nrounds = 10 + ((key_len - 16) >> 2);
+    unsigned int nkf = ((nrounds + 1) << 2);
 
+    aes_keysched_words(skey, key, key_len, sub_word);
     for (i = 0, j = 0; i < nkf; i += 4, j += 2) {
         uint64_t q[8];
 
@@ -542,10 +551,9 @@ static void aes_ecb(unsigned char *out, const unsigned char *in, size_t nblocks,
 }
 
 
-static void aes_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const uint64_t *rkeys, unsigned int nrounds) {
+static void aes_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t cc, const uint64_t *rkeys, unsigned int nrounds) {
     uint32_t ivw[16];
     size_t i;
-    uint32_t cc = 0;
 
     br_range_dec32le(ivw, 3, iv);
     memcpy(ivw +  4, ivw, 3 * sizeof(uint32_t));
@@ -571,55 +579,336 @@ static void aes_ctr(unsigned char *out, size_t outlen, const unsigned char *iv,
 }
 
 
+/*
+ * AES-NI / VAES backend, picked once from CPUID. With it the context
+ * holds the plain (nrounds + 1) round keys instead of the bitsliced schedule;
+ * as the choice is fixed for the life of the process, keyexp and encryption
+ * always agree on the format. Eight independent blocks are kept in flight to
+ * hide the latency of aesenc; with VAES they travel as four 256-bit lanes.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define AES_X86
+#endif
 
+#ifdef AES_X86
+#include <immintrin.h>
 
+#define AESNI_TARGET __attribute__((target("aes,sse2")))
+#define VAES_TARGET __attribute__((target("aes,vaes,avx2")))
 
-void aes128_keyexp(aes128ctx *r, const unsigned char *key) {
-    uint64_t skey[22];
+enum {
+    AES_BACKEND_CT64,
+    AES_BACKEND_AESNI,
+    AES_BACKEND_VAES
+};
 
-    br_aes_ct64_keysched(skey, key, 16);
-    br_aes_ct64_skey_expand(r->sk_exp, skey, 10);
+static int aes_backend_detect(void) {
+    /* the first call may come from a constructor */
+    __builtin_cpu_init();
+    if (!__builtin_cpu_supports("aes")) {
+        return AES_BACKEND_CT64;
+    }
+    if (__builtin_cpu_supports("vaes") && __builtin_cpu_supports("avx2")) {
+        return AES_BACKEND_VAES;
+    }
+    return AES_BACKEND_AESNI;
 }
 
+/*
+ * CPUID is queried on the first call only, as in pqdispatch. The cache is
+ * accessed atomically so that first calls from several threads are well
+ * defined; they all store the same value.
+ */
+static int aes_backend_cached = -1;
 
-void aes192_keyexp(aes192ctx *r, const unsigned char *key) {
-    uint64_t skey[26];
+static int aes_backend(void) {
+    int b = __atomic_load_n(&aes_backend_cached, __ATOMIC_RELAXED);
 
-    br_aes_ct64_keysched(skey, key, 24);
-    br_aes_ct64_skey_expand(r->sk_exp, skey, 12);
+    if (b < 0) {
+        b = aes_backend_detect();
+        __atomic_store_n(&aes_backend_cached, b, __ATOMIC_RELAXED);
+    }
+    return b;
 }
 
+/* aeskeygenassist returns SubWord of the second dword in the first one */
+static AESNI_TARGET uint32_t aesni_sub_word(uint32_t x) {
+    __m128i t = _mm_aeskeygenassist_si128(_mm_set_epi32(0, 0, (int)x, 0), 0);
 
-void aes256_keyexp(aes256ctx *r, const unsigned char *key) {
+    return (uint32_t)_mm_cvtsi128_si32(t);
+}
+
+static void aes_x86_keysched(uint64_t *sk_exp, const unsigned char *key, unsigned int key_len) {
+    uint32_t skey[60];
+    unsigned int nrounds = 10 + ((key_len - 16) >> 2);
+
+    aes_keysched_words(skey, key, key_len, aesni_sub_word);
+    br_range_enc32le((unsigned char *)sk_exp, skey, (nrounds + 1) << 2);
+}
+
+static inline AESNI_TARGET void aesni_encrypt8(__m128i b[8], const __m128i *rk, unsigned int nrounds) {
+    unsigned int i, r;
+
+    for (i = 0; i < 8; i++) {
+        b[i] = _mm_xor_si128(b[i], rk[0]);
+    }
+    for (r = 1; r < nrounds; r++) {
+        for (i = 0; i < 8; i++) {
+            b[i] = _mm_aesenc_si128(b[i], rk[r]);
+        }
+    }
+    for (i = 0; i < 8; i++) {
+        b[i] = _mm_aesenclast_si128(b[i], rk[nrounds]);
+    }
+}
+
+static AESNI_TARGET void aesni_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, const uint64_t *sk_exp, unsigned int nrounds) {
+    __m128i rk[15], b[8];
+    unsigned char t[128];
+    unsigned int i;
+
+    for (i = 0; i <= nrounds; i++) {
+        rk[i] = _mm_loadu_si128((const __m128i *)sk_exp + i);
+    }
+    while (nblocks > 0) {
+        const unsigned char *src = in;
+        unsigned char *dst = out;
+        size_t n = nblocks < 8 ? nblocks : 8;
+
+        if (n < 8) {
+            memset(t, 0, sizeof(t));
+            memcpy(t, in, n * 16);
+            src = dst = t;
+        }
+        for (i = 0; i < 8; i++) {
+            b[i] = _mm_loadu_si128((const __m128i *)src + i);
+        }
+        aesni_encrypt8(b, rk, nrounds);
+        for (i = 0; i < 8; i++) {
+            _mm_storeu_si128((__m128i *)dst + i, b[i]);
+        }
+        if (n < 8) {
+            memcpy(out, t, n * 16);
+        }
+        in += 16 * n;
+        out += 16 * n;
+        nblocks -= n;
+    }
+}
+
+static AESNI_TARGET void aesni_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t cc, const uint64_t *sk_exp, unsigned int nrounds) {
+    __m128i rk[15], b[8], nonce;
+    unsigned char ivb[16] = {0}, t[128];
+    unsigned int i;
+
+    for (i = 0; i <= nrounds; i++) {
+        rk[i] = _mm_loadu_si128((const __m128i *)sk_exp + i);
+    }
+    memcpy(ivb, iv, AESCTR_NONCEBYTES);
+    nonce = _mm_loadu_si128((const __m128i *)ivb);
+    while (outlen > 0) {
+        for (i = 0; i < 8; i++) {
+            b[i] = _mm_or_si128(nonce, _mm_set_epi32((int)br_swap32(cc + i), 0, 0, 0));
+        }
+        cc += 8;
+        aesni_encrypt8(b, rk, nrounds);
+        if (outlen >= 128) {
+            for (i = 0; i < 8; i++) {
+                _mm_storeu_si128((__m128i *)out + i, b[i]);
+            }
+            out += 128;
+            outlen -= 128;
+        } else {
+            for (i = 0; i < 8; i++) {
+                _mm_storeu_si128((__m128i *)t + i, b[i]);
+            }
+            memcpy(out, t, outlen);
+            outlen = 0;
+        }
+    }
+}
+
+static inline VAES_TARGET void vaes_encrypt8(__m256i b[4], const __m256i *rk, unsigned int nrounds) {
+    unsigned int i, r;
+
+    for (i = 0; i < 4; i++) {
+        b[i] = _mm256_xor_si256(b[i], rk[0]);
+    }
+    for (r = 1; r < nrounds; r++) {
+        for (i = 0; i < 4; i++) {
+            b[i] = _mm256_aesenc_epi128(b[i], rk[r]);
+        }
+    }
+    for (i = 0; i < 4; i++) {
+        b[i] = _mm256_aesenclast_epi128(b[i], rk[nrounds]);
+    }
+}
+
+static VAES_TARGET void vaes_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, const uint64_t *sk_exp, unsigned int nrounds) {
+    __m256i rk[15], b[4];
+    unsigned char t[128];
+    unsigned int i;
+
+    for (i = 0; i <= nrounds; i++) {
+        rk[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)sk_exp + i));
+    }
+    while (nblocks > 0) {
+        const unsigned char *src = in;
+        unsigned char *dst = out;
+        size_t n = nblocks < 8 ? nblocks : 8;
+
+        if (n < 8) {
+            memset(t, 0, sizeof(t));
+            memcpy(t, in, n * 16);
+            src = dst = t;
+        }
+        for (i = 0; i < 4; i++) {
+            b[i] = _mm256_loadu_si256((const __m256i *)src + i);
+        }
+        vaes_encrypt8(b, rk, nrounds);
+        for (i = 0; i < 4; i++) {
+            _mm256_storeu_si256((__m256i *)dst + i, b[i]);
+        }
+        if (n < 8) {
+            memcpy(out, t, n * 16);
+        }
+        in += 16 * n;
+        out += 16 * n;
+        nblocks -= n;
+    }
+}
+
+static VAES_TARGET void vaes_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t cc, const uint64_t *sk_exp, unsigned int nrounds) {
+    __m256i rk[15], b[4], nonce;
+    unsigned char ivb[16] = {0}, t[128];
+    unsigned int i;
+
+    for (i = 0; i <= nrounds; i++) {
+        rk[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)sk_exp + i));
+    }
+    memcpy(ivb, iv, AESCTR_NONCEBYTES);
+    nonce = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ivb));
+    while (outlen > 0) {
+        for (i = 0; i < 4; i++) {
+            b[i] = _mm256_or_si256(nonce, _mm256_set_epi32((int)br_swap32(cc + 2 * i + 1), 0, 0, 0,
+                                   (int)br_swap32(cc + 2 * i), 0, 0, 0));
+        }
+        cc += 8;
+        vaes_encrypt8(b, rk, nrounds);
+        if (outlen >= 128) {
+            for (i = 0; i < 4; i++) {
+                _mm256_storeu_si256((__m256i *)out + i, b[i]);
+            }
+            out += 128;
+            outlen -= 128;
+        } else {
+            for (i = 0; i < 4; i++) {
+                _mm256_storeu_si256((__m256i *)t + i, b[i]);
+            }
+            memcpy(out, t, outlen);
+            outlen = 0;
+        }
+    }
+}
+#endif
+
+
+static void aes_keyexp(uint64_t *sk_exp, const unsigned char *key, unsigned int key_len) {
     uint64_t skey[30];
+    unsigned int nrounds = 10 + ((key_len - 16) >> 2);
+
+#ifdef AES_X86
+    if (aes_backend() != AES_BACKEND_CT64) {
+        aes_x86_keysched(sk_exp, key, key_len);
+        return;
+    }
+#endif
+    br_aes_ct64_keysched(skey, key, key_len);
+    br_aes_ct64_skey_expand(sk_exp, skey, nrounds);
+}
+
+static void aes_ecb_any(unsigned char *out, const unsigned char *in, size_t nblocks, const uint64_t *sk_exp, unsigned int nrounds) {
+#ifdef AES_X86
+    switch (aes_backend()) {
+    case AES_BACKEND_VAES:
+        vaes_ecb(out, in, nblocks, sk_exp, nrounds);
+        return;
+    case AES_BACKEND_AESNI:
+        aesni_ecb(out, in, nblocks, sk_exp, nrounds);
+        return;
+    default:
+        break;
+    }
+#endif
+    aes_ecb(out, in, nblocks, sk_exp, nrounds);
+}
+
+static void aes_ctr_any(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t ctr, const uint64_t *sk_exp, unsigned int nrounds) {
+#ifdef AES_X86
+    switch (aes_backend()) {
+    case AES_BACKEND_VAES:
+        vaes_ctr(out, outlen, iv, ctr, sk_exp, nrounds);
+        return;
+    case AES_BACKEND_AESNI:
+        aesni_ctr(out, outlen, iv, ctr, sk_exp, nrounds);
+        return;
+    default:
+        break;
+    }
+#endif
+    aes_ctr(out, outlen, iv, ctr, sk_exp, nrounds);
+}
+
+
+void aes128_keyexp(aes128ctx *r, const unsigned char *key) {
+    aes_keyexp(r->sk_exp, key, 16);
+}
+
 
-    br_aes_ct64_keysched(skey, key, 32);
-    br_aes_ct64_skey_expand(r->sk_exp, skey, 14);
+void aes192_keyexp(aes192ctx *r, const unsigned char *key) {
+    aes_keyexp(r->sk_exp, key, 24);
+}
+
+
+void aes256_keyexp(aes256ctx *r, const unsigned char *key) {
+    aes_keyexp(r->sk_exp, key, 32);
 }
 
 
 void aes128_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, const aes128ctx *ctx) {
-    aes_ecb(out, in, nblocks, ctx->sk_exp, 10);
+    aes_ecb_any(out, in, nblocks, ctx->sk_exp, 10);
 }
 
 void aes128_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const aes128ctx *ctx) {
-    aes_ctr(out, outlen, iv, ctx->sk_exp, 10);
+    aes_ctr_any(out, outlen, iv, 0, ctx->sk_exp, 10);
+}
+
+void aes128_ctr_ic(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t ctr, const aes128ctx *ctx) {
+    aes_ctr_any(out, outlen, iv, ctr, ctx->sk_exp, 10);
 }
 
 void aes192_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, const aes192ctx *ctx) {
-    aes_ecb(out, in, nblocks, ctx->sk_exp, 12);
+    aes_ecb_any(out, in, nblocks, ctx->sk_exp, 12);
 }
 
 void aes192_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const aes192ctx *ctx) {
-    aes_ctr(out, outlen, iv, ctx->sk_exp, 12);
+    aes_ctr_any(out, outlen, iv, 0, ctx->sk_exp, 12);
+}
+
+void aes192_ctr_ic(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t ctr, const aes192ctx *ctx) {
+    aes_ctr_any(out, outlen, iv, ctr, ctx->sk_exp, 12);
 }
 
 void aes256_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, const aes256ctx *ctx) {
-    aes_ecb(out, in, nblocks, ctx->sk_exp, 14);
+    aes_ecb_any(out, in, nblocks, ctx->sk_exp, 14);
 }
 
 void aes256_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const aes256ctx *ctx) {
-    aes_ctr(out, outlen, iv, ctx->sk_exp, 14);
+    aes_ctr_any(out, outlen, iv, 0, ctx->sk_exp, 14);
+}
+
+void aes256_ctr_ic(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t ctr, const aes256ctx *ctx) {
+    aes_ctr_any(out, outlen, iv, ctr, ctx->sk_exp, 14);
 }
 
 void aes128_ctx_release(aes128ctx *r) {
@@ -636,4 +925,3 @@ void aes256_ctx_release(aes256ctx *r) {
     // no-op for PQClean's basic AES operation
     (void) r;
 }
-
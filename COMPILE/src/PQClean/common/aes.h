@@ -30,6 +30,9 @@ void aes128_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, con
 
 void aes128_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const aes128ctx *ctx);
 
+// Same as aes128_ctr, but the 32-bit block counter starts at ctr instead of 0
+void aes128_ctr_ic(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t ctr, const aes128ctx *ctx);
+
 void aes128_ctx_release(aes128ctx *r);
 
 
@@ -39,6 +42,9 @@ void aes192_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, con
 
 void aes192_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const aes192ctx *ctx);
 
+// Same as aes192_ctr, but the 32-bit block counter starts at ctr instead of 0
+void aes192_ctr_ic(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t ctr, const aes192ctx *ctx);
+
 void aes192_ctx_release(aes192ctx *r);
 
 
@@ -48,6 +54,9 @@ void aes256_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, con
 
 void aes256_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const aes256ctx *ctx);
 
+// Same as aes256_ctr, but the 32-bit block counter starts at ctr instead of 0
+void aes256_ctr_ic(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t ctr, const aes256ctx *ctx);
+
 void aes256_ctx_release(aes256ctx *r);
 
 
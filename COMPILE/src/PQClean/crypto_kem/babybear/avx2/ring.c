@@ -0,0 +1,193 @@
+/** Ring arithmetic implementation */
+#include "ring.h"
+
+#include <immintrin.h>
+#include <string.h>
+
+/** Return the i'th limb of the modulus */
+limb_t PQCLEAN_BABYBEAR_AVX2_modulus(size_t i) {
+    return (i == DIGITS / 2) ? LMASK - 1 : LMASK;
+}
+
+/*
+ * The limb product a*b is computed with KARATSUBA_LEVELS levels of Karatsuba
+ * on operands zero-padded to PADDED_DIGITS limbs, followed by schoolbook
+ * products of LEAF_DIGITS limbs. The limbs of a and b are below 2^11 and
+ * grow by one bit per level, so the leaves have 14-bit inputs and multiply
+ * 16-bit pairs with _mm256_madd_epi16. Intermediate sums are taken modulo
+ * 2^32, which is exact for the final product.
+ */
+#define KARATSUBA_LEVELS 3
+#define LEAF_DIGITS ((((DIGITS - 1) >> KARATSUBA_LEVELS) + 8) & ~7)
+#define PADDED_DIGITS (LEAF_DIGITS << KARATSUBA_LEVELS)
+
+/** r[0 .. 2*LEAF_DIGITS) = a*b */
+static void schoolbook(dlimb_t r[2 * LEAF_DIGITS], const limb_t a[LEAF_DIGITS], const limb_t b[LEAF_DIGITS]) {
+    /* ap[i] = a[2i+1] | a[2i] << 16 and bp[LEAF_DIGITS+m] = b[m-1] | b[m] << 16,
+     * so that lane l of madd(ap[i], bp[LEAF_DIGITS+k-2i+l]) is the
+     * contribution of a[2i] and a[2i+1] to column k+l */
+    uint32_t ap[LEAF_DIGITS / 2];
+    uint32_t bp[3 * LEAF_DIGITS];
+    const __m256i rot = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    __m256i x, y, prev, acc;
+    __m128i t;
+    size_t i, k;
+
+    for (i = 0; i < LEAF_DIGITS; i += 8) {
+        t = _mm_loadu_si128((const __m128i *)&a[i]);
+        t = _mm_or_si128(_mm_slli_epi32(t, 16), _mm_srli_epi32(t, 16));
+        _mm_storeu_si128((__m128i *)&ap[i / 2], t);
+    }
+
+    prev = _mm256_setzero_si256();
+    for (i = 0; i < LEAF_DIGITS; i += 8) {
+        _mm256_storeu_si256((__m256i *)&bp[i], prev);
+    }
+    for (i = 2 * LEAF_DIGITS + 8; i < 3 * LEAF_DIGITS; i += 8) {
+        _mm256_storeu_si256((__m256i *)&bp[i], prev);
+    }
+    for (i = 0; i < LEAF_DIGITS; i += 8) {
+        x = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&b[i]));
+        y = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(x, rot), prev, 0x01);
+        _mm256_storeu_si256((__m256i *)&bp[LEAF_DIGITS + i], _mm256_or_si256(_mm256_slli_epi32(x, 16), y));
+        prev = _mm256_permutevar8x32_epi32(x, rot);
+    }
+    _mm256_storeu_si256((__m256i *)&bp[2 * LEAF_DIGITS], _mm256_blend_epi32(_mm256_setzero_si256(), prev, 0x01));
+
+    for (k = 0; k < 2 * LEAF_DIGITS; k += 8) {
+        /* pairs outside [k - LEAF_DIGITS, k + 8) only meet zeros */
+        acc = _mm256_setzero_si256();
+        for (i = k > LEAF_DIGITS ? k - LEAF_DIGITS : 0; i < LEAF_DIGITS && i < k + 8; i += 2) {
+            acc = _mm256_add_epi32(acc, _mm256_madd_epi16(_mm256_set1_epi32((int32_t)ap[i / 2]),
+                                   _mm256_loadu_si256((const __m256i *)&bp[LEAF_DIGITS + k - i])));
+        }
+        _mm256_storeu_si256((__m256i *)&r[k], acc);
+    }
+}
+
+/** r[0 .. 2n) = a*b */
+static void karatsuba(dlimb_t *r, const limb_t *a, const limb_t *b, size_t n) {
+    limb_t sa[PADDED_DIGITS / 2], sb[PADDED_DIGITS / 2];
+    dlimb_t m[PADDED_DIGITS];
+    size_t h = n / 2, i;
+
+    if (n == LEAF_DIGITS) {
+        schoolbook(r, a, b);
+        return;
+    }
+
+    karatsuba(r, a, b, h);
+    karatsuba(r + n, a + h, b + h, h);
+    for (i = 0; i < h; i++) {
+        sa[i] = (limb_t)(a[i] + a[i + h]);
+        sb[i] = (limb_t)(b[i] + b[i + h]);
+    }
+    karatsuba(m, sa, sb, h);
+    for (i = 0; i < n; i++) {
+        m[i] -= r[i] + r[i + n];
+    }
+    for (i = 0; i < n; i++) {
+        r[i + h] += m[i];
+    }
+}
+
+/** Multiply and accumulate c += a*b */
+void PQCLEAN_BABYBEAR_AVX2_mac(gf_t c, const gf_t a, const gf_t b) {
+    dslimb_t accum[2 * DIGITS];
+    dlimb_t prod[2 * PADDED_DIGITS];
+    limb_t pa[PADDED_DIGITS] = {0}, pb[PADDED_DIGITS] = {0};
+    dslimb_t chain;
+    size_t i;
+
+    memcpy(pa, a, sizeof(gf_t));
+    memcpy(pb, b, sizeof(gf_t));
+    karatsuba(prod, pa, pb, PADDED_DIGITS);
+
+    /* Initialize accumulator = a*b + unclarify(c) */
+    for (i = 0; i < 2 * DIGITS; i++) {
+        accum[i] = (dslimb_t)prod[i];
+    }
+    for (i = 0; i < DIGITS; i++) {
+        accum[i + DIGITS / 2] += c[i];
+    }
+
+    /* Clarify and reduce */
+    for (i = 0; i < DIGITS / 2; i++) {
+        accum[i + DIGITS / 2] -= accum[i];
+        accum[i + DIGITS]   += accum[i];
+        accum[i + DIGITS / 2] += accum[i + 3 * DIGITS / 2];
+        accum[i + DIGITS]   += accum[i + 3 * DIGITS / 2];
+    }
+
+    /* Carry propagate */
+    chain = accum[3 * DIGITS / 2 - 1];
+    accum[3 * DIGITS / 2 - 1] = chain & LMASK;
+    chain >>= LGX;
+    accum[DIGITS] += chain;
+    for (i = DIGITS / 2; i < 3 * DIGITS / 2; i++) {
+        chain += accum[i];
+        c[i - DIGITS / 2] = chain & LMASK;
+        chain >>= LGX;
+    }
+    c[0] = (limb_t) (c[0] + chain);
+    c[DIGITS / 2] = (limb_t) (c[DIGITS / 2] + chain);
+}
+
+/** Reduce a gf_t to canonical form, i.e. strictly less than N. */
+void PQCLEAN_BABYBEAR_AVX2_canon(gf_t c) {
+    const limb_t DELTA = (limb_t)1 << (LGX - 1);
+    slimb_t hi;
+    dslimb_t scarry;
+    dlimb_t carry;
+
+    /* Reduce to 0..2p */
+    hi = (slimb_t) (c[DIGITS - 1] - DELTA);
+    c[DIGITS - 1] = (limb_t) ((hi & LMASK) + DELTA);
+    c[DIGITS / 2] = (limb_t) (c[DIGITS / 2] + (hi >> LGX));
+
+    /* Strong reduce.  First subtract modulus */
+    scarry = hi >> LGX;
+    for (size_t i = 0; i < DIGITS; i++) {
+        scarry = scarry + (slimb_t)c[i] - PQCLEAN_BABYBEAR_AVX2_modulus(i);
+        c[i] = scarry & LMASK;
+        scarry >>= LGX;
+    }
+
+    /* add it back */
+    carry = 0;
+    for (size_t i = 0; i < DIGITS; i++) {
+        carry = carry + c[i] + ((dlimb_t)scarry & PQCLEAN_BABYBEAR_AVX2_modulus(i));
+        c[i] = carry & LMASK;
+        carry >>= LGX;
+    }
+}
+
+/** Serialize a gf_t to bytes */
+void PQCLEAN_BABYBEAR_AVX2_contract(uint8_t ch[GF_BYTES], gf_t a) {
+    size_t pos;
+
+    PQCLEAN_BABYBEAR_AVX2_canon(a);
+    for (size_t i = 0; i < GF_BYTES; i++) {
+        pos = (i * 8) / LGX;
+        ch[i] = (uint8_t)(a[pos] >> ((i * 8) % LGX));
+        if (i < GF_BYTES - 1) {
+            ch[i] |= (uint8_t)(a[pos + 1] << (LGX - ((i * 8) % LGX)));
+        }
+    }
+}
+
+/** Deserialize a gf_t from bytes */
+void PQCLEAN_BABYBEAR_AVX2_expand(gf_t ll, const uint8_t ch[GF_BYTES]) {
+    limb_t tmp, buffer = 0;
+
+    for (size_t i = 0, j = 0, bbits = 0; i < GF_BYTES; i++) {
+        tmp = ch[i];
+        buffer |= (limb_t)(tmp << bbits);
+        bbits += 8;
+        if (bbits >= LGX) {
+            ll[j++] = buffer & LMASK;
+            buffer = (limb_t)(tmp >> (LGX - (bbits - 8)));
+            bbits = bbits - LGX;
+        }
+    }
+}
@@ -13,14 +13,15 @@
 #include "common.h"
 #include "params.h"
 
-int PQCLEAN_FRODOKEM1344AES_CLEAN_mul_add_as_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A) {
+int PQCLEAN_FRODOKEM1344AES_CLEAN_mul_add_as_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A, uint16_t *tmp) {
     // Generate-and-multiply: generate matrix A (N x N) row-wise, multiply by s on the right.
     // Inputs: s, e (N x N_BAR)
     // Output: out = A*s + e (N x N_BAR)
     int i, j, k;
-    int16_t A[PARAMS_N * PARAMS_N] = {0};
+    int16_t *A = (int16_t *)tmp;                                // N x N, from the workspace
     aes128ctx ctx128;
 
+    memset(A, 0, PARAMS_N * PARAMS_N * sizeof(int16_t));
     aes128_keyexp(&ctx128, seed_A);
     for (i = 0; i < PARAMS_N; i++) {
         for (j = 0; j < PARAMS_N; j += PARAMS_STRIPE_STEP) {
@@ -54,14 +55,15 @@ int PQCLEAN_FRODOKEM1344AES_CLEAN_mul_add_as_plus_e(uint16_t *out, const uint16_
 }
 
 
-int PQCLEAN_FRODOKEM1344AES_CLEAN_mul_add_sa_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A) {
+int PQCLEAN_FRODOKEM1344AES_CLEAN_mul_add_sa_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A, uint16_t *tmp) {
     // Generate-and-multiply: generate matrix A (N x N) column-wise, multiply by s' on the left.
     // Inputs: s', e' (N_BAR x N)
     // Output: out = s'*A + e' (N_BAR x N)
     int i, j, k;
-    int16_t A[PARAMS_N * PARAMS_N] = {0};
+    int16_t *A = (int16_t *)tmp;                                // N x N, from the workspace
     aes128ctx ctx128;
 
+    memset(A, 0, PARAMS_N * PARAMS_N * sizeof(int16_t));
     aes128_keyexp(&ctx128, seed_A);
     for (i = 0; i < PARAMS_N; i++) {
         for (j = 0; j < PARAMS_N; j += PARAMS_STRIPE_STEP) {
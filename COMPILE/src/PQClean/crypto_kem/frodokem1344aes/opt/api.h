@@ -8,6 +8,7 @@
 #define PQCLEAN_FRODOKEM1344AES_OPT_CRYPTO_PUBLICKEYBYTES  21520     // sizeof(seed_A) + (PARAMS_LOGQ*PARAMS_N*PARAMS_NBAR)/8
 #define PQCLEAN_FRODOKEM1344AES_OPT_CRYPTO_BYTES              32
 #define PQCLEAN_FRODOKEM1344AES_OPT_CRYPTO_CIPHERTEXTBYTES 21632     // (PARAMS_LOGQ*PARAMS_N*PARAMS_NBAR)/8 + (PARAMS_LOGQ*PARAMS_NBAR*PARAMS_NBAR)/8
+#define PQCLEAN_FRODOKEM1344AES_OPT_CRYPTO_WORKSPACEBYTES 215360     // scratch of the _ws functions, see below
 
 #define PQCLEAN_FRODOKEM1344AES_OPT_CRYPTO_ALGNAME "FrodoKEM-1344-AES"
 
@@ -17,4 +18,14 @@ int PQCLEAN_FRODOKEM1344AES_OPT_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const u
 
 int PQCLEAN_FRODOKEM1344AES_OPT_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
 
+// Same as above, but all large temporaries live in ws, which must hold
+// CRYPTO_WORKSPACEBYTES bytes and be at least 8-byte aligned (64-byte alignment keeps
+// it off shared cache lines). A workspace can be reused by any number of calls, but
+// not by concurrent ones.
+int PQCLEAN_FRODOKEM1344AES_OPT_crypto_kem_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws);
+
+int PQCLEAN_FRODOKEM1344AES_OPT_crypto_kem_enc_ws(uint8_t *ct, uint8_t *ss, const uint8_t *pk, void *ws);
+
+int PQCLEAN_FRODOKEM1344AES_OPT_crypto_kem_dec_ws(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, void *ws);
+
 #endif
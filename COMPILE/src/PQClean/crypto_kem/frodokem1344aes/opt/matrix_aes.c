@@ -13,21 +13,22 @@
 #include "common.h"
 #include "params.h"
 
-int PQCLEAN_FRODOKEM1344AES_OPT_mul_add_as_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A) {
+int PQCLEAN_FRODOKEM1344AES_OPT_mul_add_as_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A, uint16_t *tmp) {
     // Generate-and-multiply: generate matrix A (N x N) row-wise, multiply by s on the right.
     // Inputs: s, e (N x N_BAR)
     // Output: out = A*s + e (N x N_BAR)
     int k;
     uint16_t i, j;
-    int16_t a_row[4 * PARAMS_N];
+    int16_t *a_row = (int16_t *)tmp;                            // 4 x N
 
     for (i = 0; i < (PARAMS_N * PARAMS_NBAR); i += 2) {
         *((uint32_t *)&out[i]) = *((uint32_t *)&e[i]);
     }
 
-    int16_t a_row_temp[4 * PARAMS_N] = {0};                     // Take four lines of A at once
+    int16_t *a_row_temp = (int16_t *)tmp + 4 * PARAMS_N;         // Take four lines of A at once
     aes128ctx ctx128;
 
+    memset(a_row_temp, 0, 4 * PARAMS_N * sizeof(int16_t));
     aes128_keyexp(&ctx128, seed_A);
 
     for (j = 0; j < PARAMS_N; j += PARAMS_STRIPE_STEP) {
@@ -70,7 +71,7 @@ int PQCLEAN_FRODOKEM1344AES_OPT_mul_add_as_plus_e(uint16_t *out, const uint16_t
 
 
 
-int PQCLEAN_FRODOKEM1344AES_OPT_mul_add_sa_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A) {
+int PQCLEAN_FRODOKEM1344AES_OPT_mul_add_sa_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A, uint16_t *tmp) {
     // Generate-and-multiply: generate matrix A (N x N) column-wise, multiply by s' on the left.
     // Inputs: s', e' (N_BAR x N)
     // Output: out = s'*A + e' (N_BAR x N)
@@ -81,11 +82,12 @@ int PQCLEAN_FRODOKEM1344AES_OPT_mul_add_sa_plus_e(uint16_t *out, const uint16_t
     }
 
     int k;
-    uint16_t a_cols[PARAMS_N * PARAMS_STRIPE_STEP] = {0};
-    uint16_t a_cols_t[PARAMS_N * PARAMS_STRIPE_STEP];
-    uint16_t a_cols_temp[PARAMS_N * PARAMS_STRIPE_STEP] = {0};
+    uint16_t *a_cols = tmp;                                     // N x STRIPE_STEP each
+    uint16_t *a_cols_t = tmp + PARAMS_N * PARAMS_STRIPE_STEP;
+    uint16_t *a_cols_temp = tmp + 2 * PARAMS_N * PARAMS_STRIPE_STEP;
     aes128ctx ctx128;
 
+    memset(a_cols_temp, 0, PARAMS_N * PARAMS_STRIPE_STEP * sizeof(uint16_t));
     aes128_keyexp(&ctx128, seed_A);
 
     for (i = 0, j = 0; i < PARAMS_N; i++, j += PARAMS_STRIPE_STEP) {
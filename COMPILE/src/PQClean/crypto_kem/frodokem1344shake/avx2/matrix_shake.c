@@ -0,0 +1,215 @@
+/********************************************************************************************
+* FrodoKEM: Learning with Errors Key Encapsulation
+*
+* Abstract: matrix arithmetic functions used by the KEM
+*           AVX2 version: rows of A are generated four at a time with 4-way SHAKE128 and
+*           consumed by an AVX2 kernel while they are still in L1. Building with
+*           NTHREADS=<t> (see Makefile) splits the rows of A over t POSIX threads.
+*********************************************************************************************/
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+#if FRODO_NTHREADS > 1
+#include <pthread.h>
+#endif
+
+#include "fips202x4.h"
+
+#include "api.h"
+#include "common.h"
+#include "params.h"
+
+// First row of the block of rows handled by thread t
+#define ROW_SPLIT(t) ((size_t)(((PARAMS_N / 4) * (t)) / FRODO_NTHREADS) * 4)
+
+static void gen_rows4(uint16_t *a_rows, const uint8_t *seed_A, size_t row) {
+    // Rows row, ..., row+3 of A; SHAKE128 output is little-endian, as is the target
+    uint8_t seed_A_separated[4][2 + BYTES_SEED_A];
+    size_t j;
+
+    for (j = 0; j < 4; j++) {
+        seed_A_separated[j][0] = (uint8_t)(row + j);
+        seed_A_separated[j][1] = (uint8_t)((row + j) >> 8);
+        memcpy(&seed_A_separated[j][2], seed_A, BYTES_SEED_A);
+    }
+    PQCLEAN_FRODOKEM1344SHAKE_AVX2_shake128x4((unsigned char *)(a_rows + 0 * PARAMS_N),
+                  (unsigned char *)(a_rows + 1 * PARAMS_N),
+                  (unsigned char *)(a_rows + 2 * PARAMS_N),
+                  (unsigned char *)(a_rows + 3 * PARAMS_N),
+                  (unsigned long long)(2 * PARAMS_N),
+                  seed_A_separated[0], seed_A_separated[1],
+                  seed_A_separated[2], seed_A_separated[3],
+                  2 + BYTES_SEED_A);
+}
+
+static uint16_t hsum16(__m256i x) {
+    __m128i t = _mm_add_epi16(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+    t = _mm_add_epi16(t, _mm_srli_si128(t, 8));
+    t = _mm_add_epi16(t, _mm_srli_si128(t, 4));
+    t = _mm_add_epi16(t, _mm_srli_si128(t, 2));
+    return (uint16_t)_mm_cvtsi128_si32(t);
+}
+
+static void as_rows(uint16_t *out, const uint16_t *s, const uint8_t *seed_A, size_t lo, size_t hi, uint16_t *a_rows) {
+    // out[lo..hi) += A[lo..hi) * s, with s stored transposed (N_BAR x N); a_rows holds 4 x N
+    __m256i a, s0, s1;
+    __m256i acc[8];
+    size_t i, j, k, r;
+
+    for (i = lo; i < hi; i += 4) {
+        gen_rows4(a_rows, seed_A, i);
+        for (k = 0; k < PARAMS_NBAR; k += 2) {
+            for (r = 0; r < 8; r++) {
+                acc[r] = _mm256_setzero_si256();
+            }
+            for (j = 0; j < PARAMS_N; j += 16) {
+                s0 = _mm256_loadu_si256((__m256i *)(s + (k + 0) * PARAMS_N + j));
+                s1 = _mm256_loadu_si256((__m256i *)(s + (k + 1) * PARAMS_N + j));
+                for (r = 0; r < 4; r++) {
+                    a = _mm256_loadu_si256((__m256i *)(a_rows + r * PARAMS_N + j));
+                    acc[2 * r + 0] = _mm256_add_epi16(acc[2 * r + 0], _mm256_mullo_epi16(a, s0));
+                    acc[2 * r + 1] = _mm256_add_epi16(acc[2 * r + 1], _mm256_mullo_epi16(a, s1));
+                }
+            }
+            for (r = 0; r < 4; r++) {
+                out[(i + r) * PARAMS_NBAR + k + 0] += hsum16(acc[2 * r + 0]);
+                out[(i + r) * PARAMS_NBAR + k + 1] += hsum16(acc[2 * r + 1]);
+            }
+        }
+    }
+}
+
+static void sa_rows(uint16_t *out, const uint16_t *s, const uint8_t *seed_A, size_t lo, size_t hi, uint16_t *a_rows) {
+    // out += s[:, lo..hi) * A[lo..hi); a_rows holds 4 x N
+    __m256i sp[PARAMS_NBAR][4];
+    __m256i a0, a1, a2, a3, acc;
+    size_t i, j, k, kk;
+
+    for (kk = lo; kk < hi; kk += 4) {
+        gen_rows4(a_rows, seed_A, kk);
+        for (i = 0; i < PARAMS_NBAR; i++) {
+            for (j = 0; j < 4; j++) {
+                sp[i][j] = _mm256_set1_epi16((short)s[i * PARAMS_N + kk + j]);
+            }
+        }
+        for (k = 0; k < PARAMS_N; k += 16) {
+            a0 = _mm256_loadu_si256((__m256i *)(a_rows + 0 * PARAMS_N + k));
+            a1 = _mm256_loadu_si256((__m256i *)(a_rows + 1 * PARAMS_N + k));
+            a2 = _mm256_loadu_si256((__m256i *)(a_rows + 2 * PARAMS_N + k));
+            a3 = _mm256_loadu_si256((__m256i *)(a_rows + 3 * PARAMS_N + k));
+            for (i = 0; i < PARAMS_NBAR; i++) {
+                acc = _mm256_loadu_si256((__m256i *)(out + i * PARAMS_N + k));
+                acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(sp[i][0], a0));
+                acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(sp[i][1], a1));
+                acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(sp[i][2], a2));
+                acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(sp[i][3], a3));
+                _mm256_storeu_si256((__m256i *)(out + i * PARAMS_N + k), acc);
+            }
+        }
+    }
+}
+
+#if FRODO_NTHREADS > 1
+typedef struct matrix_job {
+    void *(*worker)(struct matrix_job *);
+    uint16_t *out;
+    const uint16_t *s;
+    const uint8_t *seed_A;
+    size_t lo;
+    size_t hi;
+    uint16_t *a_rows;           // 4 x N
+    uint16_t *partial;          // N x N_BAR
+    pthread_mutex_t *lock;
+} matrix_job;
+
+static void *as_worker(matrix_job *job) {
+    as_rows(job->out, job->s, job->seed_A, job->lo, job->hi, job->a_rows);
+    return NULL;
+}
+
+static void *sa_worker(matrix_job *job) {
+    // Accumulates its block of rows of A privately and adds the result to out
+    size_t i;
+
+    memset(job->partial, 0, PARAMS_N * PARAMS_NBAR * sizeof(uint16_t));
+    sa_rows(job->partial, job->s, job->seed_A, job->lo, job->hi, job->a_rows);
+    pthread_mutex_lock(job->lock);
+    for (i = 0; i < PARAMS_N * PARAMS_NBAR; i++) {
+        job->out[i] += job->partial[i];
+    }
+    pthread_mutex_unlock(job->lock);
+    return NULL;
+}
+
+static void *thread_main(void *arg) {
+    // Threads other than the caller keep their buffers on their own stack
+    matrix_job *job = arg;
+    uint16_t a_rows[4 * PARAMS_N];
+    uint16_t partial[PARAMS_N * PARAMS_NBAR];
+
+    job->a_rows = a_rows;
+    job->partial = partial;
+    return job->worker(job);
+}
+
+static void run_threaded(void *(*worker)(matrix_job *), uint16_t *out, const uint16_t *s, const uint8_t *seed_A, uint16_t *tmp) {
+    // Thread t handles rows ROW_SPLIT(t) to ROW_SPLIT(t+1), the caller handles t = 0 with the buffers in tmp
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t threads[FRODO_NTHREADS];
+    matrix_job jobs[FRODO_NTHREADS];
+    int started[FRODO_NTHREADS];
+    int t;
+
+    for (t = 0; t < FRODO_NTHREADS; t++) {
+        jobs[t].worker = worker;
+        jobs[t].out = out;
+        jobs[t].s = s;
+        jobs[t].seed_A = seed_A;
+        jobs[t].lo = ROW_SPLIT(t);
+        jobs[t].hi = ROW_SPLIT(t + 1);
+        jobs[t].a_rows = tmp;
+        jobs[t].partial = tmp + 4 * PARAMS_N;
+        jobs[t].lock = &lock;
+        started[t] = 0;
+    }
+    for (t = 1; t < FRODO_NTHREADS; t++) {
+        started[t] = pthread_create(&threads[t], NULL, thread_main, &jobs[t]) == 0;
+        if (!started[t]) {
+            worker(&jobs[t]);
+        }
+    }
+    worker(&jobs[0]);
+    for (t = 1; t < FRODO_NTHREADS; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+}
+#endif
+
+int PQCLEAN_FRODOKEM1344SHAKE_AVX2_mul_add_as_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A, uint16_t *tmp) {
+    // Generate-and-multiply: generate matrix A (N x N) row-wise, multiply by s on the right.
+    // Inputs: s, e (N x N_BAR)
+    // Output: out = A*s + e (N x N_BAR)
+    memcpy(out, e, PARAMS_N * PARAMS_NBAR * sizeof(uint16_t));
+#if FRODO_NTHREADS > 1
+    run_threaded(as_worker, out, s, seed_A, tmp);
+#else
+    as_rows(out, s, seed_A, 0, PARAMS_N, tmp);
+#endif
+    return 1;
+}
+
+int PQCLEAN_FRODOKEM1344SHAKE_AVX2_mul_add_sa_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A, uint16_t *tmp) {
+    // Generate-and-multiply: generate matrix A (N x N) column-wise, multiply by s' on the left.
+    // Inputs: s', e' (N_BAR x N)
+    // Output: out = s'*A + e' (N_BAR x N)
+    memcpy(out, e, PARAMS_N * PARAMS_NBAR * sizeof(uint16_t));
+#if FRODO_NTHREADS > 1
+    run_threaded(sa_worker, out, s, seed_A, tmp);
+#else
+    sa_rows(out, s, seed_A, 0, PARAMS_N, tmp);
+#endif
+    return 1;
+}
@@ -14,18 +14,50 @@
 #include "common.h"
 #include "params.h"
 
-int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_keypair(uint8_t *pk, uint8_t *sk) {
+// Matrices of the _ws functions, carved from the caller's workspace. A is the scratch
+// memory of mul_add_as_plus_e and mul_add_sa_plus_e.
+typedef struct {
+    uint16_t B[PARAMS_N * PARAMS_NBAR];
+    uint16_t S[2 * PARAMS_N * PARAMS_NBAR];                     // contains secret data
+    uint16_t A[PARAMS_MATRIX_TMP];
+} keypair_workspace;
+
+typedef struct {
+    uint16_t B[PARAMS_N * PARAMS_NBAR];
+    uint16_t Bp[PARAMS_N * PARAMS_NBAR];
+    uint16_t Sp[(2 * PARAMS_N + PARAMS_NBAR) * PARAMS_NBAR];    // contains secret data
+    uint8_t Fin[CRYPTO_CIPHERTEXTBYTES + CRYPTO_BYTES];         // contains secret data via Fin_k
+    uint16_t A[PARAMS_MATRIX_TMP];
+} enc_workspace;
+
+typedef struct {
+    uint16_t B[PARAMS_N * PARAMS_NBAR];
+    uint16_t Bp[PARAMS_N * PARAMS_NBAR];
+    uint16_t BBp[PARAMS_N * PARAMS_NBAR];
+    uint16_t Sp[(2 * PARAMS_N + PARAMS_NBAR) * PARAMS_NBAR];    // contains secret data
+    uint16_t S[PARAMS_N * PARAMS_NBAR];                         // contains secret data
+    uint8_t Fin[CRYPTO_CIPHERTEXTBYTES + CRYPTO_BYTES];         // contains secret data via Fin_k
+    uint16_t A[PARAMS_MATRIX_TMP];
+} dec_workspace;
+
+// CRYPTO_WORKSPACEBYTES in api.h must cover all three
+typedef char workspace_keypair_fits[sizeof(keypair_workspace) <= CRYPTO_WORKSPACEBYTES ? 1 : -1];
+typedef char workspace_enc_fits[sizeof(enc_workspace) <= CRYPTO_WORKSPACEBYTES ? 1 : -1];
+typedef char workspace_dec_fits[sizeof(dec_workspace) <= CRYPTO_WORKSPACEBYTES ? 1 : -1];
+
+int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws) {
     // FrodoKEM's key generation
     // Outputs: public key pk (               BYTES_SEED_A + (PARAMS_LOGQ*PARAMS_N*PARAMS_NBAR)/8 bytes)
     //          secret key sk (CRYPTO_BYTES + BYTES_SEED_A + (PARAMS_LOGQ*PARAMS_N*PARAMS_NBAR)/8 + 2*PARAMS_N*PARAMS_NBAR + BYTES_PKHASH bytes)
+    keypair_workspace *w = ws;
     uint8_t *pk_seedA = &pk[0];
     uint8_t *pk_b = &pk[BYTES_SEED_A];
     uint8_t *sk_s = &sk[0];
     uint8_t *sk_pk = &sk[CRYPTO_BYTES];
     uint8_t *sk_S = &sk[CRYPTO_BYTES + CRYPTO_PUBLICKEYBYTES];
     uint8_t *sk_pkh = &sk[CRYPTO_BYTES + CRYPTO_PUBLICKEYBYTES + 2 * PARAMS_N * PARAMS_NBAR];
-    uint16_t B[PARAMS_N * PARAMS_NBAR] = {0};
-    uint16_t S[2 * PARAMS_N * PARAMS_NBAR] = {0};           // contains secret data
+    uint16_t *B = w->B;
+    uint16_t *S = w->S;                                     // contains secret data
     uint16_t *E = &S[PARAMS_N * PARAMS_NBAR];               // contains secret data
     uint8_t randomness[2 * CRYPTO_BYTES + BYTES_SEED_A];    // contains secret data via randomness_s and randomness_seedSE
     uint8_t *randomness_s = &randomness[0];                 // contains secret data
@@ -46,7 +78,7 @@ int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
     }
     PQCLEAN_FRODOKEM1344SHAKE_CLEAN_sample_n(S, PARAMS_N * PARAMS_NBAR);
     PQCLEAN_FRODOKEM1344SHAKE_CLEAN_sample_n(E, PARAMS_N * PARAMS_NBAR);
-    PQCLEAN_FRODOKEM1344SHAKE_CLEAN_mul_add_as_plus_e(B, S, E, pk);
+    PQCLEAN_FRODOKEM1344SHAKE_CLEAN_mul_add_as_plus_e(B, S, E, pk, w->A);
 
     // Encode the second part of the public key
     PQCLEAN_FRODOKEM1344SHAKE_CLEAN_pack(pk_b, CRYPTO_PUBLICKEYBYTES - BYTES_SEED_A, B, PARAMS_N * PARAMS_NBAR, PARAMS_LOGQ);
@@ -71,17 +103,18 @@ int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
 }
 
 
-int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk) {
+int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_enc_ws(uint8_t *ct, uint8_t *ss, const uint8_t *pk, void *ws) {
     // FrodoKEM's key encapsulation
+    enc_workspace *w = ws;
     const uint8_t *pk_seedA = &pk[0];
     const uint8_t *pk_b = &pk[BYTES_SEED_A];
     uint8_t *ct_c1 = &ct[0];
     uint8_t *ct_c2 = &ct[(PARAMS_LOGQ * PARAMS_N * PARAMS_NBAR) / 8];
-    uint16_t B[PARAMS_N * PARAMS_NBAR] = {0};
+    uint16_t *B = w->B;
     uint16_t V[PARAMS_NBAR * PARAMS_NBAR] = {0};              // contains secret data
     uint16_t C[PARAMS_NBAR * PARAMS_NBAR] = {0};
-    uint16_t Bp[PARAMS_N * PARAMS_NBAR] = {0};
-    uint16_t Sp[(2 * PARAMS_N + PARAMS_NBAR)*PARAMS_NBAR] = {0}; // contains secret data
+    uint16_t *Bp = w->Bp;
+    uint16_t *Sp = w->Sp;                                     // contains secret data
     uint16_t *Ep = &Sp[PARAMS_N * PARAMS_NBAR];               // contains secret data
     uint16_t *Epp = &Sp[2 * PARAMS_N * PARAMS_NBAR];          // contains secret data
     uint8_t G2in[BYTES_PKHASH + BYTES_MU];                    // contains secret data via mu
@@ -90,7 +123,7 @@ int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_enc(uint8_t *ct, uint8_t *ss, con
     uint8_t G2out[2 * CRYPTO_BYTES];                          // contains secret data
     uint8_t *seedSE = &G2out[0];                              // contains secret data
     uint8_t *k = &G2out[CRYPTO_BYTES];                        // contains secret data
-    uint8_t Fin[CRYPTO_CIPHERTEXTBYTES + CRYPTO_BYTES];       // contains secret data via Fin_k
+    uint8_t *Fin = w->Fin;                                    // contains secret data via Fin_k
     uint8_t *Fin_ct = &Fin[0];
     uint8_t *Fin_k = &Fin[CRYPTO_CIPHERTEXTBYTES];            // contains secret data
     uint8_t shake_input_seedSE[1 + CRYPTO_BYTES];             // contains secret data
@@ -109,7 +142,7 @@ int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_enc(uint8_t *ct, uint8_t *ss, con
     }
     PQCLEAN_FRODOKEM1344SHAKE_CLEAN_sample_n(Sp, PARAMS_N * PARAMS_NBAR);
     PQCLEAN_FRODOKEM1344SHAKE_CLEAN_sample_n(Ep, PARAMS_N * PARAMS_NBAR);
-    PQCLEAN_FRODOKEM1344SHAKE_CLEAN_mul_add_sa_plus_e(Bp, Sp, Ep, pk_seedA);
+    PQCLEAN_FRODOKEM1344SHAKE_CLEAN_mul_add_sa_plus_e(Bp, Sp, Ep, pk_seedA, w->A);
     PQCLEAN_FRODOKEM1344SHAKE_CLEAN_pack(ct_c1, (PARAMS_LOGQ * PARAMS_N * PARAMS_NBAR) / 8, Bp, PARAMS_N * PARAMS_NBAR, PARAMS_LOGQ);
 
     // Generate Epp, and compute V = Sp*B + Epp
@@ -140,15 +173,16 @@ int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_enc(uint8_t *ct, uint8_t *ss, con
 }
 
 
-int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk) {
+int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_dec_ws(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, void *ws) {
     // FrodoKEM's key decapsulation
-    uint16_t B[PARAMS_N * PARAMS_NBAR] = {0};
-    uint16_t Bp[PARAMS_N * PARAMS_NBAR] = {0};
+    dec_workspace *w = ws;
+    uint16_t *B = w->B;
+    uint16_t *Bp = w->Bp;
     uint16_t W[PARAMS_NBAR * PARAMS_NBAR] = {0};              // contains secret data
     uint16_t C[PARAMS_NBAR * PARAMS_NBAR] = {0};
     uint16_t CC[PARAMS_NBAR * PARAMS_NBAR] = {0};
-    uint16_t BBp[PARAMS_N * PARAMS_NBAR] = {0};
-    uint16_t Sp[(2 * PARAMS_N + PARAMS_NBAR)*PARAMS_NBAR] = {0}; // contains secret data
+    uint16_t *BBp = w->BBp;
+    uint16_t *Sp = w->Sp;                                        // contains secret data
     uint16_t *Ep = &Sp[PARAMS_N * PARAMS_NBAR];                  // contains secret data
     uint16_t *Epp = &Sp[2 * PARAMS_N * PARAMS_NBAR];             // contains secret data
     const uint8_t *ct_c1 = &ct[0];
@@ -156,7 +190,7 @@ int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_dec(uint8_t *ss, const uint8_t *c
     const uint8_t *sk_s = &sk[0];
     const uint8_t *sk_pk = &sk[CRYPTO_BYTES];
     const uint16_t *sk_S = (uint16_t *) &sk[CRYPTO_BYTES + CRYPTO_PUBLICKEYBYTES];
-    uint16_t S[PARAMS_N * PARAMS_NBAR];                      // contains secret data
+    uint16_t *S = w->S;                                      // contains secret data
     const uint8_t *sk_pkh = &sk[CRYPTO_BYTES + CRYPTO_PUBLICKEYBYTES + 2 * PARAMS_N * PARAMS_NBAR];
     const uint8_t *pk_seedA = &sk_pk[0];
     const uint8_t *pk_b = &sk_pk[BYTES_SEED_A];
@@ -166,7 +200,7 @@ int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_dec(uint8_t *ss, const uint8_t *c
     uint8_t G2out[2 * CRYPTO_BYTES];                         // contains secret data
     uint8_t *seedSEprime = &G2out[0];                        // contains secret data
     uint8_t *kprime = &G2out[CRYPTO_BYTES];                  // contains secret data
-    uint8_t Fin[CRYPTO_CIPHERTEXTBYTES + CRYPTO_BYTES];      // contains secret data via Fin_k
+    uint8_t *Fin = w->Fin;                                   // contains secret data via Fin_k
     uint8_t *Fin_ct = &Fin[0];
     uint8_t *Fin_k = &Fin[CRYPTO_CIPHERTEXTBYTES];           // contains secret data
     uint8_t shake_input_seedSEprime[1 + CRYPTO_BYTES];       // contains secret data
@@ -195,7 +229,7 @@ int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_dec(uint8_t *ss, const uint8_t *c
     }
     PQCLEAN_FRODOKEM1344SHAKE_CLEAN_sample_n(Sp, PARAMS_N * PARAMS_NBAR);
     PQCLEAN_FRODOKEM1344SHAKE_CLEAN_sample_n(Ep, PARAMS_N * PARAMS_NBAR);
-    PQCLEAN_FRODOKEM1344SHAKE_CLEAN_mul_add_sa_plus_e(BBp, Sp, Ep, pk_seedA);
+    PQCLEAN_FRODOKEM1344SHAKE_CLEAN_mul_add_sa_plus_e(BBp, Sp, Ep, pk_seedA, w->A);
 
     // Generate Epp, and compute W = Sp*B + Epp
     PQCLEAN_FRODOKEM1344SHAKE_CLEAN_sample_n(Epp, PARAMS_NBAR * PARAMS_NBAR);
@@ -236,3 +270,22 @@ int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_dec(uint8_t *ss, const uint8_t *c
     PQCLEAN_FRODOKEM1344SHAKE_CLEAN_clear_bytes(shake_input_seedSEprime, 1 + CRYPTO_BYTES);
     return 0;
 }
+
+
+// Without a caller-provided workspace the matrices live on the stack
+int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_keypair(uint8_t *pk, uint8_t *sk) {
+    keypair_workspace ws;
+    return PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_keypair_ws(pk, sk, &ws);
+}
+
+
+int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk) {
+    enc_workspace ws;
+    return PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_enc_ws(ct, ss, pk, &ws);
+}
+
+
+int PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk) {
+    dec_workspace ws;
+    return PQCLEAN_FRODOKEM1344SHAKE_CLEAN_crypto_kem_dec_ws(ss, ct, sk, &ws);
+}
@@ -13,13 +13,13 @@
 #include "common.h"
 #include "params.h"
 
-int PQCLEAN_FRODOKEM1344SHAKE_OPT_mul_add_as_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A) {
+int PQCLEAN_FRODOKEM1344SHAKE_OPT_mul_add_as_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A, uint16_t *tmp) {
     // Generate-and-multiply: generate matrix A (N x N) row-wise, multiply by s on the right.
     // Inputs: s, e (N x N_BAR)
     // Output: out = A*s + e (N x N_BAR)
     int j, k;
     uint16_t i;
-    int16_t a_row[4 * PARAMS_N];
+    int16_t *a_row = (int16_t *)tmp;                            // 4 x N
 
     for (i = 0; i < (PARAMS_N * PARAMS_NBAR); i += 2) {
         *((uint32_t *)&out[i]) = *((uint32_t *)&e[i]);
@@ -61,7 +61,7 @@ int PQCLEAN_FRODOKEM1344SHAKE_OPT_mul_add_as_plus_e(uint16_t *out, const uint16_
 
 
 
-int PQCLEAN_FRODOKEM1344SHAKE_OPT_mul_add_sa_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A) {
+int PQCLEAN_FRODOKEM1344SHAKE_OPT_mul_add_sa_plus_e(uint16_t *out, const uint16_t *s, const uint16_t *e, const uint8_t *seed_A, uint16_t *tmp) {
     // Generate-and-multiply: generate matrix A (N x N) column-wise, multiply by s' on the left.
     // Inputs: s', e' (N_BAR x N)
     // Output: out = s'*A + e' (N_BAR x N)
@@ -72,7 +72,7 @@ int PQCLEAN_FRODOKEM1344SHAKE_OPT_mul_add_sa_plus_e(uint16_t *out, const uint16_
     }
 
     int t = 0;
-    uint16_t a_cols[4 * PARAMS_N];
+    uint16_t *a_cols = tmp;                                     // 4 x N
 
     int k;
     uint8_t seed_A_separated[2 + BYTES_SEED_A];
@@ -5,6 +5,7 @@
 #define CRYPTO_PUBLICKEYBYTES PQCLEAN_FRODOKEM1344SHAKE_OPT_CRYPTO_PUBLICKEYBYTES
 #define CRYPTO_BYTES PQCLEAN_FRODOKEM1344SHAKE_OPT_CRYPTO_BYTES
 #define CRYPTO_CIPHERTEXTBYTES PQCLEAN_FRODOKEM1344SHAKE_OPT_CRYPTO_CIPHERTEXTBYTES
+#define CRYPTO_WORKSPACEBYTES PQCLEAN_FRODOKEM1344SHAKE_OPT_CRYPTO_WORKSPACEBYTES
 
 #define PARAMS_N 1344
 #define PARAMS_NBAR 8
@@ -17,6 +18,9 @@
 #define BYTES_MU ((PARAMS_EXTRACTED_BITS * PARAMS_NBAR * PARAMS_NBAR) / 8)
 #define BYTES_PKHASH CRYPTO_BYTES
 
+// uint16_t scratch words of mul_add_as_plus_e and mul_add_sa_plus_e: four rows of A
+#define PARAMS_MATRIX_TMP (4 * PARAMS_N)
+
 // Selecting SHAKE XOF function for the KEM and noise sampling
 #define shake     shake256
 
@@ -1,13 +1,15 @@
 #ifndef AES256CTR_H
 #define AES256CTR_H
 
-#include <immintrin.h>
+#include "aes.h"
+
 #include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
-    __m128i rkeys[16];
-    __m128i n;
+    aes256ctx sk_exp;
+    uint8_t iv[AESCTR_NONCEBYTES];
+    uint32_t ctr;
 } aes256ctr_ctx;
 
 void PQCLEAN_KYBER51290S_AVX2_aes256ctr_init(aes256ctr_ctx *state,
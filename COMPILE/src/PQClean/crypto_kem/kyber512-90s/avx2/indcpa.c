@@ -7,6 +7,8 @@
 #include "rejsample.h"
 #include "symmetric.h"
 
+#include <immintrin.h>
+
 /*************************************************
 * Name:        pack_pk
 *
@@ -5,6 +5,7 @@
 #include "symmetric.h"
 #include "verify.h"
 
+#include <immintrin.h>
 #include <stdlib.h>
 /*************************************************
 * Name:        crypto_kem_keypair
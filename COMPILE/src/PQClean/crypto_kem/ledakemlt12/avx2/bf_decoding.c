@@ -0,0 +1,119 @@
+#include "bf_decoding.h"
+#include "gf2x_arith_mod_xPplusOne.h"
+
+#include <immintrin.h>
+#include <string.h>
+
+/* Expands the P coefficients of poly to one byte each, followed by a copy */
+static void expand_coeffs(uint8_t out[EXT_BYTES], const DIGIT poly[]) {
+    const __m256i shuf = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0,
+                                          1, 1, 1, 1, 1, 1, 1, 1,
+                                          2, 2, 2, 2, 2, 2, 2, 2,
+                                          3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i bits = _mm256_set1_epi64x((long long)0x8040201008040201);
+    const __m256i one = _mm256_set1_epi8(1);
+    __m256i t;
+    uint32_t w;
+
+    for (size_t i = 0; i < P_CHUNKS; i++) {
+        w = (uint32_t)(poly[NUM_DIGITS_GF2X_ELEMENT - 1 - i / 2] >> (32 * (i % 2)));
+        t = _mm256_shuffle_epi8(_mm256_set1_epi32((int32_t)w), shuf);
+        t = _mm256_cmpeq_epi8(_mm256_and_si256(t, bits), bits);
+        _mm256_storeu_si256((__m256i *)(out + 32 * i), _mm256_and_si256(t, one));
+    }
+    memcpy(out + P, out, P);
+    memcpy(out + 2 * P, out, 32);
+}
+
+/* The unsatisfied parity-check counts and the correlations are computed for
+ * 32 positions at once with byte-wise additions of rotated windows: counts
+ * stay below DV and correlations below DV * M < 256. The flips of an
+ * iteration do not affect its correlations, so the positions to flip are
+ * taken from a comparison mask afterwards and are the same as in the
+ * portable decoder. */
+int PQCLEAN_LEDAKEMLT12_AVX2_bf_decoding(DIGIT err[],
+        const POSITION_T HtrPosOnes[N0][DV],
+        const POSITION_T QtrPosOnes[N0][M],
+        DIGIT privateSyndrome[],
+        uint8_t secondIterThreshold,
+        bf_decoding_workspace_t *ws) {
+
+    uint8_t *currSyndrome = ws->currSyndrome;
+    uint8_t (*unsatParityChecks)[EXT_BYTES] = ws->unsatParityChecks;
+    POSITION_T currQBlkPos[N0][M], currQBitPos;
+    POSITION_T syndromePosToFlip, tmp;
+    uint32_t corrt_syndrome_based, flipMask;
+    size_t currQoneIdx, endQblockIdx;
+    __m256i acc, threshold;
+    int check;
+    int iteration = 0;
+
+    for (size_t i = 0; i < N0; i++) {
+        currQoneIdx = endQblockIdx = 0;
+        for (size_t blockIdx = 0; blockIdx < N0; blockIdx++) {
+            endQblockIdx += qBlockWeights[blockIdx][i];
+            for (; currQoneIdx < endQblockIdx; currQoneIdx++) {
+                currQBlkPos[i][currQoneIdx] = (POSITION_T)blockIdx;
+            }
+        }
+    }
+
+    do {
+        expand_coeffs(currSyndrome, privateSyndrome);
+        for (size_t i = 0; i < N0; i++) {
+            for (size_t j = 0; j < P_CHUNKS; j++) {
+                acc = _mm256_setzero_si256();
+                for (size_t HtrOneIdx = 0; HtrOneIdx < DV; HtrOneIdx++) {
+                    acc = _mm256_add_epi8(acc, _mm256_loadu_si256(
+                                              (const __m256i *)(currSyndrome + HtrPosOnes[i][HtrOneIdx] + 32 * j)));
+                }
+                _mm256_storeu_si256((__m256i *)(unsatParityChecks[i] + 32 * j), acc);
+            }
+            memcpy(unsatParityChecks[i] + P, unsatParityChecks[i], P);
+            memcpy(unsatParityChecks[i] + 2 * P, unsatParityChecks[i], 32);
+        }
+
+        /* iteration based threshold determination*/
+        corrt_syndrome_based = iteration * secondIterThreshold + (1 - iteration) * B0;
+        threshold = _mm256_set1_epi8((char)(corrt_syndrome_based > 0xFF ? 0xFF : corrt_syndrome_based));
+
+        // Computation of correlation  with a full Q matrix
+        for (size_t i = 0; i < N0; i++) {
+            for (size_t j = 0; j < P_CHUNKS; j++) {
+                acc = _mm256_setzero_si256();
+                for (size_t v = 0; v < M; v++) {
+                    acc = _mm256_add_epi8(acc, _mm256_loadu_si256(
+                                              (const __m256i *)(unsatParityChecks[currQBlkPos[i][v]] + QtrPosOnes[i][v] + 32 * j)));
+                }
+
+                /* Correlation based flipping */
+                acc = _mm256_cmpeq_epi8(_mm256_max_epu8(acc, threshold), acc);
+                flipMask = (uint32_t)_mm256_movemask_epi8(acc);
+                if (32 * j + 32 > P) {
+                    flipMask &= ((uint32_t)1 << (P % 32)) - 1;
+                }
+                while (flipMask) {
+                    tmp = (POSITION_T)(32 * j + __builtin_ctz(flipMask));
+                    flipMask &= flipMask - 1;
+                    PQCLEAN_LEDAKEMLT12_AVX2_gf2x_toggle_coeff(err + NUM_DIGITS_GF2X_ELEMENT * i, tmp);
+                    for (size_t v = 0; v < M; v++) {
+                        currQBitPos = QtrPosOnes[i][v] + tmp;
+                        currQBitPos = currQBitPos >= P ? currQBitPos - P : currQBitPos;
+                        for (size_t HtrOneIdx = 0; HtrOneIdx < DV; HtrOneIdx++) {
+                            syndromePosToFlip = (HtrPosOnes[currQBlkPos[i][v]][HtrOneIdx] + currQBitPos);
+                            syndromePosToFlip = syndromePosToFlip >= P ? syndromePosToFlip - P : syndromePosToFlip;
+                            PQCLEAN_LEDAKEMLT12_AVX2_gf2x_toggle_coeff(privateSyndrome, syndromePosToFlip);
+                        }
+                    } // end for v
+                } // end while
+            } // end for j
+        } // end for i
+
+        iteration = iteration + 1;
+        check = 0;
+        while (check < NUM_DIGITS_GF2X_ELEMENT && privateSyndrome[check++] == 0) {};
+
+    } while (iteration < ITERATIONS_MAX && check < NUM_DIGITS_GF2X_ELEMENT);
+
+    return (check == NUM_DIGITS_GF2X_ELEMENT);
+}
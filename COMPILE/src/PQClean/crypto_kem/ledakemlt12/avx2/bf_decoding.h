@@ -0,0 +1,31 @@
+#ifndef BF_DECODING_H
+#define BF_DECODING_H
+
+#include "gf2x_arith.h"
+#include "qc_ldpc_parameters.h"
+
+/*  Definitions for DFR level 2^-SL with SL=128 */
+#define ITERATIONS_MAX  (2)
+#define B0              (43)
+#define T_BAR           (4)
+
+/* Rotated windows of P bytes are read starting anywhere in [0, P), in
+ * chunks of 32 bytes: the byte arrays hold two copies of the P values and
+ * room for the last, partial, chunk. */
+#define P_CHUNKS ((P + 31) / 32)
+#define EXT_BYTES (2 * P + 32)
+
+/* Scratch memory of bf_decoding */
+typedef struct {
+    uint8_t currSyndrome[EXT_BYTES];
+    uint8_t unsatParityChecks[N0][EXT_BYTES];
+} bf_decoding_workspace_t;
+
+int PQCLEAN_LEDAKEMLT12_AVX2_bf_decoding(DIGIT err[],
+        const POSITION_T HtrPosOnes[N0][DV],
+        const POSITION_T QtrPosOnes[N0][M],
+        DIGIT privateSyndrome[],
+        uint8_t threshold, // B2
+        bf_decoding_workspace_t *ws);
+
+#endif
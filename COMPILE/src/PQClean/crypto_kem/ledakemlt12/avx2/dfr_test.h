@@ -0,0 +1,14 @@
+#ifndef DFR_TEST_H
+#define DFR_TEST_H
+
+#include "gf2x_arith.h"
+#include "qc_ldpc_parameters.h"
+
+/* Scratch memory of DFR_test */
+typedef struct {
+    uint8_t gamma[N0][N0][P];
+} DFR_test_workspace_t;
+
+int PQCLEAN_LEDAKEMLT12_AVX2_DFR_test(POSITION_T LSparse[N0][DV * M], uint8_t *secondIterThreshold, DFR_test_workspace_t *ws);
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef SORT_H
+#define SORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define int32 int32_t
+
+void PQCLEAN_LEDAKEMLT12_AVX2_uint32_sort(uint32_t *x, size_t n);
+
+#endif
@@ -7,10 +7,11 @@ int PQCLEAN_LEDAKEMLT12_LEAKTIME_bf_decoding(DIGIT err[],
         const POSITION_T HtrPosOnes[N0][DV],
         const POSITION_T QtrPosOnes[N0][M],
         DIGIT privateSyndrome[],
-        uint8_t secondIterThreshold) {
+        uint8_t secondIterThreshold,
+        bf_decoding_workspace_t *ws) {
 
-    DIGIT currSyndrome[NUM_DIGITS_GF2X_ELEMENT];
-    uint8_t unsatParityChecks[N0 * P];
+    DIGIT *currSyndrome = ws->currSyndrome;
+    uint8_t *unsatParityChecks = ws->unsatParityChecks;
     POSITION_T currQBlkPos[M], currQBitPos[M];
     POSITION_T syndromePosToFlip, tmp;
     uint32_t correlation, corrt_syndrome_based;
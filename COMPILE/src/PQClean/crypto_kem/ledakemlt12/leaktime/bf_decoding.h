@@ -2,6 +2,7 @@
 #define BF_DECODING_H
 
 #include "gf2x_arith.h"
+#include "gf2x_arith_mod_xPplusOne.h"
 #include "qc_ldpc_parameters.h"
 
 /*  Definitions for DFR level 2^-SL with SL=128 */
@@ -9,10 +10,17 @@
 #define B0              (43)
 #define T_BAR           (4)
 
+/* Scratch memory of bf_decoding */
+typedef struct {
+    DIGIT currSyndrome[NUM_DIGITS_GF2X_ELEMENT];
+    uint8_t unsatParityChecks[N0 * P];
+} bf_decoding_workspace_t;
+
 int PQCLEAN_LEDAKEMLT12_LEAKTIME_bf_decoding(DIGIT err[],
         const POSITION_T HtrPosOnes[N0][DV],
         const POSITION_T QtrPosOnes[N0][M],
         DIGIT privateSyndrome[],
-        uint8_t threshold); // B2
+        uint8_t threshold, // B2
+        bf_decoding_workspace_t *ws);
 
 #endif
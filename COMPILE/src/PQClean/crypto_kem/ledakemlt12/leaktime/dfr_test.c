@@ -7,15 +7,16 @@
 #include <string.h>
 
 
-int PQCLEAN_LEDAKEMLT12_LEAKTIME_DFR_test(POSITION_T LSparse[N0][DV * M], uint8_t *secondIterThreshold) {
+int PQCLEAN_LEDAKEMLT12_LEAKTIME_DFR_test(POSITION_T LSparse[N0][DV * M], uint8_t *secondIterThreshold, DFR_test_workspace_t *ws) {
 
     POSITION_T LSparse_loc[N0][DV * M]; /* vector of N_0 sparse blocks */
-    uint8_t gamma[N0][N0][P] = {{{0}}};
+    uint8_t (*gamma)[N0][P] = ws->gamma;
     uint32_t gammaHist[N0][DV * M + 1] = {{0}};
     size_t maxMut[N0], maxMutMinusOne[N0];
     size_t allBlockMaxSumst, allBlockMaxSumstMinusOne;
     size_t histIdx, toAdd;
 
+    memset(ws->gamma, 0x00, sizeof(ws->gamma));
     for (size_t i = 0; i < N0; i++) {
         for (size_t j = 0; j < DV * M; j++) {
             if (LSparse[i][j] != 0) {
@@ -32,25 +32,58 @@ static void pack_error(uint8_t *error_bytes, DIGIT *error_digits) {
     }
 }
 
-/* IND-CCA2 Keygen */
-int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_keypair(uint8_t *pk, uint8_t *sk) {
+/* Large temporaries of the _ws functions, carved from the caller's workspace */
+typedef struct {
     publicKeyNiederreiter_t niederreiter_pk;
+    DFR_test_workspace_t dfr;
+} keypair_workspace;
 
-    PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_keygen(&niederreiter_pk, (privateKeyNiederreiter_t *) sk);
+typedef struct {
+    publicKeyNiederreiter_t niederreiter_pk;
+    DIGIT syndrome[NUM_DIGITS_GF2X_ELEMENT];
+    DIGIT error_vector[N0 * NUM_DIGITS_GF2X_ELEMENT];
+    uint8_t error_bytes[N0 * NUM_DIGITS_GF2X_ELEMENT * DIGIT_SIZE_B];
+} enc_workspace;
 
-    pack_pk(pk, &niederreiter_pk);
+typedef struct {
+    DIGIT syndrome[NUM_DIGITS_GF2X_ELEMENT];
+    DIGIT reconstructed_error_vector[N0 * NUM_DIGITS_GF2X_ELEMENT];
+    DIGIT decoded_error_vector[N0 * NUM_DIGITS_GF2X_ELEMENT];
+    uint8_t decoded_error_bytes[N0 * NUM_DIGITS_GF2X_ELEMENT * DIGIT_SIZE_B];
+    niederreiter_decrypt_workspace_t decrypt;
+} dec_workspace;
+
+/* CRYPTO_WORKSPACEBYTES in api.h must cover all three */
+typedef char workspace_keypair_fits[sizeof(keypair_workspace) <= PQCLEAN_LEDAKEMLT12_LEAKTIME_CRYPTO_WORKSPACEBYTES ? 1 : -1];
+typedef char workspace_enc_fits[sizeof(enc_workspace) <= PQCLEAN_LEDAKEMLT12_LEAKTIME_CRYPTO_WORKSPACEBYTES ? 1 : -1];
+typedef char workspace_dec_fits[sizeof(dec_workspace) <= PQCLEAN_LEDAKEMLT12_LEAKTIME_CRYPTO_WORKSPACEBYTES ? 1 : -1];
+
+/* IND-CCA2 Keygen */
+int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws) {
+    keypair_workspace *w = ws;
+
+    PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_keygen(&w->niederreiter_pk, (privateKeyNiederreiter_t *) sk, &w->dfr);
+
+    pack_pk(pk, &w->niederreiter_pk);
 
     return 0;
 }
 
+int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_keypair(uint8_t *pk, uint8_t *sk) {
+    /* Without a caller-provided workspace the temporaries live on the stack */
+    keypair_workspace ws;
+    return PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_keypair_ws(pk, sk, &ws);
+}
+
 /* IND-CCA2 Encapsulation */
-int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk) {
-    publicKeyNiederreiter_t niederreiter_pk;
-    DIGIT syndrome[NUM_DIGITS_GF2X_ELEMENT];
+int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_enc_ws(uint8_t *ct, uint8_t *ss, const uint8_t *pk, void *ws) {
+    enc_workspace *w = ws;
+    publicKeyNiederreiter_t *niederreiter_pk = &w->niederreiter_pk;
+    DIGIT *syndrome = w->syndrome;
     AES_XOF_struct hashedAndTruncatedSeed_expander;
     POSITION_T errorPos[NUM_ERRORS_T];
-    DIGIT error_vector[N0 * NUM_DIGITS_GF2X_ELEMENT];
-    uint8_t error_bytes[N0 * NUM_DIGITS_GF2X_ELEMENT * DIGIT_SIZE_B];
+    DIGIT *error_vector = w->error_vector;
+    uint8_t *error_bytes = w->error_bytes;
     uint8_t seed[TRNG_BYTE_LENGTH];
     uint8_t ss_input[2 * TRNG_BYTE_LENGTH] = {0};
     uint8_t hashedSeed[HASH_BYTE_LENGTH];
@@ -59,7 +92,7 @@ int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const
     uint8_t hashedAndTruncatedErrorVector[TRNG_BYTE_LENGTH] = {0};
     uint8_t maskedSeed[TRNG_BYTE_LENGTH];
 
-    unpack_pk(&niederreiter_pk, pk);
+    unpack_pk(niederreiter_pk, pk);
 
     randombytes(seed, TRNG_BYTE_LENGTH);
     memcpy(ss_input, seed, TRNG_BYTE_LENGTH);
@@ -84,7 +117,7 @@ int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const
     }
 
     PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_encrypt(syndrome,
-            (const publicKeyNiederreiter_t *) &niederreiter_pk, error_vector);
+            (const publicKeyNiederreiter_t *) niederreiter_pk, error_vector);
 
     pack_ct(ct, syndrome);
     memcpy(ct + (NUM_DIGITS_GF2X_ELEMENT * DIGIT_SIZE_B), maskedSeed, TRNG_BYTE_LENGTH);
@@ -92,15 +125,21 @@ int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const
     return 0;
 }
 
+int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk) {
+    enc_workspace ws;
+    return PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_enc_ws(ct, ss, pk, &ws);
+}
+
 
 /* IND-CCA2 Decapsulation  */
-int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk) {
-    DIGIT syndrome[NUM_DIGITS_GF2X_ELEMENT];
+int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_dec_ws(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, void *ws) {
+    dec_workspace *w = ws;
+    DIGIT *syndrome = w->syndrome;
     AES_XOF_struct hashedAndTruncatedSeed_expander;
     POSITION_T reconstructed_errorPos[NUM_ERRORS_T];
-    DIGIT reconstructed_error_vector[N0 * NUM_DIGITS_GF2X_ELEMENT];
-    DIGIT decoded_error_vector[N0 * NUM_DIGITS_GF2X_ELEMENT];
-    uint8_t decoded_error_bytes[N0 * NUM_DIGITS_GF2X_ELEMENT * DIGIT_SIZE_B];
+    DIGIT *reconstructed_error_vector = w->reconstructed_error_vector;
+    DIGIT *decoded_error_vector = w->decoded_error_vector;
+    uint8_t *decoded_error_bytes = w->decoded_error_bytes;
     uint8_t hashedErrorVector[HASH_BYTE_LENGTH];
     uint8_t hashedAndTruncatedErrorVector[TRNG_BYTE_LENGTH] = {0};
     uint8_t decoded_seed[TRNG_BYTE_LENGTH];
@@ -112,7 +151,7 @@ int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_dec(uint8_t *ss, const uint8_t *ct,
     unpack_ct(syndrome, ct);
 
     decode_ok = PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_decrypt(decoded_error_vector,
-                (const privateKeyNiederreiter_t *)sk, syndrome);
+                (const privateKeyNiederreiter_t *)sk, syndrome, &w->decrypt);
 
     pack_error(decoded_error_bytes, decoded_error_vector);
     HASH_FUNCTION(hashedErrorVector, decoded_error_bytes, N0 * NUM_DIGITS_GF2X_ELEMENT * DIGIT_SIZE_B);
@@ -155,3 +194,8 @@ int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_dec(uint8_t *ss, const uint8_t *ct,
 
     return 0;
 }
+
+int PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk) {
+    dec_workspace ws;
+    return PQCLEAN_LEDAKEMLT12_LEAKTIME_crypto_kem_dec_ws(ss, ct, sk, &ws);
+}
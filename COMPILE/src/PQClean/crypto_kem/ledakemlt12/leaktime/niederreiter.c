@@ -9,7 +9,7 @@
 
 #include <string.h>
 
-void PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_keygen(publicKeyNiederreiter_t *pk, privateKeyNiederreiter_t *sk) {
+void PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_keygen(publicKeyNiederreiter_t *pk, privateKeyNiederreiter_t *sk, DFR_test_workspace_t *ws) {
 
     AES_XOF_struct keys_expander;
     POSITION_T HPosOnes[N0][DV];
@@ -54,7 +54,7 @@ void PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_keygen(publicKeyNiederreiter_t *p
         }
         sk->rejections = sk->rejections + 1;
         if (is_L_full) {
-            isDFRok = PQCLEAN_LEDAKEMLT12_LEAKTIME_DFR_test(LPosOnes, &(sk->secondIterThreshold));
+            isDFRok = PQCLEAN_LEDAKEMLT12_LEAKTIME_DFR_test(LPosOnes, &(sk->secondIterThreshold), ws);
         }
     } while (!is_L_full || !isDFRok);
     sk->rejections = sk->rejections - 1;
@@ -99,7 +99,7 @@ void PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_encrypt(DIGIT syndrome[],
     PQCLEAN_LEDAKEMLT12_LEAKTIME_gf2x_mod_add(syndrome, syndrome, err + (N0 - 1)*NUM_DIGITS_GF2X_ELEMENT);
 }
 
-int PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_decrypt(DIGIT *err, const privateKeyNiederreiter_t *sk, const DIGIT *syndrome) {
+int PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_decrypt(DIGIT *err, const privateKeyNiederreiter_t *sk, const DIGIT *syndrome, niederreiter_decrypt_workspace_t *ws) {
     AES_XOF_struct niederreiter_decrypt_expander;
     POSITION_T HPosOnes[N0][DV];
     POSITION_T QPosOnes[N0][M];
@@ -109,14 +109,15 @@ int PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_decrypt(DIGIT *err, const privateK
     POSITION_T QtrPosOnes[N0][M];
     POSITION_T auxSparse[DV * M];
     POSITION_T Ln0trSparse[DV * M];
-    DIGIT err_computed[N0 * NUM_DIGITS_GF2X_ELEMENT] = {0};
-    DIGIT err_mockup[N0 * NUM_DIGITS_GF2X_ELEMENT];
+    DIGIT *err_computed = ws->err_computed;
+    DIGIT *err_mockup = ws->err_mockup;
     DIGIT privateSyndrome[NUM_DIGITS_GF2X_ELEMENT];
     uint8_t processedQOnes[N0];
     int rejections = sk->rejections;
     int decrypt_ok = 0;
     int err_weight;
 
+    memset(err_computed, 0x00, N0 * NUM_DIGITS_GF2X_ELEMENT * DIGIT_SIZE_B);
     PQCLEAN_LEDAKEMLT12_LEAKTIME_seedexpander_from_trng(&niederreiter_decrypt_expander, sk->prng_seed);
     do {
         PQCLEAN_LEDAKEMLT12_LEAKTIME_generateHPosOnes(HPosOnes, &niederreiter_decrypt_expander);
@@ -169,7 +170,7 @@ int PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_decrypt(DIGIT *err, const privateK
     decrypt_ok = PQCLEAN_LEDAKEMLT12_LEAKTIME_bf_decoding(err_computed,
                  (const POSITION_T (*)[DV]) HtrPosOnes,
                  (const POSITION_T (*)[M])  QtrPosOnes,
-                 privateSyndrome, sk->secondIterThreshold);
+                 privateSyndrome, sk->secondIterThreshold, &ws->bf);
 
     err_weight = 0;
     for (size_t i = 0 ; i < N0; i++) {
@@ -1,6 +1,8 @@
 #ifndef NIEDERREITER_H
 #define NIEDERREITER_H
 
+#include "bf_decoding.h"
+#include "dfr_test.h"
 #include "gf2x_arith_mod_xPplusOne.h"
 #include "qc_ldpc_parameters.h"
 #include "rng.h"
@@ -16,9 +18,15 @@ typedef struct {
     DIGIT Mtr[(N0 - 1)*NUM_DIGITS_GF2X_ELEMENT];
 } publicKeyNiederreiter_t;
 
+/* Scratch memory of niederreiter_decrypt */
+typedef struct {
+    DIGIT err_computed[N0 * NUM_DIGITS_GF2X_ELEMENT];
+    DIGIT err_mockup[N0 * NUM_DIGITS_GF2X_ELEMENT];
+    bf_decoding_workspace_t bf;
+} niederreiter_decrypt_workspace_t;
 
-void PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_keygen(publicKeyNiederreiter_t *pk, privateKeyNiederreiter_t *sk);
+void PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_keygen(publicKeyNiederreiter_t *pk, privateKeyNiederreiter_t *sk, DFR_test_workspace_t *ws);
 void PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_encrypt(DIGIT syndrome[], const publicKeyNiederreiter_t *pk, const DIGIT err[]);
-int PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_decrypt(DIGIT *err, const privateKeyNiederreiter_t *sk, const DIGIT *syndrome);
+int PQCLEAN_LEDAKEMLT12_LEAKTIME_niederreiter_decrypt(DIGIT *err, const privateKeyNiederreiter_t *sk, const DIGIT *syndrome, niederreiter_decrypt_workspace_t *ws);
 
 #endif
@@ -0,0 +1,9 @@
+#ifndef UTILS_H
+#define UTILS_H
+
+#include <stdint.h>
+
+int PQCLEAN_LEDAKEMLT32_AVX2_gf2x_verify(const DIGIT *a, const DIGIT *b, size_t len);
+void PQCLEAN_LEDAKEMLT32_AVX2_cmov(uint8_t *r, const uint8_t *a, size_t len, int cond);
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef PQCLEAN_LEDAKEMLT52_AVX2_API_H
+#define PQCLEAN_LEDAKEMLT52_AVX2_API_H
+
+#include <stdint.h>
+
+#define PQCLEAN_LEDAKEMLT52_AVX2_CRYPTO_SECRETKEYBYTES  82
+#define PQCLEAN_LEDAKEMLT52_AVX2_CRYPTO_PUBLICKEYBYTES  19040
+#define PQCLEAN_LEDAKEMLT52_AVX2_CRYPTO_CIPHERTEXTBYTES 19080
+#define PQCLEAN_LEDAKEMLT52_AVX2_CRYPTO_BYTES           64
+#define PQCLEAN_LEDAKEMLT52_AVX2_CRYPTO_WORKSPACEBYTES  1123200    // scratch of the _ws functions, see below
+
+#define PQCLEAN_LEDAKEMLT52_AVX2_CRYPTO_ALGNAME "LEDAKEMLT52"
+
+int PQCLEAN_LEDAKEMLT52_AVX2_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
+int PQCLEAN_LEDAKEMLT52_AVX2_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
+int PQCLEAN_LEDAKEMLT52_AVX2_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+
+// Same as above, but all large temporaries live in ws, which must hold
+// CRYPTO_WORKSPACEBYTES bytes and be at least 8-byte aligned (64-byte alignment keeps
+// it off shared cache lines). A workspace can be reused by any number of calls, but
+// not by concurrent ones.
+int PQCLEAN_LEDAKEMLT52_AVX2_crypto_kem_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws);
+int PQCLEAN_LEDAKEMLT52_AVX2_crypto_kem_enc_ws(uint8_t *ct, uint8_t *ss, const uint8_t *pk, void *ws);
+int PQCLEAN_LEDAKEMLT52_AVX2_crypto_kem_dec_ws(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, void *ws);
+
+
+#endif
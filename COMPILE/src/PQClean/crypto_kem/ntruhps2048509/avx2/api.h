@@ -0,0 +1,19 @@
+#ifndef PQCLEAN_NTRUHPS2048509_AVX2_API_H
+#define PQCLEAN_NTRUHPS2048509_AVX2_API_H
+
+#include <stdint.h>
+
+#define PQCLEAN_NTRUHPS2048509_AVX2_CRYPTO_SECRETKEYBYTES 935
+#define PQCLEAN_NTRUHPS2048509_AVX2_CRYPTO_PUBLICKEYBYTES 699
+#define PQCLEAN_NTRUHPS2048509_AVX2_CRYPTO_CIPHERTEXTBYTES 699
+#define PQCLEAN_NTRUHPS2048509_AVX2_CRYPTO_BYTES 32
+
+#define PQCLEAN_NTRUHPS2048509_AVX2_CRYPTO_ALGNAME "NTRU-HPS2048509"
+
+int PQCLEAN_NTRUHPS2048509_AVX2_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
+
+int PQCLEAN_NTRUHPS2048509_AVX2_crypto_kem_enc(uint8_t *c, uint8_t *k, const uint8_t *pk);
+
+int PQCLEAN_NTRUHPS2048509_AVX2_crypto_kem_dec(uint8_t *k, const uint8_t *c, const uint8_t *sk);
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef CRYPTO_SORT
+#define CRYPTO_SORT
+
+void PQCLEAN_NTRUHPS2048509_AVX2_crypto_sort(void *array, long long n);
+
+#endif
@@ -1,6 +1,5 @@
 #include "poly.h"
 #include "fips202.h"
-#include "verify.h"
 
 uint16_t PQCLEAN_NTRUHPS2048509_CLEAN_mod3(uint16_t a) {
     uint16_t r;
@@ -33,21 +32,6 @@ void PQCLEAN_NTRUHPS2048509_CLEAN_poly_trinary_Zq_to_Z3(poly *r) {
     }
 }
 
-void PQCLEAN_NTRUHPS2048509_CLEAN_poly_Rq_mul(poly *r, const poly *a, const poly *b) {
-    int k, i;
-
-    for (k = 0; k < NTRU_N; k++) {
-        r->coeffs[k] = 0;
-        for (i = 1; i < NTRU_N - k; i++) {
-            r->coeffs[k] += a->coeffs[k + i] * b->coeffs[NTRU_N - i];
-        }
-        for (i = 0; i < k + 1; i++) {
-            r->coeffs[k] += a->coeffs[k - i] * b->coeffs[i];
-        }
-        r->coeffs[k] = MODQ(r->coeffs[k]);
-    }
-}
-
 void PQCLEAN_NTRUHPS2048509_CLEAN_poly_Sq_mul(poly *r, const poly *a, const poly *b) {
     int i;
     PQCLEAN_NTRUHPS2048509_CLEAN_poly_Rq_mul(r, a, b);
@@ -56,23 +40,6 @@ void PQCLEAN_NTRUHPS2048509_CLEAN_poly_Sq_mul(poly *r, const poly *a, const poly
     }
 }
 
-void PQCLEAN_NTRUHPS2048509_CLEAN_poly_S3_mul(poly *r, const poly *a, const poly *b) {
-    int k, i;
-
-    for (k = 0; k < NTRU_N; k++) {
-        r->coeffs[k] = 0;
-        for (i = 1; i < NTRU_N - k; i++) {
-            r->coeffs[k] += a->coeffs[k + i] * b->coeffs[NTRU_N - i];
-        }
-        for (i = 0; i < k + 1; i++) {
-            r->coeffs[k] += a->coeffs[k - i] * b->coeffs[i];
-        }
-    }
-    for (k = 0; k < NTRU_N; k++) {
-        r->coeffs[k] = PQCLEAN_NTRUHPS2048509_CLEAN_mod3(r->coeffs[k] + 2 * r->coeffs[NTRU_N - 1]);
-    }
-}
-
 void PQCLEAN_NTRUHPS2048509_CLEAN_poly_Rq_mul_x_minus_1(poly *r, const poly *a) {
     int i;
     uint16_t last_coeff = a->coeffs[NTRU_N - 1];
@@ -108,115 +75,123 @@ void PQCLEAN_NTRUHPS2048509_CLEAN_poly_Rq_to_S3(poly *r, const poly *a) {
     }
 }
 
-#define POLY_R2_ADD(I,A,B,S) \
-    for ((I)=0; (I)<NTRU_N; (I)++) { \
-        (A).coeffs[(I)] ^= (B).coeffs[(I)] * (S); \
-    }
+/* Binary and trinary polynomials are bit-sliced into 64-bit words for the */
+/* inversions below. A trinary polynomial uses two bit-planes: the first   */
+/* has the coefficients equal to 1 set, the second those equal to 2.       */
+#define NTRU_N_WORDS ((NTRU_N + 63) / 64)
 
-static void cswappoly(poly *a, poly *b, int swap) {
+typedef struct {
+    uint64_t w[NTRU_N_WORDS];
+} poly_bits;
+
+static int16_t both_negative_mask(int16_t x, int16_t y) {
+    return (x & y) >> 15;
+}
+
+static void bits_cswap(poly_bits *a, poly_bits *b, uint64_t mask) {
     int i;
-    uint16_t t;
-    swap = -swap;
-    for (i = 0; i < NTRU_N; i++) {
-        t = (a->coeffs[i] ^ b->coeffs[i]) & swap;
-        a->coeffs[i] ^= t;
-        b->coeffs[i] ^= t;
+    uint64_t t;
+    for (i = 0; i < NTRU_N_WORDS; i++) {
+        t = (a->w[i] ^ b->w[i]) & mask;
+        a->w[i] ^= t;
+        b->w[i] ^= t;
     }
 }
 
-static inline void poly_divx(poly *a, int s) {
+/* a := x*a, dropping the coefficient of x^N */
+static void bits_mulx(poly_bits *a) {
     int i;
+    for (i = NTRU_N_WORDS - 1; i > 0; i--) {
+        a->w[i] = (a->w[i] << 1) | (a->w[i - 1] >> 63);
+    }
+    a->w[0] <<= 1;
+    a->w[NTRU_N_WORDS - 1] &= ~(uint64_t)0 >> (64 * NTRU_N_WORDS - NTRU_N);
+}
 
-    for (i = 1; i < NTRU_N; i++) {
-        a->coeffs[i - 1] = (unsigned char) ((s * a->coeffs[i]) | (!s * a->coeffs[i - 1]));
+/* a := a/x, dropping the constant coefficient */
+static void bits_divx(poly_bits *a) {
+    int i;
+    for (i = 0; i < NTRU_N_WORDS - 1; i++) {
+        a->w[i] = (a->w[i] >> 1) | (a->w[i + 1] << 63);
     }
-    a->coeffs[NTRU_N - 1] = (!s * a->coeffs[NTRU_N - 1]);
+    a->w[NTRU_N_WORDS - 1] >>= 1;
 }
 
-static inline void poly_mulx(poly *a, int s) {
+/* (c1, c2) := (a1, a2) + (b1, b2) over GF(3), bit-sliced */
+static void bits_add3(poly_bits *c1, poly_bits *c2,
+                      const poly_bits *a1, const poly_bits *a2,
+                      const poly_bits *b1, const poly_bits *b2) {
     int i;
+    uint64_t t, x1, x2;
+    for (i = 0; i < NTRU_N_WORDS; i++) {
+        t = (a1->w[i] | b2->w[i]) ^ (a2->w[i] | b1->w[i]);
+        x1 = (a2->w[i] | b2->w[i]) ^ t;
+        x2 = (a1->w[i] | b1->w[i]) ^ t;
+        c1->w[i] = x1;
+        c2->w[i] = x2;
+    }
+}
 
-    for (i = 1; i < NTRU_N; i++) {
-        a->coeffs[NTRU_N - i] = (unsigned char) ((s * a->coeffs[NTRU_N - i - 1]) | (!s * a->coeffs[NTRU_N - i]));
+/* (c1, c2) := s * (a1, a2) over GF(3) for a scalar s in {0,1,2} */
+static void bits_scale3(poly_bits *c1, poly_bits *c2,
+                        const poly_bits *a1, const poly_bits *a2, uint16_t s) {
+    int i;
+    uint64_t m1 = -(uint64_t)(s & 1);
+    uint64_t m2 = -(uint64_t)(s >> 1);
+    for (i = 0; i < NTRU_N_WORDS; i++) {
+        c1->w[i] = (a1->w[i] & m1) | (a2->w[i] & m2);
+        c2->w[i] = (a2->w[i] & m1) | (a1->w[i] & m2);
     }
-    a->coeffs[0] = (!s * a->coeffs[0]);
 }
 
 static void poly_R2_inv(poly *r, const poly *a) {
-    /* Schroeppel--Orman--O'Malley--Spatscheck
-     * "Almost Inverse" algorithm as described
-     * by Silverman in NTRU Tech Report #14 */
-    // with several modifications to make it run in constant-time
+    /* Constant-time divstep inversion (Bernstein--Yang) on bit-sliced     */
+    /* polynomials. f starts as Phi_N and g as the reversal of a mod Phi_N */
     int i, j;
-    int k = 0;
-    uint16_t degf = NTRU_N - 1;
-    uint16_t degg = NTRU_N - 1;
-    int sign, t, swap;
-    int16_t done = 0;
-    poly b, f, g;
-    poly *c = r; // save some stack space
-    poly *temp_r = &f;
-
-    /* b(X) := 1 */
-    for (i = 1; i < NTRU_N; i++) {
-        b.coeffs[i] = 0;
+    int16_t delta = 1;
+    int16_t swap;
+    uint64_t sign;
+    poly_bits f, g, v, w;
+
+    for (i = 0; i < NTRU_N_WORDS; i++) {
+        f.w[i] = 0;
+        g.w[i] = 0;
+        v.w[i] = 0;
+        w.w[i] = 0;
     }
-    b.coeffs[0] = 1;
+    w.w[0] = 1;
 
-    /* c(X) := 0 */
     for (i = 0; i < NTRU_N; i++) {
-        c->coeffs[i] = 0;
+        f.w[i / 64] |= (uint64_t)1 << (i % 64);
     }
-
-    /* f(X) := a(X) */
-    for (i = 0; i < NTRU_N; i++) {
-        f.coeffs[i] = a->coeffs[i] & 1;
-    }
-
-    /* g(X) := 1 + X + X^2 + ... + X^{N-1} */
-    for (i = 0; i < NTRU_N; i++) {
-        g.coeffs[i] = 1;
+    for (i = 0; i < NTRU_N - 1; i++) {
+        j = NTRU_N - 2 - i;
+        g.w[j / 64] |= (uint64_t)((a->coeffs[i] ^ a->coeffs[NTRU_N - 1]) & 1) << (j % 64);
     }
 
     for (j = 0; j < 2 * (NTRU_N - 1) - 1; j++) {
-        sign = f.coeffs[0];
-        swap = sign & !done & ((degf - degg) >> 15);
-
-        cswappoly(&f, &g, swap);
-        cswappoly(&b, c, swap);
-        t = (degf ^ degg) & (-swap);
-        degf ^= t;
-        degg ^= t;
+        bits_mulx(&v);
 
-        POLY_R2_ADD(i, f, g, sign * (!done));
-        POLY_R2_ADD(i, b, (*c), sign * (!done));
+        sign = g.w[0] & f.w[0] & 1;
+        swap = both_negative_mask((int16_t) - delta, (int16_t) - (int16_t)(g.w[0] & 1));
+        delta ^= swap & (delta ^ -delta);
+        delta += 1;
 
-        poly_divx(&f, !done);
-        poly_mulx(c, !done);
-        degf -= !done;
-        k += !done;
-
-        done = 1 - (((uint16_t) - degf) >> 15);
-    }
+        bits_cswap(&f, &g, (uint64_t)(int64_t)swap);
+        bits_cswap(&v, &w, (uint64_t)(int64_t)swap);
 
-    k = k - NTRU_N * ((uint16_t)(NTRU_N - k - 1) >> 15);
-
-    /* Return X^{N-k} * b(X) */
-    /* This is a k-coefficient rotation. We do this by looking at the binary
-       representation of k, rotating for every power of 2, and performing a cmov
-       if the respective bit is set. */
-    for (i = 0; i < NTRU_N; i++) {
-        r->coeffs[i] = b.coeffs[i];
+        for (i = 0; i < NTRU_N_WORDS; i++) {
+            g.w[i] ^= f.w[i] & -sign;
+            w.w[i] ^= v.w[i] & -sign;
+        }
+        bits_divx(&g);
     }
 
-    for (i = 0; i < 10; i++) {
-        for (j = 0; j < NTRU_N; j++) {
-            temp_r->coeffs[j] = r->coeffs[(j + (1 << i)) % NTRU_N];
-        }
-        PQCLEAN_NTRUHPS2048509_CLEAN_cmov((unsigned char *) & (r->coeffs),
-                                          (unsigned char *) & (temp_r->coeffs), sizeof(uint16_t) * NTRU_N, k & 1);
-        k >>= 1;
+    for (i = 0; i < NTRU_N - 1; i++) {
+        j = NTRU_N - 2 - i;
+        r->coeffs[i] = (uint16_t)((v.w[j / 64] >> (j % 64)) & 1);
     }
+    r->coeffs[NTRU_N - 1] = 0;
 }
 
 static void poly_R2_inv_to_Rq_inv(poly *r, const poly *ai, const poly *a) {
@@ -259,87 +234,66 @@ void PQCLEAN_NTRUHPS2048509_CLEAN_poly_Rq_inv(poly *r, const poly *a) {
 }
 
 void PQCLEAN_NTRUHPS2048509_CLEAN_poly_S3_inv(poly *r, const poly *a) {
-    /* Schroeppel--Orman--O'Malley--Spatscheck
-     * "Almost Inverse" algorithm as described
-     * by Silverman in NTRU Tech Report #14 */
-    // with several modifications to make it run in constant-time
+    /* Constant-time divstep inversion (Bernstein--Yang) on bit-sliced     */
+    /* trinary polynomials, see poly_R2_inv                                */
     int i, j;
-    uint16_t k = 0;
-    uint16_t degf = NTRU_N - 1;
-    uint16_t degg = NTRU_N - 1;
-    int sign, fsign = 0, t, swap;
-    int16_t done = 0;
-    poly b, c, f, g;
-    poly *temp_r = &f;
-
-    /* b(X) := 1 */
-    for (i = 1; i < NTRU_N; i++) {
-        b.coeffs[i] = 0;
+    int16_t delta = 1;
+    int16_t swap;
+    uint16_t f0, g0, sign, c;
+    poly_bits f1, f2, g1, g2, v1, v2, w1, w2, t1, t2;
+
+    for (i = 0; i < NTRU_N_WORDS; i++) {
+        f1.w[i] = 0;
+        f2.w[i] = 0;
+        g1.w[i] = 0;
+        g2.w[i] = 0;
+        v1.w[i] = 0;
+        v2.w[i] = 0;
+        w1.w[i] = 0;
+        w2.w[i] = 0;
     }
-    b.coeffs[0] = 1;
+    w1.w[0] = 1;
 
-    /* c(X) := 0 */
     for (i = 0; i < NTRU_N; i++) {
-        c.coeffs[i] = 0;
+        f1.w[i / 64] |= (uint64_t)1 << (i % 64);
     }
-
-    /* f(X) := a(X) */
-    for (i = 0; i < NTRU_N; i++) {
-        f.coeffs[i] = a->coeffs[i];
-    }
-
-    /* g(X) := 1 + X + X^2 + ... + X^{N-1} */
-    for (i = 0; i < NTRU_N; i++) {
-        g.coeffs[i] = 1;
+    for (i = 0; i < NTRU_N - 1; i++) {
+        j = NTRU_N - 2 - i;
+        c = PQCLEAN_NTRUHPS2048509_CLEAN_mod3((a->coeffs[i] & 3) + 2 * (a->coeffs[NTRU_N - 1] & 3));
+        g1.w[j / 64] |= (uint64_t)(c & 1) << (j % 64);
+        g2.w[j / 64] |= (uint64_t)(c >> 1) << (j % 64);
     }
 
     for (j = 0; j < 2 * (NTRU_N - 1) - 1; j++) {
-        sign = PQCLEAN_NTRUHPS2048509_CLEAN_mod3(2 * g.coeffs[0] * f.coeffs[0]);
-        swap = (((sign & 2) >> 1) | sign) & !done & ((degf - degg) >> 15);
-
-        cswappoly(&f, &g, swap);
-        cswappoly(&b, &c, swap);
-        t = (degf ^ degg) & (-swap);
-        degf ^= t;
-        degg ^= t;
-
-        for (i = 0; i < NTRU_N; i++) {
-            f.coeffs[i] = PQCLEAN_NTRUHPS2048509_CLEAN_mod3(f.coeffs[i] + ((uint16_t) (sign * (!done))) * g.coeffs[i]);
-        }
-        for (i = 0; i < NTRU_N; i++) {
-            b.coeffs[i] = PQCLEAN_NTRUHPS2048509_CLEAN_mod3(b.coeffs[i] + ((uint16_t) (sign * (!done))) * c.coeffs[i]);
-        }
-
-        poly_divx(&f, !done);
-        poly_mulx(&c, !done);
-        degf -= !done;
-        k += !done;
-
-        done = 1 - (((uint16_t) - degf) >> 15);
-    }
-
-    fsign = f.coeffs[0];
-    k = k - NTRU_N * ((uint16_t)(NTRU_N - k - 1) >> 15);
-
-    /* Return X^{N-k} * b(X) */
-    /* This is a k-coefficient rotation. We do this by looking at the binary
-       representation of k, rotating for every power of 2, and performing a cmov
-       if the respective bit is set. */
-    for (i = 0; i < NTRU_N; i++) {
-        r->coeffs[i] = PQCLEAN_NTRUHPS2048509_CLEAN_mod3((uint16_t) fsign * b.coeffs[i]);
+        bits_mulx(&v1);
+        bits_mulx(&v2);
+
+        f0 = (uint16_t)((f1.w[0] & 1) | ((f2.w[0] & 1) << 1));
+        g0 = (uint16_t)((g1.w[0] & 1) | ((g2.w[0] & 1) << 1));
+        sign = PQCLEAN_NTRUHPS2048509_CLEAN_mod3((uint16_t)(2 * g0 * f0));
+        swap = both_negative_mask((int16_t) - delta, (int16_t) - (int16_t)g0);
+        delta ^= swap & (delta ^ -delta);
+        delta += 1;
+
+        bits_cswap(&f1, &g1, (uint64_t)(int64_t)swap);
+        bits_cswap(&f2, &g2, (uint64_t)(int64_t)swap);
+        bits_cswap(&v1, &w1, (uint64_t)(int64_t)swap);
+        bits_cswap(&v2, &w2, (uint64_t)(int64_t)swap);
+
+        bits_scale3(&t1, &t2, &f1, &f2, sign);
+        bits_add3(&g1, &g2, &g1, &g2, &t1, &t2);
+        bits_scale3(&t1, &t2, &v1, &v2, sign);
+        bits_add3(&w1, &w2, &w1, &w2, &t1, &t2);
+
+        bits_divx(&g1);
+        bits_divx(&g2);
     }
 
-    for (i = 0; i < 10; i++) {
-        for (j = 0; j < NTRU_N; j++) {
-            temp_r->coeffs[j] = r->coeffs[(j + (1 << i)) % NTRU_N];
-        }
-        PQCLEAN_NTRUHPS2048509_CLEAN_cmov((unsigned char *) & (r->coeffs),
-                                          (unsigned char *) & (temp_r->coeffs), sizeof(uint16_t) * NTRU_N, k & 1);
-        k >>= 1;
-    }
-
-    /* Reduce modulo Phi_n */
-    for (i = 0; i < NTRU_N; i++) {
-        r->coeffs[i] = PQCLEAN_NTRUHPS2048509_CLEAN_mod3(r->coeffs[i] + 2 * r->coeffs[NTRU_N - 1]);
+    f0 = (uint16_t)((f1.w[0] & 1) | ((f2.w[0] & 1) << 1));
+    for (i = 0; i < NTRU_N - 1; i++) {
+        j = NTRU_N - 2 - i;
+        c = (uint16_t)(((v1.w[j / 64] >> (j % 64)) & 1) | (((v2.w[j / 64] >> (j % 64)) & 1) << 1));
+        r->coeffs[i] = PQCLEAN_NTRUHPS2048509_CLEAN_mod3((uint16_t)(f0 * c));
     }
+    r->coeffs[NTRU_N - 1] = 0;
 }
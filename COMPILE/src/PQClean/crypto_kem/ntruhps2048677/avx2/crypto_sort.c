@@ -0,0 +1,148 @@
+// Constant-time sorting network on AVX2 registers in the style of djbsort.
+// The input is padded with INT32_MAX to a power of two and sorted with a
+// bitonic network whose comparators all point the same way: every merge
+// of two sorted blocks of size k/2 first compares i with k-1-i and then
+// runs the usual half-cleaners. Inputs larger than CRYPTO_SORT_MAXN fall
+// back to the portable network from supercop-20190110/crypto_sort/int32.
+
+#include <immintrin.h>
+#include <stdint.h>
+
+#include "crypto_sort.h"
+
+#define CRYPTO_SORT_MAXN 2048
+
+#define int32_MINMAX(a,b) \
+    do { \
+        int32_t ab = (b) ^ (a); \
+        int32_t c = (int32_t)((int64_t)(b) - (int64_t)(a)); \
+        c ^= ab & (c ^ (b)); \
+        c >>= 31; \
+        c &= ab; \
+        (a) ^= c; \
+        (b) ^= c; \
+    } while(0)
+
+static void sort_portable(int32_t *x, long long n) {
+    long long top, p, q, r, i;
+
+    top = 1;
+    while (top < n - top) {
+        top += top;
+    }
+
+    for (p = top; p > 0; p >>= 1) {
+        for (i = 0; i < n - p; ++i) {
+            if (!(i & p)) {
+                int32_MINMAX(x[i], x[i + p]);
+            }
+        }
+        i = 0;
+        for (q = top; q > p; q >>= 1) {
+            for (; i < n - q; ++i) {
+                if (!(i & p)) {
+                    int32_t a = x[i + p];
+                    for (r = q; r > p; r >>= 1) {
+                        int32_MINMAX(a, x[i + r]);
+                    }
+                    x[i + p] = a;
+                }
+            }
+        }
+    }
+}
+
+// Compares lane l with lane idx[l]; the lanes set in upper keep the maximum
+static __m256i minmax_lanes(__m256i x, __m256i idx, __m256i upper) {
+    __m256i y = _mm256_permutevar8x32_epi32(x, idx);
+    __m256i lo = _mm256_min_epi32(x, y);
+    __m256i hi = _mm256_max_epi32(x, y);
+    return _mm256_blendv_epi8(lo, hi, upper);
+}
+
+// Sorts m = 2^k >= 8 words
+static void sort_pow2(int32_t *x, long long m) {
+    const __m256i rev = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i idx1 = _mm256_set_epi32(6, 7, 4, 5, 2, 3, 0, 1);
+    const __m256i idx2 = _mm256_set_epi32(5, 4, 7, 6, 1, 0, 3, 2);
+    const __m256i idx4 = _mm256_set_epi32(3, 2, 1, 0, 7, 6, 5, 4);
+    const __m256i rev4 = _mm256_set_epi32(4, 5, 6, 7, 0, 1, 2, 3);
+    const __m256i up1 = _mm256_set_epi32(-1, 0, -1, 0, -1, 0, -1, 0);
+    const __m256i up2 = _mm256_set_epi32(-1, -1, 0, 0, -1, -1, 0, 0);
+    const __m256i up4 = _mm256_set_epi32(-1, -1, -1, -1, 0, 0, 0, 0);
+    __m256i a, b, lo, hi;
+    long long i, j, k, l;
+
+    // Blocks of up to 8 words live in a single register
+    for (i = 0; i < m; i += 8) {
+        a = _mm256_loadu_si256((__m256i *)(x + i));
+        a = minmax_lanes(a, idx1, up1);
+        a = minmax_lanes(a, rev4, up2);
+        a = minmax_lanes(a, idx1, up1);
+        a = minmax_lanes(a, rev, up4);
+        a = minmax_lanes(a, idx2, up2);
+        a = minmax_lanes(a, idx1, up1);
+        _mm256_storeu_si256((__m256i *)(x + i), a);
+    }
+
+    for (k = 16; k <= m; k <<= 1) {
+        for (i = 0; i < m; i += k) {
+            for (l = 0; l < k / 2; l += 8) {
+                a = _mm256_loadu_si256((__m256i *)(x + i + l));
+                b = _mm256_loadu_si256((__m256i *)(x + i + k - 8 - l));
+                b = _mm256_permutevar8x32_epi32(b, rev);
+                lo = _mm256_min_epi32(a, b);
+                hi = _mm256_max_epi32(a, b);
+                hi = _mm256_permutevar8x32_epi32(hi, rev);
+                _mm256_storeu_si256((__m256i *)(x + i + l), lo);
+                _mm256_storeu_si256((__m256i *)(x + i + k - 8 - l), hi);
+            }
+        }
+        for (j = k / 4; j >= 8; j >>= 1) {
+            for (i = 0; i < m; i += 2 * j) {
+                for (l = 0; l < j; l += 8) {
+                    a = _mm256_loadu_si256((__m256i *)(x + i + l));
+                    b = _mm256_loadu_si256((__m256i *)(x + i + l + j));
+                    _mm256_storeu_si256((__m256i *)(x + i + l), _mm256_min_epi32(a, b));
+                    _mm256_storeu_si256((__m256i *)(x + i + l + j), _mm256_max_epi32(a, b));
+                }
+            }
+        }
+        for (i = 0; i < m; i += 8) {
+            a = _mm256_loadu_si256((__m256i *)(x + i));
+            a = minmax_lanes(a, idx4, up4);
+            a = minmax_lanes(a, idx2, up2);
+            a = minmax_lanes(a, idx1, up1);
+            _mm256_storeu_si256((__m256i *)(x + i), a);
+        }
+    }
+}
+
+void PQCLEAN_NTRUHPS2048677_AVX2_crypto_sort(void *array, long long n) {
+    int32_t buf[CRYPTO_SORT_MAXN];
+    int32_t *x = array;
+    long long i, m;
+
+    if (n < 2) {
+        return;
+    }
+    if (n > CRYPTO_SORT_MAXN) {
+        sort_portable(x, n);
+        return;
+    }
+
+    m = 8;
+    while (m < n) {
+        m += m;
+    }
+    for (i = 0; i < n; i++) {
+        buf[i] = x[i];
+    }
+    for (i = n; i < m; i++) {
+        buf[i] = INT32_MAX;
+    }
+    sort_pow2(buf, m);
+    for (i = 0; i < n; i++) {
+        x[i] = buf[i];
+    }
+}
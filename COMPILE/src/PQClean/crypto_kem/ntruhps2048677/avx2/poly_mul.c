@@ -0,0 +1,225 @@
+#include "poly.h"
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Same Toom-Cook-4 on top of two levels of Karatsuba as the clean         */
+/* implementation. The evaluation and interpolation run on 16 coefficients */
+/* per instruction and the 63 schoolbook products of NTRU_N_PAD/16         */
+/* coefficients are computed column-wise in AVX2 registers.                */
+/* All results are only correct modulo 2^13, which is enough since q<=2^13 */
+
+#define NTRU_N_PAD ((NTRU_N + 31) & ~31)
+
+#define TC_N (NTRU_N_PAD / 4)
+#define KA_N (TC_N / 2)
+#define SB_N (TC_N / 4)
+
+/* Schoolbook outputs are written in full vectors */
+#define SB_RES ((2 * SB_N + 15) & ~15)
+
+/* c = a*b with a, b of SB_N coefficients; c[2*SB_N-1 .. SB_RES) is zero */
+static void schoolbook(uint16_t c[SB_RES], const uint16_t a[SB_N], const uint16_t b[SB_N]) {
+    uint16_t bz[16 + SB_N + 16];
+    __m256i acc, av, bv;
+    int i, k, lo, hi;
+
+    memset(bz, 0, sizeof(bz));
+    memcpy(bz + 16, b, SB_N * sizeof(uint16_t));
+
+    for (k = 0; k < SB_RES; k += 16) {
+        lo = k - SB_N + 1 > 0 ? k - SB_N + 1 : 0;
+        hi = k + 15 < SB_N - 1 ? k + 15 : SB_N - 1;
+        acc = _mm256_setzero_si256();
+        for (i = lo; i <= hi; i++) {
+            av = _mm256_set1_epi16((int16_t)a[i]);
+            bv = _mm256_loadu_si256((const __m256i *)&bz[16 + k - i]);
+            acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(av, bv));
+        }
+        _mm256_storeu_si256((__m256i *)&c[k], acc);
+    }
+}
+
+/* One level of Karatsuba on top of the schoolbook products */
+static void karatsuba_lo(uint16_t c[2 * KA_N], const uint16_t a[KA_N], const uint16_t b[KA_N]) {
+    uint16_t t0[SB_RES], t1[SB_RES], t2[SB_RES];
+    uint16_t as[SB_N], bs[SB_N];
+    int i;
+
+    for (i = 0; i < SB_N; i++) {
+        as[i] = a[i] + a[i + SB_N];
+        bs[i] = b[i] + b[i + SB_N];
+    }
+    schoolbook(t0, a, b);
+    schoolbook(t1, a + SB_N, b + SB_N);
+    schoolbook(t2, as, bs);
+
+    memset(c, 0, 2 * KA_N * sizeof(uint16_t));
+    for (i = 0; i < 2 * SB_N - 1; i++) {
+        c[i] += t0[i];
+        c[i + SB_N] += t2[i] - t0[i] - t1[i];
+        c[i + 2 * SB_N] += t1[i];
+    }
+}
+
+/* Second level of Karatsuba, multiplying the TC_N-coefficient Toom-4 limbs */
+static void karatsuba_hi(uint16_t c[2 * TC_N], const uint16_t a[TC_N], const uint16_t b[TC_N]) {
+    uint16_t t0[2 * KA_N], t1[2 * KA_N], t2[2 * KA_N];
+    uint16_t as[KA_N], bs[KA_N];
+    int i;
+
+    for (i = 0; i < KA_N; i++) {
+        as[i] = a[i] + a[i + KA_N];
+        bs[i] = b[i] + b[i + KA_N];
+    }
+    karatsuba_lo(t0, a, b);
+    karatsuba_lo(t1, a + KA_N, b + KA_N);
+    karatsuba_lo(t2, as, bs);
+
+    memset(c, 0, 2 * TC_N * sizeof(uint16_t));
+    for (i = 0; i < 2 * KA_N - 1; i++) {
+        c[i] += t0[i];
+        c[i + KA_N] += t2[i] - t0[i] - t1[i];
+        c[i + 2 * KA_N] += t1[i];
+    }
+}
+
+static void toom_cook_4way(const uint16_t *a1, const uint16_t *b1, uint16_t *result) {
+    const __m256i inv3 = _mm256_set1_epi16((int16_t)43691);
+    const __m256i inv9 = _mm256_set1_epi16((int16_t)36409);
+    const __m256i inv15 = _mm256_set1_epi16((int16_t)61167);
+    const __m256i c30 = _mm256_set1_epi16(30);
+    const __m256i c45 = _mm256_set1_epi16(45);
+
+    uint16_t aw[7][TC_N], bw[7][TC_N];
+    uint16_t w[7][2 * TC_N];
+    __m256i r0, r1, r2, r3, r4, r5, r6, r7;
+    const uint16_t *in;
+    uint16_t (*out)[TC_N];
+    int i, j, k;
+
+    // EVALUATION
+    for (k = 0; k < 2; k++) {
+        in = k == 0 ? a1 : b1;
+        out = k == 0 ? aw : bw;
+        for (j = 0; j < TC_N; j += 16) {
+            r0 = _mm256_loadu_si256((const __m256i *)&in[j]);
+            r1 = _mm256_loadu_si256((const __m256i *)&in[j + TC_N]);
+            r2 = _mm256_loadu_si256((const __m256i *)&in[j + 2 * TC_N]);
+            r3 = _mm256_loadu_si256((const __m256i *)&in[j + 3 * TC_N]);
+            r4 = _mm256_add_epi16(r0, r2);
+            r5 = _mm256_add_epi16(r1, r3);
+            r6 = _mm256_add_epi16(r4, r5);
+            r7 = _mm256_sub_epi16(r4, r5);
+            _mm256_storeu_si256((__m256i *)&out[2][j], r6);
+            _mm256_storeu_si256((__m256i *)&out[3][j], r7);
+            r4 = _mm256_slli_epi16(_mm256_add_epi16(_mm256_slli_epi16(r0, 2), r2), 1);
+            r5 = _mm256_add_epi16(_mm256_slli_epi16(r1, 2), r3);
+            r6 = _mm256_add_epi16(r4, r5);
+            r7 = _mm256_sub_epi16(r4, r5);
+            _mm256_storeu_si256((__m256i *)&out[4][j], r6);
+            _mm256_storeu_si256((__m256i *)&out[5][j], r7);
+            r4 = _mm256_add_epi16(_mm256_slli_epi16(r3, 3), _mm256_slli_epi16(r2, 2));
+            r4 = _mm256_add_epi16(r4, _mm256_add_epi16(_mm256_slli_epi16(r1, 1), r0));
+            _mm256_storeu_si256((__m256i *)&out[1][j], r4);
+            _mm256_storeu_si256((__m256i *)&out[6][j], r0);
+            _mm256_storeu_si256((__m256i *)&out[0][j], r3);
+        }
+    }
+
+    // MULTIPLICATION
+    for (k = 0; k < 7; k++) {
+        karatsuba_hi(w[k], aw[k], bw[k]);
+    }
+
+    // INTERPOLATION
+    for (i = 0; i < 2 * TC_N; i += 16) {
+        r0 = _mm256_loadu_si256((const __m256i *)&w[0][i]);
+        r1 = _mm256_loadu_si256((const __m256i *)&w[1][i]);
+        r2 = _mm256_loadu_si256((const __m256i *)&w[2][i]);
+        r3 = _mm256_loadu_si256((const __m256i *)&w[3][i]);
+        r4 = _mm256_loadu_si256((const __m256i *)&w[4][i]);
+        r5 = _mm256_loadu_si256((const __m256i *)&w[5][i]);
+        r6 = _mm256_loadu_si256((const __m256i *)&w[6][i]);
+
+        r1 = _mm256_add_epi16(r1, r4);
+        r5 = _mm256_sub_epi16(r5, r4);
+        r3 = _mm256_srli_epi16(_mm256_sub_epi16(r3, r2), 1);
+        r4 = _mm256_sub_epi16(r4, r0);
+        r4 = _mm256_sub_epi16(r4, _mm256_slli_epi16(r6, 6));
+        r4 = _mm256_add_epi16(_mm256_slli_epi16(r4, 1), r5);
+        r2 = _mm256_add_epi16(r2, r3);
+        r1 = _mm256_sub_epi16(r1, _mm256_add_epi16(_mm256_slli_epi16(r2, 6), r2));
+        r2 = _mm256_sub_epi16(r2, r6);
+        r2 = _mm256_sub_epi16(r2, r0);
+        r1 = _mm256_add_epi16(r1, _mm256_mullo_epi16(c45, r2));
+        r4 = _mm256_sub_epi16(r4, _mm256_slli_epi16(r2, 3));
+        r4 = _mm256_srli_epi16(_mm256_mullo_epi16(r4, inv3), 3);
+        r5 = _mm256_add_epi16(r5, r1);
+        r1 = _mm256_add_epi16(r1, _mm256_slli_epi16(r3, 4));
+        r1 = _mm256_srli_epi16(_mm256_mullo_epi16(r1, inv9), 1);
+        r3 = _mm256_sub_epi16(_mm256_setzero_si256(), _mm256_add_epi16(r3, r1));
+        r5 = _mm256_sub_epi16(_mm256_mullo_epi16(c30, r1), r5);
+        r5 = _mm256_srli_epi16(_mm256_mullo_epi16(r5, inv15), 2);
+        r2 = _mm256_sub_epi16(r2, r4);
+        r1 = _mm256_sub_epi16(r1, r5);
+
+        r7 = _mm256_loadu_si256((__m256i *)&result[i]);
+        _mm256_storeu_si256((__m256i *)&result[i], _mm256_add_epi16(r7, r6));
+        r7 = _mm256_loadu_si256((__m256i *)&result[i + 1 * TC_N]);
+        _mm256_storeu_si256((__m256i *)&result[i + 1 * TC_N], _mm256_add_epi16(r7, r5));
+        r7 = _mm256_loadu_si256((__m256i *)&result[i + 2 * TC_N]);
+        _mm256_storeu_si256((__m256i *)&result[i + 2 * TC_N], _mm256_add_epi16(r7, r4));
+        r7 = _mm256_loadu_si256((__m256i *)&result[i + 3 * TC_N]);
+        _mm256_storeu_si256((__m256i *)&result[i + 3 * TC_N], _mm256_add_epi16(r7, r3));
+        r7 = _mm256_loadu_si256((__m256i *)&result[i + 4 * TC_N]);
+        _mm256_storeu_si256((__m256i *)&result[i + 4 * TC_N], _mm256_add_epi16(r7, r2));
+        r7 = _mm256_loadu_si256((__m256i *)&result[i + 5 * TC_N]);
+        _mm256_storeu_si256((__m256i *)&result[i + 5 * TC_N], _mm256_add_epi16(r7, r1));
+        r7 = _mm256_loadu_si256((__m256i *)&result[i + 6 * TC_N]);
+        _mm256_storeu_si256((__m256i *)&result[i + 6 * TC_N], _mm256_add_epi16(r7, r0));
+    }
+}
+
+/* c = a*b in Z[x]/(x^N - 1), coefficients correct modulo 2^13 */
+static void poly_mul_cyclic(uint16_t c[NTRU_N], const poly *a, const poly *b) {
+    uint16_t ap[NTRU_N_PAD], bp[NTRU_N_PAD];
+    uint16_t ab[2 * NTRU_N_PAD];
+    int i;
+
+    memcpy(ap, a->coeffs, NTRU_N * sizeof(uint16_t));
+    memcpy(bp, b->coeffs, NTRU_N * sizeof(uint16_t));
+    memset(ap + NTRU_N, 0, (NTRU_N_PAD - NTRU_N) * sizeof(uint16_t));
+    memset(bp + NTRU_N, 0, (NTRU_N_PAD - NTRU_N) * sizeof(uint16_t));
+    memset(ab, 0, sizeof(ab));
+
+    toom_cook_4way(ap, bp, ab);
+
+    for (i = 0; i < NTRU_N; i++) {
+        c[i] = ab[i] + ab[i + NTRU_N];
+    }
+}
+
+void PQCLEAN_NTRUHPS2048677_AVX2_poly_Rq_mul(poly *r, const poly *a, const poly *b) {
+    int i;
+
+    poly_mul_cyclic(r->coeffs, a, b);
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = MODQ(r->coeffs[i]);
+    }
+}
+
+void PQCLEAN_NTRUHPS2048677_AVX2_poly_S3_mul(poly *r, const poly *a, const poly *b) {
+    /* NOTE: Assumes inputs are in {0,1,2}^N, so every coefficient of the  */
+    /*       product is at most 4N < 2^13 before the reduction mod 3       */
+    int i;
+
+    poly_mul_cyclic(r->coeffs, a, b);
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] &= (1 << 13) - 1;
+    }
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = PQCLEAN_NTRUHPS2048677_AVX2_mod3(r->coeffs[i] + 2 * r->coeffs[NTRU_N - 1]);
+    }
+}
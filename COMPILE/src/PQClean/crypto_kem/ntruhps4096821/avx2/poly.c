@@ -0,0 +1,299 @@
+#include "poly.h"
+#include "fips202.h"
+
+uint16_t PQCLEAN_NTRUHPS4096821_AVX2_mod3(uint16_t a) {
+    uint16_t r;
+    int16_t t, c;
+
+    r = (a >> 8) + (a & 0xff); // r mod 255 == a mod 255
+    r = (r >> 4) + (r & 0xf); // r' mod 15 == r mod 15
+    r = (r >> 2) + (r & 0x3); // r' mod 3 == r mod 3
+    r = (r >> 2) + (r & 0x3); // r' mod 3 == r mod 3
+
+    t = r - 3;
+    c = t >> 15;
+
+    return (c & r) ^ (~c & t);
+}
+
+/* Map {0, 1, 2} -> {0,1,q-1} in place */
+void PQCLEAN_NTRUHPS4096821_AVX2_poly_Z3_to_Zq(poly *r) {
+    int i;
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = r->coeffs[i] | ((-(r->coeffs[i] >> 1)) & (NTRU_Q - 1));
+    }
+}
+
+/* Map {0, 1, q-1} -> {0,1,2} in place */
+void PQCLEAN_NTRUHPS4096821_AVX2_poly_trinary_Zq_to_Z3(poly *r) {
+    int i;
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = 3 & (r->coeffs[i] ^ (r->coeffs[i] >> (NTRU_LOGQ - 1)));
+    }
+}
+
+void PQCLEAN_NTRUHPS4096821_AVX2_poly_Sq_mul(poly *r, const poly *a, const poly *b) {
+    int i;
+    PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul(r, a, b);
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = MODQ(r->coeffs[i] - r->coeffs[NTRU_N - 1]);
+    }
+}
+
+void PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul_x_minus_1(poly *r, const poly *a) {
+    int i;
+    uint16_t last_coeff = a->coeffs[NTRU_N - 1];
+
+    for (i = NTRU_N - 1; i > 0; i--) {
+        r->coeffs[i] = MODQ(a->coeffs[i - 1] + (NTRU_Q - a->coeffs[i]));
+    }
+    r->coeffs[0] = MODQ(last_coeff + (NTRU_Q - a->coeffs[0]));
+}
+
+void PQCLEAN_NTRUHPS4096821_AVX2_poly_lift(poly *r, const poly *a) {
+    int i;
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = a->coeffs[i];
+    }
+    PQCLEAN_NTRUHPS4096821_AVX2_poly_Z3_to_Zq(r);
+}
+
+void PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_to_S3(poly *r, const poly *a) {
+    /* NOTE: Assumes input is in [0,Q-1]^N */
+    /*       Produces output in {0,1,2}^N */
+    int i;
+
+    /* Center coeffs around 3Q: [0, Q-1] -> [3Q - Q/2, 3Q + Q/2) */
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = ((a->coeffs[i] >> (NTRU_LOGQ - 1)) ^ 3) << NTRU_LOGQ;
+        r->coeffs[i] += a->coeffs[i];
+    }
+    /* Reduce mod (3, Phi) */
+    r->coeffs[NTRU_N - 1] = PQCLEAN_NTRUHPS4096821_AVX2_mod3(r->coeffs[NTRU_N - 1]);
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = PQCLEAN_NTRUHPS4096821_AVX2_mod3(r->coeffs[i] + 2 * r->coeffs[NTRU_N - 1]);
+    }
+}
+
+/* Binary and trinary polynomials are bit-sliced into 64-bit words for the */
+/* inversions below. A trinary polynomial uses two bit-planes: the first   */
+/* has the coefficients equal to 1 set, the second those equal to 2.       */
+#define NTRU_N_WORDS ((NTRU_N + 63) / 64)
+
+typedef struct {
+    uint64_t w[NTRU_N_WORDS];
+} poly_bits;
+
+static int16_t both_negative_mask(int16_t x, int16_t y) {
+    return (x & y) >> 15;
+}
+
+static void bits_cswap(poly_bits *a, poly_bits *b, uint64_t mask) {
+    int i;
+    uint64_t t;
+    for (i = 0; i < NTRU_N_WORDS; i++) {
+        t = (a->w[i] ^ b->w[i]) & mask;
+        a->w[i] ^= t;
+        b->w[i] ^= t;
+    }
+}
+
+/* a := x*a, dropping the coefficient of x^N */
+static void bits_mulx(poly_bits *a) {
+    int i;
+    for (i = NTRU_N_WORDS - 1; i > 0; i--) {
+        a->w[i] = (a->w[i] << 1) | (a->w[i - 1] >> 63);
+    }
+    a->w[0] <<= 1;
+    a->w[NTRU_N_WORDS - 1] &= ~(uint64_t)0 >> (64 * NTRU_N_WORDS - NTRU_N);
+}
+
+/* a := a/x, dropping the constant coefficient */
+static void bits_divx(poly_bits *a) {
+    int i;
+    for (i = 0; i < NTRU_N_WORDS - 1; i++) {
+        a->w[i] = (a->w[i] >> 1) | (a->w[i + 1] << 63);
+    }
+    a->w[NTRU_N_WORDS - 1] >>= 1;
+}
+
+/* (c1, c2) := (a1, a2) + (b1, b2) over GF(3), bit-sliced */
+static void bits_add3(poly_bits *c1, poly_bits *c2,
+                      const poly_bits *a1, const poly_bits *a2,
+                      const poly_bits *b1, const poly_bits *b2) {
+    int i;
+    uint64_t t, x1, x2;
+    for (i = 0; i < NTRU_N_WORDS; i++) {
+        t = (a1->w[i] | b2->w[i]) ^ (a2->w[i] | b1->w[i]);
+        x1 = (a2->w[i] | b2->w[i]) ^ t;
+        x2 = (a1->w[i] | b1->w[i]) ^ t;
+        c1->w[i] = x1;
+        c2->w[i] = x2;
+    }
+}
+
+/* (c1, c2) := s * (a1, a2) over GF(3) for a scalar s in {0,1,2} */
+static void bits_scale3(poly_bits *c1, poly_bits *c2,
+                        const poly_bits *a1, const poly_bits *a2, uint16_t s) {
+    int i;
+    uint64_t m1 = -(uint64_t)(s & 1);
+    uint64_t m2 = -(uint64_t)(s >> 1);
+    for (i = 0; i < NTRU_N_WORDS; i++) {
+        c1->w[i] = (a1->w[i] & m1) | (a2->w[i] & m2);
+        c2->w[i] = (a2->w[i] & m1) | (a1->w[i] & m2);
+    }
+}
+
+static void poly_R2_inv(poly *r, const poly *a) {
+    /* Constant-time divstep inversion (Bernstein--Yang) on bit-sliced     */
+    /* polynomials. f starts as Phi_N and g as the reversal of a mod Phi_N */
+    int i, j;
+    int16_t delta = 1;
+    int16_t swap;
+    uint64_t sign;
+    poly_bits f, g, v, w;
+
+    for (i = 0; i < NTRU_N_WORDS; i++) {
+        f.w[i] = 0;
+        g.w[i] = 0;
+        v.w[i] = 0;
+        w.w[i] = 0;
+    }
+    w.w[0] = 1;
+
+    for (i = 0; i < NTRU_N; i++) {
+        f.w[i / 64] |= (uint64_t)1 << (i % 64);
+    }
+    for (i = 0; i < NTRU_N - 1; i++) {
+        j = NTRU_N - 2 - i;
+        g.w[j / 64] |= (uint64_t)((a->coeffs[i] ^ a->coeffs[NTRU_N - 1]) & 1) << (j % 64);
+    }
+
+    for (j = 0; j < 2 * (NTRU_N - 1) - 1; j++) {
+        bits_mulx(&v);
+
+        sign = g.w[0] & f.w[0] & 1;
+        swap = both_negative_mask((int16_t) - delta, (int16_t) - (int16_t)(g.w[0] & 1));
+        delta ^= swap & (delta ^ -delta);
+        delta += 1;
+
+        bits_cswap(&f, &g, (uint64_t)(int64_t)swap);
+        bits_cswap(&v, &w, (uint64_t)(int64_t)swap);
+
+        for (i = 0; i < NTRU_N_WORDS; i++) {
+            g.w[i] ^= f.w[i] & -sign;
+            w.w[i] ^= v.w[i] & -sign;
+        }
+        bits_divx(&g);
+    }
+
+    for (i = 0; i < NTRU_N - 1; i++) {
+        j = NTRU_N - 2 - i;
+        r->coeffs[i] = (uint16_t)((v.w[j / 64] >> (j % 64)) & 1);
+    }
+    r->coeffs[NTRU_N - 1] = 0;
+}
+
+static void poly_R2_inv_to_Rq_inv(poly *r, const poly *ai, const poly *a) {
+
+    int i;
+    poly b, c;
+    poly s;
+
+    // for 0..4
+    //    ai = ai * (2 - a*ai)  mod q
+    for (i = 0; i < NTRU_N; i++) {
+        b.coeffs[i] = MODQ(NTRU_Q - a->coeffs[i]); // b = -a
+    }
+
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = ai->coeffs[i];
+    }
+
+    PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul(&c, r, &b);
+    c.coeffs[0] += 2; // c = 2 - a*ai
+    PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul(&s, &c, r); // s = ai*c
+
+    PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul(&c, &s, &b);
+    c.coeffs[0] += 2; // c = 2 - a*s
+    PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul(r, &c, &s); // r = s*c
+
+    PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul(&c, r, &b);
+    c.coeffs[0] += 2; // c = 2 - a*r
+    PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul(&s, &c, r); // s = r*c
+
+    PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul(&c, &s, &b);
+    c.coeffs[0] += 2; // c = 2 - a*s
+    PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_mul(r, &c, &s); // r = s*c
+}
+
+void PQCLEAN_NTRUHPS4096821_AVX2_poly_Rq_inv(poly *r, const poly *a) {
+    poly ai2;
+    poly_R2_inv(&ai2, a);
+    poly_R2_inv_to_Rq_inv(r, &ai2, a);
+}
+
+void PQCLEAN_NTRUHPS4096821_AVX2_poly_S3_inv(poly *r, const poly *a) {
+    /* Constant-time divstep inversion (Bernstein--Yang) on bit-sliced     */
+    /* trinary polynomials, see poly_R2_inv                                */
+    int i, j;
+    int16_t delta = 1;
+    int16_t swap;
+    uint16_t f0, g0, sign, c;
+    poly_bits f1, f2, g1, g2, v1, v2, w1, w2, t1, t2;
+
+    for (i = 0; i < NTRU_N_WORDS; i++) {
+        f1.w[i] = 0;
+        f2.w[i] = 0;
+        g1.w[i] = 0;
+        g2.w[i] = 0;
+        v1.w[i] = 0;
+        v2.w[i] = 0;
+        w1.w[i] = 0;
+        w2.w[i] = 0;
+    }
+    w1.w[0] = 1;
+
+    for (i = 0; i < NTRU_N; i++) {
+        f1.w[i / 64] |= (uint64_t)1 << (i % 64);
+    }
+    for (i = 0; i < NTRU_N - 1; i++) {
+        j = NTRU_N - 2 - i;
+        c = PQCLEAN_NTRUHPS4096821_AVX2_mod3((a->coeffs[i] & 3) + 2 * (a->coeffs[NTRU_N - 1] & 3));
+        g1.w[j / 64] |= (uint64_t)(c & 1) << (j % 64);
+        g2.w[j / 64] |= (uint64_t)(c >> 1) << (j % 64);
+    }
+
+    for (j = 0; j < 2 * (NTRU_N - 1) - 1; j++) {
+        bits_mulx(&v1);
+        bits_mulx(&v2);
+
+        f0 = (uint16_t)((f1.w[0] & 1) | ((f2.w[0] & 1) << 1));
+        g0 = (uint16_t)((g1.w[0] & 1) | ((g2.w[0] & 1) << 1));
+        sign = PQCLEAN_NTRUHPS4096821_AVX2_mod3((uint16_t)(2 * g0 * f0));
+        swap = both_negative_mask((int16_t) - delta, (int16_t) - (int16_t)g0);
+        delta ^= swap & (delta ^ -delta);
+        delta += 1;
+
+        bits_cswap(&f1, &g1, (uint64_t)(int64_t)swap);
+        bits_cswap(&f2, &g2, (uint64_t)(int64_t)swap);
+        bits_cswap(&v1, &w1, (uint64_t)(int64_t)swap);
+        bits_cswap(&v2, &w2, (uint64_t)(int64_t)swap);
+
+        bits_scale3(&t1, &t2, &f1, &f2, sign);
+        bits_add3(&g1, &g2, &g1, &g2, &t1, &t2);
+        bits_scale3(&t1, &t2, &v1, &v2, sign);
+        bits_add3(&w1, &w2, &w1, &w2, &t1, &t2);
+
+        bits_divx(&g1);
+        bits_divx(&g2);
+    }
+
+    f0 = (uint16_t)((f1.w[0] & 1) | ((f2.w[0] & 1) << 1));
+    for (i = 0; i < NTRU_N - 1; i++) {
+        j = NTRU_N - 2 - i;
+        c = (uint16_t)(((v1.w[j / 64] >> (j % 64)) & 1) | (((v2.w[j / 64] >> (j % 64)) & 1) << 1));
+        r->coeffs[i] = PQCLEAN_NTRUHPS4096821_AVX2_mod3((uint16_t)(f0 * c));
+    }
+    r->coeffs[NTRU_N - 1] = 0;
+}
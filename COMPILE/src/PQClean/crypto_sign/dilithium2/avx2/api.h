@@ -8,6 +8,7 @@
 #define PQCLEAN_DILITHIUM2_AVX2_CRYPTO_PUBLICKEYBYTES 1184U
 #define PQCLEAN_DILITHIUM2_AVX2_CRYPTO_SECRETKEYBYTES 2800U
 #define PQCLEAN_DILITHIUM2_AVX2_CRYPTO_BYTES 2044U
+#define PQCLEAN_DILITHIUM2_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES 23632U
 
 #define PQCLEAN_DILITHIUM2_AVX2_CRYPTO_ALGNAME "Dilithium2"
 
@@ -29,6 +30,13 @@ int PQCLEAN_DILITHIUM2_AVX2_crypto_sign_signature(
     uint8_t *sig, size_t *siglen,
     const uint8_t *m, size_t mlen, const uint8_t *sk);
 
+int PQCLEAN_DILITHIUM2_AVX2_crypto_sign_expand_sk(
+    uint8_t *esk, const uint8_t *sk);
+
+int PQCLEAN_DILITHIUM2_AVX2_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *esk);
+
 int PQCLEAN_DILITHIUM2_AVX2_crypto_sign_verify(
     const uint8_t *sig, size_t siglen,
     const uint8_t *m, size_t mlen, const uint8_t *pk);
@@ -17,6 +17,14 @@ void PQCLEAN_DILITHIUM2_CLEAN_pack_sk(
     const polyvecl *s1,
     const polyveck *s2,
     const polyveck *t0);
+void PQCLEAN_DILITHIUM2_CLEAN_pack_expanded_sk(
+    uint8_t esk[PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES],
+    const uint8_t key[SEEDBYTES],
+    const uint8_t tr[CRHBYTES],
+    const polyvecl mat[K],
+    const polyvecl *s1hat,
+    const polyveck *s2hat,
+    const polyveck *t0hat);
 void PQCLEAN_DILITHIUM2_CLEAN_pack_sig(
     uint8_t sig[PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_SECRETKEYBYTES],
     const polyvecl *z, const polyveck *h, const poly *c);
@@ -33,6 +41,14 @@ void PQCLEAN_DILITHIUM2_CLEAN_unpack_sk(
     polyveck *s2,
     polyveck *t0,
     const uint8_t *sk);
+void PQCLEAN_DILITHIUM2_CLEAN_unpack_expanded_sk(
+    uint8_t key[SEEDBYTES],
+    uint8_t tr[CRHBYTES],
+    polyvecl mat[K],
+    polyvecl *s1hat,
+    polyveck *s2hat,
+    polyveck *t0hat,
+    const uint8_t esk[PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES]);
 int PQCLEAN_DILITHIUM2_CLEAN_unpack_sig(
     polyvecl *z,
     polyveck *h,
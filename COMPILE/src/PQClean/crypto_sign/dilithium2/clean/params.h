@@ -25,5 +25,6 @@
 #define POLETA_SIZE_PACKED ((N*SETABITS)/8)
 #define POLZ_SIZE_PACKED ((N*(QBITS - 3))/8)
 #define POLW1_SIZE_PACKED ((N*4)/8)
+#define POLY_SIZE_EXPANDED (N*4)
 
 #endif
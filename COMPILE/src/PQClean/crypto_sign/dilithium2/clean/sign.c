@@ -150,39 +150,70 @@ int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
 }
 
 /*************************************************
-* Name:        PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature
+* Name:        expand_sk
 *
-* Description: Compute signed message.
+* Description: Unpacks the secret key, expands the matrix A and transforms
+*              s1, s2 and t0 to NTT domain.
 *
-* Arguments:   - uint8_t *sig:  pointer to output signature (PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_BYTES
-*                               of len)
-*              - size_t *smlen: pointer to output length of signed message
-*                               (should be PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_BYTES)
-*              - uint8_t *m:    pointer to message to be signed
-*              - size_t mlen:   length of message
-*              - uint8_t *sk:   pointer to bit-packed secret key
+* Arguments:   - uint8_t key[]: output byte array for key
+*              - uint8_t tr[]: output byte array for tr
+*              - polyvecl mat[]: output matrix A
+*              - polyvecl *s1hat: pointer to output vector NTT(s1)
+*              - polyveck *s2hat: pointer to output vector NTT(s2)
+*              - polyveck *t0hat: pointer to output vector NTT(t0)
+*              - const uint8_t *sk: pointer to bit-packed secret key
+**************************************************/
+static void expand_sk(uint8_t key[SEEDBYTES], uint8_t tr[CRHBYTES],
+                      polyvecl mat[K], polyvecl *s1hat,
+                      polyveck *s2hat, polyveck *t0hat,
+                      const uint8_t *sk) {
+    uint8_t rho[SEEDBYTES];
+
+    PQCLEAN_DILITHIUM2_CLEAN_unpack_sk(rho, key, tr, s1hat, s2hat, t0hat, sk);
+
+    /* Expand matrix and transform vectors */
+    PQCLEAN_DILITHIUM2_CLEAN_expand_mat(mat, rho);
+    PQCLEAN_DILITHIUM2_CLEAN_polyvecl_ntt(s1hat);
+    PQCLEAN_DILITHIUM2_CLEAN_polyveck_ntt(s2hat);
+    PQCLEAN_DILITHIUM2_CLEAN_polyveck_ntt(t0hat);
+}
+
+/*************************************************
+* Name:        sign_expanded
+*
+* Description: Computes the signature from the expanded secret key.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature
+*              - size_t *siglen: pointer to output length of signature
+*              - const uint8_t *msg: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - const uint8_t key[]: byte array containing key
+*              - const uint8_t tr[]: byte array containing tr
+*              - const polyvecl mat[]: expanded matrix A
+*              - const polyvecl *s1: pointer to vector NTT(s1)
+*              - const polyveck *s2: pointer to vector NTT(s2)
+*              - const polyveck *t0: pointer to vector NTT(t0)
 *
 * Returns 0 (success)
 **************************************************/
-int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature(
+static int sign_expanded(
     uint8_t *sig, size_t *siglen,
     const uint8_t *msg, size_t mlen,
-    const uint8_t *sk) {
-    uint8_t seedbuf[2 * SEEDBYTES + 3 * CRHBYTES];
-    uint8_t *rho, *tr, *key, *mu, *rhoprime;
+    const uint8_t key[SEEDBYTES], const uint8_t tr[CRHBYTES],
+    const polyvecl mat[K], const polyvecl *s1,
+    const polyveck *s2, const polyveck *t0) {
+    uint8_t seedbuf[SEEDBYTES + 2 * CRHBYTES];
+    uint8_t *mu, *rhoprime;
     uint32_t n;
     uint16_t nonce = 0;
     poly c, chat;
-    polyvecl mat[K], s1, y, yhat, z;
-    polyveck t0, s2, w, w1, w0;
+    polyvecl y, yhat, z;
+    polyveck w, w1, w0;
     polyveck h, cs2, ct0;
 
-    rho = seedbuf;
-    tr = rho + SEEDBYTES;
-    key = tr + CRHBYTES;
-    mu = key + SEEDBYTES;
+    memcpy(seedbuf, key, SEEDBYTES);
+    mu = seedbuf + SEEDBYTES;
     rhoprime = mu + CRHBYTES;
-    PQCLEAN_DILITHIUM2_CLEAN_unpack_sk(rho, key, tr, &s1, &s2, &t0, sk);
 
     // use incremental hash API instead of copying around buffers
     /* Compute CRH(tr, msg) */
@@ -193,13 +224,7 @@ int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature(
     shake256_inc_finalize(&state);
     shake256_inc_squeeze(mu, CRHBYTES, &state);
 
-    crh(rhoprime, key, SEEDBYTES + CRHBYTES);
-
-    /* Expand matrix and transform vectors */
-    PQCLEAN_DILITHIUM2_CLEAN_expand_mat(mat, rho);
-    PQCLEAN_DILITHIUM2_CLEAN_polyvecl_ntt(&s1);
-    PQCLEAN_DILITHIUM2_CLEAN_polyveck_ntt(&s2);
-    PQCLEAN_DILITHIUM2_CLEAN_polyveck_ntt(&t0);
+    crh(rhoprime, seedbuf, SEEDBYTES + CRHBYTES);
 
 rej:
     /* Sample intermediate vector y */
@@ -226,7 +251,7 @@ rej:
     /* Check that subtracting cs2 does not change high bits of w and low bits
      * do not reveal secret information */
     for (size_t i = 0; i < K; ++i) {
-        PQCLEAN_DILITHIUM2_CLEAN_poly_pointwise_invmontgomery(&cs2.vec[i], &chat, &s2.vec[i]);
+        PQCLEAN_DILITHIUM2_CLEAN_poly_pointwise_invmontgomery(&cs2.vec[i], &chat, &s2->vec[i]);
         PQCLEAN_DILITHIUM2_CLEAN_poly_invntt_montgomery(&cs2.vec[i]);
     }
     PQCLEAN_DILITHIUM2_CLEAN_polyveck_sub(&w0, &w0, &cs2);
@@ -237,7 +262,7 @@ rej:
 
     /* Compute z, reject if it reveals secret */
     for (size_t i = 0; i < L; ++i) {
-        PQCLEAN_DILITHIUM2_CLEAN_poly_pointwise_invmontgomery(&z.vec[i], &chat, &s1.vec[i]);
+        PQCLEAN_DILITHIUM2_CLEAN_poly_pointwise_invmontgomery(&z.vec[i], &chat, &s1->vec[i]);
         PQCLEAN_DILITHIUM2_CLEAN_poly_invntt_montgomery(&z.vec[i]);
     }
     PQCLEAN_DILITHIUM2_CLEAN_polyvecl_add(&z, &z, &y);
@@ -248,7 +273,7 @@ rej:
 
     /* Compute hints for w1 */
     for (size_t i = 0; i < K; ++i) {
-        PQCLEAN_DILITHIUM2_CLEAN_poly_pointwise_invmontgomery(&ct0.vec[i], &chat, &t0.vec[i]);
+        PQCLEAN_DILITHIUM2_CLEAN_poly_pointwise_invmontgomery(&ct0.vec[i], &chat, &t0->vec[i]);
         PQCLEAN_DILITHIUM2_CLEAN_poly_invntt_montgomery(&ct0.vec[i]);
     }
 
@@ -270,6 +295,88 @@ rej:
     return 0;
 }
 
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature
+*
+* Description: Computes signature.
+*
+* Arguments:   - uint8_t *sig:  pointer to output signature (PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_BYTES
+*                               of len)
+*              - size_t *siglen: pointer to output length of signature
+*                               (should be PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_BYTES)
+*              - uint8_t *msg:  pointer to message to be signed
+*              - size_t mlen:   length of message
+*              - uint8_t *sk:   pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *msg, size_t mlen,
+    const uint8_t *sk) {
+    uint8_t key[SEEDBYTES], tr[CRHBYTES];
+    polyvecl mat[K], s1;
+    polyveck s2, t0;
+
+    expand_sk(key, tr, mat, &s1, &s2, &t0, sk);
+    return sign_expanded(sig, siglen, msg, mlen, key, tr, mat, &s1, &s2, &t0);
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_expand_sk
+*
+* Description: Expands the secret key for repeated signing with
+*              PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature_expanded. The expanded key holds
+*              the matrix A and the vectors s1, s2 and t0 in NTT domain, so
+*              that ExpandA and the transforms are not repeated for every
+*              signature. It is only valid on the platform it was computed
+*              on and has to be protected like the secret key.
+*
+* Arguments:   - uint8_t *esk: pointer to output expanded secret key
+*                              (PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES of len)
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk) {
+    uint8_t key[SEEDBYTES], tr[CRHBYTES];
+    polyvecl mat[K], s1;
+    polyveck s2, t0;
+
+    expand_sk(key, tr, mat, &s1, &s2, &t0, sk);
+    PQCLEAN_DILITHIUM2_CLEAN_pack_expanded_sk(esk, key, tr, mat, &s1, &s2, &t0);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature_expanded
+*
+* Description: Computes signature with an expanded secret key. The output
+*              is identical to PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature with the
+*              secret key esk was expanded from.
+*
+* Arguments:   - uint8_t *sig:  pointer to output signature (PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_BYTES
+*                               of len)
+*              - size_t *siglen: pointer to output length of signature
+*                               (should be PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_BYTES)
+*              - uint8_t *msg:  pointer to message to be signed
+*              - size_t mlen:   length of message
+*              - uint8_t *esk:  pointer to expanded secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *msg, size_t mlen,
+    const uint8_t *esk) {
+    uint8_t key[SEEDBYTES], tr[CRHBYTES];
+    polyvecl mat[K], s1;
+    polyveck s2, t0;
+
+    PQCLEAN_DILITHIUM2_CLEAN_unpack_expanded_sk(key, tr, mat, &s1, &s2, &t0, esk);
+    return sign_expanded(sig, siglen, msg, mlen, key, tr, mat, &s1, &s2, &t0);
+}
+
 /*************************************************
 * Name:        PQCLEAN_DILITHIUM2_CLEAN_crypto_sign
 *
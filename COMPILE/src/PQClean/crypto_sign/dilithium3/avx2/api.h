@@ -8,6 +8,7 @@
 #define PQCLEAN_DILITHIUM3_AVX2_CRYPTO_PUBLICKEYBYTES 1472U
 #define PQCLEAN_DILITHIUM3_AVX2_CRYPTO_SECRETKEYBYTES 3504U
 #define PQCLEAN_DILITHIUM3_AVX2_CRYPTO_BYTES 2701U
+#define PQCLEAN_DILITHIUM3_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES 34896U
 
 #define PQCLEAN_DILITHIUM3_AVX2_CRYPTO_ALGNAME "Dilithium3"
 
@@ -29,6 +30,13 @@ int PQCLEAN_DILITHIUM3_AVX2_crypto_sign_signature(
     uint8_t *sig, size_t *siglen,
     const uint8_t *m, size_t mlen, const uint8_t *sk);
 
+int PQCLEAN_DILITHIUM3_AVX2_crypto_sign_expand_sk(
+    uint8_t *esk, const uint8_t *sk);
+
+int PQCLEAN_DILITHIUM3_AVX2_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *esk);
+
 int PQCLEAN_DILITHIUM3_AVX2_crypto_sign_verify(
     const uint8_t *sig, size_t siglen,
     const uint8_t *m, size_t mlen, const uint8_t *pk);
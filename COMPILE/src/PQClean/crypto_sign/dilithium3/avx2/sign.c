@@ -1,5 +1,9 @@
+#include <limits.h>
 #include <stdint.h>
 #include <string.h>
+#if DILITHIUM_NTHREADS > 1
+#include <pthread.h>
+#endif
 
 #include "fips202.h"
 #include "packing.h"
@@ -10,6 +14,27 @@
 #include "sign.h"
 #include "symmetric.h"
 
+typedef struct {
+    poly buf[4];
+    unsigned int avail;  // polynomials in buf not handed out yet
+    uint16_t nonce;      // nonce of the next polynomial
+} ystream;
+
+typedef struct {
+    uint8_t *sig;
+    const uint8_t *mu;
+    const uint8_t *rhoprime;
+    const polyvecl *mat;
+    const polyvecl *s1;
+    const polyveck *s2;
+    const polyveck *t0;
+    unsigned int next;      // next attempt to be claimed
+    unsigned int accepted;  // lowest accepted attempt so far
+#if DILITHIUM_NTHREADS > 1
+    pthread_mutex_t lock;
+#endif
+} sign_job;
+
 /*************************************************
 * Name:        expand_mat
 *
@@ -171,69 +196,94 @@ int PQCLEAN_DILITHIUM3_AVX2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
 }
 
 /*************************************************
-* Name:        PQCLEAN_DILITHIUM3_AVX2_crypto_sign_signature
+* Name:        expand_sk
 *
-* Description: Compute signed message.
-*
-* Arguments:   - uint8_t *sig:  pointer to output signature (PQCLEAN_DILITHIUM3_AVX2_CRYPTO_BYTES
-*                               of len)
-*              - size_t *siglen: pointer to output length of signed message
-*                               (should be PQCLEAN_DILITHIUM3_AVX2_CRYPTO_BYTES)
-*              - uint8_t *m:    pointer to message to be signed
-*              - size_t mlen:   length of message
-*              - uint8_t *sk:   pointer to bit-packed secret key
+* Description: Unpacks the secret key, expands the matrix A and transforms
+*              s1, s2 and t0 to NTT domain.
 *
-* Returns 0 (success)
+* Arguments:   - uint8_t key[]: output byte array for key
+*              - uint8_t tr[]: output byte array for tr
+*              - polyvecl mat[]: output matrix A
+*              - polyvecl *s1hat: pointer to output vector NTT(s1)
+*              - polyveck *s2hat: pointer to output vector NTT(s2)
+*              - polyveck *t0hat: pointer to output vector NTT(t0)
+*              - const uint8_t *sk: pointer to bit-packed secret key
 **************************************************/
-int PQCLEAN_DILITHIUM3_AVX2_crypto_sign_signature(
-    uint8_t *sig, size_t *siglen,
-    const uint8_t *m, size_t mlen,
-    const uint8_t *sk) {
-    uint32_t n;
-    uint8_t seedbuf[2 * SEEDBYTES + 3 * CRHBYTES];
-    uint8_t *rho, *tr, *key, *mu, *rhoprime;
-    uint16_t nonce = 0;
-    poly c, chat;
-    polyvecl mat[K], s1, y, yhat, z;
-    polyveck t0, s2, w, w1, w0;
-    polyveck h, cs2, ct0;
-
-    rho = seedbuf;
-    tr = rho + SEEDBYTES;
-    key = tr + CRHBYTES;
-    mu = key + SEEDBYTES;
-    rhoprime = mu + CRHBYTES;
-    PQCLEAN_DILITHIUM3_AVX2_unpack_sk(rho, key, tr, &s1, &s2, &t0, sk);
-
-
-    // use incremental hash API instead of copying around buffers
-    /* Compute CRH(tr, m) */
-    shake256incctx state;
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, tr, CRHBYTES);
-    shake256_inc_absorb(&state, m, mlen);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(mu, CRHBYTES, &state);
+static void expand_sk(uint8_t key[SEEDBYTES], uint8_t tr[CRHBYTES],
+                      polyvecl mat[K], polyvecl *s1hat,
+                      polyveck *s2hat, polyveck *t0hat,
+                      const uint8_t *sk) {
+    uint8_t rho[SEEDBYTES];
 
-    crh(rhoprime, key, SEEDBYTES + CRHBYTES);
+    PQCLEAN_DILITHIUM3_AVX2_unpack_sk(rho, key, tr, s1hat, s2hat, t0hat, sk);
 
     /* Expand matrix and transform vectors */
     PQCLEAN_DILITHIUM3_AVX2_expand_mat(mat, rho);
-    PQCLEAN_DILITHIUM3_AVX2_polyvecl_ntt(&s1);
-    PQCLEAN_DILITHIUM3_AVX2_polyveck_ntt(&s2);
-    PQCLEAN_DILITHIUM3_AVX2_polyveck_ntt(&t0);
+    PQCLEAN_DILITHIUM3_AVX2_polyvecl_ntt(s1hat);
+    PQCLEAN_DILITHIUM3_AVX2_polyveck_ntt(s2hat);
+    PQCLEAN_DILITHIUM3_AVX2_polyveck_ntt(t0hat);
+}
 
-rej:
-    /* Sample intermediate vector y */
-    PQCLEAN_DILITHIUM3_AVX2_poly_uniform_gamma1m1_4x(&y.vec[0], &y.vec[1], &y.vec[2], &y.vec[3],
-            rhoprime, nonce, nonce + 1, nonce + 2, nonce + 3);
-    nonce += 4;
+/*************************************************
+* Name:        sample_y
+*
+* Description: Samples the intermediate vector y of the attempt whose
+*              first nonce is nonce. The 4-way sampler runs over the nonces
+*              of consecutive attempts, so when attempts are run in order no
+*              lane is left idle and polynomials sampled ahead are kept in
+*              ys for the next attempt.
+*
+* Arguments:   - polyvecl *y: pointer to output vector y
+*              - ystream *ys: pointer to the sampler state
+*              - const uint8_t rhoprime[]: byte array containing rhoprime
+*              - uint16_t nonce: nonce of the first polynomial of y
+**************************************************/
+static void sample_y(polyvecl *y, ystream *ys,
+                     const uint8_t rhoprime[CRHBYTES], uint16_t nonce) {
+    if (ys->nonce != nonce) {
+        ys->avail = 0;
+        ys->nonce = nonce;
+    }
+    for (size_t i = 0; i < L; ++i) {
+        if (ys->avail == 0) {
+            PQCLEAN_DILITHIUM3_AVX2_poly_uniform_gamma1m1_4x(&ys->buf[0], &ys->buf[1],
+                    &ys->buf[2], &ys->buf[3], rhoprime, ys->nonce,
+                    (uint16_t)(ys->nonce + 1), (uint16_t)(ys->nonce + 2),
+                    (uint16_t)(ys->nonce + 3));
+            ys->avail = 4;
+        }
+        y->vec[i] = ys->buf[4 - ys->avail];
+        ys->avail--;
+        ys->nonce++;
+    }
+}
+
+/*************************************************
+* Name:        sign_attempt
+*
+* Description: One iteration of the rejection loop for a given y.
+*
+* Arguments:   - polyvecl *z: pointer to output vector z
+*              - polyveck *h: pointer to output hint vector h
+*              - poly *c: pointer to output challenge c
+*              - const polyvecl *y: pointer to intermediate vector y
+*              - const sign_job *job: pointer to the signing job
+*
+* Returns 0 if the attempt is accepted and -1 if it is rejected
+**************************************************/
+static int sign_attempt(polyvecl *z, polyveck *h, poly *c,
+                        const polyvecl *y, const sign_job *job) {
+    uint32_t n;
+    poly chat;
+    polyvecl yhat;
+    polyveck w, w1, w0;
+    polyveck cs2, ct0;
 
     /* Matrix-vector multiplication */
-    yhat = y;
+    yhat = *y;
     PQCLEAN_DILITHIUM3_AVX2_polyvecl_ntt(&yhat);
     for (size_t i = 0; i < K; ++i) {
-        PQCLEAN_DILITHIUM3_AVX2_polyvecl_pointwise_acc_invmontgomery(&w.vec[i], &mat[i], &yhat);
+        PQCLEAN_DILITHIUM3_AVX2_polyvecl_pointwise_acc_invmontgomery(&w.vec[i], &job->mat[i], &yhat);
         PQCLEAN_DILITHIUM3_AVX2_poly_reduce(&w.vec[i]);
         PQCLEAN_DILITHIUM3_AVX2_poly_invntt_montgomery(&w.vec[i]);
     }
@@ -241,57 +291,276 @@ rej:
     /* Decompose w and call the random oracle */
     PQCLEAN_DILITHIUM3_AVX2_polyveck_csubq(&w);
     PQCLEAN_DILITHIUM3_AVX2_polyveck_decompose(&w1, &w0, &w);
-    PQCLEAN_DILITHIUM3_AVX2_challenge(&c, mu, &w1);
-    chat = c;
+    PQCLEAN_DILITHIUM3_AVX2_challenge(c, job->mu, &w1);
+    chat = *c;
     PQCLEAN_DILITHIUM3_AVX2_poly_ntt(&chat);
 
     /* Check that subtracting cs2 does not change high bits of w and low bits
      * do not reveal secret information */
     for (size_t i = 0; i < K; ++i) {
-        PQCLEAN_DILITHIUM3_AVX2_poly_pointwise_invmontgomery(&cs2.vec[i], &chat, &s2.vec[i]);
+        PQCLEAN_DILITHIUM3_AVX2_poly_pointwise_invmontgomery(&cs2.vec[i], &chat, &job->s2->vec[i]);
         PQCLEAN_DILITHIUM3_AVX2_poly_invntt_montgomery(&cs2.vec[i]);
     }
     PQCLEAN_DILITHIUM3_AVX2_polyveck_sub(&w0, &w0, &cs2);
     PQCLEAN_DILITHIUM3_AVX2_polyveck_freeze(&w0);
     if (PQCLEAN_DILITHIUM3_AVX2_polyveck_chknorm(&w0, GAMMA2 - BETA)) {
-        goto rej;
+        return -1;
     }
 
     /* Compute z, reject if it reveals secret */
     for (size_t i = 0; i < L; ++i) {
-        PQCLEAN_DILITHIUM3_AVX2_poly_pointwise_invmontgomery(&z.vec[i], &chat, &s1.vec[i]);
-        PQCLEAN_DILITHIUM3_AVX2_poly_invntt_montgomery(&z.vec[i]);
+        PQCLEAN_DILITHIUM3_AVX2_poly_pointwise_invmontgomery(&z->vec[i], &chat, &job->s1->vec[i]);
+        PQCLEAN_DILITHIUM3_AVX2_poly_invntt_montgomery(&z->vec[i]);
     }
-    PQCLEAN_DILITHIUM3_AVX2_polyvecl_add(&z, &z, &y);
-    PQCLEAN_DILITHIUM3_AVX2_polyvecl_freeze(&z);
-    if (PQCLEAN_DILITHIUM3_AVX2_polyvecl_chknorm(&z, GAMMA1 - BETA)) {
-        goto rej;
+    PQCLEAN_DILITHIUM3_AVX2_polyvecl_add(z, z, y);
+    PQCLEAN_DILITHIUM3_AVX2_polyvecl_freeze(z);
+    if (PQCLEAN_DILITHIUM3_AVX2_polyvecl_chknorm(z, GAMMA1 - BETA)) {
+        return -1;
     }
 
     /* Compute hints for w1 */
     for (size_t i = 0; i < K; ++i) {
-        PQCLEAN_DILITHIUM3_AVX2_poly_pointwise_invmontgomery(&ct0.vec[i], &chat, &t0.vec[i]);
+        PQCLEAN_DILITHIUM3_AVX2_poly_pointwise_invmontgomery(&ct0.vec[i], &chat, &job->t0->vec[i]);
         PQCLEAN_DILITHIUM3_AVX2_poly_invntt_montgomery(&ct0.vec[i]);
     }
 
     PQCLEAN_DILITHIUM3_AVX2_polyveck_csubq(&ct0);
     if (PQCLEAN_DILITHIUM3_AVX2_polyveck_chknorm(&ct0, GAMMA2)) {
-        goto rej;
+        return -1;
     }
 
     PQCLEAN_DILITHIUM3_AVX2_polyveck_add(&w0, &w0, &ct0);
     PQCLEAN_DILITHIUM3_AVX2_polyveck_csubq(&w0);
-    n = PQCLEAN_DILITHIUM3_AVX2_polyveck_make_hint(&h, &w0, &w1);
+    n = PQCLEAN_DILITHIUM3_AVX2_polyveck_make_hint(h, &w0, &w1);
     if (n > OMEGA) {
-        goto rej;
+        return -1;
+    }
+    return 0;
+}
+
+static void job_lock(sign_job *job) {
+#if DILITHIUM_NTHREADS > 1
+    pthread_mutex_lock(&job->lock);
+#else
+    (void)job;
+#endif
+}
+
+static void job_unlock(sign_job *job) {
+#if DILITHIUM_NTHREADS > 1
+    pthread_mutex_unlock(&job->lock);
+#else
+    (void)job;
+#endif
+}
+
+/*************************************************
+* Name:        sign_worker
+*
+* Description: Claims attempts of the rejection loop in increasing order
+*              and runs them until an attempt is accepted. Attempts above
+*              the lowest accepted one are skipped, and every attempt below
+*              it has been claimed before it, so the signature that is
+*              written is the one of the sequential loop.
+*
+* Arguments:   - void *arg: pointer to the signing job
+**************************************************/
+static void *sign_worker(void *arg) {
+    sign_job *job = arg;
+    unsigned int attempt, accepted;
+    ystream ys;
+    polyvecl y, z;
+    polyveck h;
+    poly c;
+
+    ys.avail = 0;
+    ys.nonce = 0;
+    for (;;) {
+        job_lock(job);
+        attempt = job->next++;
+        accepted = job->accepted;
+        job_unlock(job);
+        if (attempt > accepted) {
+            return NULL;
+        }
+
+        /* Sample intermediate vector y */
+        sample_y(&y, &ys, job->rhoprime, (uint16_t)(attempt * L));
+
+        if (sign_attempt(&z, &h, &c, &y, job) == 0) {
+            job_lock(job);
+            if (attempt < job->accepted) {
+                job->accepted = attempt;
+                PQCLEAN_DILITHIUM3_AVX2_pack_sig(job->sig, &z, &h, &c);
+            }
+            job_unlock(job);
+            return NULL;
+        }
+    }
+}
+
+/*************************************************
+* Name:        sign_expanded
+*
+* Description: Computes the signature from the expanded secret key. With
+*              DILITHIUM_NTHREADS > 1 the attempts of the rejection loop
+*              are spread over that many threads.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature
+*              - size_t *siglen: pointer to output length of signature
+*              - const uint8_t *msg: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - const uint8_t key[]: byte array containing key
+*              - const uint8_t tr[]: byte array containing tr
+*              - const polyvecl mat[]: expanded matrix A
+*              - const polyvecl *s1: pointer to vector NTT(s1)
+*              - const polyveck *s2: pointer to vector NTT(s2)
+*              - const polyveck *t0: pointer to vector NTT(t0)
+*
+* Returns 0 (success)
+**************************************************/
+static int sign_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *msg, size_t mlen,
+    const uint8_t key[SEEDBYTES], const uint8_t tr[CRHBYTES],
+    const polyvecl mat[K], const polyvecl *s1,
+    const polyveck *s2, const polyveck *t0) {
+    uint8_t seedbuf[SEEDBYTES + 2 * CRHBYTES];
+    uint8_t *mu, *rhoprime;
+    sign_job job;
+
+    memcpy(seedbuf, key, SEEDBYTES);
+    mu = seedbuf + SEEDBYTES;
+    rhoprime = mu + CRHBYTES;
+
+    // use incremental hash API instead of copying around buffers
+    /* Compute CRH(tr, msg) */
+    shake256incctx state;
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, tr, CRHBYTES);
+    shake256_inc_absorb(&state, msg, mlen);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(mu, CRHBYTES, &state);
+
+    crh(rhoprime, seedbuf, SEEDBYTES + CRHBYTES);
+
+    job.sig = sig;
+    job.mu = mu;
+    job.rhoprime = rhoprime;
+    job.mat = mat;
+    job.s1 = s1;
+    job.s2 = s2;
+    job.t0 = t0;
+    job.next = 0;
+    job.accepted = UINT_MAX;
+
+#if DILITHIUM_NTHREADS > 1
+    /* The caller runs as one of the workers; if a thread cannot be
+     * created, the remaining workers still find the signature. */
+    pthread_t threads[DILITHIUM_NTHREADS];
+    int started[DILITHIUM_NTHREADS];
+
+    pthread_mutex_init(&job.lock, NULL);
+    for (size_t t = 1; t < DILITHIUM_NTHREADS; ++t) {
+        started[t] = pthread_create(&threads[t], NULL, sign_worker, &job) == 0;
+    }
+    sign_worker(&job);
+    for (size_t t = 1; t < DILITHIUM_NTHREADS; ++t) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
     }
+    pthread_mutex_destroy(&job.lock);
+#else
+    sign_worker(&job);
+#endif
 
-    /* Write signature */
-    PQCLEAN_DILITHIUM3_AVX2_pack_sig(sig, &z, &h, &c);
     *siglen = PQCLEAN_DILITHIUM3_AVX2_CRYPTO_BYTES;
     return 0;
 }
 
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_AVX2_crypto_sign_signature
+*
+* Description: Computes signature.
+*
+* Arguments:   - uint8_t *sig:  pointer to output signature (PQCLEAN_DILITHIUM3_AVX2_CRYPTO_BYTES
+*                               of len)
+*              - size_t *siglen: pointer to output length of signature
+*                               (should be PQCLEAN_DILITHIUM3_AVX2_CRYPTO_BYTES)
+*              - uint8_t *msg:  pointer to message to be signed
+*              - size_t mlen:   length of message
+*              - uint8_t *sk:   pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3_AVX2_crypto_sign_signature(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *msg, size_t mlen,
+    const uint8_t *sk) {
+    uint8_t key[SEEDBYTES], tr[CRHBYTES];
+    polyvecl mat[K], s1;
+    polyveck s2, t0;
+
+    expand_sk(key, tr, mat, &s1, &s2, &t0, sk);
+    return sign_expanded(sig, siglen, msg, mlen, key, tr, mat, &s1, &s2, &t0);
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_AVX2_crypto_sign_expand_sk
+*
+* Description: Expands the secret key for repeated signing with
+*              PQCLEAN_DILITHIUM3_AVX2_crypto_sign_signature_expanded. The expanded key holds
+*              the matrix A and the vectors s1, s2 and t0 in NTT domain, so
+*              that ExpandA and the transforms are not repeated for every
+*              signature. It is only valid on the platform it was computed
+*              on and has to be protected like the secret key.
+*
+* Arguments:   - uint8_t *esk: pointer to output expanded secret key
+*                              (PQCLEAN_DILITHIUM3_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES of len)
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3_AVX2_crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk) {
+    uint8_t key[SEEDBYTES], tr[CRHBYTES];
+    polyvecl mat[K], s1;
+    polyveck s2, t0;
+
+    expand_sk(key, tr, mat, &s1, &s2, &t0, sk);
+    PQCLEAN_DILITHIUM3_AVX2_pack_expanded_sk(esk, key, tr, mat, &s1, &s2, &t0);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_AVX2_crypto_sign_signature_expanded
+*
+* Description: Computes signature with an expanded secret key. The output
+*              is identical to PQCLEAN_DILITHIUM3_AVX2_crypto_sign_signature with the
+*              secret key esk was expanded from.
+*
+* Arguments:   - uint8_t *sig:  pointer to output signature (PQCLEAN_DILITHIUM3_AVX2_CRYPTO_BYTES
+*                               of len)
+*              - size_t *siglen: pointer to output length of signature
+*                               (should be PQCLEAN_DILITHIUM3_AVX2_CRYPTO_BYTES)
+*              - uint8_t *msg:  pointer to message to be signed
+*              - size_t mlen:   length of message
+*              - uint8_t *esk:  pointer to expanded secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3_AVX2_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *msg, size_t mlen,
+    const uint8_t *esk) {
+    uint8_t key[SEEDBYTES], tr[CRHBYTES];
+    polyvecl mat[K], s1;
+    polyveck s2, t0;
+
+    PQCLEAN_DILITHIUM3_AVX2_unpack_expanded_sk(key, tr, mat, &s1, &s2, &t0, esk);
+    return sign_expanded(sig, siglen, msg, mlen, key, tr, mat, &s1, &s2, &t0);
+}
+
 /*************************************************
 * Name:        PQCLEAN_DILITHIUM3_AVX2_crypto_sign
 *
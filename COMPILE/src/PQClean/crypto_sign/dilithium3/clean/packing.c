@@ -3,6 +3,8 @@
 #include "poly.h"
 #include "polyvec.h"
 
+#include <string.h>
+
 /*************************************************
 * Name:        PQCLEAN_DILITHIUM3_CLEAN_pack_pk
 *
@@ -151,6 +153,111 @@ void PQCLEAN_DILITHIUM3_CLEAN_unpack_sk(
     }
 }
 
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_pack_expanded_sk
+*
+* Description: Store the expanded secret key (key, tr, A, s1, s2, t0), with
+*              A, s1, s2 and t0 in NTT domain. Polynomials are copied in
+*              their in-memory representation, so the expanded key is only
+*              meant to be kept in memory by the signer and not to be
+*              stored or transmitted.
+*
+* Arguments:   - uint8_t esk[]: output byte array
+*              - const uint8_t key[]: byte array containing key
+*              - const uint8_t tr[]: byte array containing tr
+*              - const polyvecl mat[]: expanded matrix A
+*              - const polyvecl *s1hat: pointer to vector NTT(s1)
+*              - const polyveck *s2hat: pointer to vector NTT(s2)
+*              - const polyveck *t0hat: pointer to vector NTT(t0)
+**************************************************/
+void PQCLEAN_DILITHIUM3_CLEAN_pack_expanded_sk(
+    uint8_t esk[PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES],
+    const uint8_t key[SEEDBYTES],
+    const uint8_t tr[CRHBYTES],
+    const polyvecl mat[K],
+    const polyvecl *s1hat,
+    const polyveck *s2hat,
+    const polyveck *t0hat) {
+    memcpy(esk, key, SEEDBYTES);
+    esk += SEEDBYTES;
+
+    memcpy(esk, tr, CRHBYTES);
+    esk += CRHBYTES;
+
+    for (size_t i = 0; i < K; ++i) {
+        for (size_t j = 0; j < L; ++j) {
+            memcpy(esk, mat[i].vec[j].coeffs, POLY_SIZE_EXPANDED);
+            esk += POLY_SIZE_EXPANDED;
+        }
+    }
+
+    for (size_t i = 0; i < L; ++i) {
+        memcpy(esk, s1hat->vec[i].coeffs, POLY_SIZE_EXPANDED);
+        esk += POLY_SIZE_EXPANDED;
+    }
+
+    for (size_t i = 0; i < K; ++i) {
+        memcpy(esk, s2hat->vec[i].coeffs, POLY_SIZE_EXPANDED);
+        esk += POLY_SIZE_EXPANDED;
+    }
+
+    for (size_t i = 0; i < K; ++i) {
+        memcpy(esk, t0hat->vec[i].coeffs, POLY_SIZE_EXPANDED);
+        esk += POLY_SIZE_EXPANDED;
+    }
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_unpack_expanded_sk
+*
+* Description: Load the expanded secret key written by
+*              PQCLEAN_DILITHIUM3_CLEAN_pack_expanded_sk.
+*
+* Arguments:   - uint8_t key[]: output byte array for key
+*              - uint8_t tr[]: output byte array for tr
+*              - polyvecl mat[]: output matrix A
+*              - polyvecl *s1hat: pointer to output vector NTT(s1)
+*              - polyveck *s2hat: pointer to output vector NTT(s2)
+*              - polyveck *t0hat: pointer to output vector NTT(t0)
+*              - const uint8_t esk[]: byte array containing expanded sk
+**************************************************/
+void PQCLEAN_DILITHIUM3_CLEAN_unpack_expanded_sk(
+    uint8_t key[SEEDBYTES],
+    uint8_t tr[CRHBYTES],
+    polyvecl mat[K],
+    polyvecl *s1hat,
+    polyveck *s2hat,
+    polyveck *t0hat,
+    const uint8_t esk[PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES]) {
+    memcpy(key, esk, SEEDBYTES);
+    esk += SEEDBYTES;
+
+    memcpy(tr, esk, CRHBYTES);
+    esk += CRHBYTES;
+
+    for (size_t i = 0; i < K; ++i) {
+        for (size_t j = 0; j < L; ++j) {
+            memcpy(mat[i].vec[j].coeffs, esk, POLY_SIZE_EXPANDED);
+            esk += POLY_SIZE_EXPANDED;
+        }
+    }
+
+    for (size_t i = 0; i < L; ++i) {
+        memcpy(s1hat->vec[i].coeffs, esk, POLY_SIZE_EXPANDED);
+        esk += POLY_SIZE_EXPANDED;
+    }
+
+    for (size_t i = 0; i < K; ++i) {
+        memcpy(s2hat->vec[i].coeffs, esk, POLY_SIZE_EXPANDED);
+        esk += POLY_SIZE_EXPANDED;
+    }
+
+    for (size_t i = 0; i < K; ++i) {
+        memcpy(t0hat->vec[i].coeffs, esk, POLY_SIZE_EXPANDED);
+        esk += POLY_SIZE_EXPANDED;
+    }
+}
+
 /*************************************************
 * Name:        PQCLEAN_DILITHIUM3_CLEAN_pack_sig
 *
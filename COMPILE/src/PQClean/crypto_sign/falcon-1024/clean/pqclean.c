@@ -3,6 +3,7 @@
  */
 
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "api.h"
@@ -37,8 +38,27 @@
  *      header byte:       0010nnnn
  *      value              (12 bits by element)
  *      (signature length is 1+len(value), not counting the nonce)
+ *
+ *   expanded private key (see crypto_sign_expand_sk() in api.h):
+ *      magic              8 bytes "FALCONEK"
+ *      version            1 byte (currently 1)
+ *      logn               1 byte
+ *      fpr format         1 byte (1 = IEEE-754 binary64, native byte order)
+ *      reserved           1 byte (0)
+ *      header length      4 bytes, little-endian (64)
+ *      payload length     4 bytes, little-endian (8*(logn+5)*2^logn)
+ *      byte order mark    8 bytes: the fpr value 1.0 in native byte order
+ *      reserved           32 bytes (0)
+ *      payload            basis B0 in FFT representation followed by the
+ *                         ffLDL tree, as produced by expand_privkey()
+ *   The payload starts 64 bytes into the key, so a key file that is
+ *   mmap()ed to a page boundary is suitably aligned to be used in place.
  */
 
+#define EXPKEY_HEADERLEN   64
+#define EXPKEY_VERSION     1
+#define EXPKEY_FPR_BINARY64   1
+
 /* see api.h */
 int
 PQCLEAN_FALCON1024_CLEAN_crypto_sign_keypair(
@@ -108,39 +128,16 @@ PQCLEAN_FALCON1024_CLEAN_crypto_sign_keypair(
 }
 
 /*
- * Compute the signature. nonce[] receives the nonce and must have length
- * NONCELEN bytes. sigbuf[] receives the signature value (without nonce
- * or header byte), with *sigbuflen providing the maximum value length and
- * receiving the actual value length.
- *
- * If a signature could be computed but not encoded because it would
- * exceed the output buffer size, then a new signature is computed. If
- * the provided buffer size is too low, this could loop indefinitely, so
- * the caller must provide a size that can accommodate signatures with a
- * large enough probability.
+ * Decode the private key into f, g and F, and recompute G. The tmp[]
+ * buffer must have room for 72*2^logn bytes.
  *
  * Return value: 0 on success, -1 on error.
  */
 static int
-do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
-        const uint8_t *m, size_t mlen, const uint8_t *sk) {
-    union {
-        uint8_t b[72 * 1024];
-        uint64_t dummy_u64;
-        fpr dummy_fpr;
-    } tmp;
-    int8_t f[1024], g[1024], F[1024], G[1024];
-    union {
-        int16_t sig[1024];
-        uint16_t hm[1024];
-    } r;
-    unsigned char seed[48];
-    inner_shake256_context sc;
+decode_private(int8_t *f, int8_t *g, int8_t *F, int8_t *G,
+               const uint8_t *sk, uint8_t *tmp) {
     size_t u, v;
 
-    /*
-     * Decode the private key.
-     */
     if (sk[0] != 0x50 + 10) {
         return -1;
     }
@@ -169,9 +166,62 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
     if (u != PQCLEAN_FALCON1024_CLEAN_CRYPTO_SECRETKEYBYTES) {
         return -1;
     }
-    if (!PQCLEAN_FALCON1024_CLEAN_complete_private(G, f, g, F, 10, tmp.b)) {
+    if (!PQCLEAN_FALCON1024_CLEAN_complete_private(G, f, g, F, 10, tmp)) {
         return -1;
     }
+    return 0;
+}
+
+/*
+ * Write the header of an expanded private key (EXPKEY_HEADERLEN bytes).
+ */
+static void
+expanded_header(uint8_t *hdr) {
+    uint32_t plen;
+
+    plen = PQCLEAN_FALCON1024_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES - EXPKEY_HEADERLEN;
+    memset(hdr, 0, EXPKEY_HEADERLEN);
+    memcpy(hdr, "FALCONEK", 8);
+    hdr[8] = EXPKEY_VERSION;
+    hdr[9] = 10;
+    hdr[10] = EXPKEY_FPR_BINARY64;
+    hdr[12] = EXPKEY_HEADERLEN;
+    hdr[16] = (uint8_t)plen;
+    hdr[17] = (uint8_t)(plen >> 8);
+    hdr[18] = (uint8_t)(plen >> 16);
+    hdr[19] = (uint8_t)(plen >> 24);
+    memcpy(hdr + 24, &fpr_one, sizeof fpr_one);
+}
+
+/*
+ * Compute the signature, either from an expanded key (expanded_key is
+ * not NULL) or from the raw key (f, g, F, G). Both take the same values
+ * from randombytes(). nonce[] receives the nonce and must have length
+ * NONCELEN bytes. sigbuf[] receives the signature value (without nonce
+ * or header byte), with *sigbuflen providing the maximum value length and
+ * receiving the actual value length.
+ *
+ * If a signature could be computed but not encoded because it would
+ * exceed the output buffer size, then a new signature is computed. If
+ * the provided buffer size is too low, this could loop indefinitely, so
+ * the caller must provide a size that can accommodate signatures with a
+ * large enough probability.
+ *
+ * The tmp[] buffer must have room for 72*2^logn bytes with a raw key,
+ * and 48*2^logn bytes with an expanded key.
+ */
+static void
+sign_common(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
+            const uint8_t *m, size_t mlen, const fpr *expanded_key,
+            const int8_t *f, const int8_t *g,
+            const int8_t *F, const int8_t *G, uint8_t *tmp) {
+    union {
+        int16_t sig[1024];
+        uint16_t hm[1024];
+    } r;
+    unsigned char seed[48];
+    inner_shake256_context sc;
+    size_t v;
 
     /*
      * Create a random nonce (40 bytes).
@@ -185,7 +235,7 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
     inner_shake256_inject(&sc, nonce, NONCELEN);
     inner_shake256_inject(&sc, m, mlen);
     inner_shake256_flip(&sc);
-    PQCLEAN_FALCON1024_CLEAN_hash_to_point_ct(&sc, r.hm, 10, tmp.b);
+    PQCLEAN_FALCON1024_CLEAN_hash_to_point_ct(&sc, r.hm, 10, tmp);
 
     /*
      * Initialize a RNG.
@@ -200,15 +250,70 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
      * value is found that fits in the provided buffer.
      */
     for (;;) {
-        PQCLEAN_FALCON1024_CLEAN_sign_dyn(r.sig, &sc, f, g, F, G, r.hm, 10, tmp.b);
+        if (expanded_key != NULL) {
+            PQCLEAN_FALCON1024_CLEAN_sign_tree(r.sig, &sc, expanded_key, r.hm, 10, tmp);
+        } else {
+            PQCLEAN_FALCON1024_CLEAN_sign_dyn(r.sig, &sc, f, g, F, G, r.hm, 10, tmp);
+        }
         v = PQCLEAN_FALCON1024_CLEAN_comp_encode(sigbuf, *sigbuflen, r.sig, 10);
         if (v != 0) {
             *sigbuflen = v;
-            return 0;
+            return;
         }
     }
 }
 
+/*
+ * Compute the signature with the raw private key; see sign_common().
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
+        const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    union {
+        uint8_t b[72 * 1024];
+        uint64_t dummy_u64;
+        fpr dummy_fpr;
+    } tmp;
+    int8_t f[1024], g[1024], F[1024], G[1024];
+
+    if (decode_private(f, g, F, G, sk, tmp.b) < 0) {
+        return -1;
+    }
+    sign_common(nonce, sigbuf, sigbuflen, m, mlen, NULL, f, g, F, G, tmp.b);
+    return 0;
+}
+
+/*
+ * Compute the signature with an expanded private key; see sign_common().
+ * The key header is checked, and the payload is used in place.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+do_sign_expanded(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
+                 const uint8_t *m, size_t mlen, const uint8_t *esk) {
+    union {
+        uint8_t b[48 * 1024];
+        uint64_t dummy_u64;
+        fpr dummy_fpr;
+    } tmp;
+    uint8_t hdr[EXPKEY_HEADERLEN];
+
+    expanded_header(hdr);
+    if (memcmp(esk, hdr, EXPKEY_HEADERLEN) != 0) {
+        return -1;
+    }
+    if (((uintptr_t)esk & (sizeof(fpr) - 1)) != 0) {
+        return -1;
+    }
+    sign_common(nonce, sigbuf, sigbuflen, m, mlen,
+                (const fpr *)(const void *)(esk + EXPKEY_HEADERLEN),
+                NULL, NULL, NULL, NULL, tmp.b);
+    return 0;
+}
+
 /*
  * Verify a sigature. The nonce has size NONCELEN bytes. sigbuf[]
  * (of size sigbuflen) contains the signature value, not including the
@@ -295,6 +400,47 @@ PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature(
     return 0;
 }
 
+/* see api.h */
+int
+PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk) {
+    union {
+        uint8_t b[72 * 1024];
+        uint64_t dummy_u64;
+        fpr dummy_fpr;
+    } tmp;
+    int8_t f[1024], g[1024], F[1024], G[1024];
+
+    if (((uintptr_t)esk & (sizeof(fpr) - 1)) != 0) {
+        return -1;
+    }
+    if (decode_private(f, g, F, G, sk, tmp.b) < 0) {
+        return -1;
+    }
+    expanded_header(esk);
+    PQCLEAN_FALCON1024_CLEAN_expand_privkey((fpr *)(void *)(esk + EXPKEY_HEADERLEN),
+                      f, g, F, G, 10, tmp.b);
+    return 0;
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *esk) {
+    size_t vlen;
+
+    /*
+     * Same maximum length as in crypto_sign_signature().
+     */
+    vlen = PQCLEAN_FALCON1024_CLEAN_CRYPTO_BYTES - NONCELEN - 3;
+    if (do_sign_expanded(sig + 1, sig + 1 + NONCELEN, &vlen, m, mlen, esk) < 0) {
+        return -1;
+    }
+    sig[0] = 0x30 + 10;
+    *siglen = 1 + NONCELEN + vlen;
+    return 0;
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify(
@@ -7,6 +7,7 @@
 #define PQCLEAN_FALCON512_CLEAN_CRYPTO_SECRETKEYBYTES   1281
 #define PQCLEAN_FALCON512_CLEAN_CRYPTO_PUBLICKEYBYTES   897
 #define PQCLEAN_FALCON512_CLEAN_CRYPTO_BYTES            690
+#define PQCLEAN_FALCON512_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES   57408
 
 #define PQCLEAN_FALCON512_CLEAN_CRYPTO_ALGNAME          "Falcon-512"
 
@@ -35,6 +36,36 @@ int PQCLEAN_FALCON512_CLEAN_crypto_sign_signature(
     uint8_t *sig, size_t *siglen,
     const uint8_t *m, size_t mlen, const uint8_t *sk);
 
+/*
+ * Expand a private key (sk) for repeated signing with
+ * PQCLEAN_FALCON512_CLEAN_crypto_sign_signature_expanded(). The expanded key (esk) holds
+ * the basis B0 in FFT representation and the ffLDL tree, so that they
+ * are not recomputed for every signature. Its size is exactly
+ * PQCLEAN_FALCON512_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES bytes, and
+ * esk[] must be 8-byte aligned. The format is versioned and described
+ * in pqclean.c; it uses native floating-point values and is only
+ * portable between platforms with the same byte order. It may be
+ * written to a file and mmap()ed read-only by several signers. It
+ * contains the private key and must be protected as such.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCON512_CLEAN_crypto_sign_expand_sk(
+    uint8_t *esk, const uint8_t *sk);
+
+/*
+ * Compute a signature on a provided message (m, mlen), with an expanded
+ * private key (esk) as produced by PQCLEAN_FALCON512_CLEAN_crypto_sign_expand_sk().
+ * The expanded key is only read and must be 8-byte aligned. Output is
+ * as for PQCLEAN_FALCON512_CLEAN_crypto_sign_signature().
+ *
+ * Return value: 0 on success, -1 on error (including an expanded key
+ * with a wrong header).
+ */
+int PQCLEAN_FALCON512_CLEAN_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *esk);
+
 /*
  * Verify a signature (sig, siglen) on a message (m, mlen) with a given
  * public key (pk).
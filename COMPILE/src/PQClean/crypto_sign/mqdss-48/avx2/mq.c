@@ -0,0 +1,182 @@
+#include <immintrin.h>
+#include <stdint.h>
+
+#include "mq.h"
+#include "params.h"
+
+/* The MQ instances are evaluated in batches of MQ_BATCH. The terms of each
+   batch are stored pairwise interleaved, i.e. as one 32-bit word per pair of
+   consecutive terms and instance, so that _mm256_madd_epi16 multiplies them
+   with the bytewise pairs of coefficients in F. The products are formed in
+   16-bit lanes and summed into exact 32-bit accumulators; reduction only
+   happens once per output, as in the clean implementation. */
+#define MQ_BATCH 8
+
+#define N_QUAD_TERMS ((N * (N + 1)) >> 1)
+#define N_MQ_PAIRS ((N + N_QUAD_TERMS) >> 1)
+#define N_G_PAIRS (N_QUAD_TERMS >> 1)
+
+/* Reduces 16-bit lanes to [0, 30]. The quotient estimate is exact or one
+   too large; in the latter case the difference wraps below zero and the
+   unsigned minimum picks the corrected value. */
+static inline __m128i mod31_epu16(__m128i x) {
+    __m128i q = _mm_mulhi_epu16(x, _mm_set1_epi16(2115));
+    __m128i r = _mm_sub_epi16(x, _mm_mullo_epi16(q, _mm_set1_epi16(31)));
+    return _mm_min_epu16(r, _mm_add_epi16(r, _mm_set1_epi16(31)));
+}
+
+/* Stores the terms lo and hi of MQ_BATCH instances as 32-bit pairs. */
+static inline void store_pair(uint32_t *t, __m128i lo, __m128i hi) {
+    _mm_storeu_si128((__m128i *)t, _mm_unpacklo_epi16(lo, hi));
+    _mm_storeu_si128((__m128i *)(t + 4), _mm_unpackhi_epi16(lo, hi));
+}
+
+/* Transposes count (at most MQ_BATCH) vectors of N elements into one
+   vector of MQ_BATCH lanes per element; missing instances are zero. */
+static void transpose(__m128i *xt, const gf31 *x, int count) {
+    uint16_t lanes[MQ_BATCH];
+    int i, b;
+
+    for (i = 0; i < N; i++) {
+        for (b = 0; b < MQ_BATCH; b++) {
+            lanes[b] = b < count ? x[b * N + i] : 0;
+        }
+        xt[i] = _mm_loadu_si128((const __m128i *)lanes);
+    }
+}
+
+/* Computes the terms x_i and x_i * x_j (reduced) of MQ_BATCH instances. */
+static void generate_mq_terms(uint32_t *t, const __m128i *xt) {
+    __m128i prev = _mm_setzero_si128();
+    __m128i v;
+    int i, j, k;
+
+    for (i = 0; i < N; i += 2) {
+        store_pair(t, xt[i], xt[i + 1]);
+        t += MQ_BATCH;
+    }
+    k = 0;
+    for (i = 0; i < N; i++) {
+        for (j = 0; j <= i; j++) {
+            v = mod31_epu16(_mm_mullo_epi16(xt[i], xt[j]));
+            if (k & 1) {
+                store_pair(t, prev, v);
+                t += MQ_BATCH;
+            } else {
+                prev = v;
+            }
+            k++;
+        }
+    }
+}
+
+/* Computes the terms (x_i * y_j) + (x_j * y_i) (reduced) of MQ_BATCH
+   instances. */
+static void generate_g_terms(uint32_t *t, const __m128i *xt, const __m128i *yt) {
+    __m128i prev = _mm_setzero_si128();
+    __m128i v;
+    int i, j, k;
+
+    k = 0;
+    for (i = 0; i < N; i++) {
+        for (j = 0; j <= i; j++) {
+            v = mod31_epu16(_mm_add_epi16(_mm_mullo_epi16(xt[i], yt[j]),
+                                          _mm_mullo_epi16(xt[j], yt[i])));
+            if (k & 1) {
+                store_pair(t, prev, v);
+                t += MQ_BATCH;
+            } else {
+                prev = v;
+            }
+            k++;
+        }
+    }
+}
+
+/* Multiplies npairs pairs of terms of MQ_BATCH instances with F and
+   accumulates the M outputs per instance in r. F holds the coefficients of
+   pair p at F[2 * p * M], as bytewise pairs per output. */
+static void evaluate(int32_t r[MQ_BATCH][M], const uint32_t *t, int npairs, const signed char *F) {
+    __m256i acc0, acc1, acc2, acc3, acc4, acc5, acc6, acc7;
+    __m256i f;
+    const uint32_t *tp;
+    int j, p;
+
+    for (j = 0; j < M; j += 8) {
+        acc0 = acc1 = acc2 = acc3 = _mm256_setzero_si256();
+        acc4 = acc5 = acc6 = acc7 = _mm256_setzero_si256();
+        tp = t;
+        for (p = 0; p < npairs; p++) {
+            f = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(F + 2 * p * M + 2 * j)));
+            acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(f, _mm256_set1_epi32((int32_t)tp[0])));
+            acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(f, _mm256_set1_epi32((int32_t)tp[1])));
+            acc2 = _mm256_add_epi32(acc2, _mm256_madd_epi16(f, _mm256_set1_epi32((int32_t)tp[2])));
+            acc3 = _mm256_add_epi32(acc3, _mm256_madd_epi16(f, _mm256_set1_epi32((int32_t)tp[3])));
+            acc4 = _mm256_add_epi32(acc4, _mm256_madd_epi16(f, _mm256_set1_epi32((int32_t)tp[4])));
+            acc5 = _mm256_add_epi32(acc5, _mm256_madd_epi16(f, _mm256_set1_epi32((int32_t)tp[5])));
+            acc6 = _mm256_add_epi32(acc6, _mm256_madd_epi16(f, _mm256_set1_epi32((int32_t)tp[6])));
+            acc7 = _mm256_add_epi32(acc7, _mm256_madd_epi16(f, _mm256_set1_epi32((int32_t)tp[7])));
+            tp += MQ_BATCH;
+        }
+        _mm256_storeu_si256((__m256i *)(r[0] + j), acc0);
+        _mm256_storeu_si256((__m256i *)(r[1] + j), acc1);
+        _mm256_storeu_si256((__m256i *)(r[2] + j), acc2);
+        _mm256_storeu_si256((__m256i *)(r[3] + j), acc3);
+        _mm256_storeu_si256((__m256i *)(r[4] + j), acc4);
+        _mm256_storeu_si256((__m256i *)(r[5] + j), acc5);
+        _mm256_storeu_si256((__m256i *)(r[6] + j), acc6);
+        _mm256_storeu_si256((__m256i *)(r[7] + j), acc7);
+    }
+}
+
+/* Reduces the accumulators of count instances, as in the clean code. */
+static void reduce(gf31 *fx, int32_t r[MQ_BATCH][M], int count) {
+    int b, j;
+
+    for (b = 0; b < count; b++) {
+        for (j = 0; j < M; j++) {
+            fx[b * M + j] = PQCLEAN_MQDSS48_AVX2_mod31((gf31)((r[b][j] >> 15) + (r[b][j] & 0x7FFF)));
+        }
+    }
+}
+
+void PQCLEAN_MQDSS48_AVX2_MQ_batch(gf31 *fx, const gf31 *x, const signed char *F, int count) {
+    uint32_t t[N_MQ_PAIRS * MQ_BATCH];
+    int32_t r[MQ_BATCH][M];
+    __m128i xt[N];
+    int n;
+
+    for (; count > 0; count -= n) {
+        n = count < MQ_BATCH ? count : MQ_BATCH;
+        transpose(xt, x, n);
+        generate_mq_terms(t, xt);
+        evaluate(r, t, N_MQ_PAIRS, F);
+        reduce(fx, r, n);
+        x += n * N;
+        fx += n * M;
+    }
+}
+
+void PQCLEAN_MQDSS48_AVX2_G_batch(gf31 *fx, const gf31 *x, const gf31 *y, const signed char *F, int count) {
+    uint32_t t[N_G_PAIRS * MQ_BATCH];
+    int32_t r[MQ_BATCH][M];
+    __m128i xt[N];
+    __m128i yt[N];
+    int n;
+
+    for (; count > 0; count -= n) {
+        n = count < MQ_BATCH ? count : MQ_BATCH;
+        transpose(xt, x, n);
+        transpose(yt, y, n);
+        generate_g_terms(t, xt, yt);
+        evaluate(r, t, N_G_PAIRS, F + N * M);
+        reduce(fx, r, n);
+        x += n * N;
+        y += n * N;
+        fx += n * M;
+    }
+}
+
+void PQCLEAN_MQDSS48_AVX2_MQ(gf31 *fx, const gf31 *x, const signed char *F) {
+    PQCLEAN_MQDSS48_AVX2_MQ_batch(fx, x, F, 1);
+}
@@ -0,0 +1,26 @@
+#ifndef MQDSS_MQ_H
+#define MQDSS_MQ_H
+
+#include "gf31.h"
+
+/* Evaluates the MQ function on a vector of N gf31 elements x (expected to be
+   in reduced 5-bit representation). Expects the coefficients in F to be in
+   signed representation (i.e. [-15, 15], packed bytewise).
+   Outputs M gf31 elements in unique 16-bit representation as fx. */
+void PQCLEAN_MQDSS64_AVX2_MQ(gf31 *fx, const gf31 *x, const signed char *F);
+
+/* Evaluates the MQ function on count vectors of N gf31 elements, stored
+   consecutively in x, and writes count vectors of M elements to fx.
+   The result is the same as count calls to MQ, but F is only read once per
+   batch of instances. */
+void PQCLEAN_MQDSS64_AVX2_MQ_batch(gf31 *fx, const gf31 *x, const signed char *F, int count);
+
+/* Evaluates the bilinear polar form of the MQ function (i.e. G) on count
+   pairs of vectors of N gf31 elements, stored consecutively in x and y, and
+   writes count vectors of M elements to fx. The elements of x and y may be
+   any value below 64 (e.g. 31 + a - b). Expects the coefficients in F to be
+   in signed representation (i.e. [-15, 15], packed bytewise). Outputs M gf31
+   elements per instance in unique 16-bit representation. */
+void PQCLEAN_MQDSS64_AVX2_G_batch(gf31 *fx, const gf31 *x, const gf31 *y, const signed char *F, int count);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef PQCLEAN_QTESLAPI_AVX2_CONFIG_H
+#define PQCLEAN_QTESLAPI_AVX2_CONFIG_H
+
+/*************************************************************************************
+* qTESLA: an efficient post-quantum signature scheme based on the R-LWE problem
+*
+* Abstract: configuration file
+**************************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define RADIX 32
+#define RADIX32 32
+typedef uint32_t digit_t;
+typedef int32_t sdigit_t;
+
+#endif
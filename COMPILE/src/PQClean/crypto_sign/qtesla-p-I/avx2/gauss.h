@@ -0,0 +1,13 @@
+#ifndef PQCLEAN_QTESLAPI_AVX2_GAUSS_H
+#define PQCLEAN_QTESLAPI_AVX2_GAUSS_H
+
+#include "config.h"
+#include "params.h"
+#include "poly.h"
+#include <stdint.h>
+
+#define CHUNK_SIZE 512   // Fix chunk size for sampling
+
+void PQCLEAN_QTESLAPI_AVX2_sample_gauss_poly(poly z, const uint8_t *seed, uint16_t nonce);
+
+#endif
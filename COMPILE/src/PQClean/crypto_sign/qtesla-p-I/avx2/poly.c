@@ -0,0 +1,322 @@
+/*************************************************************************************
+* qTESLA: an efficient post-quantum signature scheme based on the R-LWE problem
+*
+* Abstract: NTT, modular reduction and polynomial functions
+**************************************************************************************/
+
+#include "api.h"
+#include "poly.h"
+#include "sp800-185.h"
+#include <immintrin.h>
+
+extern const poly PQCLEAN_QTESLAPI_AVX2_zeta;
+extern const poly PQCLEAN_QTESLAPI_AVX2_zetainv;
+
+
+
+static int64_t reduce(int64_t a) {
+    // Montgomery reduction
+    int64_t u;
+
+    u = ((uint64_t)a * PARAM_QINV) & 0xFFFFFFFF;
+    u *= PARAM_Q;
+    a += u;
+    return a >> 32;
+}
+
+
+static int64_t barr_reduce(int64_t a) {
+    // Barrett reduction
+    int64_t u = (a * PARAM_BARR_MULT) >> PARAM_BARR_DIV;
+    return a - u * PARAM_Q;
+}
+
+
+static void ntt(poly a, const poly w) {
+    // Forward NTT transform
+    size_t NumoProblems = PARAM_N >> 1, jTwiddle = 0;
+
+    for (; NumoProblems > 0; NumoProblems >>= 1) {
+        size_t jFirst, j = 0;
+        for (jFirst = 0; jFirst < PARAM_N; jFirst = j + NumoProblems) {
+            sdigit_t W = (sdigit_t)w[jTwiddle++];
+            for (j = jFirst; j < jFirst + NumoProblems; j++) {
+                int64_t temp = reduce((int64_t)W * a[j + NumoProblems]);
+                a[j + NumoProblems] = a[j] + (PARAM_Q - temp);
+                a[j] = temp + a[j];
+            }
+        }
+    }
+}
+
+
+static void nttinv(poly a, const poly w) {
+    // Inverse NTT transform
+    size_t NumoProblems = 1, jTwiddle = 0;
+    for (; NumoProblems < PARAM_N; NumoProblems *= 2) {
+        size_t jFirst, j = 0;
+        for (jFirst = 0; jFirst < PARAM_N; jFirst = j + NumoProblems) {
+            sdigit_t W = (sdigit_t)w[jTwiddle++];
+            for (j = jFirst; j < jFirst + NumoProblems; j++) {
+                int64_t temp = a[j];
+                a[j] = (temp + a[j + NumoProblems]);
+                a[j + NumoProblems] = reduce((int64_t)W * (temp + (2 * PARAM_Q - a[j + NumoProblems])));
+            }
+        }
+        NumoProblems *= 2;
+        for (jFirst = 0; jFirst < PARAM_N; jFirst = j + NumoProblems) {
+            sdigit_t W = (sdigit_t)w[jTwiddle++];
+            for (j = jFirst; j < jFirst + NumoProblems; j++) {
+                int64_t temp = a[j];
+                a[j] = barr_reduce(temp + a[j + NumoProblems]);
+                a[j + NumoProblems] = reduce((int64_t)W * (temp + (2 * PARAM_Q - a[j + NumoProblems])));
+            }
+        }
+    }
+}
+
+
+static void poly_pointwise(poly result, const poly x, const poly y) {
+    // Pointwise polynomial multiplication result = x.y
+
+    for (size_t i = 0; i < PARAM_N; i++) {
+        result[i] = reduce(x[i] * y[i]);
+    }
+}
+
+void PQCLEAN_QTESLAPI_AVX2_poly_ntt(poly x_ntt, const poly x) {
+    // Call to NTT function. Avoids input destruction
+
+    for (size_t i = 0; i < PARAM_N; i++) {
+        x_ntt[i] = x[i];
+    }
+    ntt(x_ntt, PQCLEAN_QTESLAPI_AVX2_zeta);
+}
+
+
+void PQCLEAN_QTESLAPI_AVX2_poly_mul(poly result, const poly x, const poly y) {
+    // Polynomial multiplication result = x*y, with in place reduction for (X^N+1)
+    // The inputs x and y are assumed to be in NTT form
+
+    poly_pointwise(result, x, y);
+    nttinv(result, PQCLEAN_QTESLAPI_AVX2_zetainv);
+}
+
+
+void PQCLEAN_QTESLAPI_AVX2_poly_add(poly result, const poly x, const poly y) {
+    // Polynomial addition result = x+y
+
+    for (size_t i = 0; i < PARAM_N; i++) {
+        result[i] = x[i] + y[i];
+    }
+}
+
+
+void PQCLEAN_QTESLAPI_AVX2_poly_add_correct(poly result, const poly x, const poly y) {
+    // Polynomial addition result = x+y with correction
+
+    for (size_t i = 0; i < PARAM_N; i++) {
+        result[i] = x[i] + y[i];
+        result[i] -= PARAM_Q;
+        result[i] += (result[i] >> (RADIX32 - 1)) & PARAM_Q;  // If result[i] >= q then subtract q
+    }
+}
+
+
+void PQCLEAN_QTESLAPI_AVX2_poly_sub(poly result, const poly x, const poly y) {
+    // Polynomial subtraction result = x-y
+
+    for (size_t i = 0; i < PARAM_N; i++) {
+        result[i] = barr_reduce(x[i] - y[i]);
+    }
+}
+
+/********************************************************************************************
+* Name:        split_signs
+* Description: sorts the positions of the nonzero elements of c by their sign
+* Parameters:  inputs:
+*              - const uint32_t pos_list[PARAM_H]: list of indices of nonzero elements in c
+*              - const int16_t sign_list[PARAM_H]: list of signs of nonzero elements in c
+*              outputs:
+*              - size_t add[PARAM_H]: offsets PARAM_N-pos of the positions with sign 1
+*              - size_t sub[PARAM_H]: offsets PARAM_N-pos of the positions with sign -1
+*              - size_t *nadd, *nsub: number of entries in add[] and sub[]
+*
+* Note: branching on the signs is fine since c is public
+*********************************************************************************************/
+static void split_signs(size_t add[PARAM_H], size_t *nadd, size_t sub[PARAM_H], size_t *nsub, const uint32_t pos_list[PARAM_H], const int16_t sign_list[PARAM_H]) {
+    *nadd = 0;
+    *nsub = 0;
+    for (size_t i = 0; i < PARAM_H; i++) {
+        if (sign_list[i] > 0) {
+            add[(*nadd)++] = PARAM_N - pos_list[i];
+        } else {
+            sub[(*nsub)++] = PARAM_N - pos_list[i];
+        }
+    }
+}
+
+static void store_epi16(int64_t *p, __m256i a) {
+    // Sign-extends the 16-bit lanes of a to p[0..15]
+    __m128i lo = _mm256_castsi256_si128(a), hi = _mm256_extracti128_si256(a, 1);
+
+    _mm256_storeu_si256((__m256i *)&p[0], _mm256_cvtepi16_epi64(lo));
+    _mm256_storeu_si256((__m256i *)&p[4], _mm256_cvtepi16_epi64(_mm_srli_si128(lo, 8)));
+    _mm256_storeu_si256((__m256i *)&p[8], _mm256_cvtepi16_epi64(hi));
+    _mm256_storeu_si256((__m256i *)&p[12], _mm256_cvtepi16_epi64(_mm_srli_si128(hi, 8)));
+}
+
+/********************************************************************************************
+* Name:        sparse_mul8
+* Description: performs sparse polynomial multiplication
+* Parameters:  inputs:
+*              - const uint8_t *s: part of the secret key
+*              - const uint32_t pos_list[PARAM_H]: list of indices of nonzero elements in c
+*              - const int16_t sign_list[PARAM_H]: list of signs of nonzero elements in c
+*              outputs:
+*              - poly prod: product of 2 polynomials
+*
+* Note: pos_list[] and sign_list[] contain public information since c is public.
+*       The secret polynomial is stored twice as 16-bit values, negated in the lower half,
+*       so that the product with x^pos mod x^N+1 is a contiguous slice starting at PARAM_N-pos.
+*       The sums fit in 16 bits since |s[i]| < 2^7 and PARAM_H < 2^8.
+*********************************************************************************************/
+void PQCLEAN_QTESLAPI_AVX2_sparse_mul8(poly prod, const uint8_t *s, const uint32_t pos_list[PARAM_H], const int16_t sign_list[PARAM_H]) {
+    int16_t ext[2 * PARAM_N];
+    size_t add[PARAM_H], sub[PARAM_H], nadd, nsub, i, j;
+    __m256i acc0, acc1, t;
+
+    for (j = 0; j < PARAM_N; j += 16) {
+        t = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)&s[j]));
+        _mm256_storeu_si256((__m256i *)&ext[j], _mm256_sub_epi16(_mm256_setzero_si256(), t));
+        _mm256_storeu_si256((__m256i *)&ext[PARAM_N + j], t);
+    }
+    split_signs(add, &nadd, sub, &nsub, pos_list, sign_list);
+
+    for (j = 0; j < PARAM_N; j += 32) {
+        acc0 = _mm256_setzero_si256();
+        acc1 = _mm256_setzero_si256();
+        for (i = 0; i < nadd; i++) {
+            acc0 = _mm256_add_epi16(acc0, _mm256_loadu_si256((const __m256i *)&ext[add[i] + j]));
+            acc1 = _mm256_add_epi16(acc1, _mm256_loadu_si256((const __m256i *)&ext[add[i] + j + 16]));
+        }
+        for (i = 0; i < nsub; i++) {
+            acc0 = _mm256_sub_epi16(acc0, _mm256_loadu_si256((const __m256i *)&ext[sub[i] + j]));
+            acc1 = _mm256_sub_epi16(acc1, _mm256_loadu_si256((const __m256i *)&ext[sub[i] + j + 16]));
+        }
+        store_epi16(&prod[j], acc0);
+        store_epi16(&prod[j + 16], acc1);
+    }
+}
+
+/********************************************************************************************
+* Name:        sparse_mul32
+* Description: performs sparse polynomial multiplication
+* Parameters:  inputs:
+*              - const int32_t* pk: part of the public key
+*              - const uint32_t pos_list[PARAM_H]: list of indices of nonzero elements in c
+*              - const int16_t sign_list[PARAM_H]: list of signs of nonzero elements in c
+*              outputs:
+*              - poly prod: product of 2 polynomials
+*
+* Note: the public polynomial is extended as in sparse_mul8 and accumulated in 64-bit lanes.
+*********************************************************************************************/
+void PQCLEAN_QTESLAPI_AVX2_sparse_mul32(poly prod, const int32_t *pk, const uint32_t pos_list[PARAM_H], const int16_t sign_list[PARAM_H]) {
+    int32_t ext[2 * PARAM_N];
+    size_t add[PARAM_H], sub[PARAM_H], nadd, nsub, i, j;
+    __m256i acc0, acc1, acc2, acc3, t;
+
+    for (j = 0; j < PARAM_N; j += 8) {
+        t = _mm256_loadu_si256((const __m256i *)&pk[j]);
+        _mm256_storeu_si256((__m256i *)&ext[j], _mm256_sub_epi32(_mm256_setzero_si256(), t));
+        _mm256_storeu_si256((__m256i *)&ext[PARAM_N + j], t);
+    }
+    split_signs(add, &nadd, sub, &nsub, pos_list, sign_list);
+
+    for (j = 0; j < PARAM_N; j += 16) {
+        acc0 = acc1 = acc2 = acc3 = _mm256_setzero_si256();
+        for (i = 0; i < nadd; i++) {
+            const int32_t *p = &ext[add[i] + j];
+            acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&p[0])));
+            acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&p[4])));
+            acc2 = _mm256_add_epi64(acc2, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&p[8])));
+            acc3 = _mm256_add_epi64(acc3, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&p[12])));
+        }
+        for (i = 0; i < nsub; i++) {
+            const int32_t *p = &ext[sub[i] + j];
+            acc0 = _mm256_sub_epi64(acc0, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&p[0])));
+            acc1 = _mm256_sub_epi64(acc1, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&p[4])));
+            acc2 = _mm256_sub_epi64(acc2, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&p[8])));
+            acc3 = _mm256_sub_epi64(acc3, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&p[12])));
+        }
+        _mm256_storeu_si256((__m256i *)&prod[j], acc0);
+        _mm256_storeu_si256((__m256i *)&prod[j + 4], acc1);
+        _mm256_storeu_si256((__m256i *)&prod[j + 8], acc2);
+        _mm256_storeu_si256((__m256i *)&prod[j + 12], acc3);
+    }
+    for (i = 0; i < PARAM_N; i++) {
+        prod[i] = barr_reduce(prod[i]);
+    }
+}
+
+void PQCLEAN_QTESLAPI_AVX2_poly_uniform(poly_k a, const uint8_t *seed) {
+    // Generation of polynomials "a_i"
+    size_t pos = 0, i = 0, nbytes = (PARAM_Q_LOG + 7) / 8;
+    size_t nblocks = PARAM_GEN_A;
+    uint32_t val1, val2, val3, val4, mask = (uint32_t)(1 << PARAM_Q_LOG) - 1;
+    uint8_t buf[SHAKE128_RATE * PARAM_GEN_A];
+    uint16_t dmsp = 0;
+    uint8_t dmsp_bytes[2];
+    dmsp_bytes[0] = (uint8_t)(dmsp & 0xff);
+    dmsp_bytes[1] = (uint8_t)(dmsp >> 8);
+    cshake128(buf, SHAKE128_RATE * PARAM_GEN_A, (uint8_t *)NULL, 0, dmsp_bytes, 2, seed, CRYPTO_RANDOMBYTES);
+    ++dmsp;
+
+    while (i < PARAM_K * PARAM_N) {
+        if (pos > SHAKE128_RATE * nblocks - 4 * nbytes) {
+            nblocks = 1;
+            dmsp_bytes[0] = (uint8_t)(dmsp & 0xff);
+            dmsp_bytes[1] = (uint8_t)(dmsp >> 8);
+            cshake128(buf, SHAKE128_RATE * nblocks, (uint8_t *)NULL, 0, dmsp_bytes, 2, seed, CRYPTO_RANDOMBYTES);
+            ++dmsp;
+            pos = 0;
+        }
+        val1 = ((uint32_t)(buf[pos])
+                |  (uint32_t)(buf[pos + 1] << 8)
+                |  (uint32_t)(buf[pos + 2] << 16)
+                |  (uint32_t)(buf[pos + 3] << 24))
+               & mask;
+        pos += nbytes;
+        val2 = ((uint32_t)(buf[pos])
+                |  (uint32_t)(buf[pos + 1] << 8)
+                |  (uint32_t)(buf[pos + 2] << 16)
+                |  (uint32_t)(buf[pos + 3] << 24))
+               & mask;
+        pos += nbytes;
+        val3 = ((uint32_t)(buf[pos])
+                |  (uint32_t)(buf[pos + 1] << 8)
+                |  (uint32_t)(buf[pos + 2] << 16)
+                |  (uint32_t)(buf[pos + 3] << 24))
+               & mask;
+        pos += nbytes;
+        val4 = ((uint32_t)(buf[pos])
+                |  (uint32_t)(buf[pos + 1] << 8)
+                |  (uint32_t)(buf[pos + 2] << 16)
+                |  (uint32_t)(buf[pos + 3] << 24))
+               & mask;
+        pos += nbytes;
+        if (val1 < PARAM_Q && i < PARAM_K * PARAM_N) {
+            a[i++] = reduce((int64_t)val1 * PARAM_R2_INVN);
+        }
+        if (val2 < PARAM_Q && i < PARAM_K * PARAM_N) {
+            a[i++] = reduce((int64_t)val2 * PARAM_R2_INVN);
+        }
+        if (val3 < PARAM_Q && i < PARAM_K * PARAM_N) {
+            a[i++] = reduce((int64_t)val3 * PARAM_R2_INVN);
+        }
+        if (val4 < PARAM_Q && i < PARAM_K * PARAM_N) {
+            a[i++] = reduce((int64_t)val4 * PARAM_R2_INVN);
+        }
+    }
+}
+
@@ -0,0 +1,61 @@
+/*************************************************************************************
+* qTESLA: an efficient post-quantum signature scheme based on the R-LWE problem
+*
+* Abstract: constant-time Gaussian sampler using AVX2
+**************************************************************************************/
+
+#include "api.h"
+#include "CDT32.h"
+#include "gauss.h"
+#include "sp800-185.h"
+#include <immintrin.h>
+
+// Number of samples that are compared against the table at once
+#define GAUSS_LANES 8
+
+void PQCLEAN_QTESLAPIII_AVX2_sample_gauss_poly(poly z, const uint8_t *seed, uint16_t nonce) {
+    // The whole table is scanned for GAUSS_LANES samples at once, one sample per 32-bit lane.
+    // The multi-precision comparison with every row is the same as in the portable sampler:
+    // borrow is 0 or -1, so the number of rows below the sample is CDT_ROWS-1 plus the sum
+    // of all final borrows.
+    uint16_t dmsp = (uint16_t)(nonce << 8);
+    uint8_t buf[CHUNK_SIZE * CDT_COLS * sizeof(int32_t)];
+    const __m256i mask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(CDT_COLS));
+    __m256i samp[CDT_COLS], borrow, cnt, sign;
+    int32_t out[GAUSS_LANES];
+
+    for (size_t chunk = 0; chunk < PARAM_N; chunk += CHUNK_SIZE) {
+        uint8_t dmsp_bytes[2];
+        dmsp_bytes[0] = (uint8_t)(dmsp & 0xff);
+        dmsp_bytes[1] = (uint8_t)(dmsp >> 8);
+        cSHAKE(buf, CHUNK_SIZE * CDT_COLS * sizeof(int32_t), (uint8_t *)NULL, 0, dmsp_bytes, 2, seed, CRYPTO_RANDOMBYTES);
+        ++dmsp;
+        for (size_t i = 0; i < CHUNK_SIZE; i += GAUSS_LANES) {
+            const int *p = (const int *)&buf[i * CDT_COLS * sizeof(int32_t)];
+            for (size_t k = 0; k < CDT_COLS; k++) {
+                samp[k] = _mm256_i32gather_epi32(p + k, idx, 4);
+            }
+            sign = _mm256_srai_epi32(samp[0], RADIX32 - 1);
+            for (size_t k = 0; k < CDT_COLS; k++) {
+                samp[k] = _mm256_and_si256(samp[k], mask);
+            }
+            cnt = _mm256_set1_epi32(CDT_ROWS - 1);
+            for (size_t j = 1; j < CDT_ROWS; j++) {
+                borrow = _mm256_setzero_si256();
+                for (size_t k = CDT_COLS; k > 0; ) {
+                    k--;
+                    borrow = _mm256_add_epi32(_mm256_set1_epi32(cdt_v[j * CDT_COLS + k]), borrow);
+                    borrow = _mm256_srai_epi32(_mm256_sub_epi32(samp[k], borrow), RADIX32 - 1);
+                }
+                cnt = _mm256_add_epi32(cnt, borrow);
+            }
+            // Negate where the sign bit of the first word is set
+            cnt = _mm256_sub_epi32(_mm256_xor_si256(cnt, sign), sign);
+            _mm256_storeu_si256((__m256i *)out, cnt);
+            for (size_t l = 0; l < GAUSS_LANES; l++) {
+                z[chunk + i + l] = out[l];
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef PQCLEAN_RAINBOWIIICCLASSIC_AVX2_API_H
+#define PQCLEAN_RAINBOWIIICCLASSIC_AVX2_API_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PQCLEAN_RAINBOWIIICCLASSIC_AVX2_CRYPTO_SECRETKEYBYTES 511448
+#define PQCLEAN_RAINBOWIIICCLASSIC_AVX2_CRYPTO_PUBLICKEYBYTES 710640
+#define PQCLEAN_RAINBOWIIICCLASSIC_AVX2_CRYPTO_WORKSPACEBYTES 710656    // scratch of the _ws functions, see below
+#define PQCLEAN_RAINBOWIIICCLASSIC_AVX2_CRYPTO_BYTES 156
+#define PQCLEAN_RAINBOWIIICCLASSIC_AVX2_CRYPTO_ALGNAME "RAINBOW(256,68,36,36) - classic"
+
+int PQCLEAN_RAINBOWIIICCLASSIC_AVX2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
+
+
+int PQCLEAN_RAINBOWIIICCLASSIC_AVX2_crypto_sign_signature(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk);
+
+int PQCLEAN_RAINBOWIIICCLASSIC_AVX2_crypto_sign_verify(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *pk);
+
+int PQCLEAN_RAINBOWIIICCLASSIC_AVX2_crypto_sign(uint8_t *sm, size_t *smlen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *sk);
+
+int PQCLEAN_RAINBOWIIICCLASSIC_AVX2_crypto_sign_open(uint8_t *m, size_t *mlen,
+        const uint8_t *sm, size_t smlen,
+        const uint8_t *pk);
+
+// Same as above, but the large temporaries of the key generation live in ws, which
+// must hold CRYPTO_WORKSPACEBYTES bytes (64-byte alignment keeps it off shared cache
+// lines). Signing has no large temporaries and ignores ws. A workspace can be reused
+// by any number of calls, but not by concurrent ones.
+int PQCLEAN_RAINBOWIIICCLASSIC_AVX2_crypto_sign_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws);
+
+int PQCLEAN_RAINBOWIIICCLASSIC_AVX2_crypto_sign_signature_ws(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk, void *ws);
+
+int PQCLEAN_RAINBOWIIICCLASSIC_AVX2_crypto_sign_ws(uint8_t *sm, size_t *smlen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *sk, void *ws);
+
+#endif
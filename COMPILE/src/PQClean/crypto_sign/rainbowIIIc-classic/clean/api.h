@@ -6,6 +6,7 @@
 
 #define PQCLEAN_RAINBOWIIICCLASSIC_CLEAN_CRYPTO_SECRETKEYBYTES 511448
 #define PQCLEAN_RAINBOWIIICCLASSIC_CLEAN_CRYPTO_PUBLICKEYBYTES 710640
+#define PQCLEAN_RAINBOWIIICCLASSIC_CLEAN_CRYPTO_WORKSPACEBYTES 710656    // scratch of the _ws functions, see below
 #define PQCLEAN_RAINBOWIIICCLASSIC_CLEAN_CRYPTO_BYTES 156
 #define PQCLEAN_RAINBOWIIICCLASSIC_CLEAN_CRYPTO_ALGNAME "RAINBOW(256,68,36,36) - classic"
 
@@ -28,5 +29,18 @@ int PQCLEAN_RAINBOWIIICCLASSIC_CLEAN_crypto_sign_open(uint8_t *m, size_t *mlen,
         const uint8_t *sm, size_t smlen,
         const uint8_t *pk);
 
+// Same as above, but the large temporaries of the key generation live in ws, which
+// must hold CRYPTO_WORKSPACEBYTES bytes (64-byte alignment keeps it off shared cache
+// lines). Signing has no large temporaries and ignores ws. A workspace can be reused
+// by any number of calls, but not by concurrent ones.
+int PQCLEAN_RAINBOWIIICCLASSIC_CLEAN_crypto_sign_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws);
+
+int PQCLEAN_RAINBOWIIICCLASSIC_CLEAN_crypto_sign_signature_ws(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk, void *ws);
+
+int PQCLEAN_RAINBOWIIICCLASSIC_CLEAN_crypto_sign_ws(uint8_t *sm, size_t *smlen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *sk, void *ws);
 
 #endif
@@ -0,0 +1,59 @@
+#ifndef PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_API_H
+#define PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_API_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_CRYPTO_SECRETKEYBYTES 64
+#define PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_CRYPTO_PUBLICKEYBYTES 206744
+#define PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_CRYPTO_EXPANDEDPUBLICKEYBYTES 710640
+#define PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_CRYPTO_WORKSPACEBYTES 2045824    // scratch of the _ws functions, see below
+#define PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_CRYPTO_BYTES 156
+#define PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_CRYPTO_ALGNAME "RAINBOW(256,68,36,36) - cyclic compressed"
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
+
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_crypto_sign_signature(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk);
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_crypto_sign_verify(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *pk);
+
+// Expands a cyclic public key (pk) into the classic public key (epk) of
+// exactly CRYPTO_EXPANDEDPUBLICKEYBYTES bytes, so that repeated verifications
+// with the same key do not regenerate it from the seed. The expanded key has
+// no alignment requirements; it may be kept in memory or written to a file
+// and mmap()ed read-only.
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk);
+
+// Verifies as crypto_sign_verify(), with an expanded public key (epk).
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_crypto_sign_verify_expanded(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *epk);
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_crypto_sign(uint8_t *sm, size_t *smlen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *sk);
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_crypto_sign_open(uint8_t *m, size_t *mlen,
+        const uint8_t *sm, size_t smlen,
+        const uint8_t *pk);
+
+// Same as above, but the large temporaries, including the secret key expanded for
+// signing, live in ws, which must hold CRYPTO_WORKSPACEBYTES bytes (64-byte alignment
+// keeps it off shared cache lines). A workspace can be reused by any number of calls,
+// but not by concurrent ones.
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_crypto_sign_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws);
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_crypto_sign_signature_ws(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk, void *ws);
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_crypto_sign_ws(uint8_t *sm, size_t *smlen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *sk, void *ws);
+
+#endif
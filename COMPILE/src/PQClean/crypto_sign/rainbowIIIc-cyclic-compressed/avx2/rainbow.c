@@ -0,0 +1,273 @@
+/// @file rainbow.c
+/// @brief The standard implementations for functions in rainbow.h
+///
+
+#include "blas.h"
+#include "parallel_matrix_op.h"
+#include "rainbow.h"
+#include "rainbow_blas.h"
+#include "rainbow_config.h"
+#include "rainbow_keypair.h"
+#include "utils_hash.h"
+#include "utils_prng.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ATTEMPT_FRMAT 128
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_rainbow_sign(uint8_t *signature, const sk_t *sk, const uint8_t *_digest) {
+    uint8_t mat_l1[_O1 * _O1_BYTE];
+    uint8_t mat_l2[_O2 * _O2_BYTE];
+    uint8_t mat_buffer[2 * _MAX_O * _MAX_O_BYTE];
+
+    // setup PRNG
+    prng_t prng_sign;
+    uint8_t prng_preseed[LEN_SKSEED + _HASH_LEN];
+    memcpy(prng_preseed, sk->sk_seed, LEN_SKSEED);
+    memcpy(prng_preseed + LEN_SKSEED, _digest, _HASH_LEN); // prng_preseed = sk_seed || digest
+    uint8_t prng_seed[_HASH_LEN];
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_hash_msg(prng_seed, _HASH_LEN, prng_preseed, _HASH_LEN + LEN_SKSEED);
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_prng_set(&prng_sign, prng_seed, _HASH_LEN); // seed = H( sk_seed || digest )
+    for (unsigned int i = 0; i < LEN_SKSEED + _HASH_LEN; i++) {
+        prng_preseed[i] ^= prng_preseed[i]; // clean
+    }
+    for (unsigned int i = 0; i < _HASH_LEN; i++) {
+        prng_seed[i] ^= prng_seed[i]; // clean
+    }
+
+    // roll vinegars.
+    uint8_t vinegar[_V1_BYTE];
+    unsigned int n_attempt = 0;
+    unsigned int l1_succ = 0;
+    while (!l1_succ) {
+        if (MAX_ATTEMPT_FRMAT <= n_attempt) {
+            break;
+        }
+        PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_prng_gen(&prng_sign, vinegar, _V1_BYTE);   // generating vinegars
+        gfmat_prod(mat_l1, sk->l1_F2, _O1 * _O1_BYTE, _V1, vinegar); // generating the linear equations for layer 1
+        l1_succ = gfmat_inv(mat_l1, mat_l1, _O1, mat_buffer);        // check if the linear equation solvable
+        n_attempt++;
+    }
+
+    // Given the vinegars, pre-compute variables needed for layer 2
+    uint8_t r_l1_F1[_O1_BYTE] = {0};
+    uint8_t r_l2_F1[_O2_BYTE] = {0};
+    batch_quad_trimat_eval(r_l1_F1, sk->l1_F1, vinegar, _V1, _O1_BYTE);
+    batch_quad_trimat_eval(r_l2_F1, sk->l2_F1, vinegar, _V1, _O2_BYTE);
+    uint8_t mat_l2_F3[_O2 * _O2_BYTE];
+    uint8_t mat_l2_F2[_O1 * _O2_BYTE];
+    gfmat_prod(mat_l2_F3, sk->l2_F3, _O2 * _O2_BYTE, _V1, vinegar);
+    gfmat_prod(mat_l2_F2, sk->l2_F2, _O1 * _O2_BYTE, _V1, vinegar);
+
+    // Some local variables.
+    uint8_t _z[_PUB_M_BYTE];
+    uint8_t y[_PUB_M_BYTE];
+    uint8_t *x_v1 = vinegar;
+    uint8_t x_o1[_O1_BYTE];
+    uint8_t x_o2[_O1_BYTE];
+
+    uint8_t digest_salt[_HASH_LEN + _SALT_BYTE];
+    memcpy(digest_salt, _digest, _HASH_LEN);
+    uint8_t *salt = digest_salt + _HASH_LEN;
+
+    uint8_t temp_o[_MAX_O_BYTE + 32] = {0};
+    unsigned int succ = 0;
+    while (!succ) {
+        if (MAX_ATTEMPT_FRMAT <= n_attempt) {
+            break;
+        }
+        // The computation:  H(digest||salt)  -->   z   --S-->   y  --C-map-->   x   --T-->   w
+
+        PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_prng_gen(&prng_sign, salt, _SALT_BYTE);                         // roll the salt
+        PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_hash_msg(_z, _PUB_M_BYTE, digest_salt, _HASH_LEN + _SALT_BYTE); // H(digest||salt)
+
+        //  y = S^-1 * z
+        memcpy(y, _z, _PUB_M_BYTE); // identity part of S
+        gfmat_prod(temp_o, sk->s1, _O1_BYTE, _O2, _z + _O1_BYTE);
+        PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(y, temp_o, _O1_BYTE);
+
+        // Central Map:
+        // layer 1: calculate x_o1
+        memcpy(temp_o, r_l1_F1, _O1_BYTE);
+        PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(temp_o, y, _O1_BYTE);
+        gfmat_prod(x_o1, mat_l1, _O1_BYTE, _O1, temp_o);
+
+        // layer 2: calculate x_o2
+        PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_set_zero(temp_o, _O2_BYTE);
+        gfmat_prod(temp_o, mat_l2_F2, _O2_BYTE, _O1, x_o1);             // F2
+        batch_quad_trimat_eval(mat_l2, sk->l2_F5, x_o1, _O1, _O2_BYTE); // F5
+        PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(temp_o, mat_l2, _O2_BYTE);
+        PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(temp_o, r_l2_F1, _O2_BYTE); // F1
+        PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(temp_o, y + _O1_BYTE, _O2_BYTE);
+
+        // generate the linear equations of the 2nd layer
+        gfmat_prod(mat_l2, sk->l2_F6, _O2 * _O2_BYTE, _O1, x_o1); // F6
+        PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(mat_l2, mat_l2_F3, _O2 * _O2_BYTE);            // F3
+        succ = gfmat_inv(mat_l2, mat_l2, _O2, mat_buffer);
+        gfmat_prod(x_o2, mat_l2, _O2_BYTE, _O2, temp_o); // solve l2 eqs
+
+        n_attempt++;
+    };
+    //  w = T^-1 * y
+    uint8_t w[_PUB_N_BYTE];
+    // identity part of T.
+    memcpy(w, x_v1, _V1_BYTE);
+    memcpy(w + _V1_BYTE, x_o1, _O1_BYTE);
+    memcpy(w + _V2_BYTE, x_o2, _O2_BYTE);
+    // Computing the t1 part.
+    gfmat_prod(y, sk->t1, _V1_BYTE, _O1, x_o1);
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(w, y, _V1_BYTE);
+    // Computing the t4 part.
+    gfmat_prod(y, sk->t4, _V1_BYTE, _O2, x_o2);
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(w, y, _V1_BYTE);
+    // Computing the t3 part.
+    gfmat_prod(y, sk->t3, _O1_BYTE, _O2, x_o2);
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(w + _V1_BYTE, y, _O1_BYTE);
+
+    memset(signature, 0, _SIGNATURE_BYTE); // set the output 0
+    // clean
+    memset(&prng_sign, 0, sizeof(prng_t));
+    memset(vinegar, 0, _V1_BYTE);
+    memset(r_l1_F1, 0, _O1_BYTE);
+    memset(r_l2_F1, 0, _O2_BYTE);
+    memset(_z, 0, _PUB_M_BYTE);
+    memset(y, 0, _PUB_M_BYTE);
+    memset(x_o1, 0, _O1_BYTE);
+    memset(x_o2, 0, _O2_BYTE);
+    memset(temp_o, 0, sizeof(temp_o));
+
+    // return: copy w and salt to the signature.
+    if (MAX_ATTEMPT_FRMAT <= n_attempt) {
+        return -1;
+    }
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(signature, w, _PUB_N_BYTE);
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_gf256v_add(signature + _PUB_N_BYTE, salt, _SALT_BYTE);
+    return 0;
+}
+
+///
+/// @brief Comparing the evaluation of the public map with H( digest || salt ).
+///
+/// @return 0 if they match, -1 otherwise.
+///
+static int check_digest(const unsigned char *digest_ck, const uint8_t *digest, const uint8_t *signature) {
+    unsigned char correct[_PUB_M_BYTE];
+    unsigned char digest_salt[_HASH_LEN + _SALT_BYTE];
+    memcpy(digest_salt, digest, _HASH_LEN);
+    memcpy(digest_salt + _HASH_LEN, signature + _PUB_N_BYTE, _SALT_BYTE);
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_hash_msg(correct, _PUB_M_BYTE, digest_salt, _HASH_LEN + _SALT_BYTE); // H( digest || salt )
+
+    // check consistancy.
+    unsigned char cc = 0;
+    for (unsigned int i = 0; i < _PUB_M_BYTE; i++) {
+        cc |= (digest_ck[i] ^ correct[i]);
+    }
+    return (0 == cc) ? 0 : -1;
+}
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_rainbow_verify(const uint8_t *digest, const uint8_t *signature, const pk_t *pk) {
+    unsigned char digest_ck[_PUB_M_BYTE];
+    // public_map( digest_ck , pk , signature ); Evaluating the quadratic public polynomials.
+    batch_quad_trimat_eval(digest_ck, pk->pk, signature, _PUB_N, _PUB_M_BYTE);
+
+    return check_digest(digest_ck, digest, signature);
+}
+
+///////////////  cyclic version  ///////////////////////////
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_rainbow_sign_cyclic(uint8_t *signature, const csk_t *csk, const uint8_t *digest, sk_t *tmp) {
+    sk_t *sk = &tmp[1]; // the last one, followed by the 32 spare bytes
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_generate_secretkey_cyclic(sk, csk->pk_seed, csk->sk_seed, &tmp[0]); // generating classic secret key.
+    return PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_rainbow_sign(signature, sk, digest);
+}
+
+///
+/// @brief Accumulating  x_row[i] * ( sum_j mat[i][j] * x_col[j] )  over the rows of a (block) matrix into y.
+///
+/// The rows are either read from mat or, if mat is NULL, generated with the prng stream st,
+/// one row at a time, so a block generated from the seed is never held in memory as a whole.
+///
+/// @param[in,out] y          - the accumulator, size_batch bytes.
+/// @param[in]     mat        - the matrix, or NULL.
+/// @param[in,out] st         - the prng stream producing the matrix if mat is NULL.
+/// @param[in]     x_row      - the variables of the rows, one gf element per byte.
+/// @param[in]     n_row      - the number of rows.
+/// @param[in]     x_col      - the variables of the columns, one gf element per byte.
+/// @param[in]     n_col      - the number of columns.
+/// @param[in]     is_trimat  - the matrix is upper-triangular, i.e., row i starts at column i.
+/// @param[in]     size_batch - the number of bytes of a batched element.
+///
+static void quad_rows_accu(unsigned char *y, const unsigned char *mat, prng_stream_t *st,
+                           const unsigned char *x_row, unsigned int n_row, const unsigned char *x_col, unsigned int n_col,
+                           unsigned int is_trimat, unsigned int size_batch) {
+    unsigned char row[_V1 * _MAX_O_BYTE];
+    unsigned char tmp[_MAX_O_BYTE];
+
+    for (unsigned int i = 0; i < n_row; i++) {
+        unsigned int j0 = (is_trimat) ? i : 0;
+        const unsigned char *r = mat;
+        if (NULL == mat) {
+            PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_prng_stream_gen(st, row, (n_col - j0) * size_batch);
+            r = row;
+        } else {
+            mat += (n_col - j0) * size_batch;
+        }
+        memset(tmp, 0, size_batch);
+        for (unsigned int j = j0; j < n_col; j++) {
+            gfv_madd(tmp, r, x_col[j], size_batch);
+            r += size_batch;
+        }
+        gfv_madd(y, tmp, x_row[i], size_batch);
+    }
+}
+
+///
+/// @brief Accumulating the rows of a (block) matrix that is generated from the prng into y.
+///
+static void quad_rows_accu_prng(unsigned char *y, prng_t *prng, unsigned long n_byte,
+                                const unsigned char *x_row, unsigned int n_row, const unsigned char *x_col, unsigned int n_col,
+                                unsigned int is_trimat, unsigned int size_batch) {
+    prng_stream_t st;
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_prng_stream_start(&st, prng, n_byte);
+    quad_rows_accu(y, NULL, &st, x_row, n_row, x_col, n_col, is_trimat, size_batch);
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_prng_stream_end(&st);
+}
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_rainbow_verify_cyclic(const uint8_t *digest, const uint8_t *signature, const cpk_t *pk) {
+    // Evaluating the public map block by block, in the order the blocks are stored in cpk_t or
+    // generated from pk_seed, instead of expanding the classic public key first.
+    // The terms of layer 1 go to digest_ck[0.._O1_BYTE) and those of layer 2 to the rest.
+    unsigned char x[_PUB_N];
+    for (unsigned int i = 0; i < _PUB_N; i++) {
+        x[i] = gfv_get_ele(signature, i);
+    }
+    const unsigned char *x_v1 = x;
+    const unsigned char *x_o1 = x + _V1;
+    const unsigned char *x_o2 = x + _V1 + _O1;
+
+    unsigned char digest_ck[_PUB_M_BYTE] = {0};
+    unsigned char *y_l1 = digest_ck;
+    unsigned char *y_l2 = digest_ck + _O1_BYTE;
+
+    prng_t prng0;
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_AVX2_prng_set(&prng0, pk->pk_seed, LEN_PKSEED);
+
+    // layer 1: l1_Q1 and l1_Q2 from the prng, l1_Q3, l1_Q5, l1_Q6, l1_Q9 from the key
+    quad_rows_accu_prng(y_l1, &prng0, _O1_BYTE * N_TRIANGLE_TERMS(_V1), x_v1, _V1, x_v1, _V1, 1, _O1_BYTE);
+    quad_rows_accu_prng(y_l1, &prng0, _O1_BYTE * _V1 * _O1, x_v1, _V1, x_o1, _O1, 0, _O1_BYTE);
+    quad_rows_accu(y_l1, pk->l1_Q3, NULL, x_v1, _V1, x_o2, _O2, 0, _O1_BYTE);
+    quad_rows_accu(y_l1, pk->l1_Q5, NULL, x_o1, _O1, x_o1, _O1, 1, _O1_BYTE);
+    quad_rows_accu(y_l1, pk->l1_Q6, NULL, x_o1, _O1, x_o2, _O2, 0, _O1_BYTE);
+    quad_rows_accu(y_l1, pk->l1_Q9, NULL, x_o2, _O2, x_o2, _O2, 1, _O1_BYTE);
+
+    // layer 2: l2_Q1, l2_Q2, l2_Q3, l2_Q5, l2_Q6 from the prng, l2_Q9 from the key
+    quad_rows_accu_prng(y_l2, &prng0, _O2_BYTE * N_TRIANGLE_TERMS(_V1), x_v1, _V1, x_v1, _V1, 1, _O2_BYTE);
+    quad_rows_accu_prng(y_l2, &prng0, _O2_BYTE * _V1 * _O1, x_v1, _V1, x_o1, _O1, 0, _O2_BYTE);
+    quad_rows_accu_prng(y_l2, &prng0, _O2_BYTE * _V1 * _O2, x_v1, _V1, x_o2, _O2, 0, _O2_BYTE);
+    quad_rows_accu_prng(y_l2, &prng0, _O2_BYTE * N_TRIANGLE_TERMS(_O1), x_o1, _O1, x_o1, _O1, 1, _O2_BYTE);
+    quad_rows_accu_prng(y_l2, &prng0, _O2_BYTE * _O1 * _O2, x_o1, _O1, x_o2, _O2, 0, _O2_BYTE);
+    quad_rows_accu(y_l2, pk->l2_Q9, NULL, x_o2, _O2, x_o2, _O2, 1, _O2_BYTE);
+
+    memset(&prng0, 0, sizeof(prng_t));
+    return check_digest(digest_ck, digest, signature);
+}
@@ -146,11 +146,12 @@ int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_sign(uint8_t *signature, c
     return 0;
 }
 
-int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_verify(const uint8_t *digest, const uint8_t *signature, const pk_t *pk) {
-    unsigned char digest_ck[_PUB_M_BYTE];
-    // public_map( digest_ck , pk , signature ); Evaluating the quadratic public polynomials.
-    batch_quad_trimat_eval(digest_ck, pk->pk, signature, _PUB_N, _PUB_M_BYTE);
-
+///
+/// @brief Comparing the evaluation of the public map with H( digest || salt ).
+///
+/// @return 0 if they match, -1 otherwise.
+///
+static int check_digest(const unsigned char *digest_ck, const uint8_t *digest, const uint8_t *signature) {
     unsigned char correct[_PUB_M_BYTE];
     unsigned char digest_salt[_HASH_LEN + _SALT_BYTE];
     memcpy(digest_salt, digest, _HASH_LEN);
@@ -165,15 +166,108 @@ int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_verify(const uint8_t *dige
     return (0 == cc) ? 0 : -1;
 }
 
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_verify(const uint8_t *digest, const uint8_t *signature, const pk_t *pk) {
+    unsigned char digest_ck[_PUB_M_BYTE];
+    // public_map( digest_ck , pk , signature ); Evaluating the quadratic public polynomials.
+    batch_quad_trimat_eval(digest_ck, pk->pk, signature, _PUB_N, _PUB_M_BYTE);
+
+    return check_digest(digest_ck, digest, signature);
+}
+
 ///////////////  cyclic version  ///////////////////////////
-int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_sign_cyclic(uint8_t *signature, const csk_t *csk, const uint8_t *digest) {
-    unsigned char sk[sizeof(sk_t) + 32];
-    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_generate_secretkey_cyclic((sk_t *)sk, csk->pk_seed, csk->sk_seed); // generating classic secret key.
-    return PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_sign(signature, (sk_t *)sk, digest);
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_sign_cyclic(uint8_t *signature, const csk_t *csk, const uint8_t *digest, sk_t *tmp) {
+    sk_t *sk = &tmp[1]; // the last one, followed by the 32 spare bytes
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_generate_secretkey_cyclic(sk, csk->pk_seed, csk->sk_seed, &tmp[0]); // generating classic secret key.
+    return PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_sign(signature, sk, digest);
 }
 
-int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_verify_cyclic(const uint8_t *digest, const uint8_t *signature, const cpk_t *_pk) {
-    unsigned char pk[sizeof(pk_t) + 32];
-    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_cpk_to_pk((pk_t *)pk, _pk); // generating classic public key.
-    return PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_verify(digest, signature, (pk_t *)pk);
+///
+/// @brief Accumulating  x_row[i] * ( sum_j mat[i][j] * x_col[j] )  over the rows of a (block) matrix into y.
+///
+/// The rows are either read from mat or, if mat is NULL, generated with the prng stream st,
+/// one row at a time, so a block generated from the seed is never held in memory as a whole.
+///
+/// @param[in,out] y          - the accumulator, size_batch bytes.
+/// @param[in]     mat        - the matrix, or NULL.
+/// @param[in,out] st         - the prng stream producing the matrix if mat is NULL.
+/// @param[in]     x_row      - the variables of the rows, one gf element per byte.
+/// @param[in]     n_row      - the number of rows.
+/// @param[in]     x_col      - the variables of the columns, one gf element per byte.
+/// @param[in]     n_col      - the number of columns.
+/// @param[in]     is_trimat  - the matrix is upper-triangular, i.e., row i starts at column i.
+/// @param[in]     size_batch - the number of bytes of a batched element.
+///
+static void quad_rows_accu(unsigned char *y, const unsigned char *mat, prng_stream_t *st,
+                           const unsigned char *x_row, unsigned int n_row, const unsigned char *x_col, unsigned int n_col,
+                           unsigned int is_trimat, unsigned int size_batch) {
+    unsigned char row[_V1 * _MAX_O_BYTE];
+    unsigned char tmp[_MAX_O_BYTE];
+
+    for (unsigned int i = 0; i < n_row; i++) {
+        unsigned int j0 = (is_trimat) ? i : 0;
+        const unsigned char *r = mat;
+        if (NULL == mat) {
+            PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_prng_stream_gen(st, row, (n_col - j0) * size_batch);
+            r = row;
+        } else {
+            mat += (n_col - j0) * size_batch;
+        }
+        memset(tmp, 0, size_batch);
+        for (unsigned int j = j0; j < n_col; j++) {
+            gfv_madd(tmp, r, x_col[j], size_batch);
+            r += size_batch;
+        }
+        gfv_madd(y, tmp, x_row[i], size_batch);
+    }
+}
+
+///
+/// @brief Accumulating the rows of a (block) matrix that is generated from the prng into y.
+///
+static void quad_rows_accu_prng(unsigned char *y, prng_t *prng, unsigned long n_byte,
+                                const unsigned char *x_row, unsigned int n_row, const unsigned char *x_col, unsigned int n_col,
+                                unsigned int is_trimat, unsigned int size_batch) {
+    prng_stream_t st;
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_prng_stream_start(&st, prng, n_byte);
+    quad_rows_accu(y, NULL, &st, x_row, n_row, x_col, n_col, is_trimat, size_batch);
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_prng_stream_end(&st);
+}
+
+int PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_rainbow_verify_cyclic(const uint8_t *digest, const uint8_t *signature, const cpk_t *pk) {
+    // Evaluating the public map block by block, in the order the blocks are stored in cpk_t or
+    // generated from pk_seed, instead of expanding the classic public key first.
+    // The terms of layer 1 go to digest_ck[0.._O1_BYTE) and those of layer 2 to the rest.
+    unsigned char x[_PUB_N];
+    for (unsigned int i = 0; i < _PUB_N; i++) {
+        x[i] = gfv_get_ele(signature, i);
+    }
+    const unsigned char *x_v1 = x;
+    const unsigned char *x_o1 = x + _V1;
+    const unsigned char *x_o2 = x + _V1 + _O1;
+
+    unsigned char digest_ck[_PUB_M_BYTE] = {0};
+    unsigned char *y_l1 = digest_ck;
+    unsigned char *y_l2 = digest_ck + _O1_BYTE;
+
+    prng_t prng0;
+    PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_prng_set(&prng0, pk->pk_seed, LEN_PKSEED);
+
+    // layer 1: l1_Q1 and l1_Q2 from the prng, l1_Q3, l1_Q5, l1_Q6, l1_Q9 from the key
+    quad_rows_accu_prng(y_l1, &prng0, _O1_BYTE * N_TRIANGLE_TERMS(_V1), x_v1, _V1, x_v1, _V1, 1, _O1_BYTE);
+    quad_rows_accu_prng(y_l1, &prng0, _O1_BYTE * _V1 * _O1, x_v1, _V1, x_o1, _O1, 0, _O1_BYTE);
+    quad_rows_accu(y_l1, pk->l1_Q3, NULL, x_v1, _V1, x_o2, _O2, 0, _O1_BYTE);
+    quad_rows_accu(y_l1, pk->l1_Q5, NULL, x_o1, _O1, x_o1, _O1, 1, _O1_BYTE);
+    quad_rows_accu(y_l1, pk->l1_Q6, NULL, x_o1, _O1, x_o2, _O2, 0, _O1_BYTE);
+    quad_rows_accu(y_l1, pk->l1_Q9, NULL, x_o2, _O2, x_o2, _O2, 1, _O1_BYTE);
+
+    // layer 2: l2_Q1, l2_Q2, l2_Q3, l2_Q5, l2_Q6 from the prng, l2_Q9 from the key
+    quad_rows_accu_prng(y_l2, &prng0, _O2_BYTE * N_TRIANGLE_TERMS(_V1), x_v1, _V1, x_v1, _V1, 1, _O2_BYTE);
+    quad_rows_accu_prng(y_l2, &prng0, _O2_BYTE * _V1 * _O1, x_v1, _V1, x_o1, _O1, 0, _O2_BYTE);
+    quad_rows_accu_prng(y_l2, &prng0, _O2_BYTE * _V1 * _O2, x_v1, _V1, x_o2, _O2, 0, _O2_BYTE);
+    quad_rows_accu_prng(y_l2, &prng0, _O2_BYTE * N_TRIANGLE_TERMS(_O1), x_o1, _O1, x_o1, _O1, 1, _O2_BYTE);
+    quad_rows_accu_prng(y_l2, &prng0, _O2_BYTE * _O1 * _O2, x_o1, _O1, x_o2, _O2, 0, _O2_BYTE);
+    quad_rows_accu(y_l2, pk->l2_Q9, NULL, x_o2, _O2, x_o2, _O2, 1, _O2_BYTE);
+
+    memset(&prng0, 0, sizeof(prng_t));
+    return check_digest(digest_ck, digest, signature);
 }
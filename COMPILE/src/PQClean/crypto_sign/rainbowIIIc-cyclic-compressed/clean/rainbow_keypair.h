@@ -76,8 +76,9 @@ typedef struct rainbow_secretkey_cyclic {
 /// @param[out] sk        - the secret key.
 /// @param[in]  pk_seed   - seed for generating parts of public key.
 /// @param[in]  sk_seed   - seed for generating secret key.
+/// @param[in]  tmp       - scratch memory for three sk_t.
 ///
-void PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_generate_keypair_cyclic(cpk_t *pk, sk_t *sk, const unsigned char *pk_seed, const unsigned char *sk_seed);
+void PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_generate_keypair_cyclic(cpk_t *pk, sk_t *sk, const unsigned char *pk_seed, const unsigned char *sk_seed, sk_t *tmp);
 
 ///
 /// @brief Generate compressed key pairs for cyclic rainbow.
@@ -86,8 +87,9 @@ void PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_generate_keypair_cyclic(cpk_t *pk
 /// @param[out] sk        - the compressed secret key.
 /// @param[in]  pk_seed   - seed for generating parts of the public key.
 /// @param[in]  sk_seed   - seed for generating the secret key.
+/// @param[in]  tmp       - scratch memory for four sk_t.
 ///
-void PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_generate_compact_keypair_cyclic(cpk_t *pk, csk_t *sk, const unsigned char *pk_seed, const unsigned char *sk_seed);
+void PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_generate_compact_keypair_cyclic(cpk_t *pk, csk_t *sk, const unsigned char *pk_seed, const unsigned char *sk_seed, sk_t *tmp);
 
 ///
 /// @brief Generate secret key for cyclic rainbow.
@@ -95,8 +97,9 @@ void PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_generate_compact_keypair_cyclic(c
 /// @param[out] sk        - the secret key.
 /// @param[in]  pk_seed   - seed for generating parts of the pbulic key.
 /// @param[in]  sk_seed   - seed for generating the secret key.
+/// @param[in]  tmp       - scratch memory for one sk_t.
 ///
-void PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_generate_secretkey_cyclic(sk_t *sk, const unsigned char *pk_seed, const unsigned char *sk_seed);
+void PQCLEAN_RAINBOWIIICCYCLICCOMPRESSED_CLEAN_generate_secretkey_cyclic(sk_t *sk, const unsigned char *pk_seed, const unsigned char *sk_seed, sk_t *tmp);
 
 ////////////////////////////////////
 
@@ -0,0 +1,127 @@
+/// @file utils_prng.c
+/// @brief The implementation of PRNG related functions.
+///
+
+#include "utils_prng.h"
+#include "aes.h"
+#include "randombytes.h"
+#include "utils_hash.h"
+#include <stdlib.h>
+#include <string.h>
+
+static void prng_update(const unsigned char *provided_data,
+                        unsigned char *Key,
+                        unsigned char *V) {
+    unsigned char temp[48];
+    aes256ctx ctx;
+    aes256_keyexp(&ctx, Key);
+    for (int i = 0; i < 3; i++) {
+        //increment V
+        for (int j = 15; j >= 0; j--) {
+            if (V[j] == 0xff) {
+                V[j] = 0x00;
+            } else {
+                V[j]++;
+                break;
+            }
+        }
+        aes256_ecb(temp + 16 * i, V, 1, &ctx);
+    }
+    if (provided_data != NULL) {
+        for (int i = 0; i < 48; i++) {
+            temp[i] ^= provided_data[i];
+        }
+    }
+    memcpy(Key, temp, 32);
+    memcpy(V, temp + 32, 16);
+}
+static void randombytes_init_with_state(prng_t *state,
+                                        unsigned char *entropy_input_48bytes) {
+    memset(state->Key, 0x00, 32);
+    memset(state->V, 0x00, 16);
+    prng_update(entropy_input_48bytes, state->Key, state->V);
+}
+
+static void prng_stream_refill(prng_stream_t *st) {
+    unsigned char ctr[AES_BLOCKBYTES * PRNG_BATCH_BLOCKS] = {0};
+    unsigned long nblocks = (st->remaining + AES_BLOCKBYTES - 1) / AES_BLOCKBYTES;
+    if (nblocks > PRNG_BATCH_BLOCKS) {
+        nblocks = PRNG_BATCH_BLOCKS;
+    }
+
+    for (unsigned long k = 0; k < nblocks; k++) {
+        //increment V
+        for (int j = 15; j >= 0; j--) {
+            if (st->prng->V[j] == 0xff) {
+                st->prng->V[j] = 0x00;
+            } else {
+                st->prng->V[j]++;
+                break;
+            }
+        }
+        memcpy(ctr + AES_BLOCKBYTES * k, st->prng->V, AES_BLOCKBYTES);
+    }
+    aes256_ecb(st->buf, ctr, nblocks, &st->ctx);
+
+    st->buf_len = (unsigned int)(AES_BLOCKBYTES * nblocks);
+    if (st->buf_len > st->remaining) {
+        st->buf_len = (unsigned int)st->remaining;
+    }
+    st->buf_pos = 0;
+    st->remaining -= st->buf_len;
+}
+
+int PQCLEAN_RAINBOWIIICCYCLIC_AVX2_prng_set(prng_t *ctx, const void *prng_seed, unsigned long prng_seedlen) {
+    unsigned char seed[48];
+    if (prng_seedlen >= 48) {
+        memcpy(seed, prng_seed, 48);
+    } else {
+        memcpy(seed, prng_seed, prng_seedlen);
+        PQCLEAN_RAINBOWIIICCYCLIC_AVX2_hash_msg(seed + prng_seedlen, 48 - (unsigned)prng_seedlen, (const unsigned char *)prng_seed, prng_seedlen);
+    }
+
+    randombytes_init_with_state(ctx, seed);
+
+    return 0;
+}
+
+int PQCLEAN_RAINBOWIIICCYCLIC_AVX2_prng_gen(prng_t *ctx, unsigned char *out, unsigned long outlen) {
+    prng_stream_t st;
+    PQCLEAN_RAINBOWIIICCYCLIC_AVX2_prng_stream_start(&st, ctx, outlen);
+    PQCLEAN_RAINBOWIIICCYCLIC_AVX2_prng_stream_gen(&st, out, outlen);
+    PQCLEAN_RAINBOWIIICCYCLIC_AVX2_prng_stream_end(&st);
+    return 0;
+}
+
+void PQCLEAN_RAINBOWIIICCYCLIC_AVX2_prng_stream_start(prng_stream_t *st, prng_t *ctx, unsigned long outlen) {
+    st->prng = ctx;
+    aes256_keyexp(&st->ctx, ctx->Key);
+    st->remaining = outlen;
+    st->buf_pos = 0;
+    st->buf_len = 0;
+}
+
+void PQCLEAN_RAINBOWIIICCYCLIC_AVX2_prng_stream_gen(prng_stream_t *st, unsigned char *out, unsigned long outlen) {
+    while (outlen > 0) {
+        if (st->buf_pos == st->buf_len) {
+            if (st->remaining == 0) {
+                break;
+            }
+            prng_stream_refill(st);
+        }
+        unsigned long n = st->buf_len - st->buf_pos;
+        if (n > outlen) {
+            n = outlen;
+        }
+        memcpy(out, st->buf + st->buf_pos, n);
+        st->buf_pos += (unsigned int)n;
+        out += n;
+        outlen -= n;
+    }
+}
+
+void PQCLEAN_RAINBOWIIICCYCLIC_AVX2_prng_stream_end(prng_stream_t *st) {
+    prng_update(NULL, st->prng->Key, st->prng->V);
+    aes256_ctx_release(&st->ctx);
+    memset(st->buf, 0, sizeof(st->buf));
+}
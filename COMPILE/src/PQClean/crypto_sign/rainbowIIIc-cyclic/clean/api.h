@@ -6,6 +6,8 @@
 
 #define PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_CRYPTO_SECRETKEYBYTES 511448
 #define PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_CRYPTO_PUBLICKEYBYTES 206744
+#define PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_CRYPTO_EXPANDEDPUBLICKEYBYTES 710640
+#define PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_CRYPTO_WORKSPACEBYTES 1534400    // scratch of the _ws functions, see below
 #define PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_CRYPTO_BYTES 156
 #define PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_CRYPTO_ALGNAME "RAINBOW(256,68,36,36) - cyclic"
 
@@ -20,6 +22,18 @@ int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_crypto_sign_verify(
     const uint8_t *sig, size_t siglen,
     const uint8_t *m, size_t mlen, const uint8_t *pk);
 
+// Expands a cyclic public key (pk) into the classic public key (epk) of
+// exactly CRYPTO_EXPANDEDPUBLICKEYBYTES bytes, so that repeated verifications
+// with the same key do not regenerate it from the seed. The expanded key has
+// no alignment requirements; it may be kept in memory or written to a file
+// and mmap()ed read-only.
+int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk);
+
+// Verifies as crypto_sign_verify(), with an expanded public key (epk).
+int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_crypto_sign_verify_expanded(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *epk);
+
 int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_crypto_sign(uint8_t *sm, size_t *smlen,
         const uint8_t *m, size_t mlen,
         const uint8_t *sk);
@@ -28,5 +42,18 @@ int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_crypto_sign_open(uint8_t *m, size_t *mlen,
         const uint8_t *sm, size_t smlen,
         const uint8_t *pk);
 
+// Same as above, but the large temporaries of the key generation live in ws, which
+// must hold CRYPTO_WORKSPACEBYTES bytes (64-byte alignment keeps it off shared cache
+// lines). Signing has no large temporaries and ignores ws. A workspace can be reused
+// by any number of calls, but not by concurrent ones.
+int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_crypto_sign_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws);
+
+int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_crypto_sign_signature_ws(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk, void *ws);
+
+int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_crypto_sign_ws(uint8_t *sm, size_t *smlen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *sk, void *ws);
 
 #endif
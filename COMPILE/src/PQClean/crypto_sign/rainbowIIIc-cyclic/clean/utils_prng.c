@@ -42,38 +42,33 @@ static void randombytes_init_with_state(prng_t *state,
     prng_update(entropy_input_48bytes, state->Key, state->V);
 }
 
-static int randombytes_with_state(prng_t *state,
-                                  unsigned char *x,
-                                  size_t xlen) {
-
-    unsigned char block[16];
-    int i = 0;
-
-    aes256ctx ctx;
-    aes256_keyexp(&ctx, state->Key);
+static void prng_stream_refill(prng_stream_t *st) {
+    unsigned char ctr[AES_BLOCKBYTES * PRNG_BATCH_BLOCKS] = {0};
+    unsigned long nblocks = (st->remaining + AES_BLOCKBYTES - 1) / AES_BLOCKBYTES;
+    if (nblocks > PRNG_BATCH_BLOCKS) {
+        nblocks = PRNG_BATCH_BLOCKS;
+    }
 
-    while (xlen > 0) {
+    for (unsigned long k = 0; k < nblocks; k++) {
         //increment V
         for (int j = 15; j >= 0; j--) {
-            if (state->V[j] == 0xff) {
-                state->V[j] = 0x00;
+            if (st->prng->V[j] == 0xff) {
+                st->prng->V[j] = 0x00;
             } else {
-                state->V[j]++;
+                st->prng->V[j]++;
                 break;
             }
         }
-        aes256_ecb(block, state->V, 1, &ctx);
-        if (xlen > 15) {
-            memcpy(x + i, block, 16);
-            i += 16;
-            xlen -= 16;
-        } else {
-            memcpy(x + i, block, xlen);
-            xlen = 0;
-        }
+        memcpy(ctr + AES_BLOCKBYTES * k, st->prng->V, AES_BLOCKBYTES);
     }
-    prng_update(NULL, state->Key, state->V);
-    return 0;
+    aes256_ecb(st->buf, ctr, nblocks, &st->ctx);
+
+    st->buf_len = (unsigned int)(AES_BLOCKBYTES * nblocks);
+    if (st->buf_len > st->remaining) {
+        st->buf_len = (unsigned int)st->remaining;
+    }
+    st->buf_pos = 0;
+    st->remaining -= st->buf_len;
 }
 
 int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_prng_set(prng_t *ctx, const void *prng_seed, unsigned long prng_seedlen) {
@@ -91,5 +86,42 @@ int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_prng_set(prng_t *ctx, const void *prng_seed,
 }
 
 int PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_prng_gen(prng_t *ctx, unsigned char *out, unsigned long outlen) {
-    return randombytes_with_state(ctx, out, outlen);
+    prng_stream_t st;
+    PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_prng_stream_start(&st, ctx, outlen);
+    PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_prng_stream_gen(&st, out, outlen);
+    PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_prng_stream_end(&st);
+    return 0;
+}
+
+void PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_prng_stream_start(prng_stream_t *st, prng_t *ctx, unsigned long outlen) {
+    st->prng = ctx;
+    aes256_keyexp(&st->ctx, ctx->Key);
+    st->remaining = outlen;
+    st->buf_pos = 0;
+    st->buf_len = 0;
+}
+
+void PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_prng_stream_gen(prng_stream_t *st, unsigned char *out, unsigned long outlen) {
+    while (outlen > 0) {
+        if (st->buf_pos == st->buf_len) {
+            if (st->remaining == 0) {
+                break;
+            }
+            prng_stream_refill(st);
+        }
+        unsigned long n = st->buf_len - st->buf_pos;
+        if (n > outlen) {
+            n = outlen;
+        }
+        memcpy(out, st->buf + st->buf_pos, n);
+        st->buf_pos += (unsigned int)n;
+        out += n;
+        outlen -= n;
+    }
+}
+
+void PQCLEAN_RAINBOWIIICCYCLIC_CLEAN_prng_stream_end(prng_stream_t *st) {
+    prng_update(NULL, st->prng->Key, st->prng->V);
+    aes256_ctx_release(&st->ctx);
+    memset(st->buf, 0, sizeof(st->buf));
 }
@@ -0,0 +1,114 @@
+#include "blas.h"
+#include "gf.h"
+
+#include <immintrin.h>
+#include <stddef.h>
+#include <string.h>
+
+///
+/// Multiplication by a fixed b is GF(2)-linear, so the table T[x] = b * x is
+/// the XOR of the rows below that are selected by the bits of b. Row i holds
+/// (1 << i) * x. The table is assembled with masks, so b is never used as a
+/// memory index.
+///
+static const uint8_t gf16_mul_basis[4][16] = {
+    {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f},
+    {0x00, 0x02, 0x03, 0x01, 0x08, 0x0a, 0x0b, 0x09, 0x0c, 0x0e, 0x0f, 0x0d, 0x04, 0x06, 0x07, 0x05},
+    {0x00, 0x04, 0x08, 0x0c, 0x06, 0x02, 0x0e, 0x0a, 0x0b, 0x0f, 0x03, 0x07, 0x0d, 0x09, 0x05, 0x01},
+    {0x00, 0x08, 0x0c, 0x04, 0x0b, 0x03, 0x07, 0x0f, 0x0d, 0x05, 0x01, 0x09, 0x06, 0x0e, 0x0a, 0x02}
+};
+
+/// @brief the tables for multiplying the low (tab_l) and high (tab_h) nibbles by b, repeated in both 128-bit lanes.
+static inline void gf16_multab(__m256i *tab_l, __m256i *tab_h, uint8_t b) {
+    __m256i bb = _mm256_set1_epi8((char) b);
+    __m256i tab = _mm256_setzero_si256();
+    for (int i = 0; i < 4; i++) {
+        __m256i bit = _mm256_set1_epi8((char) (1 << i));
+        __m256i mask = _mm256_cmpeq_epi8(_mm256_and_si256(bb, bit), bit);
+        __m256i row = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) gf16_mul_basis[i]));
+        tab = _mm256_xor_si256(tab, _mm256_and_si256(mask, row));
+    }
+    *tab_l = tab;
+    *tab_h = _mm256_slli_epi16(tab, 4);
+}
+
+static inline __m256i gf16_mul_avx2(__m256i a, __m256i tab_l, __m256i tab_h) {
+    __m256i mask_f = _mm256_set1_epi8(0x0f);
+    __m256i a_l = _mm256_and_si256(a, mask_f);
+    __m256i a_h = _mm256_and_si256(_mm256_srli_epi16(a, 4), mask_f);
+    return _mm256_xor_si256(_mm256_shuffle_epi8(tab_l, a_l), _mm256_shuffle_epi8(tab_h, a_h));
+}
+
+void PQCLEAN_RAINBOWIACLASSIC_AVX2_gf256v_predicated_add(uint8_t *accu_b, uint8_t predicate, const uint8_t *a, size_t _num_byte) {
+    __m256i pr_u8 = _mm256_set1_epi8((char) ((uint8_t) 0 - predicate));
+    size_t i = 0;
+    for (; i + 32 <= _num_byte; i += 32) {
+        __m256i bi = _mm256_loadu_si256((const __m256i *) (accu_b + i));
+        __m256i ai = _mm256_loadu_si256((const __m256i *) (a + i));
+        _mm256_storeu_si256((__m256i *) (accu_b + i), _mm256_xor_si256(bi, _mm256_and_si256(ai, pr_u8)));
+    }
+    uint8_t pr = (uint8_t) ((uint8_t) 0 - predicate);
+    for (; i < _num_byte; i++) {
+        accu_b[i] ^= (a[i] & pr);
+    }
+}
+
+void PQCLEAN_RAINBOWIACLASSIC_AVX2_gf256v_add(uint8_t *accu_b, const uint8_t *a, size_t _num_byte) {
+    size_t i = 0;
+    for (; i + 32 <= _num_byte; i += 32) {
+        __m256i bi = _mm256_loadu_si256((const __m256i *) (accu_b + i));
+        __m256i ai = _mm256_loadu_si256((const __m256i *) (a + i));
+        _mm256_storeu_si256((__m256i *) (accu_b + i), _mm256_xor_si256(bi, ai));
+    }
+    for (; i < _num_byte; i++) {
+        accu_b[i] ^= a[i];
+    }
+}
+
+
+
+void PQCLEAN_RAINBOWIACLASSIC_AVX2_gf16v_mul_scalar(uint8_t *a, uint8_t gf16_b, size_t _num_byte) {
+    __m256i tab_l, tab_h;
+    gf16_multab(&tab_l, &tab_h, gf16_b);
+    size_t i = 0;
+    for (; i + 32 <= _num_byte; i += 32) {
+        __m256i ai = _mm256_loadu_si256((const __m256i *) (a + i));
+        _mm256_storeu_si256((__m256i *) (a + i), gf16_mul_avx2(ai, tab_l, tab_h));
+    }
+    if (i < _num_byte) {
+        uint8_t tmp[32] = {0};
+        memcpy(tmp, a + i, _num_byte - i);
+        __m256i ai = _mm256_loadu_si256((const __m256i *) tmp);
+        _mm256_storeu_si256((__m256i *) tmp, gf16_mul_avx2(ai, tab_l, tab_h));
+        memcpy(a + i, tmp, _num_byte - i);
+    }
+}
+
+void PQCLEAN_RAINBOWIACLASSIC_AVX2_gf16v_madd(uint8_t *accu_c, const uint8_t *a, uint8_t gf16_b, size_t _num_byte) {
+    __m256i tab_l, tab_h;
+    gf16_multab(&tab_l, &tab_h, gf16_b);
+    size_t i = 0;
+    for (; i + 32 <= _num_byte; i += 32) {
+        __m256i ai = _mm256_loadu_si256((const __m256i *) (a + i));
+        __m256i ci = _mm256_loadu_si256((const __m256i *) (accu_c + i));
+        _mm256_storeu_si256((__m256i *) (accu_c + i), _mm256_xor_si256(ci, gf16_mul_avx2(ai, tab_l, tab_h)));
+    }
+    if (i < _num_byte) {
+        uint8_t tmp[32] = {0};
+        memcpy(tmp, a + i, _num_byte - i);
+        __m256i ai = _mm256_loadu_si256((const __m256i *) tmp);
+        _mm256_storeu_si256((__m256i *) tmp, gf16_mul_avx2(ai, tab_l, tab_h));
+        for (size_t j = 0; i + j < _num_byte; j++) {
+            accu_c[i + j] ^= tmp[j];
+        }
+    }
+}
+
+uint8_t PQCLEAN_RAINBOWIACLASSIC_AVX2_gf16v_dot(const uint8_t *a, const uint8_t *b, size_t _num_byte) {
+    uint8_t r = 0;
+    for (size_t i = 0; i < _num_byte; i++) {
+        r ^= PQCLEAN_RAINBOWIACLASSIC_AVX2_gf16_mul(a[i], b[i]);
+    }
+    return r;
+}
+
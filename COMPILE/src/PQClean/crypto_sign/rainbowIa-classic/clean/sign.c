@@ -7,19 +7,32 @@
 #include "rainbow.h"
 #include "rainbow_config.h"
 #include "rainbow_keypair.h"
+#include "rainbow_keypair_computation.h"
 #include "randombytes.h"
 #include "utils_hash.h"
 #include <stdlib.h>
 #include <string.h>
 
-int PQCLEAN_RAINBOWIACLASSIC_CLEAN_crypto_sign_keypair(unsigned char *pk, unsigned char *sk) {
+// Scratch of the _ws functions, carved from the caller's workspace
+typedef ext_cpk_t keypair_workspace;
+
+// CRYPTO_WORKSPACEBYTES in api.h must cover it
+typedef char workspace_keypair_fits[sizeof(keypair_workspace) <= PQCLEAN_RAINBOWIACLASSIC_CLEAN_CRYPTO_WORKSPACEBYTES ? 1 : -1];
+
+int PQCLEAN_RAINBOWIACLASSIC_CLEAN_crypto_sign_keypair_ws(unsigned char *pk, unsigned char *sk, void *ws) {
     unsigned char sk_seed[LEN_SKSEED] = {0};
     randombytes(sk_seed, LEN_SKSEED);
 
-    PQCLEAN_RAINBOWIACLASSIC_CLEAN_generate_keypair((pk_t *)pk, (sk_t *)sk, sk_seed);
+    PQCLEAN_RAINBOWIACLASSIC_CLEAN_generate_keypair((pk_t *)pk, (sk_t *)sk, sk_seed, (keypair_workspace *)ws);
     return 0;
 }
 
+int PQCLEAN_RAINBOWIACLASSIC_CLEAN_crypto_sign_keypair(unsigned char *pk, unsigned char *sk) {
+    // Without a caller-provided workspace the temporaries live on the stack
+    keypair_workspace ws;
+    return PQCLEAN_RAINBOWIACLASSIC_CLEAN_crypto_sign_keypair_ws(pk, sk, &ws);
+}
+
 int PQCLEAN_RAINBOWIACLASSIC_CLEAN_crypto_sign(unsigned char *sm, size_t *smlen, const unsigned char *m, size_t mlen, const unsigned char *sk) {
     unsigned char digest[_HASH_LEN];
 
@@ -72,3 +85,15 @@ int PQCLEAN_RAINBOWIACLASSIC_CLEAN_crypto_sign_verify(
     PQCLEAN_RAINBOWIACLASSIC_CLEAN_hash_msg(digest, _HASH_LEN, m, mlen);
     return PQCLEAN_RAINBOWIACLASSIC_CLEAN_rainbow_verify(digest, sig, (const pk_t *)pk);
 }
+
+int PQCLEAN_RAINBOWIACLASSIC_CLEAN_crypto_sign_signature_ws(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk, void *ws) {
+    (void)ws; // signing has no large temporaries
+    return PQCLEAN_RAINBOWIACLASSIC_CLEAN_crypto_sign_signature(sig, siglen, m, mlen, sk);
+}
+
+int PQCLEAN_RAINBOWIACLASSIC_CLEAN_crypto_sign_ws(unsigned char *sm, size_t *smlen, const unsigned char *m, size_t mlen, const unsigned char *sk, void *ws) {
+    (void)ws;
+    return PQCLEAN_RAINBOWIACLASSIC_CLEAN_crypto_sign(sm, smlen, m, mlen, sk);
+}
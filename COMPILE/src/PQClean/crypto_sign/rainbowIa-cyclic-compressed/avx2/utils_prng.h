@@ -0,0 +1,42 @@
+#ifndef _UTILS_PRNG_H_
+#define _UTILS_PRNG_H_
+/// @file utils_prng.h
+/// @brief the interface for adapting PRNG functions.
+///
+///
+
+#include "aes.h"
+#include "randombytes.h"
+
+typedef struct {
+    unsigned char Key[32];
+    unsigned char V[16];
+} prng_t;
+
+/// number of AES blocks encrypted together by the PRNG.
+#define PRNG_BATCH_BLOCKS 32
+
+///
+/// @brief State for producing the output of one PQCLEAN_RAINBOWIACYCLICCOMPRESSED_AVX2_prng_gen() call in pieces.
+///
+/// PQCLEAN_RAINBOWIACYCLICCOMPRESSED_AVX2_prng_gen(ctx, out, outlen) gives the same bytes as PQCLEAN_RAINBOWIACYCLICCOMPRESSED_AVX2_prng_stream_start(st, ctx, outlen),
+/// followed by PQCLEAN_RAINBOWIACYCLICCOMPRESSED_AVX2_prng_stream_gen() calls whose lengths add up to outlen, followed by
+/// PQCLEAN_RAINBOWIACYCLICCOMPRESSED_AVX2_prng_stream_end(st). This lets a caller consume a long output in cache-sized pieces.
+///
+typedef struct {
+    prng_t *prng;
+    aes256ctx ctx;
+    unsigned long remaining;                          ///< bytes not yet encrypted
+    unsigned char buf[AES_BLOCKBYTES * PRNG_BATCH_BLOCKS]; ///< encrypted but not yet consumed bytes
+    unsigned int buf_pos;
+    unsigned int buf_len;
+} prng_stream_t;
+
+int PQCLEAN_RAINBOWIACYCLICCOMPRESSED_AVX2_prng_set(prng_t *ctx, const void *prng_seed, unsigned long prng_seedlen);
+int PQCLEAN_RAINBOWIACYCLICCOMPRESSED_AVX2_prng_gen(prng_t *ctx, unsigned char *out, unsigned long outlen);
+
+void PQCLEAN_RAINBOWIACYCLICCOMPRESSED_AVX2_prng_stream_start(prng_stream_t *st, prng_t *ctx, unsigned long outlen);
+void PQCLEAN_RAINBOWIACYCLICCOMPRESSED_AVX2_prng_stream_gen(prng_stream_t *st, unsigned char *out, unsigned long outlen);
+void PQCLEAN_RAINBOWIACYCLICCOMPRESSED_AVX2_prng_stream_end(prng_stream_t *st);
+
+#endif // _UTILS_PRNG_H_
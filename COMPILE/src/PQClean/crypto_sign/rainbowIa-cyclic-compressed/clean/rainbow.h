@@ -34,8 +34,9 @@ int PQCLEAN_RAINBOWIACYCLICCOMPRESSED_CLEAN_rainbow_verify(const uint8_t *digest
 /// @param[out] signature - the signature.
 /// @param[in]  sk        - the compressed secret key.
 /// @param[in]  digest    - the digest.
+/// @param[in]  tmp       - scratch memory for two sk_t and 32 more bytes.
 ///
-int PQCLEAN_RAINBOWIACYCLICCOMPRESSED_CLEAN_rainbow_sign_cyclic(uint8_t *signature, const csk_t *sk, const uint8_t *digest);
+int PQCLEAN_RAINBOWIACYCLICCOMPRESSED_CLEAN_rainbow_sign_cyclic(uint8_t *signature, const csk_t *sk, const uint8_t *digest, sk_t *tmp);
 
 ///
 /// @brief Verifying function for cyclic public keys.
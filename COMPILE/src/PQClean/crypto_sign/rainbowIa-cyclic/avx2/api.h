@@ -0,0 +1,59 @@
+#ifndef PQCLEAN_RAINBOWIACYCLIC_AVX2_API_H
+#define PQCLEAN_RAINBOWIACYCLIC_AVX2_API_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PQCLEAN_RAINBOWIACYCLIC_AVX2_CRYPTO_SECRETKEYBYTES 92960
+#define PQCLEAN_RAINBOWIACYCLIC_AVX2_CRYPTO_PUBLICKEYBYTES 58144
+#define PQCLEAN_RAINBOWIACYCLIC_AVX2_CRYPTO_EXPANDEDPUBLICKEYBYTES 148992
+#define PQCLEAN_RAINBOWIACYCLIC_AVX2_CRYPTO_WORKSPACEBYTES 278912    // scratch of the _ws functions, see below
+#define PQCLEAN_RAINBOWIACYCLIC_AVX2_CRYPTO_BYTES 64
+#define PQCLEAN_RAINBOWIACYCLIC_AVX2_CRYPTO_ALGNAME "RAINBOW(16,32,32,32) - cyclic"
+
+int PQCLEAN_RAINBOWIACYCLIC_AVX2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
+
+
+int PQCLEAN_RAINBOWIACYCLIC_AVX2_crypto_sign_signature(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk);
+
+int PQCLEAN_RAINBOWIACYCLIC_AVX2_crypto_sign_verify(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *pk);
+
+// Expands a cyclic public key (pk) into the classic public key (epk) of
+// exactly CRYPTO_EXPANDEDPUBLICKEYBYTES bytes, so that repeated verifications
+// with the same key do not regenerate it from the seed. The expanded key has
+// no alignment requirements; it may be kept in memory or written to a file
+// and mmap()ed read-only.
+int PQCLEAN_RAINBOWIACYCLIC_AVX2_crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk);
+
+// Verifies as crypto_sign_verify(), with an expanded public key (epk).
+int PQCLEAN_RAINBOWIACYCLIC_AVX2_crypto_sign_verify_expanded(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *epk);
+
+int PQCLEAN_RAINBOWIACYCLIC_AVX2_crypto_sign(uint8_t *sm, size_t *smlen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *sk);
+
+int PQCLEAN_RAINBOWIACYCLIC_AVX2_crypto_sign_open(uint8_t *m, size_t *mlen,
+        const uint8_t *sm, size_t smlen,
+        const uint8_t *pk);
+
+// Same as above, but the large temporaries of the key generation live in ws, which
+// must hold CRYPTO_WORKSPACEBYTES bytes (64-byte alignment keeps it off shared cache
+// lines). Signing has no large temporaries and ignores ws. A workspace can be reused
+// by any number of calls, but not by concurrent ones.
+int PQCLEAN_RAINBOWIACYCLIC_AVX2_crypto_sign_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws);
+
+int PQCLEAN_RAINBOWIACYCLIC_AVX2_crypto_sign_signature_ws(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk, void *ws);
+
+int PQCLEAN_RAINBOWIACYCLIC_AVX2_crypto_sign_ws(uint8_t *sm, size_t *smlen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *sk, void *ws);
+
+#endif
@@ -89,7 +89,7 @@ static void obsfucate_l1_polys(unsigned char *l1_polys, const unsigned char *l2_
 
 
 /////////////////////   Cyclic   //////////////////////////////////
-void PQCLEAN_RAINBOWIACYCLIC_CLEAN_generate_keypair_cyclic(cpk_t *pk, sk_t *sk, const unsigned char *pk_seed, const unsigned char *sk_seed) {
+void PQCLEAN_RAINBOWIACYCLIC_CLEAN_generate_keypair_cyclic(cpk_t *pk, sk_t *sk, const unsigned char *pk_seed, const unsigned char *sk_seed, sk_t *tmp) {
     memcpy(pk->pk_seed, pk_seed, LEN_PKSEED);
     memcpy(sk->sk_seed, sk_seed, LEN_SKSEED);
 
@@ -104,8 +104,7 @@ void PQCLEAN_RAINBOWIACYCLIC_CLEAN_generate_keypair_cyclic(cpk_t *pk, sk_t *sk,
     calculate_t4(sk->t4, sk->t1, sk->t3); // t2 <- t4
 
     // prng for pk
-    sk_t inst_Qs;
-    sk_t *Qs = &inst_Qs;
+    sk_t *Qs = &tmp[0];
     prng_t *prng1 = &prng;
     PQCLEAN_RAINBOWIACYCLIC_CLEAN_prng_set(prng1, pk_seed, LEN_PKSEED);
     generate_B1_B2(Qs->l1_F1, prng1); // generating l1_Q1, l1_Q2, l2_Q1, l2_Q2, l2_Q3, l2_Q5, l2_Q6
@@ -118,7 +117,7 @@ void PQCLEAN_RAINBOWIACYCLIC_CLEAN_generate_keypair_cyclic(cpk_t *pk, sk_t *sk,
     unsigned char t4[sizeof(sk->t4)];
     memcpy(t4, sk->t4, _V1_BYTE * _O2);                      // temporarily store t4
     memcpy(sk->t4, t2, _V1_BYTE * _O2);                      // restore t2
-    PQCLEAN_RAINBOWIACYCLIC_CLEAN_calculate_Q_from_F_cyclic(pk, sk, sk); // calculate the rest parts of public key: l1_Q3, l1_Q5, l1_Q6, l1_Q9, l2_Q9
+    PQCLEAN_RAINBOWIACYCLIC_CLEAN_calculate_Q_from_F_cyclic(pk, sk, sk, &tmp[1]); // calculate the rest parts of public key: l1_Q3, l1_Q5, l1_Q6, l1_Q9, l2_Q9
     memcpy(sk->t4, t4, _V1_BYTE * _O2);                      // restore t4
 
     obsfucate_l1_polys(pk->l1_Q3, Qs->l2_F3, _V1 * _O2, sk->s1);
@@ -45,14 +45,17 @@ typedef struct rainbow_secretkey {
 } sk_t;
 
 
+struct rainbow_extend_publickey; // ext_cpk_t, see rainbow_keypair_computation.h
+
 ///
 /// @brief Generate key pairs for classic rainbow.
 ///
 /// @param[out] pk        - the public key.
 /// @param[out] sk        - the secret key.
 /// @param[in]  sk_seed   - seed for generating the secret key.
+/// @param[in]  tmp       - scratch memory for the public key in ext_cpk_t format.
 ///
-void PQCLEAN_RAINBOWVCCLASSIC_CLEAN_generate_keypair(pk_t *pk, sk_t *sk, const unsigned char *sk_seed);
+void PQCLEAN_RAINBOWVCCLASSIC_CLEAN_generate_keypair(pk_t *pk, sk_t *sk, const unsigned char *sk_seed, struct rainbow_extend_publickey *tmp);
 
 
 
@@ -0,0 +1,128 @@
+///  @file  sign.c
+///  @brief the implementations for functions in api.h
+///
+///
+
+#include "api.h"
+#include "rainbow.h"
+#include "rainbow_config.h"
+#include "rainbow_keypair.h"
+#include "rainbow_keypair_computation.h"
+#include "randombytes.h"
+#include "utils_hash.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Scratch of the _ws functions, carved from the caller's workspace. Both hold the
+// expanded secret key.
+typedef struct {
+    sk_t tmp[4];
+} keypair_workspace;
+
+typedef struct {
+    sk_t tmp[2];
+    // rainbow_sign_cyclic() expands the key into tmp[1]; this keeps the 32 bytes of
+    // slack its former sk[sizeof(sk_t) + 32] stack buffer had behind the key
+    unsigned char pad[32];
+} sign_workspace;
+
+// CRYPTO_WORKSPACEBYTES in api.h must cover both
+typedef char workspace_keypair_fits[sizeof(keypair_workspace) <= PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_CRYPTO_WORKSPACEBYTES ? 1 : -1];
+typedef char workspace_sign_fits[sizeof(sign_workspace) <= PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_CRYPTO_WORKSPACEBYTES ? 1 : -1];
+
+int PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_keypair_ws(unsigned char *pk, unsigned char *sk, void *ws) {
+    unsigned char sk_seed[LEN_SKSEED] = {0};
+    randombytes(sk_seed, LEN_SKSEED);
+
+    unsigned char pk_seed[LEN_PKSEED] = {0};
+    randombytes(pk_seed, LEN_PKSEED);
+    PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_generate_compact_keypair_cyclic((cpk_t *)pk, (csk_t *)sk, pk_seed, sk_seed, ((keypair_workspace *)ws)->tmp);
+    return 0;
+}
+
+int PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_keypair(unsigned char *pk, unsigned char *sk) {
+    // Without a caller-provided workspace the temporaries live on the stack
+    keypair_workspace ws;
+    return PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_keypair_ws(pk, sk, &ws);
+}
+
+int PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_ws(unsigned char *sm, size_t *smlen, const unsigned char *m, size_t mlen, const unsigned char *sk, void *ws) {
+    unsigned char digest[_HASH_LEN];
+
+    PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_hash_msg(digest, _HASH_LEN, m, mlen);
+
+    memcpy(sm, m, mlen);
+    smlen[0] = mlen + _SIGNATURE_BYTE;
+
+    return PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_rainbow_sign_cyclic(sm + mlen, (const csk_t *)sk, digest, ((sign_workspace *)ws)->tmp);
+}
+
+int PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign(unsigned char *sm, size_t *smlen, const unsigned char *m, size_t mlen, const unsigned char *sk) {
+    sign_workspace ws;
+    return PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_ws(sm, smlen, m, mlen, sk, &ws);
+}
+
+int PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_open(unsigned char *m, size_t *mlen, const unsigned char *sm, size_t smlen, const unsigned char *pk) {
+    int rc;
+    if (_SIGNATURE_BYTE > smlen) {
+        rc = -1;
+    } else {
+        *mlen = smlen - _SIGNATURE_BYTE;
+
+        unsigned char digest[_HASH_LEN];
+        PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_hash_msg(digest, _HASH_LEN, sm, *mlen);
+
+        rc = PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_rainbow_verify_cyclic(digest, sm + mlen[0], (const cpk_t *)pk);
+    }
+    if (!rc) {
+        memmove(m, sm, smlen - _SIGNATURE_BYTE);
+    } else { // bad signature
+        *mlen = (size_t) -1;
+        memset(m, 0, smlen);
+    }
+    return rc;
+}
+
+int PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_signature_ws(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk, void *ws) {
+    unsigned char digest[_HASH_LEN];
+
+    PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_hash_msg(digest, _HASH_LEN, m, mlen);
+    *siglen = _SIGNATURE_BYTE;
+    return PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_rainbow_sign_cyclic(sig, (const csk_t *)sk, digest, ((sign_workspace *)ws)->tmp);
+}
+
+int PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_signature(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    sign_workspace ws;
+    return PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_signature_ws(sig, siglen, m, mlen, sk, &ws);
+}
+
+int PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_verify(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *pk) {
+    if (siglen != _SIGNATURE_BYTE) {
+        return -1;
+    }
+    unsigned char digest[_HASH_LEN];
+    PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_hash_msg(digest, _HASH_LEN, m, mlen);
+    return PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_rainbow_verify_cyclic(digest, sig, (const cpk_t *)pk);
+}
+
+int PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk) {
+    PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_cpk_to_pk((pk_t *)epk, (const cpk_t *)pk);
+    return 0;
+}
+
+int PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_crypto_sign_verify_expanded(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *epk) {
+    if (siglen != _SIGNATURE_BYTE) {
+        return -1;
+    }
+    unsigned char digest[_HASH_LEN];
+    PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_hash_msg(digest, _HASH_LEN, m, mlen);
+    return PQCLEAN_RAINBOWVCCYCLICCOMPRESSED_AVX2_rainbow_verify(digest, sig, (const pk_t *)epk);
+}
@@ -64,6 +64,17 @@ int PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_crypto_sign_verify(
     const uint8_t *sig, size_t siglen,
     const uint8_t *m, size_t mlen, const uint8_t *pk);
 
+/**
+ * Verifies count detached signatures sig[i] on messages m[i], all under the
+ * same public key. results[i] is set to 0 if signature i is valid and to -1
+ * otherwise. Returns 0 if every signature in the batch is valid.
+ */
+int PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_crypto_sign_verify_batch(
+    int *results,
+    const uint8_t *const *sig, const size_t *siglen,
+    const uint8_t *const *m, const size_t *mlen,
+    size_t count, const uint8_t *pk);
+
 /**
  * Returns an array containing the signature followed by the message.
  */
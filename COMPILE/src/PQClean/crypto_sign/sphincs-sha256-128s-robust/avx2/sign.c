@@ -10,7 +10,9 @@
 #include "params.h"
 #include "randombytes.h"
 #include "thash.h"
+#include "thashx8.h"
 #include "utils.h"
+#include "utilsx8.h"
 #include "wots.h"
 
 /**
@@ -308,6 +310,180 @@ int PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_crypto_sign_verify(
     return 0;
 }
 
+/**
+ * Verifies a batch of detached signatures under a single public key.
+ * Up to 8 signatures are verified together: their FORS trees, WOTS chains
+ * and authentication paths are interleaved over the 8 hash lanes.
+ */
+int PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_crypto_sign_verify_batch(
+    int *results,
+    const uint8_t *const *sig, const size_t *siglen,
+    const uint8_t *const *m, const size_t *mlen,
+    size_t count, const uint8_t *pk) {
+    const unsigned char *pub_seed = pk;
+    const unsigned char *pub_root = pk + PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N;
+    unsigned char mhash[8 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_FORS_MSG_BYTES];
+    unsigned char wots_pk[8 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_WOTS_BYTES];
+    unsigned char rootx8[8 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N];
+    unsigned char leafx8[8 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N];
+    unsigned char *root[8];
+    const unsigned char *leaf[8];
+    const unsigned char *sigp[8];
+    size_t batch_idx[8];
+    unsigned int lane[8];
+    uint64_t tree[8];
+    uint32_t idx_leaf[8];
+    uint32_t idx_offset[8] = {0};
+    uint32_t wots_addrx8[8 * 8];
+    uint32_t tree_addrx8[8 * 8];
+    uint32_t wots_pk_addrx8[8 * 8];
+    unsigned int lanes;
+    unsigned int i, j;
+    size_t next = 0;
+    int ret = 0;
+
+    hash_state hash_state_seeded;
+
+    /* This hook allows the hash function instantiation to do whatever
+       preparation or computation it needs, based on the public seed. */
+    PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_initialize_hash_function(
+        &hash_state_seeded,
+        pub_seed, NULL);
+
+    for (j = 0; j < 8; j++) {
+        root[j] = rootx8 + j * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N;
+        leaf[j] = leafx8 + j * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N;
+    }
+
+    while (next < count) {
+        /* Collect the next (up to) 8 signatures of the correct length. */
+        lanes = 0;
+        while (lanes < 8 && next < count) {
+            if (siglen[next] != PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_BYTES) {
+                results[next] = -1;
+                ret = -1;
+            } else {
+                batch_idx[lanes] = next;
+                lanes++;
+            }
+            next++;
+        }
+        if (lanes == 0) {
+            break;
+        }
+
+        memset(wots_addrx8, 0, sizeof(wots_addrx8));
+        memset(tree_addrx8, 0, sizeof(tree_addrx8));
+        memset(wots_pk_addrx8, 0, sizeof(wots_pk_addrx8));
+
+        for (j = 0; j < 8; j++) {
+            PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_set_type(
+                wots_addrx8 + j * 8, PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_ADDR_TYPE_WOTS);
+            PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_set_type(
+                tree_addrx8 + j * 8, PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_ADDR_TYPE_HASHTREE);
+            PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_set_type(
+                wots_pk_addrx8 + j * 8, PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_ADDR_TYPE_WOTSPK);
+
+            /* Spare lanes shadow the first signature of this batch. */
+            lane[j] = j < lanes ? j : 0;
+            if (j >= lanes) {
+                tree[j] = tree[0];
+                idx_leaf[j] = idx_leaf[0];
+                sigp[j] = sigp[0];
+                continue;
+            }
+
+            /* Derive the message digest and leaf index from R || PK || M. */
+            PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_hash_message(
+                mhash + j * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_FORS_MSG_BYTES, &tree[j], &idx_leaf[j],
+                sig[batch_idx[j]], pk, m[batch_idx[j]], mlen[batch_idx[j]],
+                &hash_state_seeded);
+            sigp[j] = sig[batch_idx[j]] + PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N;
+        }
+
+        for (j = 0; j < 8; j++) {
+            /* Layer correctly defaults to 0, so no need to set_layer_addr */
+            PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_set_tree_addr(wots_addrx8 + j * 8, tree[j]);
+            PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_set_keypair_addr(
+                wots_addrx8 + j * 8, idx_leaf[j]);
+        }
+
+        PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_fors_pk_from_sig_batch(
+            rootx8, sigp, mhash, pub_seed, wots_addrx8, lanes, &hash_state_seeded);
+        for (j = 0; j < 8; j++) {
+            sigp[j] += PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_FORS_BYTES;
+        }
+
+        /* For each subtree.. */
+        for (i = 0; i < PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_D; i++) {
+            for (j = 0; j < 8; j++) {
+                PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_set_layer_addr(tree_addrx8 + j * 8, i);
+                PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_set_tree_addr(tree_addrx8 + j * 8, tree[j]);
+
+                PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_copy_subtree_addr(
+                    wots_addrx8 + j * 8, tree_addrx8 + j * 8);
+                PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_set_keypair_addr(
+                    wots_addrx8 + j * 8, idx_leaf[j]);
+
+                PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_copy_keypair_addr(
+                    wots_pk_addrx8 + j * 8, wots_addrx8 + j * 8);
+            }
+
+            /* The WOTS public keys are only correct if the signatures were. */
+            PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_wots_pk_from_sig_batch(
+                wots_pk, sigp, rootx8, pub_seed, wots_addrx8, lanes, &hash_state_seeded);
+            for (j = 0; j < 8; j++) {
+                sigp[j] += PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_WOTS_BYTES;
+            }
+
+            /* Compute the leaf nodes using the WOTS public keys. */
+            PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_thashx8_WOTS_LEN(
+                leafx8 + 0 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N,
+                leafx8 + 1 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N,
+                leafx8 + 2 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N,
+                leafx8 + 3 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N,
+                leafx8 + 4 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N,
+                leafx8 + 5 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N,
+                leafx8 + 6 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N,
+                leafx8 + 7 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N,
+                wots_pk + lane[0] * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_WOTS_BYTES,
+                wots_pk + lane[1] * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_WOTS_BYTES,
+                wots_pk + lane[2] * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_WOTS_BYTES,
+                wots_pk + lane[3] * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_WOTS_BYTES,
+                wots_pk + lane[4] * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_WOTS_BYTES,
+                wots_pk + lane[5] * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_WOTS_BYTES,
+                wots_pk + lane[6] * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_WOTS_BYTES,
+                wots_pk + lane[7] * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_WOTS_BYTES,
+                pub_seed, wots_pk_addrx8, &hash_state_seeded);
+
+            /* Compute the root nodes of these subtrees. */
+            PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_compute_rootx8(
+                root, leaf, idx_leaf, idx_offset, sigp, PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_TREE_HEIGHT,
+                pub_seed, tree_addrx8, &hash_state_seeded);
+
+            for (j = 0; j < 8; j++) {
+                sigp[j] += PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_TREE_HEIGHT * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N;
+
+                /* Update the indices for the next layer. */
+                idx_leaf[j] = (tree[j] & ((1 << PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_TREE_HEIGHT) - 1));
+                tree[j] = tree[j] >> PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_TREE_HEIGHT;
+            }
+        }
+
+        /* Check if the root nodes equal the root node in the public key. */
+        for (j = 0; j < lanes; j++) {
+            if (memcmp(rootx8 + j * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N, pub_root, PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N) != 0) {
+                results[batch_idx[j]] = -1;
+                ret = -1;
+            } else {
+                results[batch_idx[j]] = 0;
+            }
+        }
+    }
+
+    PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_destroy_hash_function(&hash_state_seeded);
+    return ret;
+}
 
 /**
  * Returns an array containing the signature followed by the message.
@@ -43,4 +43,17 @@ void PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_treehashx8_FORS_HEIGHT(
     uint32_t tree_addrx8[8 * 8],
     const hash_state *state_seeded);
 
+/**
+ * 8-way parallel version of compute_root. Computes the roots of eight
+ * authentication paths of equal height, which may stem from different
+ * signatures under the same pub_seed.
+ * Expects the layer, tree and type parts of each address to be set.
+ */
+void PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_compute_rootx8(
+    unsigned char *root[8], const unsigned char *leaf[8],
+    const uint32_t leaf_idx[8], const uint32_t idx_offset[8],
+    const unsigned char *auth_path[8], uint32_t tree_height,
+    const unsigned char *pub_seed, uint32_t addrx8[8 * 8],
+    const hash_state *state_seeded);
+
 #endif
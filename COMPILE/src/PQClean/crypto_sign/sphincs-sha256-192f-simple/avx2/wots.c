@@ -238,3 +238,105 @@ void PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_wots_pk_from_sig(unsigned char *pk,
                   lengths[i], PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_W - 1 - lengths[i], pub_seed, addr, state_seeded);
     }
 }
+
+/**
+ * Batched version of wots_pk_from_sig for up to 8 signatures that share
+ * pub_seed. Instead of walking one chain at a time, the chains of all
+ * signatures are scheduled over the 8 lanes of thashx8_1: whenever a chain
+ * completes, the next pending chain takes over its lane.
+ *
+ * pk holds count consecutive WOTS public keys, msg count consecutive n-byte
+ * messages, and addrx8 the WOTS key pair address of each signature.
+ */
+void PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_wots_pk_from_sig_batch(unsigned char *pk,
+        const unsigned char *sig[8], const unsigned char *msg,
+        const unsigned char *pub_seed, uint32_t addrx8[8 * 8],
+        unsigned int count, const hash_state *state_seeded) {
+    unsigned int lengths[8 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_LEN];
+    unsigned char bufx8[8 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N];
+    uint32_t lane_addrx8[8 * 8];
+    unsigned int chain[8];
+    unsigned int pos[8];
+    unsigned int active = 0;
+    unsigned int next = 0;
+    unsigned int total = count * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_LEN;
+    unsigned int i, j;
+
+    for (i = 0; i < count; i++) {
+        chain_lengths(lengths + i * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_LEN, msg + i * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N);
+    }
+    memcpy(lane_addrx8, addrx8, sizeof(lane_addrx8));
+    memset(bufx8, 0, sizeof(bufx8));
+
+    for (j = 0; j < 8; j++) {
+        chain[j] = total;
+        pos[j] = 0;
+    }
+
+    for (;;) {
+        /* Hand every idle lane the next chain that still needs work. */
+        for (j = 0; j < 8; j++) {
+            if (chain[j] != total) {
+                continue;
+            }
+            while (next < total && lengths[next] == PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_W - 1) {
+                memcpy(pk + next * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                       sig[next / PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_LEN] + (next % PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_LEN) * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                       PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N);
+                next++;
+            }
+            if (next == total) {
+                continue;
+            }
+            chain[j] = next;
+            pos[j] = lengths[next];
+            memcpy(lane_addrx8 + j * 8, addrx8 + (next / PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_LEN) * 8,
+                   sizeof(uint32_t) * 8);
+            PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_set_chain_addr(lane_addrx8 + j * 8, next % PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_LEN);
+            memcpy(bufx8 + j * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                   sig[next / PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_LEN] + (next % PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_LEN) * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                   PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N);
+            active++;
+            next++;
+        }
+        if (active == 0) {
+            break;
+        }
+
+        for (j = 0; j < 8; j++) {
+            if (chain[j] != total) {
+                PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_set_hash_addr(lane_addrx8 + j * 8, pos[j]);
+            }
+        }
+        PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_thashx8_1(
+                bufx8 + 0 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 1 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 2 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 3 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 4 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 5 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 6 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 7 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 0 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 1 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 2 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 3 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 4 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 5 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 6 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                bufx8 + 7 * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N,
+                pub_seed, lane_addrx8, state_seeded);
+
+        for (j = 0; j < 8; j++) {
+            if (chain[j] == total) {
+                continue;
+            }
+            pos[j]++;
+            if (pos[j] == PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_WOTS_W - 1) {
+                memcpy(pk + chain[j] * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N, bufx8 + j * PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N, PQCLEAN_SPHINCSSHA256192FSIMPLE_AVX2_N);
+                chain[j] = total;
+                active--;
+            }
+        }
+    }
+}
@@ -238,3 +238,98 @@ void PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_fors_pk_from_sig(unsigned char *pk,
     /* Hash horizontally across all tree roots to derive the public key. */
     PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_thash_FORS_TREES(pk, roots, pub_seed, fors_pk_addr, state_seeded);
 }
+
+/**
+ * Batched version of fors_pk_from_sig for 1 to 8 signatures that share
+ * pub_seed. The FORS trees of all signatures are walked eight at a time,
+ * regardless of which signature they belong to, so that the lanes stay
+ * occupied even though every single tree is a sequential path.
+ */
+void PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_fors_pk_from_sig_batch(unsigned char *pk,
+        const unsigned char *sig[8], const unsigned char *m,
+        const unsigned char *pub_seed,
+        const uint32_t fors_addrx8[8 * 8], unsigned int count,
+        const hash_state *state_seeded) {
+    uint32_t indices[8 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES];
+    unsigned char roots[8 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N];
+    unsigned char leafx8[8 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N];
+    uint32_t fors_tree_addrx8[8 * 8] = {0};
+    uint32_t fors_pk_addrx8[8 * 8] = {0};
+    unsigned char *root[8];
+    const unsigned char *leaf[8];
+    const unsigned char *sk[8];
+    const unsigned char *auth_path[8];
+    uint32_t leaf_idx[8];
+    uint32_t idx_offset[8];
+    unsigned int lane[8];
+    unsigned int total = count * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES;
+    unsigned int i, j, k, s, t;
+
+    for (s = 0; s < count; s++) {
+        message_to_indices(indices + s * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES, m + s * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_MSG_BYTES);
+    }
+
+    for (i = 0; i < total; i += 8) {
+        for (j = 0; j < 8; j++) {
+            /* Spare lanes in the last round repeat the last tree. */
+            k = (i + j < total) ? i + j : total - 1;
+            s = k / PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES;
+            t = k % PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES;
+
+            idx_offset[j] = t * (1 << PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_HEIGHT);
+            leaf_idx[j] = indices[k];
+            sk[j] = sig[s] + t * (PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_HEIGHT + 1) * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N;
+            auth_path[j] = sk[j] + PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N;
+            leaf[j] = leafx8 + j * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N;
+            root[j] = roots + k * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N;
+
+            PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_copy_keypair_addr(fors_tree_addrx8 + j * 8, fors_addrx8 + s * 8);
+            PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_set_type(fors_tree_addrx8 + j * 8, PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_ADDR_TYPE_FORSTREE);
+            PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_set_tree_height(fors_tree_addrx8 + j * 8, 0);
+            PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_set_tree_index(fors_tree_addrx8 + j * 8, indices[k] + idx_offset[j]);
+        }
+
+        /* Derive the leaves from the included secret key parts. */
+        fors_sk_to_leafx8(
+                          leafx8 + 0 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                          leafx8 + 1 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                          leafx8 + 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                          leafx8 + 3 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                          leafx8 + 4 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                          leafx8 + 5 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                          leafx8 + 6 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                          leafx8 + 7 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                          sk[0], sk[1], sk[2], sk[3],
+                          sk[4], sk[5], sk[6], sk[7],
+                          pub_seed, fors_tree_addrx8, state_seeded);
+
+        /* Derive the corresponding root nodes of these trees. */
+        PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_compute_rootx8(root, leaf, leaf_idx, idx_offset, auth_path,
+                PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_HEIGHT, pub_seed, fors_tree_addrx8, state_seeded);
+    }
+
+    /* Hash horizontally across all tree roots to derive the public keys. */
+    for (j = 0; j < 8; j++) {
+        lane[j] = j < count ? j : count - 1;
+        PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_copy_keypair_addr(fors_pk_addrx8 + j * 8, fors_addrx8 + lane[j] * 8);
+        PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_set_type(fors_pk_addrx8 + j * 8, PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_ADDR_TYPE_FORSPK);
+    }
+    PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_thashx8_FORS_TREES(
+            pk + lane[0] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            pk + lane[1] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            pk + lane[2] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            pk + lane[3] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            pk + lane[4] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            pk + lane[5] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            pk + lane[6] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            pk + lane[7] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            roots + lane[0] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            roots + lane[1] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            roots + lane[2] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            roots + lane[3] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            roots + lane[4] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            roots + lane[5] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            roots + lane[6] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            roots + lane[7] * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_TREES * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            pub_seed, fors_pk_addrx8, state_seeded);
+}
@@ -170,3 +170,100 @@ static void treehashx8(unsigned char *rootx8, unsigned char *auth_pathx8,
 treehashx8_variant(FORS_HEIGHT, PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_FORS_HEIGHT)
 
 #undef treehashx8_variant
+
+/**
+ * 8-way parallel version of compute_root; computes eight roots from eight
+ * leaves and authentication paths of the same tree height. The leaves,
+ * paths and addresses may belong to different signatures, as long as they
+ * share pub_seed. Lanes that are not needed can repeat another lane.
+ */
+void PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_compute_rootx8(
+    unsigned char *root[8], const unsigned char *leaf[8],
+    const uint32_t leaf_idx[8], const uint32_t idx_offset[8],
+    const unsigned char *auth_path[8], uint32_t tree_height,
+    const unsigned char *pub_seed, uint32_t addrx8[8 * 8],
+    const hash_state *state_seeded) {
+    unsigned char bufferx8[8 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N];
+    const unsigned char *auth[8];
+    uint32_t idx[8];
+    uint32_t offset[8];
+    uint32_t i;
+    unsigned int j;
+
+    /* If leaf_idx is odd (last bit = 1), current path element is a right child
+       and auth_path has to go left. Otherwise it is the other way around. */
+    for (j = 0; j < 8; j++) {
+        idx[j] = leaf_idx[j];
+        offset[j] = idx_offset[j];
+        auth[j] = auth_path[j];
+        if (idx[j] & 1) {
+            memcpy(bufferx8 + j * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N + PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N, leaf[j], PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N);
+            memcpy(bufferx8 + j * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N, auth[j], PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N);
+        } else {
+            memcpy(bufferx8 + j * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N, leaf[j], PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N);
+            memcpy(bufferx8 + j * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N + PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N, auth[j], PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N);
+        }
+        auth[j] += PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N;
+    }
+
+    for (i = 0; i < tree_height - 1; i++) {
+        for (j = 0; j < 8; j++) {
+            idx[j] >>= 1;
+            offset[j] >>= 1;
+            /* Set the address of the node we're creating. */
+            PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_set_tree_height(addrx8 + j * 8, i + 1);
+            PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_set_tree_index(addrx8 + j * 8, idx[j] + offset[j]);
+        }
+
+        /* Hash into the left half, then move it to the side it belongs. */
+        PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_thashx8_2(
+                bufferx8 + 0 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 1 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 2 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 3 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 4 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 5 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 6 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 7 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 0 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 1 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 2 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 3 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 4 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 5 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 6 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                bufferx8 + 7 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+                pub_seed, addrx8, state_seeded);
+
+        /* Pick the right or left neighbor, depending on parity of the node. */
+        for (j = 0; j < 8; j++) {
+            if (idx[j] & 1) {
+                memcpy(bufferx8 + j * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N + PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N, bufferx8 + j * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N, PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N);
+                memcpy(bufferx8 + j * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N, auth[j], PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N);
+            } else {
+                memcpy(bufferx8 + j * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N + PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N, auth[j], PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N);
+            }
+            auth[j] += PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N;
+        }
+    }
+
+    /* The last iteration is exceptional; we do not copy an auth_path node. */
+    for (j = 0; j < 8; j++) {
+        idx[j] >>= 1;
+        offset[j] >>= 1;
+        PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_set_tree_height(addrx8 + j * 8, tree_height);
+        PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_set_tree_index(addrx8 + j * 8, idx[j] + offset[j]);
+    }
+    PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_thashx8_2(
+            root[0], root[1], root[2], root[3],
+            root[4], root[5], root[6], root[7],
+            bufferx8 + 0 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            bufferx8 + 1 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            bufferx8 + 2 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            bufferx8 + 3 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            bufferx8 + 4 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            bufferx8 + 5 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            bufferx8 + 6 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            bufferx8 + 7 * 2 * PQCLEAN_SPHINCSSHA256192SSIMPLE_AVX2_N,
+            pub_seed, addrx8, state_seeded);
+}
@@ -11,7 +11,9 @@
 #include "params.h"
 #include "randombytes.h"
 #include "thash.h"
+#include "thashx4.h"
 #include "utils.h"
+#include "utilsx4.h"
 #include "wots.h"
 
 
@@ -351,6 +353,179 @@ int PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_crypto_sign_verify(
     return 0;
 }
 
+/**
+ * Verifies a batch of detached signatures under a single public key.
+ * Up to 4 signatures are verified together: their FORS trees, WOTS chains
+ * and authentication paths are interleaved over the 4 hash lanes.
+ */
+int PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_crypto_sign_verify_batch(
+    int *results,
+    const uint8_t *const *sig, const size_t *siglen,
+    const uint8_t *const *m, const size_t *mlen,
+    size_t count, const uint8_t *pk) {
+    // guarantee alignment of pk
+    union {
+        __m128 *_x;
+        uint8_t pk[PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_CRYPTO_PUBLICKEYBYTES];
+    } aligned_pk;
+    memcpy(aligned_pk.pk, pk, PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_CRYPTO_PUBLICKEYBYTES);
+    pk = aligned_pk.pk;
+
+    const unsigned char *pub_seed = pk;
+    const unsigned char *pub_root = pk + PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N;
+    unsigned char mhash[4 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_FORS_MSG_BYTES];
+    unsigned char wots_pk[4 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_WOTS_BYTES];
+    unsigned char rootx4[4 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N];
+    unsigned char leafx4[4 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N];
+    unsigned char *root[4];
+    const unsigned char *leaf[4];
+    const unsigned char *sigp[4];
+    size_t batch_idx[4];
+    unsigned int lane[4];
+    uint64_t tree[4];
+    uint32_t idx_leaf[4];
+    uint32_t idx_offset[4] = {0};
+    uint32_t wots_addrx4[4 * 8];
+    uint32_t tree_addrx4[4 * 8];
+    uint32_t wots_pk_addrx4[4 * 8];
+    unsigned int lanes;
+    unsigned int i, j;
+    size_t next = 0;
+    int ret = 0;
+
+    hash_state hash_state_seeded;
+
+    /* This hook allows the hash function instantiation to do whatever
+       preparation or computation it needs, based on the public seed. */
+    PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_initialize_hash_function(
+        &hash_state_seeded,
+        pub_seed, NULL);
+
+    for (j = 0; j < 4; j++) {
+        root[j] = rootx4 + j * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N;
+        leaf[j] = leafx4 + j * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N;
+    }
+
+    while (next < count) {
+        /* Collect the next (up to) 4 signatures of the correct length. */
+        lanes = 0;
+        while (lanes < 4 && next < count) {
+            if (siglen[next] != PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_BYTES) {
+                results[next] = -1;
+                ret = -1;
+            } else {
+                batch_idx[lanes] = next;
+                lanes++;
+            }
+            next++;
+        }
+        if (lanes == 0) {
+            break;
+        }
+
+        memset(wots_addrx4, 0, sizeof(wots_addrx4));
+        memset(tree_addrx4, 0, sizeof(tree_addrx4));
+        memset(wots_pk_addrx4, 0, sizeof(wots_pk_addrx4));
+
+        for (j = 0; j < 4; j++) {
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_type(
+                wots_addrx4 + j * 8, PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_ADDR_TYPE_WOTS);
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_type(
+                tree_addrx4 + j * 8, PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_ADDR_TYPE_HASHTREE);
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_type(
+                wots_pk_addrx4 + j * 8, PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_ADDR_TYPE_WOTSPK);
+
+            /* Spare lanes shadow the first signature of this batch. */
+            lane[j] = j < lanes ? j : 0;
+            if (j >= lanes) {
+                tree[j] = tree[0];
+                idx_leaf[j] = idx_leaf[0];
+                sigp[j] = sigp[0];
+                continue;
+            }
+
+            /* Derive the message digest and leaf index from R || PK || M. */
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_hash_message(
+                mhash + j * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_FORS_MSG_BYTES, &tree[j], &idx_leaf[j],
+                sig[batch_idx[j]], pk, m[batch_idx[j]], mlen[batch_idx[j]],
+                &hash_state_seeded);
+            sigp[j] = sig[batch_idx[j]] + PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N;
+        }
+
+        for (j = 0; j < 4; j++) {
+            /* Layer correctly defaults to 0, so no need to set_layer_addr */
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_tree_addr(wots_addrx4 + j * 8, tree[j]);
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_keypair_addr(
+                wots_addrx4 + j * 8, idx_leaf[j]);
+        }
+
+        PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_fors_pk_from_sig_batch(
+            rootx4, sigp, mhash, pub_seed, wots_addrx4, lanes, &hash_state_seeded);
+        for (j = 0; j < 4; j++) {
+            sigp[j] += PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_FORS_BYTES;
+        }
+
+        /* For each subtree.. */
+        for (i = 0; i < PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_D; i++) {
+            for (j = 0; j < 4; j++) {
+                PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_layer_addr(tree_addrx4 + j * 8, i);
+                PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_tree_addr(tree_addrx4 + j * 8, tree[j]);
+
+                PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_copy_subtree_addr(
+                    wots_addrx4 + j * 8, tree_addrx4 + j * 8);
+                PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_keypair_addr(
+                    wots_addrx4 + j * 8, idx_leaf[j]);
+
+                PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_copy_keypair_addr(
+                    wots_pk_addrx4 + j * 8, wots_addrx4 + j * 8);
+            }
+
+            /* The WOTS public keys are only correct if the signatures were. */
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_wots_pk_from_sig_batch(
+                wots_pk, sigp, rootx4, pub_seed, wots_addrx4, lanes, &hash_state_seeded);
+            for (j = 0; j < 4; j++) {
+                sigp[j] += PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_WOTS_BYTES;
+            }
+
+            /* Compute the leaf nodes using the WOTS public keys. */
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_thashx4_WOTS_LEN(
+                leafx4 + 0 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                leafx4 + 1 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                leafx4 + 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                leafx4 + 3 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                wots_pk + lane[0] * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_WOTS_BYTES,
+                wots_pk + lane[1] * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_WOTS_BYTES,
+                wots_pk + lane[2] * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_WOTS_BYTES,
+                wots_pk + lane[3] * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_WOTS_BYTES,
+                pub_seed, wots_pk_addrx4, &hash_state_seeded);
+
+            /* Compute the root nodes of these subtrees. */
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_compute_rootx4(
+                root, leaf, idx_leaf, idx_offset, sigp, PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_TREE_HEIGHT,
+                pub_seed, tree_addrx4, &hash_state_seeded);
+
+            for (j = 0; j < 4; j++) {
+                sigp[j] += PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_TREE_HEIGHT * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N;
+
+                /* Update the indices for the next layer. */
+                idx_leaf[j] = (tree[j] & ((1 << PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_TREE_HEIGHT) - 1));
+                tree[j] = tree[j] >> PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_TREE_HEIGHT;
+            }
+        }
+
+        /* Check if the root nodes equal the root node in the public key. */
+        for (j = 0; j < lanes; j++) {
+            if (memcmp(rootx4 + j * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N, pub_root, PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N) != 0) {
+                results[batch_idx[j]] = -1;
+                ret = -1;
+            } else {
+                results[batch_idx[j]] = 0;
+            }
+        }
+    }
+
+    return ret;
+}
 
 /**
  * Returns an array containing the signature followed by the message.
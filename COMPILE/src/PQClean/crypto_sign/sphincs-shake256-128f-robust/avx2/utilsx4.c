@@ -96,3 +96,87 @@
     }
 
 treehashx4_variant(FORS_HEIGHT, PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_FORS_HEIGHT)
+
+/**
+ * 4-way parallel version of compute_root; computes four roots from four
+ * leaves and authentication paths of the same tree height. The leaves,
+ * paths and addresses may belong to different signatures, as long as they
+ * share pub_seed. Lanes that are not needed can repeat another lane.
+ */
+void PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_compute_rootx4(
+    unsigned char *root[4], const unsigned char *leaf[4],
+    const uint32_t leaf_idx[4], const uint32_t idx_offset[4],
+    const unsigned char *auth_path[4], uint32_t tree_height,
+    const unsigned char *pub_seed, uint32_t addrx4[4 * 8],
+    const hash_state *state_seeded) {
+    unsigned char bufferx4[4 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N];
+    const unsigned char *auth[4];
+    uint32_t idx[4];
+    uint32_t offset[4];
+    uint32_t i;
+    unsigned int j;
+
+    /* If leaf_idx is odd (last bit = 1), current path element is a right child
+       and auth_path has to go left. Otherwise it is the other way around. */
+    for (j = 0; j < 4; j++) {
+        idx[j] = leaf_idx[j];
+        offset[j] = idx_offset[j];
+        auth[j] = auth_path[j];
+        if (idx[j] & 1) {
+            memcpy(bufferx4 + j * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N + PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N, leaf[j], PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N);
+            memcpy(bufferx4 + j * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N, auth[j], PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N);
+        } else {
+            memcpy(bufferx4 + j * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N, leaf[j], PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N);
+            memcpy(bufferx4 + j * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N + PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N, auth[j], PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N);
+        }
+        auth[j] += PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N;
+    }
+
+    for (i = 0; i < tree_height - 1; i++) {
+        for (j = 0; j < 4; j++) {
+            idx[j] >>= 1;
+            offset[j] >>= 1;
+            /* Set the address of the node we're creating. */
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_tree_height(addrx4 + j * 8, i + 1);
+            PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_tree_index(addrx4 + j * 8, idx[j] + offset[j]);
+        }
+
+        /* Hash into the left half, then move it to the side it belongs. */
+        PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_thashx4_2(
+                bufferx4 + 0 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                bufferx4 + 1 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                bufferx4 + 2 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                bufferx4 + 3 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                bufferx4 + 0 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                bufferx4 + 1 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                bufferx4 + 2 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                bufferx4 + 3 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+                pub_seed, addrx4, state_seeded);
+
+        /* Pick the right or left neighbor, depending on parity of the node. */
+        for (j = 0; j < 4; j++) {
+            if (idx[j] & 1) {
+                memcpy(bufferx4 + j * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N + PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N, bufferx4 + j * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N, PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N);
+                memcpy(bufferx4 + j * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N, auth[j], PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N);
+            } else {
+                memcpy(bufferx4 + j * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N + PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N, auth[j], PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N);
+            }
+            auth[j] += PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N;
+        }
+    }
+
+    /* The last iteration is exceptional; we do not copy an auth_path node. */
+    for (j = 0; j < 4; j++) {
+        idx[j] >>= 1;
+        offset[j] >>= 1;
+        PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_tree_height(addrx4 + j * 8, tree_height);
+        PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_set_tree_index(addrx4 + j * 8, idx[j] + offset[j]);
+    }
+    PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_thashx4_2(
+            root[0], root[1], root[2], root[3],
+            bufferx4 + 0 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+            bufferx4 + 1 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+            bufferx4 + 2 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+            bufferx4 + 3 * 2 * PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_N,
+            pub_seed, addrx4, state_seeded);
+}
@@ -35,4 +35,17 @@ void PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_treehashx4_FORS_HEIGHT(unsigned char
         uint32_t tree_addrx4[4 * 8],
         const hash_state *state_seeded);
 
+/**
+ * 4-way parallel version of compute_root. Computes the roots of four
+ * authentication paths of equal height, which may stem from different
+ * signatures under the same pub_seed.
+ * Expects the layer, tree and type parts of each address to be set.
+ */
+void PQCLEAN_SPHINCSSHAKE256128FROBUST_AVX2_compute_rootx4(
+    unsigned char *root[4], const unsigned char *leaf[4],
+    const uint32_t leaf_idx[4], const uint32_t idx_offset[4],
+    const unsigned char *auth_path[4], uint32_t tree_height,
+    const unsigned char *pub_seed, uint32_t addrx4[4 * 8],
+    const hash_state *state_seeded);
+
 #endif
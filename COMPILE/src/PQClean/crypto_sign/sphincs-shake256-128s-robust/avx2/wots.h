@@ -38,4 +38,16 @@ void PQCLEAN_SPHINCSSHAKE256128SROBUST_AVX2_wots_pk_from_sig(
     const unsigned char *pub_seed, uint32_t addr[8],
     const hash_state *hash_state_seeded);
 
+/**
+ * Batched version of wots_pk_from_sig for up to 4 signatures under the same
+ * pub_seed; interleaves the chains of all signatures over the SIMD lanes.
+ *
+ * Writes count consecutive WOTS public keys to 'pk'.
+ */
+void PQCLEAN_SPHINCSSHAKE256128SROBUST_AVX2_wots_pk_from_sig_batch(
+    unsigned char *pk,
+    const unsigned char *sig[4], const unsigned char *msg,
+    const unsigned char *pub_seed, uint32_t addrx4[4 * 8],
+    unsigned int count, const hash_state *hash_state_seeded);
+
 #endif
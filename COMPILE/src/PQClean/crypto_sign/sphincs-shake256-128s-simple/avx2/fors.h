@@ -29,4 +29,16 @@ void PQCLEAN_SPHINCSSHAKE256128SSIMPLE_AVX2_fors_pk_from_sig(
     const unsigned char *pub_seed, const uint32_t fors_addr[8],
     const hash_state *hash_state_seeded);
 
+/**
+ * Batched version of fors_pk_from_sig for 1 to 4 signatures under the same
+ * pub_seed. The FORS trees of all signatures share the SIMD lanes.
+ * Writes count consecutive FORS public keys to 'pk'; m holds count
+ * consecutive message digests and fors_addrx4 the address of each signature.
+ */
+void PQCLEAN_SPHINCSSHAKE256128SSIMPLE_AVX2_fors_pk_from_sig_batch(
+    unsigned char *pk,
+    const unsigned char *sig[4], const unsigned char *m,
+    const unsigned char *pub_seed, const uint32_t fors_addrx4[4 * 8],
+    unsigned int count, const hash_state *hash_state_seeded);
+
 #endif
@@ -238,3 +238,97 @@ void PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_wots_pk_from_sig(unsigned char *pk,
     // avoid unused argument
     (void)state_seeded;
 }
+
+/**
+ * Batched version of wots_pk_from_sig for up to 4 signatures that share
+ * pub_seed. Instead of walking one chain at a time, the chains of all
+ * signatures are scheduled over the 4 lanes of thashx4_1: whenever a chain
+ * completes, the next pending chain takes over its lane.
+ *
+ * pk holds count consecutive WOTS public keys, msg count consecutive n-byte
+ * messages, and addrx4 the WOTS key pair address of each signature.
+ */
+void PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_wots_pk_from_sig_batch(unsigned char *pk,
+        const unsigned char *sig[4], const unsigned char *msg,
+        const unsigned char *pub_seed, uint32_t addrx4[4 * 8],
+        unsigned int count, const hash_state *state_seeded) {
+    unsigned int lengths[4 * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_LEN];
+    unsigned char bufx4[4 * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N];
+    uint32_t lane_addrx4[4 * 8];
+    unsigned int chain[4];
+    unsigned int pos[4];
+    unsigned int active = 0;
+    unsigned int next = 0;
+    unsigned int total = count * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_LEN;
+    unsigned int i, j;
+
+    for (i = 0; i < count; i++) {
+        chain_lengths(lengths + i * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_LEN, msg + i * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N);
+    }
+    memcpy(lane_addrx4, addrx4, sizeof(lane_addrx4));
+    memset(bufx4, 0, sizeof(bufx4));
+
+    for (j = 0; j < 4; j++) {
+        chain[j] = total;
+        pos[j] = 0;
+    }
+
+    for (;;) {
+        /* Hand every idle lane the next chain that still needs work. */
+        for (j = 0; j < 4; j++) {
+            if (chain[j] != total) {
+                continue;
+            }
+            while (next < total && lengths[next] == PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_W - 1) {
+                memcpy(pk + next * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                       sig[next / PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_LEN] + (next % PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_LEN) * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                       PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N);
+                next++;
+            }
+            if (next == total) {
+                continue;
+            }
+            chain[j] = next;
+            pos[j] = lengths[next];
+            memcpy(lane_addrx4 + j * 8, addrx4 + (next / PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_LEN) * 8,
+                   sizeof(uint32_t) * 8);
+            PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_set_chain_addr(lane_addrx4 + j * 8, next % PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_LEN);
+            memcpy(bufx4 + j * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                   sig[next / PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_LEN] + (next % PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_LEN) * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                   PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N);
+            active++;
+            next++;
+        }
+        if (active == 0) {
+            break;
+        }
+
+        for (j = 0; j < 4; j++) {
+            if (chain[j] != total) {
+                PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_set_hash_addr(lane_addrx4 + j * 8, pos[j]);
+            }
+        }
+        PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_thashx4_1(
+                bufx4 + 0 * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                bufx4 + 1 * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                bufx4 + 2 * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                bufx4 + 3 * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                bufx4 + 0 * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                bufx4 + 1 * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                bufx4 + 2 * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                bufx4 + 3 * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N,
+                pub_seed, lane_addrx4, state_seeded);
+
+        for (j = 0; j < 4; j++) {
+            if (chain[j] == total) {
+                continue;
+            }
+            pos[j]++;
+            if (pos[j] == PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_WOTS_W - 1) {
+                memcpy(pk + chain[j] * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N, bufx4 + j * PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N, PQCLEAN_SPHINCSSHAKE256192SSIMPLE_AVX2_N);
+                chain[j] = total;
+                active--;
+            }
+        }
+    }
+}
@@ -21,14 +21,30 @@ typedef struct {
 static AES256_CTR_DRBG_struct DRBG_ctx;
 static void AES256_CTR_DRBG_Update(const uint8_t *provided_data, uint8_t *Key, uint8_t *V);
 
-// Use whatever AES implementation you have. This uses AES from openSSL library
-//    key - 256-bit AES key
-//    ctr - a 128-bit plaintext value
-//    buffer - a 128-bit ciphertext value
-static void AES256_ECB(uint8_t *key, uint8_t *ctr, uint8_t *buffer) {
+// Encrypts the next nblocks values of the 128-bit big-endian counter V (which
+// is incremented before each block) into buffer, expanding the key only once;
+// the blocks are independent, so the AES backend can pipeline them.
+//    Key - 256-bit AES key
+//    V - 128-bit counter, left at the last value used
+//    buffer - nblocks 128-bit ciphertext values
+static void AES256_CTR_DRBG_Blocks(const uint8_t *Key, uint8_t *V, uint8_t *buffer, size_t nblocks) {
     aes256ctx ctx;
-    aes256_keyexp(&ctx, key);
-    aes256_ecb(buffer, ctr, 1, &ctx);
+
+    for (size_t i = 0; i < nblocks; i++) {
+        //increment V
+        for (int j = 15; j >= 0; j--) {
+            if (V[j] == 0xff) {
+                V[j] = 0x00;
+            } else {
+                V[j]++;
+                break;
+            }
+        }
+        memcpy(buffer + 16 * i, V, 16);
+    }
+    aes256_keyexp(&ctx, Key);
+    aes256_ecb(buffer, buffer, nblocks, &ctx);
+    aes256_ctx_release(&ctx);
 }
 
 void nist_kat_init(uint8_t *entropy_input, const uint8_t *personalization_string, int security_strength);
@@ -50,27 +66,14 @@ void nist_kat_init(uint8_t *entropy_input, const uint8_t *personalization_string
 
 int randombytes(uint8_t *buf, size_t xlen) {
     uint8_t block[16];
-    int i = 0;
+    size_t nblocks = xlen / 16;
 
-    while (xlen > 0) {
-        //increment V
-        for (int j = 15; j >= 0; j--) {
-            if (DRBG_ctx.V[j] == 0xff) {
-                DRBG_ctx.V[j] = 0x00;
-            } else {
-                DRBG_ctx.V[j]++;
-                break;
-            }
-        }
-        AES256_ECB(DRBG_ctx.Key, DRBG_ctx.V, block);
-        if (xlen > 15) {
-            memcpy(buf + i, block, 16);
-            i += 16;
-            xlen -= 16;
-        } else {
-            memcpy(buf + i, block, xlen);
-            xlen = 0;
-        }
+    if (nblocks > 0) {
+        AES256_CTR_DRBG_Blocks(DRBG_ctx.Key, DRBG_ctx.V, buf, nblocks);
+    }
+    if (xlen % 16 > 0) {
+        AES256_CTR_DRBG_Blocks(DRBG_ctx.Key, DRBG_ctx.V, block, 1);
+        memcpy(buf + 16 * nblocks, block, xlen % 16);
     }
     AES256_CTR_DRBG_Update(NULL, DRBG_ctx.Key, DRBG_ctx.V);
     DRBG_ctx.reseed_counter++;
@@ -80,19 +83,7 @@ int randombytes(uint8_t *buf, size_t xlen) {
 static void AES256_CTR_DRBG_Update(const uint8_t *provided_data, uint8_t *Key, uint8_t *V) {
     uint8_t temp[48];
 
-    for (int i = 0; i < 3; i++) {
-        //increment V
-        for (int j = 15; j >= 0; j--) {
-            if (V[j] == 0xff) {
-                V[j] = 0x00;
-            } else {
-                V[j]++;
-                break;
-            }
-        }
-
-        AES256_ECB(Key, V, temp + 16 * i);
-    }
+    AES256_CTR_DRBG_Blocks(Key, V, temp, 3);
     if (provided_data != NULL) {
         for (int i = 0; i < 48; i++) {
             temp[i] ^= provided_data[i];
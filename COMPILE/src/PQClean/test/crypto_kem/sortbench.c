@@ -0,0 +1,90 @@
+#include "randombytes.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef SORTBENCH_ROUNDS
+#define SORTBENCH_ROUNDS 1000
+#endif
+
+#define MAXN 1277
+
+#ifdef SORTBENCH_UINT32
+// uint32_sort of the mupq sntrup/ntrulpr builds; it orders unsigned words
+#include "uint32.h"
+
+#define SORT_NAME "uint32_sort"
+#define crypto_sort(x, n) uint32_sort((uint32 *)(x), (int)(n))
+#define ELEM uint32_t
+#else
+#include "crypto_sort.h"
+
+// https://stackoverflow.com/a/1489985/1711232
+#define PASTER(x, y) x##_##y
+#define EVALUATOR(x, y) PASTER(x, y)
+#define NAMESPACE(fun) EVALUATOR(PQCLEAN_NAMESPACE, fun)
+
+#define SORT_NAME "crypto_sort"
+#define crypto_sort NAMESPACE(crypto_sort)
+#define ELEM int32_t
+#endif
+
+static const long long sizes[] = {
+    509, 653, 677, 701, 761, 821, 857, 1013, 1277
+};
+
+static int32_t x[MAXN];
+static int32_t y[MAXN];
+
+static int cmp_elem(const void *a, const void *b) {
+    ELEM u = *(const ELEM *)a;
+    ELEM v = *(const ELEM *)b;
+    return (u > v) - (u < v);
+}
+
+/*
+ * Checks crypto_sort against qsort on random input, including duplicates
+ * and extreme values, and reports the time per call for the sizes used by
+ * the NTRU and Streamlined NTRU Prime parameter sets. With SORTBENCH_UINT32
+ * the same is done for uint32_sort of the mupq sntrup/ntrulpr sources.
+ */
+int main(void) {
+    clock_t start;
+    double t;
+    size_t s;
+    long long n;
+    int i, r;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        n = sizes[s];
+
+        for (r = 0; r < 16; r++) {
+            randombytes((uint8_t *)x, (size_t)n * sizeof(int32_t));
+            if (r & 1) {
+                for (i = 0; i < n; i++) {
+                    x[i] &= 7;
+                }
+            }
+            x[0] = INT32_MAX;
+            x[n - 1] = INT32_MIN;
+            memcpy(y, x, (size_t)n * sizeof(int32_t));
+            crypto_sort(x, n);
+            qsort(y, (size_t)n, sizeof(int32_t), cmp_elem);
+            if (memcmp(x, y, (size_t)n * sizeof(int32_t)) != 0) {
+                printf("ERROR: " SORT_NAME " output differs for n = %lld\n", n);
+                return -1;
+            }
+        }
+
+        start = clock();
+        for (r = 0; r < SORTBENCH_ROUNDS; r++) {
+            crypto_sort(x, n);
+        }
+        t = (double)(clock() - start) / CLOCKS_PER_SEC;
+        printf(SORT_NAME " n = %4lld: %8.2f us\n", n, 1e6 * t / SORTBENCH_ROUNDS);
+    }
+    return 0;
+}
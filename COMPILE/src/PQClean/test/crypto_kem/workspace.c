@@ -0,0 +1,135 @@
+#define _DEFAULT_SOURCE
+
+#include "api.h"
+#include "fips202.h"
+#include "randombytes.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifndef NTESTS
+#define NTESTS 3
+#endif
+
+// https://stackoverflow.com/a/1489985/1711232
+#define PASTER(x, y) x##_##y
+#define EVALUATOR(x, y) PASTER(x, y)
+#define NAMESPACE(fun) EVALUATOR(PQCLEAN_NAMESPACE, fun)
+
+#define CRYPTO_BYTES           NAMESPACE(CRYPTO_BYTES)
+#define CRYPTO_PUBLICKEYBYTES  NAMESPACE(CRYPTO_PUBLICKEYBYTES)
+#define CRYPTO_SECRETKEYBYTES  NAMESPACE(CRYPTO_SECRETKEYBYTES)
+#define CRYPTO_CIPHERTEXTBYTES NAMESPACE(CRYPTO_CIPHERTEXTBYTES)
+#define CRYPTO_WORKSPACEBYTES  NAMESPACE(CRYPTO_WORKSPACEBYTES)
+
+#define crypto_kem_keypair NAMESPACE(crypto_kem_keypair)
+#define crypto_kem_enc NAMESPACE(crypto_kem_enc)
+#define crypto_kem_dec NAMESPACE(crypto_kem_dec)
+#define crypto_kem_keypair_ws NAMESPACE(crypto_kem_keypair_ws)
+#define crypto_kem_enc_ws NAMESPACE(crypto_kem_enc_ws)
+#define crypto_kem_dec_ws NAMESPACE(crypto_kem_dec_ws)
+
+static uint8_t pk[2][CRYPTO_PUBLICKEYBYTES];
+static uint8_t sk[2][CRYPTO_SECRETKEYBYTES];
+static uint8_t ct[2][CRYPTO_CIPHERTEXTBYTES];
+static uint8_t ss_enc[2][CRYPTO_BYTES];
+static uint8_t ss_dec[2][CRYPTO_BYTES];
+
+// randombytes() restarts the same stream after rng_reset(n), so that the
+// stack and the workspace path see identical randomness
+static shake256incctx rng;
+
+static void rng_reset(int n) {
+    uint8_t seed[4] = {'w', 's', 0, 0};
+
+    seed[2] = (uint8_t)n;
+    seed[3] = (uint8_t)(n >> 8);
+    shake256_inc_init(&rng);
+    shake256_inc_absorb(&rng, seed, sizeof(seed));
+    shake256_inc_finalize(&rng);
+}
+
+int randombytes(uint8_t *buf, size_t xlen) {
+    shake256_inc_squeeze(buf, xlen, &rng);
+    return 0;
+}
+
+/*
+ * Runs keypair/enc/dec through the normal API, which keeps its workspace on
+ * the stack, and through the _ws API with a workspace of exactly
+ * CRYPTO_WORKSPACEBYTES bytes, and checks that both produce the same bytes.
+ * The workspace ends at a PROT_NONE page, so an access past
+ * CRYPTO_WORKSPACEBYTES faults, and it is filled with garbage before every
+ * call, so a read of scratch that was not written shows up as a mismatch.
+ */
+int main(void) {
+    long page = sysconf(_SC_PAGESIZE);
+    size_t len = ((CRYPTO_WORKSPACEBYTES + (size_t)page - 1) / (size_t)page) * (size_t)page;
+    uint8_t *map, *ws;
+    int i, r = 0;
+
+    map = mmap(NULL, len + (size_t)page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (map == MAP_FAILED || mprotect(map + len, (size_t)page, PROT_NONE) != 0) {
+        puts("ERROR: cannot map workspace");
+        return -1;
+    }
+    ws = map + len - CRYPTO_WORKSPACEBYTES;
+    if (((uintptr_t)ws & 63) != 0) {
+        puts("ERROR: CRYPTO_WORKSPACEBYTES is not a multiple of 64");
+        return -1;
+    }
+
+    for (i = 0; i < NTESTS && r == 0; i++) {
+        rng_reset(i);
+        if (crypto_kem_keypair(pk[0], sk[0]) != 0 ||
+                crypto_kem_enc(ct[0], ss_enc[0], pk[0]) != 0 ||
+                crypto_kem_dec(ss_dec[0], ct[0], sk[0]) != 0) {
+            puts("ERROR: crypto_kem returned non-zero returncode");
+            r = -1;
+            break;
+        }
+
+        rng_reset(i);
+        memset(ws, 0xa5, CRYPTO_WORKSPACEBYTES);
+        if (crypto_kem_keypair_ws(pk[1], sk[1], ws) != 0) {
+            r = -1;
+        }
+        memset(ws, 0x5a, CRYPTO_WORKSPACEBYTES);
+        if (crypto_kem_enc_ws(ct[1], ss_enc[1], pk[1], ws) != 0) {
+            r = -1;
+        }
+        memset(ws, 0xff, CRYPTO_WORKSPACEBYTES);
+        if (crypto_kem_dec_ws(ss_dec[1], ct[1], sk[1], ws) != 0) {
+            r = -1;
+        }
+        if (r != 0) {
+            puts("ERROR: crypto_kem_*_ws returned non-zero returncode");
+            break;
+        }
+
+        if (memcmp(pk[0], pk[1], CRYPTO_PUBLICKEYBYTES) != 0 ||
+                memcmp(sk[0], sk[1], CRYPTO_SECRETKEYBYTES) != 0) {
+            puts("ERROR: crypto_kem_keypair_ws differs from crypto_kem_keypair");
+            r = -1;
+        }
+        if (memcmp(ct[0], ct[1], CRYPTO_CIPHERTEXTBYTES) != 0 ||
+                memcmp(ss_enc[0], ss_enc[1], CRYPTO_BYTES) != 0) {
+            puts("ERROR: crypto_kem_enc_ws differs from crypto_kem_enc");
+            r = -1;
+        }
+        if (memcmp(ss_dec[0], ss_dec[1], CRYPTO_BYTES) != 0 ||
+                memcmp(ss_dec[1], ss_enc[1], CRYPTO_BYTES) != 0) {
+            puts("ERROR: crypto_kem_dec_ws differs from crypto_kem_dec");
+            r = -1;
+        }
+    }
+
+    munmap(map, len + (size_t)page);
+    if (r == 0) {
+        printf("%d workspace tests passed, CRYPTO_WORKSPACEBYTES = %d\n", NTESTS, (int)CRYPTO_WORKSPACEBYTES);
+    }
+    return r;
+}
@@ -0,0 +1,109 @@
+#include "api.h"
+#include "randombytes.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef NSIGS
+#define NSIGS 32
+#endif
+
+#ifndef BATCHVERIFY_ROUNDS
+#define BATCHVERIFY_ROUNDS 4
+#endif
+
+#define MLEN 64
+
+// https://stackoverflow.com/a/1489985/1711232
+#define PASTER(x, y) x##_##y
+#define EVALUATOR(x, y) PASTER(x, y)
+#define NAMESPACE(fun) EVALUATOR(PQCLEAN_NAMESPACE, fun)
+
+#define CRYPTO_PUBLICKEYBYTES NAMESPACE(CRYPTO_PUBLICKEYBYTES)
+#define CRYPTO_SECRETKEYBYTES NAMESPACE(CRYPTO_SECRETKEYBYTES)
+#define CRYPTO_BYTES          NAMESPACE(CRYPTO_BYTES)
+#define CRYPTO_ALGNAME        NAMESPACE(CRYPTO_ALGNAME)
+
+#define crypto_sign_keypair NAMESPACE(crypto_sign_keypair)
+#define crypto_sign_signature NAMESPACE(crypto_sign_signature)
+#define crypto_sign_verify NAMESPACE(crypto_sign_verify)
+#define crypto_sign_verify_batch NAMESPACE(crypto_sign_verify_batch)
+
+static uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+static uint8_t sk[CRYPTO_SECRETKEYBYTES];
+static uint8_t sigs[NSIGS][CRYPTO_BYTES];
+static uint8_t msgs[NSIGS][MLEN];
+
+/*
+ * Checks crypto_sign_verify_batch against a loop over crypto_sign_verify,
+ * including a corrupted signature, a corrupted message and a signature of
+ * the wrong length, and reports the verification throughput of both.
+ */
+int main(void) {
+    const uint8_t *sig_ptrs[NSIGS];
+    const uint8_t *msg_ptrs[NSIGS];
+    size_t siglens[NSIGS];
+    size_t mlens[NSIGS];
+    int expected[NSIGS];
+    int results[NSIGS];
+    size_t siglen;
+    clock_t start;
+    double t_loop, t_batch;
+    int i, r;
+
+    if (crypto_sign_keypair(pk, sk) != 0) {
+        puts("crypto_sign_keypair returned non-zero returncode");
+        return -1;
+    }
+
+    for (i = 0; i < NSIGS; i++) {
+        randombytes(msgs[i], MLEN);
+        crypto_sign_signature(sigs[i], &siglen, msgs[i], MLEN, sk);
+        sig_ptrs[i] = sigs[i];
+        msg_ptrs[i] = msgs[i];
+        siglens[i] = siglen;
+        mlens[i] = MLEN;
+    }
+
+    /* Spoil a few entries in different ways. */
+    sigs[NSIGS / 4][CRYPTO_BYTES / 2] ^= 1;
+    msgs[NSIGS / 2][0] ^= 1;
+    siglens[NSIGS - 1] -= 1;
+
+    start = clock();
+    for (r = 0; r < BATCHVERIFY_ROUNDS; r++) {
+        for (i = 0; i < NSIGS; i++) {
+            expected[i] = crypto_sign_verify(sig_ptrs[i], siglens[i],
+                                             msg_ptrs[i], mlens[i], pk);
+        }
+    }
+    t_loop = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (r = 0; r < BATCHVERIFY_ROUNDS; r++) {
+        crypto_sign_verify_batch(results, sig_ptrs, siglens, msg_ptrs, mlens,
+                                 NSIGS, pk);
+    }
+    t_batch = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    for (i = 0; i < NSIGS; i++) {
+        if (results[i] != expected[i]) {
+            printf("ERROR: batch result %d differs for signature %d\n", results[i], i);
+            return -1;
+        }
+    }
+    if (expected[0] != 0 || expected[NSIGS / 4] == 0 ||
+            expected[NSIGS / 2] == 0 || expected[NSIGS - 1] == 0) {
+        puts("ERROR: unexpected verification results");
+        return -1;
+    }
+
+    printf("%s: %d signatures x %d rounds\n", CRYPTO_ALGNAME, NSIGS, BATCHVERIFY_ROUNDS);
+    printf("  crypto_sign_verify loop: %10.1f verifications/s\n",
+           (double)(NSIGS * BATCHVERIFY_ROUNDS) / t_loop);
+    printf("  crypto_sign_verify_batch: %9.1f verifications/s\n",
+           (double)(NSIGS * BATCHVERIFY_ROUNDS) / t_batch);
+    return 0;
+}
@@ -0,0 +1,135 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "api.h"
+#include "randombytes.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef NSIGS
+#define NSIGS 200
+#endif
+
+#define MLEN 64
+
+// https://stackoverflow.com/a/1489985/1711232
+#define PASTER(x, y) x##_##y
+#define EVALUATOR(x, y) PASTER(x, y)
+#define NAMESPACE(fun) EVALUATOR(PQCLEAN_NAMESPACE, fun)
+
+#define CRYPTO_PUBLICKEYBYTES NAMESPACE(CRYPTO_PUBLICKEYBYTES)
+#define CRYPTO_SECRETKEYBYTES NAMESPACE(CRYPTO_SECRETKEYBYTES)
+#define CRYPTO_EXPANDEDSECRETKEYBYTES NAMESPACE(CRYPTO_EXPANDEDSECRETKEYBYTES)
+#define CRYPTO_BYTES          NAMESPACE(CRYPTO_BYTES)
+#define CRYPTO_ALGNAME        NAMESPACE(CRYPTO_ALGNAME)
+
+#define crypto_sign_keypair NAMESPACE(crypto_sign_keypair)
+#define crypto_sign_signature NAMESPACE(crypto_sign_signature)
+#define crypto_sign_verify NAMESPACE(crypto_sign_verify)
+#define crypto_sign_expand_sk NAMESPACE(crypto_sign_expand_sk)
+#define crypto_sign_signature_expanded NAMESPACE(crypto_sign_signature_expanded)
+
+static uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+static uint8_t sk[CRYPTO_SECRETKEYBYTES];
+static uint64_t esk_words[(CRYPTO_EXPANDEDSECRETKEYBYTES + 7) / 8];
+static uint8_t sig[CRYPTO_BYTES];
+static uint8_t msg[MLEN];
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1e6 * (double)ts.tv_sec + 1e-3 * (double)ts.tv_nsec;
+}
+
+/*
+ * Signs with the raw secret key and with an expanded secret key that is
+ * written to a file and mmap()ed read-only, as a signing process sharing
+ * the key with others would do. All signatures are verified. Reports the
+ * mean latency per signature, the cost of the expansion and the key sizes.
+ * Also checks that an expanded key with a damaged header is refused, so
+ * this is meant for schemes whose expanded key format has a header
+ * (Falcon).
+ */
+int main(void) {
+    uint8_t *esk = (uint8_t *)esk_words;
+    const uint8_t *mapped;
+    char path[] = "/tmp/expandmmap_XXXXXX";
+    size_t siglen;
+    double start, t_expand, t_sign, t_expanded;
+    int fd, i;
+
+    if (crypto_sign_keypair(pk, sk) != 0) {
+        puts("crypto_sign_keypair returned non-zero returncode");
+        return -1;
+    }
+
+    start = now_us();
+    if (crypto_sign_expand_sk(esk, sk) != 0) {
+        puts("crypto_sign_expand_sk returned non-zero returncode");
+        return -1;
+    }
+    t_expand = now_us() - start;
+
+    fd = mkstemp(path);
+    if (fd < 0) {
+        puts("ERROR: cannot create key file");
+        return -1;
+    }
+    unlink(path);
+    if (write(fd, esk, CRYPTO_EXPANDEDSECRETKEYBYTES) != CRYPTO_EXPANDEDSECRETKEYBYTES) {
+        puts("ERROR: cannot write key file");
+        return -1;
+    }
+    mapped = mmap(NULL, CRYPTO_EXPANDEDSECRETKEYBYTES, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        puts("ERROR: cannot map key file");
+        return -1;
+    }
+
+    start = now_us();
+    for (i = 0; i < NSIGS; i++) {
+        randombytes(msg, MLEN);
+        crypto_sign_signature(sig, &siglen, msg, MLEN, sk);
+        if (crypto_sign_verify(sig, siglen, msg, MLEN, pk) != 0) {
+            puts("ERROR: signature does not verify");
+            return -1;
+        }
+    }
+    t_sign = now_us() - start;
+
+    start = now_us();
+    for (i = 0; i < NSIGS; i++) {
+        randombytes(msg, MLEN);
+        if (crypto_sign_signature_expanded(sig, &siglen, msg, MLEN, mapped) != 0) {
+            puts("ERROR: crypto_sign_signature_expanded returned non-zero returncode");
+            return -1;
+        }
+        if (crypto_sign_verify(sig, siglen, msg, MLEN, pk) != 0) {
+            puts("ERROR: signature from expanded key does not verify");
+            return -1;
+        }
+    }
+    t_expanded = now_us() - start;
+    munmap((void *)mapped, CRYPTO_EXPANDEDSECRETKEYBYTES);
+
+    /* A damaged expanded key must be rejected, not used. */
+    esk[8] ^= 0xff;
+    if (crypto_sign_signature_expanded(sig, &siglen, msg, MLEN, esk) == 0) {
+        puts("ERROR: expanded key with a wrong header was accepted");
+        return -1;
+    }
+
+    printf("%s: %d signatures (including verification)\n", CRYPTO_ALGNAME, NSIGS);
+    printf("  secret key:          %8d bytes\n", (int)CRYPTO_SECRETKEYBYTES);
+    printf("  expanded secret key: %8d bytes\n", (int)CRYPTO_EXPANDEDSECRETKEYBYTES);
+    printf("  crypto_sign_expand_sk:          %8.1f us\n", t_expand);
+    printf("  crypto_sign_signature:          %8.1f us/signature\n", t_sign / NSIGS);
+    printf("  crypto_sign_signature_expanded: %8.1f us/signature (mmap()ed key)\n", t_expanded / NSIGS);
+    return 0;
+}
@@ -0,0 +1,81 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "api.h"
+#include "randombytes.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifndef NSIGS
+#define NSIGS 2000
+#endif
+
+#define MLEN 64
+
+// https://stackoverflow.com/a/1489985/1711232
+#define PASTER(x, y) x##_##y
+#define EVALUATOR(x, y) PASTER(x, y)
+#define NAMESPACE(fun) EVALUATOR(PQCLEAN_NAMESPACE, fun)
+
+#define CRYPTO_PUBLICKEYBYTES NAMESPACE(CRYPTO_PUBLICKEYBYTES)
+#define CRYPTO_SECRETKEYBYTES NAMESPACE(CRYPTO_SECRETKEYBYTES)
+#define CRYPTO_BYTES          NAMESPACE(CRYPTO_BYTES)
+#define CRYPTO_ALGNAME        NAMESPACE(CRYPTO_ALGNAME)
+
+#define crypto_sign_keypair NAMESPACE(crypto_sign_keypair)
+#define crypto_sign_signature NAMESPACE(crypto_sign_signature)
+#define crypto_sign_verify NAMESPACE(crypto_sign_verify)
+
+static uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+static uint8_t sk[CRYPTO_SECRETKEYBYTES];
+static uint8_t sig[CRYPTO_BYTES];
+static uint8_t msg[MLEN];
+static double latency[NSIGS];
+
+static int cmp_double(const void *a, const void *b) {
+    double u = *(const double *)a;
+    double v = *(const double *)b;
+    return (u > v) - (u < v);
+}
+
+/*
+ * Reports the wall-clock latency distribution of crypto_sign_signature over
+ * random messages. The number of iterations of the rejection loop differs
+ * from message to message, which shows up in the tail of the distribution.
+ */
+int main(void) {
+    struct timespec start, stop;
+    double mean = 0;
+    size_t siglen;
+    int i;
+
+    if (crypto_sign_keypair(pk, sk) != 0) {
+        puts("crypto_sign_keypair returned non-zero returncode");
+        return -1;
+    }
+
+    for (i = 0; i < NSIGS; i++) {
+        randombytes(msg, MLEN);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        crypto_sign_signature(sig, &siglen, msg, MLEN, sk);
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        latency[i] = 1e6 * (double)(stop.tv_sec - start.tv_sec) +
+                     1e-3 * (double)(stop.tv_nsec - start.tv_nsec);
+        mean += latency[i];
+        if (crypto_sign_verify(sig, siglen, msg, MLEN, pk) != 0) {
+            puts("ERROR: signature does not verify");
+            return -1;
+        }
+    }
+    qsort(latency, NSIGS, sizeof(double), cmp_double);
+
+    printf("%s: %d signatures\n", CRYPTO_ALGNAME, NSIGS);
+    printf("  mean %8.1f us\n", mean / NSIGS);
+    printf("  p50  %8.1f us\n", latency[NSIGS / 2]);
+    printf("  p90  %8.1f us\n", latency[(NSIGS * 9) / 10]);
+    printf("  p99  %8.1f us\n", latency[(NSIGS * 99) / 100]);
+    printf("  max  %8.1f us\n", latency[NSIGS - 1]);
+    return 0;
+}
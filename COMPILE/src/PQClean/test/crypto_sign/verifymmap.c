@@ -0,0 +1,242 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "api.h"
+#include "randombytes.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef NSIGS
+#define NSIGS 20
+#endif
+
+#define MLEN 64
+
+// https://stackoverflow.com/a/1489985/1711232
+#define PASTER(x, y) x##_##y
+#define EVALUATOR(x, y) PASTER(x, y)
+#define NAMESPACE(fun) EVALUATOR(PQCLEAN_NAMESPACE, fun)
+
+#define CRYPTO_PUBLICKEYBYTES NAMESPACE(CRYPTO_PUBLICKEYBYTES)
+#define CRYPTO_SECRETKEYBYTES NAMESPACE(CRYPTO_SECRETKEYBYTES)
+#define CRYPTO_EXPANDEDPUBLICKEYBYTES NAMESPACE(CRYPTO_EXPANDEDPUBLICKEYBYTES)
+#define CRYPTO_BYTES          NAMESPACE(CRYPTO_BYTES)
+#define CRYPTO_ALGNAME        NAMESPACE(CRYPTO_ALGNAME)
+
+#define crypto_sign_keypair NAMESPACE(crypto_sign_keypair)
+#define crypto_sign_signature NAMESPACE(crypto_sign_signature)
+#define crypto_sign_verify NAMESPACE(crypto_sign_verify)
+#define crypto_sign_expand_pk NAMESPACE(crypto_sign_expand_pk)
+#define crypto_sign_verify_expanded NAMESPACE(crypto_sign_verify_expanded)
+
+// Layout of the file written by the key generation process. The sections
+// are aligned so that each key can be mapped on its own.
+#define ALIGN(x) (((x) + 65535) & ~(size_t)65535)
+#define OFF_SIG 0
+#define OFF_MSG (OFF_SIG + NSIGS * CRYPTO_BYTES)
+#define OFF_PK  ALIGN(OFF_MSG + NSIGS * MLEN)
+#define OFF_EPK ALIGN(OFF_PK + CRYPTO_PUBLICKEYBYTES)
+#define FILE_BYTES (OFF_EPK + CRYPTO_EXPANDEDPUBLICKEYBYTES)
+
+static uint8_t sigs[NSIGS * CRYPTO_BYTES];
+static uint8_t msgs[NSIGS * MLEN];
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1e6 * (double)ts.tv_sec + 1e-3 * (double)ts.tv_nsec;
+}
+
+static long peak_rss_kib(void) {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+/*
+ * Generates a key pair, the expanded public key and NSIGS signatures and
+ * writes them to fd. Runs in its own process, so the memory used for key
+ * generation and signing does not show up in the peak RSS of the verifier.
+ */
+static int generate(int fd) {
+    uint8_t *buf = calloc(1, FILE_BYTES);
+    uint8_t *sk = malloc(CRYPTO_SECRETKEYBYTES);
+    size_t siglen;
+    int i;
+
+    if (buf == NULL || sk == NULL) {
+        return -1;
+    }
+    if (crypto_sign_keypair(buf + OFF_PK, sk) != 0) {
+        return -1;
+    }
+    if (crypto_sign_expand_pk(buf + OFF_EPK, buf + OFF_PK) != 0) {
+        return -1;
+    }
+    randombytes(buf + OFF_MSG, NSIGS * MLEN);
+    for (i = 0; i < NSIGS; i++) {
+        if (crypto_sign_signature(buf + OFF_SIG + i * CRYPTO_BYTES, &siglen,
+                                  buf + OFF_MSG + i * MLEN, MLEN, sk) != 0 ||
+                siglen != CRYPTO_BYTES) {
+            return -1;
+        }
+    }
+    if (write(fd, buf, FILE_BYTES) != FILE_BYTES) {
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Verifies all signatures against the key of len bytes at offset off of
+ * the file, which is mmap()ed read-only on its own, with
+ * crypto_sign_verify() or, if expanded is set, crypto_sign_verify_expanded().
+ * Runs in its own process and prints the mean latency and the peak resident
+ * set size of that process (ru_maxrss, in KiB on Linux; mapped key pages
+ * count towards it).
+ */
+static int verify_all(int fd, size_t off, size_t len, int expanded, const char *label) {
+    const uint8_t *key;
+    double start, t;
+    long rss_base;
+    int i, r;
+
+    if (pread(fd, sigs, sizeof(sigs), OFF_SIG) != sizeof(sigs) ||
+            pread(fd, msgs, sizeof(msgs), OFF_MSG) != sizeof(msgs)) {
+        puts("ERROR: cannot read signatures");
+        return -1;
+    }
+    rss_base = peak_rss_kib();
+    key = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, (off_t)off);
+    if (key == MAP_FAILED) {
+        puts("ERROR: cannot map key file");
+        return -1;
+    }
+
+    start = now_us();
+    for (i = 0; i < NSIGS; i++) {
+        if (expanded) {
+            r = crypto_sign_verify_expanded(sigs + i * CRYPTO_BYTES, CRYPTO_BYTES,
+                                            msgs + i * MLEN, MLEN, key);
+        } else {
+            r = crypto_sign_verify(sigs + i * CRYPTO_BYTES, CRYPTO_BYTES,
+                                   msgs + i * MLEN, MLEN, key);
+        }
+        if (r != 0) {
+            printf("ERROR: signature does not verify with %s\n", label);
+            return -1;
+        }
+    }
+    t = now_us() - start;
+
+    printf("  %-28s %10.1f us/signature, peak RSS %6ld KiB (%ld KiB before)\n",
+           label, t / NSIGS, peak_rss_kib(), rss_base);
+    fflush(stdout);
+    munmap((void *)key, len);
+    return 0;
+}
+
+static int run_in_child(int (*fun)(int), int fd) {
+    pid_t pid;
+    int status;
+
+    pid = fork();
+    if (pid < 0) {
+        return -1;
+    }
+    if (pid == 0) {
+        _exit(fun(fd) == 0 ? 0 : 1);
+    }
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static int verify_pk(int fd) {
+    return verify_all(fd, OFF_PK, CRYPTO_PUBLICKEYBYTES, 0, "crypto_sign_verify:");
+}
+
+static int verify_epk(int fd) {
+    return verify_all(fd, OFF_EPK, CRYPTO_EXPANDEDPUBLICKEYBYTES, 1, "crypto_sign_verify_expanded:");
+}
+
+/*
+ * Verifies signatures against a public key that is mmap()ed read-only from
+ * a file, once with the key as is and once with the key expanded by
+ * crypto_sign_expand_pk(). Key generation, signing and each kind of
+ * verification run in separate processes, so the reported peak RSS is that
+ * of verification alone. Also checks that a damaged signature is rejected
+ * on both paths. This is meant for schemes with an expanded public key
+ * (cyclic Rainbow).
+ */
+int main(void) {
+    char path[] = "/tmp/verifymmap_XXXXXX";
+    const uint8_t *mapped;
+    uint8_t sig[CRYPTO_BYTES];
+    double start, t_expand;
+    uint8_t *epk;
+    int fd;
+
+    fd = mkstemp(path);
+    if (fd < 0) {
+        puts("ERROR: cannot create key file");
+        return -1;
+    }
+    unlink(path);
+
+    if (run_in_child(generate, fd) != 0) {
+        puts("ERROR: key generation or signing failed");
+        return -1;
+    }
+
+    printf("%s: %d verifications per key format\n", CRYPTO_ALGNAME, NSIGS);
+    printf("  public key:          %8d bytes\n", (int)CRYPTO_PUBLICKEYBYTES);
+    printf("  expanded public key: %8d bytes\n", (int)CRYPTO_EXPANDEDPUBLICKEYBYTES);
+    fflush(stdout);
+    if (run_in_child(verify_pk, fd) != 0 || run_in_child(verify_epk, fd) != 0) {
+        return -1;
+    }
+
+    mapped = mmap(NULL, FILE_BYTES, PROT_READ, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        puts("ERROR: cannot map key file");
+        return -1;
+    }
+
+    /* A damaged signature must be rejected on both paths. */
+    memcpy(sig, mapped + OFF_SIG, CRYPTO_BYTES);
+    sig[0] ^= 1;
+    if (crypto_sign_verify(sig, CRYPTO_BYTES, mapped + OFF_MSG, MLEN, mapped + OFF_PK) == 0 ||
+            crypto_sign_verify_expanded(sig, CRYPTO_BYTES, mapped + OFF_MSG, MLEN, mapped + OFF_EPK) == 0) {
+        puts("ERROR: damaged signature was accepted");
+        return -1;
+    }
+
+    /* The expanded key must not depend on where it was computed. */
+    epk = malloc(CRYPTO_EXPANDEDPUBLICKEYBYTES);
+    if (epk == NULL) {
+        puts("ERROR: out of memory");
+        return -1;
+    }
+    start = now_us();
+    crypto_sign_expand_pk(epk, mapped + OFF_PK);
+    t_expand = now_us() - start;
+    if (memcmp(epk, mapped + OFF_EPK, CRYPTO_EXPANDEDPUBLICKEYBYTES) != 0) {
+        puts("ERROR: crypto_sign_expand_pk is not deterministic");
+        return -1;
+    }
+    free(epk);
+    munmap((void *)mapped, FILE_BYTES);
+    close(fd);
+
+    printf("  crypto_sign_expand_pk:       %10.1f us\n", t_expand);
+    return 0;
+}
@@ -77,6 +77,12 @@ int main(void)
     r = 1;
   }
 
+  aes256_ctr_ic(ct, 67 - AES_BLOCKBYTES, nonce, 1, &ctx256);
+  if(memcmp(ct, stream256 + AES_BLOCKBYTES, 67 - AES_BLOCKBYTES)) {
+    printf("ERROR AES256CTR with initial counter does not match test vector.\n");
+    r = 1;
+  }
+
 
   aes128_ecb(ct, msg, sizeof(msg) / AES_BLOCKBYTES, &ctx128);
   if(memcmp(ct, ct128, 48)) {
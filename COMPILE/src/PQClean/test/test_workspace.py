@@ -0,0 +1,54 @@
+"""
+Checks that the _ws functions of every scheme/implementation that declares
+CRYPTO_WORKSPACEBYTES work with a workspace of exactly that size and produce
+the same output as the functions that keep the workspace on the stack.
+"""
+
+import os
+
+import pytest
+
+import helpers
+import pqclean
+
+
+def has_workspace(implementation):
+    with open(os.path.join(implementation.path(), 'api.h')) as f:
+        return 'CRYPTO_WORKSPACEBYTES' in f.read()
+
+
+IMPLEMENTATIONS = [impl
+                   for impl in pqclean.Scheme.all_supported_implementations()
+                   if has_workspace(impl)]
+
+
+@pytest.mark.parametrize(
+    'implementation,test_dir,impl_path, init, destr',
+    [(impl, *helpers.isolate_test_files(impl.path(), 'test_workspace_'))
+     for impl in IMPLEMENTATIONS],
+    ids=[str(impl) for impl in IMPLEMENTATIONS],
+)
+@helpers.skip_windows()
+@helpers.filtered_test
+def test_workspace(implementation, impl_path, test_dir, init, destr):
+    init()
+    dest_dir = os.path.join(test_dir, 'bin')
+    helpers.make('workspace',
+                 TYPE=implementation.scheme.type,
+                 SCHEME=implementation.scheme.name,
+                 IMPLEMENTATION=implementation.name,
+                 SCHEME_DIR=impl_path,
+                 DEST_DIR=dest_dir,
+                 working_dir=os.path.join(test_dir, 'test'))
+    helpers.run_subprocess(
+        [os.path.join(dest_dir, 'workspace_{}_{}'.format(
+            implementation.scheme.name,
+            implementation.name,
+        ))],
+    )
+    destr()
+
+
+if __name__ == '__main__':
+    import sys
+    pytest.main(sys.argv)
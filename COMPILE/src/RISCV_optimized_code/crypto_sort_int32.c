@@ -0,0 +1,78 @@
+#include "crypto_sort_int32.h"
+
+#include <stdint.h>
+
+/* Constant-time sorting network shared by NTRU (fixed-weight sampling)    */
+/* and Streamlined NTRU Prime / NTRU LPRime (short polynomial sampling).    */
+/* The network is supercop-20190110/crypto_sort/int32/portable3. With HW   */
+/* defined each comparator is a pair of single-cycle p.min/p.max, which    */
+/* replaces the eight-instruction branch-free MINMAX of the portable code. */
+/* The packed pv.min/pv.max only exist for 8- and 16-bit lanes, which is   */
+/* too narrow for the 32-bit keys used by both families.                   */
+
+#define HW
+
+#ifdef HW
+#define int32_MINMAX(a,b) \
+    do { \
+        int32_t t_ = (a); \
+        __asm__("p.min %0, %1, %2" : "=r"(a) : "r"(t_), "r"(b)); \
+        __asm__("p.max %0, %1, %2" : "=r"(b) : "r"(t_), "r"(b)); \
+    } while(0)
+#else
+#define int32_MINMAX(a,b) \
+    do { \
+        int32_t ab = (b) ^ (a); \
+        int32_t c = (int32_t)((int64_t)(b) - (int64_t)(a)); \
+        c ^= ab & (c ^ (b)); \
+        c >>= 31; \
+        c &= ab; \
+        (a) ^= c; \
+        (b) ^= c; \
+    } while(0)
+#endif
+
+void crypto_sort_int32(int32_t *x, long long n) {
+    long long top, p, q, r, i;
+
+    if (n < 2) {
+        return;
+    }
+    top = 1;
+    while (top < n - top) {
+        top += top;
+    }
+
+    for (p = top; p > 0; p >>= 1) {
+        for (i = 0; i < n - p; ++i) {
+            if (!(i & p)) {
+                int32_MINMAX(x[i], x[i + p]);
+            }
+        }
+        i = 0;
+        for (q = top; q > p; q >>= 1) {
+            for (; i < n - q; ++i) {
+                if (!(i & p)) {
+                    int32_t a = x[i + p];
+                    for (r = q; r > p; r >>= 1) {
+                        int32_MINMAX(a, x[i + r]);
+                    }
+                    x[i + p] = a;
+                }
+            }
+        }
+    }
+}
+
+/* Unsigned order is signed order with the top bit flipped */
+void crypto_sort_uint32(uint32_t *x, long long n) {
+    long long i;
+
+    for (i = 0; i < n; i++) {
+        x[i] ^= 0x80000000;
+    }
+    crypto_sort_int32((int32_t *)x, n);
+    for (i = 0; i < n; i++) {
+        x[i] ^= 0x80000000;
+    }
+}
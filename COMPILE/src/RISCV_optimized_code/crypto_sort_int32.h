@@ -0,0 +1,9 @@
+#ifndef CRYPTO_SORT_INT32_H
+#define CRYPTO_SORT_INT32_H
+
+#include <stdint.h>
+
+void crypto_sort_int32(int32_t *x, long long n);
+void crypto_sort_uint32(uint32_t *x, long long n);
+
+#endif
@@ -0,0 +1,104 @@
+/*
+	RISQ-V: a product is a Karatsuba multiplication of 32-bit words, each word product taking one gf.clmul and one gf.clmulh.
+*/
+
+#define HW
+
+#include "F47Field.h"
+
+/*
+	Write a field element to a char array
+
+	W : writer object
+	a : field element to write
+*/
+void f47serialize_FELT(writer *W, f47FELT a) {
+	serialize_uint64_t(W, a , 47);
+}
+
+/*
+	Read a field element from a char array
+
+	R : reader object
+
+	returns : a field element
+*/
+f47FELT f47deserialize_FELT(reader *R) {
+	return ((f47FELT) deserialize_uint64_t(R,47));
+}
+
+/*
+	Carry-less product of two 32-bit words
+*/
+static inline uint64_t clmul32(uint32_t a, uint32_t b){
+#ifdef HW
+	uint32_t lo, hi;
+	asm volatile(
+		"gf.clmul %[lo],%[a],%[b]\n"
+		"gf.clmulh %[hi],%[a],%[b]\n"
+		: [lo]"=&r" (lo), [hi]"=r" (hi)
+		: [a]"r" (a), [b]"r" (b));
+	return ((uint64_t) hi << 32) | lo;
+#else
+	uint64_t p = 0;
+	int i;
+	for (i = 0; i < 32; i++) {
+		p ^= ((uint64_t) a << i) & (0 - (uint64_t) ((b >> i) & 1));
+	}
+	return p;
+#endif
+}
+
+/*
+	Multiplies two field elements
+
+	a,b : reduced field element to multiply
+
+	return : the reduced product of a and b
+*/
+f47FELT f47multiply(f47FELT a, f47FELT b) {
+	a = a & 0x7fffffffffff;
+	b = b & 0x7fffffffffff;
+	uint32_t a_upper = a >> 32;
+	uint32_t a_lower = (uint32_t) a;
+	uint32_t b_upper = b >> 32;
+	uint32_t b_lower = (uint32_t) b;
+
+	// karatsuba
+	uint64_t out64 = clmul32(a_upper, b_upper);
+	uint64_t out0  = clmul32(a_lower, b_lower);
+	uint64_t out32 = clmul32(a_upper ^ a_lower, b_upper ^ b_lower) ^ out64 ^ out0;
+
+	out0  ^= out32 << 32;
+	out64 ^= out32 >> 32;
+
+	// x^47 = x^5 + 1
+	uint64_t overflow = (out0 >> 47) | (out64 << 17);
+	uint64_t out = (out0 & 0x7fffffffffff) ^ overflow ^ (overflow << 5);
+	overflow = out >> 47;
+	out ^= overflow ^ (overflow << 5);
+	return out & 0x7fffffffffff;
+}
+
+/*
+	Inverts a field element
+
+	a : field element to invert
+
+	return : the inverse of a, if a is nonzero
+*/
+f47FELT f47inverse(f47FELT a) {
+	uint64_t pow = 0x7ffffffffffe;
+	//uint64_t pow = 0x1;
+	uint64_t e = a;
+	uint64_t ans = 1;
+	while(pow != 0){
+		if((pow & 1) == 1){
+			ans = f47multiply(ans,e);
+		}
+		e = f47multiply(e,e);
+		pow >>= 1;
+	}
+	return ans;
+}
+
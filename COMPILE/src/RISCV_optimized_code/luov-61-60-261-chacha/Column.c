@@ -0,0 +1,317 @@
+/*
+	RISQ-V: the bitsliced kernels work on 32-bit words. The bit that selects a column is turned into a mask by p.extractr, which sign-extends a bit field of width one,
+	and the loops over the slices run as hardware loops.
+*/
+
+#define HW
+
+#include "Column.h"
+
+#if OIL_VARS>64
+
+/*
+	Write a column to a char array
+*/
+void serialize_column(writer * W, column b) {
+	int a = 0;
+	int bits = OIL_VARS;
+	while (bits >64 ){
+		serialize_uint64_t(W, b.components[a++]  , 64);
+		bits -= 64;
+	}
+	serialize_uint64_t(W, b.components[a], bits);
+}
+
+/*
+	Read a column from a char array
+*/
+column deserialize_column(reader * R) {
+	column out;
+	int a = 0;
+	int bits = OIL_VARS;
+	while (bits >64 ){
+		out.components[a++] = deserialize_uint64_t(R, 64);
+		bits -= 64;
+	}
+	out.components[a] = deserialize_uint64_t(R, bits);
+	return out;
+}
+
+/*
+	xor two columns
+*/
+column xor(column a, column b) {
+	int i;
+	column BC;
+	for(i=0 ; i<COLUMN_COMPONENTS ; i++){
+		BC.components[i] = a.components[i] ^ b.components[i];
+	}
+	return BC;
+}
+
+/*
+	Randomize column with Keccak Sponge
+*/
+column random_column(Sponge *sponge) {
+	column BC;
+	int i;
+	for(i=0 ; i<COLUMN_COMPONENTS-1 ; i++){
+		BC.components[i] = squeezeuint64_t(sponge,8);
+	}
+	BC.components[COLUMN_COMPONENTS-1] = squeezeuint64_t(sponge,((OIL_VARS%64)+7)/8);
+	return BC;
+}
+
+/*
+	Get a bit from the column
+*/
+uint64_t getBit(column container, uint64_t bit) {
+	return (container.components[bit/64] & ((uint64_t)1) << (bit%64) );
+}
+
+/*
+	Flip a bit from the column
+*/
+void flipBit(column *container, uint64_t bit) {
+	container->components[bit/64] ^= ((uint64_t)1) << (bit%64);
+}
+
+#endif
+
+/*
+	Generates an array of columns
+
+	sponge : pointer to a Sponge object
+	arr    : the array that will receive the generated columns
+	size   : the number of columns that is generated
+*/
+void squeeze_column_array(Sponge *sponge, column *arr, int size) {
+	int i;
+	for (i = 0; i < size; i++) {
+		arr[i] = random_column(sponge);
+	}
+}
+
+#define COLUMN_WORDS32 (2*COLUMN_WORDS)
+
+/*
+	Returns the all-ones word if bit b of w is set and zero otherwise
+*/
+static inline uint32_t bit_mask(uint32_t w, uint32_t b) {
+#ifdef HW
+	uint32_t m;
+	asm volatile("p.extractr %[m],%[w],%[b]\n" : [m]"=r" (m) : [w]"r" (w), [b]"r" (b));
+	return m;
+#else
+	return -((w >> b) & 1);
+#endif
+}
+
+/*
+	s[b] ^= c for every bit b < n of bits, where s[b] and c are columns of COLUMN_WORDS32 words and 0 < n <= 32
+*/
+static void xor_selected(uint32_t *s, const uint32_t *c, uint32_t bits, int n) {
+#ifdef HW
+	uint32_t m, x, y, t, b = 0;
+#if COLUMN_WORDS32 == 2
+	asm volatile(
+		"lp.setup x0,%[n],(.end_xor_selected%=)\n"
+			"p.extractr %[m],%[e],%[b]\n"
+			"lw %[x],0(%[s])\n"
+			"lw %[y],4(%[s])\n"
+			"addi %[b],%[b],1\n"
+			"and %[t],%[c0],%[m]\n"
+			"xor %[x],%[x],%[t]\n"
+			"and %[t],%[c1],%[m]\n"
+			"xor %[y],%[y],%[t]\n"
+			"sw %[x],0(%[s])\n"
+			"sw %[y],4(%[s])\n"
+			"addi %[s],%[s],8\n"
+		".end_xor_selected%=:\n"
+		: [s]"+r" (s), [b]"+r" (b), [m]"=&r" (m), [x]"=&r" (x), [y]"=&r" (y), [t]"=&r" (t)
+		: [n]"r" (n), [e]"r" (bits), [c0]"r" (c[0]), [c1]"r" (c[1])
+		: "memory");
+#else
+	asm volatile(
+		"lp.setup x0,%[n],(.end_xor_selected%=)\n"
+			"p.extractr %[m],%[e],%[b]\n"
+			"lw %[x],0(%[s])\n"
+			"lw %[y],4(%[s])\n"
+			"and %[t],%[c0],%[m]\n"
+			"xor %[x],%[x],%[t]\n"
+			"and %[t],%[c1],%[m]\n"
+			"xor %[y],%[y],%[t]\n"
+			"sw %[x],0(%[s])\n"
+			"sw %[y],4(%[s])\n"
+			"lw %[x],8(%[s])\n"
+			"lw %[y],12(%[s])\n"
+			"addi %[b],%[b],1\n"
+			"and %[t],%[c2],%[m]\n"
+			"xor %[x],%[x],%[t]\n"
+			"and %[t],%[c3],%[m]\n"
+			"xor %[y],%[y],%[t]\n"
+			"sw %[x],8(%[s])\n"
+			"sw %[y],12(%[s])\n"
+			"addi %[s],%[s],16\n"
+		".end_xor_selected%=:\n"
+		: [s]"+r" (s), [b]"+r" (b), [m]"=&r" (m), [x]"=&r" (x), [y]"=&r" (y), [t]"=&r" (t)
+		: [n]"r" (n), [e]"r" (bits), [c0]"r" (c[0]), [c1]"r" (c[1]), [c2]"r" (c[2]), [c3]"r" (c[3])
+		: "memory");
+#endif
+#else
+	uint32_t m;
+	int b, w;
+
+	for (b = 0; b < n; b++) {
+		m = bit_mask(bits, b);
+		for (w = 0; w < COLUMN_WORDS32; w++) {
+			s[b*COLUMN_WORDS32 + w] ^= c[w] & m;
+		}
+	}
+#endif
+}
+
+/*
+	s[i] ^= c[i] & m for 0 <= i < n, n > 0
+*/
+static void xor_masked(uint32_t *s, const uint32_t *c, uint32_t m, int n) {
+#ifdef HW
+	uint32_t x, y;
+	asm volatile(
+		"lp.setup x0,%[n],(.end_xor_masked%=)\n"
+			"p.lw %[x],4(%[c]!)\n"
+			"lw %[y],0(%[s])\n"
+			"and %[x],%[x],%[m]\n"
+			"xor %[y],%[y],%[x]\n"
+			"p.sw %[y],4(%[s]!)\n"
+		".end_xor_masked%=:\n"
+		: [s]"+r" (s), [c]"+r" (c), [x]"=&r" (x), [y]"=&r" (y)
+		: [n]"r" (n), [m]"r" (m)
+		: "memory");
+#else
+	int i;
+
+	for (i = 0; i < n; i++) {
+		s[i] ^= c[i] & m;
+	}
+#endif
+}
+
+/*
+	Adds a multiple of a column to a bitsliced vector: acc[b] ^= r for every bit b of a
+
+	acc : bitsliced vector of FIELD_SIZE columns
+	r   : the column, one bit per element of acc
+	a   : the field element r is multiplied with
+*/
+void bitsliced_add_scaled(column *acc, column r, FELT a) {
+#if FIELD_SIZE == 7
+	xor_selected((uint32_t *) acc, (const uint32_t *) &r, a, FIELD_SIZE);
+#else
+	uint32_t *s = (uint32_t *) acc;
+	const uint32_t *e = (const uint32_t *) &a;
+	int b;
+
+	for (b = 0; b < FIELD_SIZE; b += 32) {
+		xor_selected(s + b*COLUMN_WORDS32, (const uint32_t *) &r, e[b/32], (FIELD_SIZE - b < 32) ? FIELD_SIZE - b : 32);
+	}
+#endif
+}
+
+/*
+	Adds src to every block of acc that is selected by a column: acc[o*len + i] ^= src[i] for every bit o of sel
+
+	acc : OIL_VARS blocks of len columns
+	src : len columns
+	len : the number of columns in a block
+	sel : the column that selects the blocks of acc
+*/
+void columns_add_selected(column *acc, const column *src, int len, column sel) {
+	uint32_t *s = (uint32_t *) acc;
+	const uint32_t *c = (const uint32_t *) src;
+	const uint32_t *e = (const uint32_t *) &sel;
+	int o;
+
+	if (len == 1) {
+		for (o = 0; o < OIL_VARS; o += 32) {
+			xor_selected(s + o*COLUMN_WORDS32, c, e[o/32], (OIL_VARS - o < 32) ? OIL_VARS - o : 32);
+		}
+		return;
+	}
+
+	for (o = 0; o < OIL_VARS; o++) {
+		xor_masked(s, c, bit_mask(e[o/32], o%32), len*COLUMN_WORDS32);
+		s += len*COLUMN_WORDS32;
+	}
+}
+
+/*
+	Converts a bitsliced vector to OIL_VARS field elements
+
+	out : receives the field elements
+	acc : bitsliced vector of FIELD_SIZE columns
+*/
+void bitsliced_unslice(FELT *out, const column *acc) {
+	const uint32_t *s = (const uint32_t *) acc;
+	uint32_t w[3];
+	int k, b;
+
+	for (k = 0; k < OIL_VARS; k++) {
+		w[0] = 0;
+		w[1] = 0;
+		w[2] = 0;
+		for (b = 0; b < FIELD_SIZE; b++) {
+			w[b/32] |= ((s[b*COLUMN_WORDS32 + k/32] >> (k%32)) & 1) << (b%32);
+		}
+#if FIELD_SIZE == 79
+		out[k].coef[0] = ((uint64_t) w[1] << 32) | w[0];
+		out[k].coef[1] = w[2];
+#else
+		out[k] = (FELT) (((uint64_t) w[1] << 32) | w[0]);
+#endif
+	}
+}
+
+void ColumnGenerator_init(ColumnGenerator * col_gen, const unsigned char* key){
+	int i;
+	unsigned char stream[16] = {0};
+
+	for(i=0; i<STATES; i++){
+		stream[0] = i;
+		PRNG_INIT(&col_gen->states[i], key, stream);
+	}
+	col_gen->cols_used = BLOCK_SIZE/2;
+}
+
+
+column Next_Column(ColumnGenerator *col_gen){
+	unsigned char i;
+	if(col_gen->cols_used == BLOCK_SIZE/2){
+		for(i=0; i<STATES; i++){
+			PRNG_GET_BLOCK(&col_gen->states[i],col_gen->blocks[i]);
+		}
+		col_gen->cols_used = 0;
+	}
+
+	#if (OIL_VARS <= 64)
+		column Out = 0;
+		for(i=0; i<STATES; i++){
+			Out |= ((column)col_gen->blocks[i][col_gen->cols_used*2    ]) << (16*i);
+			Out |= ((column)col_gen->blocks[i][col_gen->cols_used*2 + 1]) << (16*i+8);
+		}
+	#else
+		column Out = {0};
+		for(i=0; i<4; i++){
+			Out.components[0] |= ((uint64_t)col_gen->blocks[i][col_gen->cols_used*2    ]) << (16*i);
+			Out.components[0] |= ((uint64_t)col_gen->blocks[i][col_gen->cols_used*2 + 1]) << (16*i+8);
+		}
+
+		for(; i<STATES; i++){
+			Out.components[1] |= ((uint64_t)col_gen->blocks[i][col_gen->cols_used*2 + 0]) << (16*(i-4));
+			Out.components[1] |= ((uint64_t)col_gen->blocks[i][col_gen->cols_used*2 + 1]) << (16*(i-4)+8);
+		}
+	#endif
+
+	col_gen->cols_used ++;
+	return Out;
+}
@@ -0,0 +1,202 @@
+#include "mq.h"
+#include "params.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/* The terms of the MQ system are stored as signed bytes, so that a single   */
+/* pv.sdotsp.b multiplies a pair of terms with the bytewise pair of          */
+/* coefficients that F holds for one output and adds both products to an    */
+/* exact 32-bit accumulator. Each 32-bit load of F covers two outputs; the   */
+/* pair of terms is placed in the lower or the upper half of the other       */
+/* operand to select one of them. Reduction only happens once per output,    */
+/* as in the clean code. The products x_i * x_j are formed two at a time in  */
+/* the 16-bit lanes of pq.mac and reduced with the lanes still packed.       */
+/* The terms are below 128 since x and y are below 64.                       */
+
+#define HW
+
+#define N_QUAD_TERMS ((N * (N + 1)) >> 1)
+#define N_MQ_TERMS (N + N_QUAD_TERMS)
+
+/* Two 16-bit lanes of a and b multiplied and added to acc, modulo 2^16. */
+static inline uint32_t mac2(uint32_t acc, uint32_t a, uint32_t b) {
+#ifdef HW
+    asm volatile(
+        "pq.mac %[acc],%[a],%[b]\n"
+        : [acc]"+r" (acc)
+        : [a]"r" (a), [b]"r" (b)
+    );
+    return acc;
+#else
+    return (uint32_t)((uint16_t)(acc + (a & 0xFFFF) * (b & 0xFFFF))) |
+           ((uint32_t)((uint16_t)((acc >> 16) + (a >> 16) * (b >> 16))) << 16);
+#endif
+}
+
+/* Reduces both 16-bit lanes of x (each below 2^12) to [0, 30]. */
+static inline uint32_t mod31x2(uint32_t x) {
+    uint32_t t, m;
+
+    t = (x & 0x001F001F) + ((x >> 5) & 0x001F001F) + ((x >> 10) & 0x00030003);
+    t = (t & 0x001F001F) + ((t >> 5) & 0x00030003);
+    t = (t & 0x001F001F) + ((t >> 5) & 0x00010001);
+    m = ((t + 0x00010001) >> 5) & 0x00010001;
+    return t - 31 * m;
+}
+
+/* Packs x[i] into both 16-bit lanes. */
+static inline uint32_t dup(const gf31 *x, int i) {
+    return (uint32_t)x[i] * 0x00010001;
+}
+
+/* Packs x[i] and x[i + 1] into the lower and upper 16-bit lane. */
+static inline uint32_t pair(const gf31 *x, int i) {
+    return (uint32_t)x[i] | ((uint32_t)x[i + 1] << 16);
+}
+
+/* Computes all products x_i * x_j, returns in reduced form. x must have one
+   extra element at index N. */
+static void generate_quadratic_terms(int8_t *xij, const gf31 *x) {
+    uint32_t t, xi;
+    int i, j, k;
+
+    k = 0;
+    for (i = 0; i < N; i++) {
+        xi = dup(x, i);
+        for (j = 0; j < i; j += 2) {
+            t = mod31x2(mac2(0, xi, pair(x, j)));
+            xij[k++] = (int8_t)t;
+            xij[k++] = (int8_t)(t >> 16);
+        }
+        if (j == i) {
+            t = mod31x2(mac2(0, xi, pair(x, j)));
+            xij[k++] = (int8_t)t;
+        }
+    }
+}
+
+/* Computes all terms (x_i * y_j) + (x_j * y_i), returns in reduced form. x
+   and y must have one extra element at index N. */
+static void generate_xiyj_p_xjyi_terms(int8_t *xij, const gf31 *x, const gf31 *y) {
+    uint32_t t, xi, yi;
+    int i, j, k;
+
+    k = 0;
+    for (i = 0; i < N; i++) {
+        xi = dup(x, i);
+        yi = dup(y, i);
+        for (j = 0; j < i; j += 2) {
+            t = mod31x2(mac2(mac2(0, xi, pair(y, j)), yi, pair(x, j)));
+            xij[k++] = (int8_t)t;
+            xij[k++] = (int8_t)(t >> 16);
+        }
+        if (j == i) {
+            t = mod31x2(mac2(mac2(0, xi, pair(y, j)), yi, pair(x, j)));
+            xij[k++] = (int8_t)t;
+        }
+    }
+}
+
+/* Adds the products of nterms terms with F to the M accumulators in r. F
+   holds the coefficients of the terms 2p and 2p + 1 at F[2 * p * M]. */
+static void evaluate(int32_t *r, const int8_t *terms, int nterms, const signed char *F) {
+    int j;
+
+#ifdef HW
+    for (j = 0; j < M; j += 8) {
+        const int8_t *pt = terms;
+        const signed char *pf = F + 2 * j;
+        int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        int32_t acc4 = 0, acc5 = 0, acc6 = 0, acc7 = 0;
+
+        asm volatile(
+            "lp.setup x0,%[np],(.end_mq_eval%=)\n"
+                "p.lhu t4,2(%[pt]!)\n"         // t4 = t_2p | t_2p+1 << 8
+                "lw t1,4(%[pf])\n"
+                "lw t2,8(%[pf])\n"
+                "lw t3,12(%[pf])\n"
+                "p.lw t0,%[stride](%[pf]!)\n"
+                "slli t5,t4,16\n"
+                "pv.sdotsp.b %[a0],t0,t4\n"     // a0 += F[., 2j] * t_2p + F[., 2j + 1] * t_2p+1
+                "pv.sdotsp.b %[a1],t0,t5\n"     // a1 += F[., 2j + 2] * t_2p + F[., 2j + 3] * t_2p+1
+                "pv.sdotsp.b %[a2],t1,t4\n"
+                "pv.sdotsp.b %[a3],t1,t5\n"
+                "pv.sdotsp.b %[a4],t2,t4\n"
+                "pv.sdotsp.b %[a5],t2,t5\n"
+                "pv.sdotsp.b %[a6],t3,t4\n"
+                "pv.sdotsp.b %[a7],t3,t5\n"
+            ".end_mq_eval%=:\n"
+            : [pt]"+r" (pt), [pf]"+r" (pf),
+              [a0]"+r" (acc0), [a1]"+r" (acc1), [a2]"+r" (acc2), [a3]"+r" (acc3),
+              [a4]"+r" (acc4), [a5]"+r" (acc5), [a6]"+r" (acc6), [a7]"+r" (acc7)
+            : [np]"r" (nterms >> 1), [stride]"i" (2 * M)
+            : "t0", "t1", "t2", "t3", "t4", "t5", "memory"
+        );
+        r[j + 0] = acc0;
+        r[j + 1] = acc1;
+        r[j + 2] = acc2;
+        r[j + 3] = acc3;
+        r[j + 4] = acc4;
+        r[j + 5] = acc5;
+        r[j + 6] = acc6;
+        r[j + 7] = acc7;
+    }
+#else
+    int i;
+
+    memset(r, 0, M * sizeof(int32_t));
+    for (i = 0; i < nterms; i += 2) {
+        for (j = 0; j < M; j++) {
+            r[j] += ((int)terms[i]) * ((int)F[i * M + 2 * j]) +
+                    ((int)terms[i + 1]) * ((int)F[i * M + 2 * j + 1]);
+        }
+    }
+#endif
+}
+
+/* Evaluates the MQ function on a vector of N gf31 elements x (expected to be
+   in reduced 5-bit representation). Expects the coefficients in F to be in
+   signed representation (i.e. [-15, 15], packed bytewise).
+   Outputs M gf31 elements in unique 16-bit representation as fx. */
+void PQCLEAN_MQDSS48_CLEAN_MQ(gf31 *fx, const gf31 *x, const signed char *F) {
+    int8_t terms[N_MQ_TERMS];
+    gf31 xp[N + 1];
+    int32_t r[M];
+    int i;
+
+    memcpy(xp, x, N * sizeof(gf31));
+    xp[N] = 0;
+    for (i = 0; i < N; i++) {
+        terms[i] = (int8_t)x[i];
+    }
+    generate_quadratic_terms(terms + N, xp);
+    evaluate(r, terms, N_MQ_TERMS, F);
+
+    for (i = 0; i < M; i++) {
+        fx[i] = PQCLEAN_MQDSS48_CLEAN_mod31((gf31)((r[i] >> 15) + (r[i] & 0x7FFF)));
+    }
+}
+
+/* Evaluates the bilinear polar form of the MQ function (i.e. G) on a vector of
+   N gf31 elements x (expected to be in reduced 5-bit representation). Expects
+   the coefficients in F to be in signed representation (i.e. [-15, 15], packed
+   bytewise). Outputs M gf31 elements in unique 16-bit representation as fx. */
+void PQCLEAN_MQDSS48_CLEAN_G(gf31 *fx, const gf31 *x, const gf31 *y, const signed char *F) {
+    int8_t terms[N_QUAD_TERMS];
+    gf31 xp[N + 1];
+    gf31 yp[N + 1];
+    int32_t r[M];
+    int i;
+
+    memcpy(xp, x, N * sizeof(gf31));
+    memcpy(yp, y, N * sizeof(gf31));
+    xp[N] = 0;
+    yp[N] = 0;
+    generate_xiyj_p_xjyi_terms(terms, xp, yp);
+    evaluate(r, terms, N_QUAD_TERMS, F + N * M);
+
+    for (i = 0; i < M; i++) {
+        fx[i] = PQCLEAN_MQDSS48_CLEAN_mod31((gf31)((r[i] >> 15) + (r[i] & 0x7FFF)));
+    }
+}
@@ -0,0 +1,6 @@
+#include "crypto_sort.h"
+#include "crypto_sort_int32.h"
+
+void PQCLEAN_NTRUHPS4096821_CLEAN_crypto_sort(void *array, long long n) {
+    crypto_sort_int32(array, n);
+}
@@ -0,0 +1,418 @@
+#include "poly.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/* Polynomials are zero-padded to NTRU_N_PAD coefficients and multiplied   */
+/* with Toom-Cook-4 on top of two levels of Karatsuba, which leaves 63     */
+/* schoolbook products of NTRU_N_PAD/16 coefficients.                      */
+/* The Toom-4 interpolation divides by 8, so all results are only correct  */
+/* modulo 2^13. This is enough for every parameter set since q <= 2^13.    */
+/* With HW defined the schoolbook loop runs on pq.mac, two coefficients    */
+/* per instruction, inside the RI5CY hardware loops.                      */
+
+#define NTRU_N_PAD ((NTRU_N + 31) & ~31)
+
+#define TC_N (NTRU_N_PAD / 4)
+#define TC_N_RES (2 * TC_N - 1)
+#define KARATSUBA_N TC_N
+
+#define HW
+
+static void karatsuba_simple(const uint16_t *a_1, const uint16_t *b_1, uint16_t *result_final) {
+    uint16_t d01[KARATSUBA_N / 2 - 1];
+    uint16_t d0123[KARATSUBA_N / 2 - 1];
+    uint16_t d23[KARATSUBA_N / 2 - 1];
+    uint16_t result_d01[KARATSUBA_N - 1];
+
+    int32_t i, j;
+
+    memset(result_d01, 0, (KARATSUBA_N - 1)*sizeof(uint16_t));
+    memset(d01, 0, (KARATSUBA_N / 2 - 1)*sizeof(uint16_t));
+    memset(d0123, 0, (KARATSUBA_N / 2 - 1)*sizeof(uint16_t));
+    memset(d23, 0, (KARATSUBA_N / 2 - 1)*sizeof(uint16_t));
+    memset(result_final, 0, (2 * KARATSUBA_N - 1)*sizeof(uint16_t));
+
+    uint16_t acc1, acc2, acc3, acc4, acc5, acc6, acc7, acc8, acc9, acc10;
+
+#ifdef HW
+    const uint16_t *addr_a = a_1;
+    const uint16_t *addr_b = b_1;
+    uint16_t *addr_final = result_final;
+    uint16_t *addr_d01 = d01;
+    uint16_t *addr_d23 = d23;
+    uint16_t *addr_res_d01 = result_d01;
+    uint16_t *addr_d0123 = d0123;
+
+    asm volatile(
+        ////////////
+        // acc1: t0
+        // acc2: t1
+        // acc3: t2
+        // acc4: t3
+        // acc5: t4
+        // acc6: t5
+        // acc7: t6
+        // acc8: a0
+        // acc9: a1
+        // acc10: a2
+        // tmp1: a3
+        // tmp2: a4
+        // tmp3: a5
+        ////////////
+
+        "li a7,%[n_inner]\n"
+        "li s1,%[rewind]\n"  // constant
+
+        "lp.starti x1, (.start_outer_hw_loop_ntru%=)\n"
+        "lp.endi x1, (.end_outer_hw_loop_ntru%=)\n"
+        "lp.counti x1, %[n_outer]\n"
+        ".start_outer_hw_loop_ntru%=:\n"
+
+            // Load coefficients a
+            "p.lhu t0,%[q1](%[addr_a]!)\n"      // acc1 = a_1[i + 0 * KARATSUBA_N / 4] //a0
+            "p.lhu t1,%[q1](%[addr_a]!)\n"      // acc2 = a_1[i + 1 * KARATSUBA_N / 4] //a1
+            "p.lhu t2,%[q1](%[addr_a]!)\n"      // acc3 = a_1[i + 2 * KARATSUBA_N / 4] //a2
+            "p.lhu t3,%[a_next](%[addr_a]!)\n"  // acc4 = a_1[i + 3 * KARATSUBA_N / 4] //a3
+
+            "pv.pack.h t0,t0,t0\n"
+            "pv.pack.h t1,t1,t1\n"
+            "pv.pack.h t2,t2,t2\n"
+            "pv.pack.h t3,t3,t3\n"
+
+            "lp.setup x0,a7,(.end_inner_hw_loop_ntru%=)\n"
+                // Load
+                "p.lw t4,%[q1](%[addr_b]!)\n"        // acc5 = b_1[j + 0 * KARATSUBA_N / 4] // b0
+                "p.lw t5,%[q1](%[addr_b]!)\n"        // acc6 = b_1[j + 1 * KARATSUBA_N / 4] // b1
+
+                "p.lw a3,%[q2](%[addr_final]!)\n"    // tmp1 = result_final[i + j + 0 * KARATSUBA_N / 4]
+                "p.lw a4,%[q2n](%[addr_final]!)\n"   // tmp2 = result_final[i + j + 2 * KARATSUBA_N / 4]
+                "p.lw a5,0(%[addr_d01]!)\n"          // tmp3 = d01[i + j]
+
+                // Operations
+                "pv.add.h t6,t4,t5\n"             // acc7 = acc5 + acc6 // b01
+                "pv.add.h a0,t0,t1\n"             // acc8 = acc1 + acc2 // a01
+
+                "pq.mac a3,t0,t4\n"               // tmp1 = result_final[i + j + 0 * KARATSUBA_N / 4] + acc1 * acc5
+                "pq.mac a4,t1,t5\n"               // tmp2 = result_final[i + j + 2 * KARATSUBA_N / 4] + acc2 * acc6
+
+                "pq.mac a5,t6,a0\n"               // tmp3 = d01[i + j] + acc7 * acc8
+
+                // Store results
+                "p.sw a3,%[q2](%[addr_final]!)\n"    // result_final[i + j + 0 * KARATSUBA_N / 4]
+                "p.sw a4,%[q2](%[addr_final]!)\n"    // result_final[i + j + 2 * KARATSUBA_N / 4]
+                "p.sw a5,4(%[addr_d01]!)\n"          // d01[i + j]
+
+                //-------------------------------------------------------------------------------------------------------------------------------------
+
+                // Load
+                "p.lw t6,%[q1](%[addr_b]!)\n"        // acc7 = b_1[j + 2 * KARATSUBA_N / 4] // b2
+                "p.lw a0,%[b_next](%[addr_b]!)\n"    // acc8 = b_1[j + 3 * KARATSUBA_N / 4] // b3
+
+                "p.lw a3,%[q2](%[addr_final]!)\n"    // tmp1 = result_final[i + j + 4 * KARATSUBA_N / 4]
+                "p.lw a4,%[q2n](%[addr_final]!)\n"   // tmp2 = result_final[i + j + 6 * KARATSUBA_N / 4]
+
+                "p.lw a5,0(%[addr_d23]!)\n"          // tmp3 = d23[i + j]
+
+                // Operations
+                "pv.add.h a1,t2,t3\n"             // acc9 = acc3 + acc4 // a23
+                "pv.add.h a2,t6,a0\n"             // acc10 = acc7 + acc8 // b23
+
+                "pq.mac a3,t2,t6\n"               // tmp1 = result_final[i + j + 4 * KARATSUBA_N / 4] + acc3 * acc7
+                "pq.mac a4,t3,a0\n"               // tmp2 = result_final[i + j + 6 * KARATSUBA_N / 4] + acc4 * acc8
+
+                "pq.mac a5,a1,a2\n"               // tmp3 = d23[i + j] + acc9 * acc10
+
+                // Store result
+                "p.sw a3,%[q2](%[addr_final]!)\n"      // result_final[i + j + 4 * KARATSUBA_N / 4]
+                "p.sw a4,%[final_next](%[addr_final]!)\n" // result_final[i + j + 6 * KARATSUBA_N / 4]
+                "p.sw a5,4(%[addr_d23]!)\n"            // d23[i + j]
+
+                //-------------------------------------------------------------------------------------------------------------------------------------
+
+                // Load
+                "p.lw a3,%[q2](%[addr_res_d01]!)\n"  // tmp1 = result_d01[i + j + 0 * KARATSUBA_N / 4]
+                "p.lw a4,%[q2n](%[addr_res_d01]!)\n" // tmp2 = result_d01[i + j + 2 * KARATSUBA_N / 4]
+                "p.lw a5,0(%[addr_d0123]!)\n"        // tmp3 = d0123[i + j]
+
+                // Operations
+                "pv.add.h t4,t4,t6\n"             // acc5 = acc5 + acc7 // b02
+                "pv.add.h t6,t0,t2\n"             // acc7 = acc1 + acc3 // a02
+
+                "pv.add.h t5,t5,a0\n"             // acc6 = acc6 + acc8 // b13
+                "pv.add.h a0,t1,t3\n"             // acc8 = acc2 + acc4 // a13
+
+                "pq.mac a3,t4,t6\n"               // tmp1 = result_d01[i + j + 0 * KARATSUBA_N / 4] + acc5 * acc7
+                "pq.mac a4,t5,a0\n"               // tmp2 = result_d01[i + j + 2 * KARATSUBA_N / 4] + acc6 * acc8
+
+                "pv.add.h t4,t4,t5\n"             // acc5 = acc5 + acc6 //b0123
+                "pv.add.h t6,t6,a0\n"             // acc7 = acc7 + acc8 //a0123
+
+                "pq.mac a5,t4,t6\n"               // tmp3 = d0123[i + j] + acc5 * acc7
+
+                // Store result
+                "p.sw a3,%[q2](%[addr_res_d01]!)\n"        // result_d01[i + j + 0 * KARATSUBA_N / 4]
+                "p.sw a4,%[res_next](%[addr_res_d01]!)\n"  // result_d01[i + j + 2 * KARATSUBA_N / 4]
+                "p.sw a5, 4(%[addr_d0123]!)\n"             // d0123[i + j]
+
+            ".end_inner_hw_loop_ntru%=:"
+
+            // Reset addresses
+            "li a6,%[q1]\n" // constant
+            "sub %[addr_b],%[addr_b],a6\n"
+            "sub %[addr_d0123],%[addr_d0123],s1\n"
+            "sub %[addr_res_d01],%[addr_res_d01],s1\n"
+            "sub %[addr_d23],%[addr_d23],s1\n"
+            "sub %[addr_d01],%[addr_d01],s1\n"
+            "sub %[addr_final],%[addr_final],s1\n"
+        ".end_outer_hw_loop_ntru%=:"
+    : [addr_d0123]"+r" (addr_d0123),
+      [addr_res_d01]"+r" (addr_res_d01),
+      [addr_d23]"+r" (addr_d23),
+      [addr_d01]"+r" (addr_d01),
+      [addr_final]"+r" (addr_final),
+      [addr_a]"+r" (addr_a),
+      [addr_b]"+r" (addr_b)
+    : [n_outer]"i" (KARATSUBA_N / 4),
+      [n_inner]"i" (KARATSUBA_N / 8),
+      [rewind]"i" (KARATSUBA_N / 2 - 2),
+      [q1]"i" (KARATSUBA_N / 2),
+      [q2]"i" (KARATSUBA_N),
+      [q2n]"i" (-KARATSUBA_N),
+      [a_next]"i" (2 - 3 * KARATSUBA_N / 2),
+      [b_next]"i" (4 - 3 * KARATSUBA_N / 2),
+      [final_next]"i" (4 - 3 * KARATSUBA_N),
+      [res_next]"i" (4 - KARATSUBA_N)
+    : "t0", "t1", "t2", "t3", "t4", "t5", "t6",
+      "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "s1", "memory"
+    );
+
+#else
+    for (i = 0; i < KARATSUBA_N / 4; i++) {
+        acc1 = a_1[i]; //a0
+        acc2 = a_1[i + KARATSUBA_N / 4]; //a1
+        acc3 = a_1[i + 2 * KARATSUBA_N / 4]; //a2
+        acc4 = a_1[i + 3 * KARATSUBA_N / 4]; //a3
+        for (j = 0; j < KARATSUBA_N / 4; j++) {
+
+            acc5 = b_1[j]; //b0
+            acc6 = b_1[j + KARATSUBA_N / 4]; //b1
+
+            result_final[i + j + 0 * KARATSUBA_N / 4] = result_final[i + j + 0 * KARATSUBA_N / 4] + acc1 * acc5;
+            result_final[i + j + 2 * KARATSUBA_N / 4] = result_final[i + j + 2 * KARATSUBA_N / 4] + acc2 * acc6;
+
+            acc7 = acc5 + acc6; //b01
+            acc8 = acc1 + acc2; //a01
+            d01[i + j] = d01[i + j] + acc7 * acc8;
+            //--------------------------------------------------------
+
+            acc7 = b_1[j + 2 * KARATSUBA_N / 4]; //b2
+            acc8 = b_1[j + 3 * KARATSUBA_N / 4]; //b3
+            result_final[i + j + 4 * KARATSUBA_N / 4] = result_final[i + j + 4 * KARATSUBA_N / 4] + acc7 * acc3;
+
+            result_final[i + j + 6 * KARATSUBA_N / 4] = result_final[i + j + 6 * KARATSUBA_N / 4] + acc8 * acc4;
+
+            acc9 = acc3 + acc4;
+            acc10 = acc7 + acc8;
+            d23[i + j] = d23[i + j] + acc9 * acc10;
+            //--------------------------------------------------------
+
+            acc5 = acc5 + acc7; //b02
+            acc7 = acc1 + acc3; //a02
+            result_d01[i + j + 0 * KARATSUBA_N / 4] = result_d01[i + j + 0 * KARATSUBA_N / 4] + acc5 * acc7;
+
+            acc6 = acc6 + acc8; //b13
+            acc8 = acc2 + acc4;
+            result_d01[i + j + 2 * KARATSUBA_N / 4] = result_d01[i + j + 2 * KARATSUBA_N / 4] + acc6 * acc8;
+
+            acc5 = acc5 + acc6;
+            acc7 = acc7 + acc8;
+            d0123[i + j] = d0123[i + j] + acc5 * acc7;
+        }
+    }
+#endif
+
+    // 2nd last stage
+
+    for (i = 0; i < KARATSUBA_N / 2 - 1; i++) {
+        d0123[i] = d0123[i] - result_d01[i + 0 * KARATSUBA_N / 4] - result_d01[i + 2 * KARATSUBA_N / 4];
+        d01[i] = d01[i] - result_final[i + 0 * KARATSUBA_N / 4] - result_final[i + 2 * KARATSUBA_N / 4];
+        d23[i] = d23[i] - result_final[i + 4 * KARATSUBA_N / 4] - result_final[i + 6 * KARATSUBA_N / 4];
+    }
+
+    for (i = 0; i < KARATSUBA_N / 2 - 1; i++) {
+        result_d01[i + 1 * KARATSUBA_N / 4] = result_d01[i + 1 * KARATSUBA_N / 4] + d0123[i];
+        result_final[i + 1 * KARATSUBA_N / 4] = result_final[i + 1 * KARATSUBA_N / 4] + d01[i];
+        result_final[i + 5 * KARATSUBA_N / 4] = result_final[i + 5 * KARATSUBA_N / 4] + d23[i];
+    }
+
+    // Last stage
+    for (i = 0; i < KARATSUBA_N - 1; i++) {
+        result_d01[i] = result_d01[i] - result_final[i] - result_final[i + KARATSUBA_N];
+    }
+
+    for (i = 0; i < KARATSUBA_N - 1; i++) {
+        result_final[i + 1 * KARATSUBA_N / 2] = result_final[i + 1 * KARATSUBA_N / 2] + result_d01[i];
+    }
+
+}
+
+static void toom_cook_4way(const uint16_t *a1, const uint16_t *b1, uint16_t *result) {
+    uint16_t inv3 = 43691, inv9 = 36409, inv15 = 61167;
+
+    uint16_t aw1[TC_N], aw2[TC_N], aw3[TC_N], aw4[TC_N], aw5[TC_N], aw6[TC_N], aw7[TC_N];
+    uint16_t bw1[TC_N], bw2[TC_N], bw3[TC_N], bw4[TC_N], bw5[TC_N], bw6[TC_N], bw7[TC_N];
+    uint16_t w1[TC_N_RES], w2[TC_N_RES], w3[TC_N_RES], w4[TC_N_RES],
+             w5[TC_N_RES], w6[TC_N_RES], w7[TC_N_RES];
+    uint16_t r0, r1, r2, r3, r4, r5, r6, r7;
+    const uint16_t *A0, *A1, *A2, *A3, *B0, *B1, *B2, *B3;
+    A0 = a1;
+    A1 = &a1[TC_N];
+    A2 = &a1[2 * TC_N];
+    A3 = &a1[3 * TC_N];
+    B0 = b1;
+    B1 = &b1[TC_N];
+    B2 = &b1[2 * TC_N];
+    B3 = &b1[3 * TC_N];
+
+    uint16_t *C;
+    C = result;
+
+    int i, j;
+
+    // EVALUATION
+    for (j = 0; j < TC_N; ++j) {
+        r0 = A0[j];
+        r1 = A1[j];
+        r2 = A2[j];
+        r3 = A3[j];
+        r4 = r0 + r2;
+        r5 = r1 + r3;
+        r6 = r4 + r5;
+        r7 = r4 - r5;
+        aw3[j] = r6;
+        aw4[j] = r7;
+        r4 = ((r0 << 2) + r2) << 1;
+        r5 = (r1 << 2) + r3;
+        r6 = r4 + r5;
+        r7 = r4 - r5;
+        aw5[j] = r6;
+        aw6[j] = r7;
+        r4 = (r3 << 3) + (r2 << 2) + (r1 << 1) + r0;
+        aw2[j] = r4;
+        aw7[j] = r0;
+        aw1[j] = r3;
+    }
+    for (j = 0; j < TC_N; ++j) {
+        r0 = B0[j];
+        r1 = B1[j];
+        r2 = B2[j];
+        r3 = B3[j];
+        r4 = r0 + r2;
+        r5 = r1 + r3;
+        r6 = r4 + r5;
+        r7 = r4 - r5;
+        bw3[j] = r6;
+        bw4[j] = r7;
+        r4 = ((r0 << 2) + r2) << 1;
+        r5 = (r1 << 2) + r3;
+        r6 = r4 + r5;
+        r7 = r4 - r5;
+        bw5[j] = r6;
+        bw6[j] = r7;
+        r4 = (r3 << 3) + (r2 << 2) + (r1 << 1) + r0;
+        bw2[j] = r4;
+        bw7[j] = r0;
+        bw1[j] = r3;
+    }
+
+    // MULTIPLICATION
+
+    karatsuba_simple(aw1, bw1, w1);
+    karatsuba_simple(aw2, bw2, w2);
+    karatsuba_simple(aw3, bw3, w3);
+    karatsuba_simple(aw4, bw4, w4);
+    karatsuba_simple(aw5, bw5, w5);
+    karatsuba_simple(aw6, bw6, w6);
+    karatsuba_simple(aw7, bw7, w7);
+
+    // INTERPOLATION
+    for (i = 0; i < TC_N_RES; ++i) {
+        r0 = w1[i];
+        r1 = w2[i];
+        r2 = w3[i];
+        r3 = w4[i];
+        r4 = w5[i];
+        r5 = w6[i];
+        r6 = w7[i];
+
+        r1 = r1 + r4;
+        r5 = r5 - r4;
+        r3 = ((r3 - r2) >> 1);
+        r4 = r4 - r0;
+        r4 = r4 - (r6 << 6);
+        r4 = (r4 << 1) + r5;
+        r2 = r2 + r3;
+        r1 = r1 - (r2 << 6) - r2;
+        r2 = r2 - r6;
+        r2 = r2 - r0;
+        r1 = r1 + 45 * r2;
+        r4 = (((r4 - (r2 << 3)) * inv3) >> 3);
+        r5 = r5 + r1;
+        r1 = (((r1 + (r3 << 4)) * inv9) >> 1);
+        r3 = -(r3 + r1);
+        r5 = (((30 * r1 - r5) * inv15) >> 2);
+        r2 = r2 - r4;
+        r1 = r1 - r5;
+
+        C[i]     += r6;
+        C[i + 1 * TC_N] += r5;
+        C[i + 2 * TC_N] += r4;
+        C[i + 3 * TC_N] += r3;
+        C[i + 4 * TC_N] += r2;
+        C[i + 5 * TC_N] += r1;
+        C[i + 6 * TC_N] += r0;
+    }
+}
+
+/* c = a*b in Z[x]/(x^N - 1), coefficients correct modulo 2^13 */
+static void poly_mul_cyclic(uint16_t c[NTRU_N], const poly *a, const poly *b) {
+    uint16_t ap[NTRU_N_PAD], bp[NTRU_N_PAD];
+    uint16_t ab[2 * NTRU_N_PAD];
+    int i;
+
+    memcpy(ap, a->coeffs, NTRU_N * sizeof(uint16_t));
+    memcpy(bp, b->coeffs, NTRU_N * sizeof(uint16_t));
+    memset(ap + NTRU_N, 0, (NTRU_N_PAD - NTRU_N) * sizeof(uint16_t));
+    memset(bp + NTRU_N, 0, (NTRU_N_PAD - NTRU_N) * sizeof(uint16_t));
+    memset(ab, 0, sizeof(ab));
+
+    toom_cook_4way(ap, bp, ab);
+
+    for (i = 0; i < NTRU_N; i++) {
+        c[i] = ab[i] + ab[i + NTRU_N];
+    }
+}
+
+void PQCLEAN_NTRUHRSS701_CLEAN_poly_Rq_mul(poly *r, const poly *a, const poly *b) {
+    int i;
+
+    poly_mul_cyclic(r->coeffs, a, b);
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = MODQ(r->coeffs[i]);
+    }
+}
+
+void PQCLEAN_NTRUHRSS701_CLEAN_poly_S3_mul(poly *r, const poly *a, const poly *b) {
+    /* NOTE: Assumes inputs are in {0,1,2}^N, so every coefficient of the  */
+    /*       product is at most 4N < 2^13 before the reduction mod 3       */
+    int i;
+
+    poly_mul_cyclic(r->coeffs, a, b);
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] &= (1 << 13) - 1;
+    }
+    for (i = 0; i < NTRU_N; i++) {
+        r->coeffs[i] = PQCLEAN_NTRUHRSS701_CLEAN_mod3(r->coeffs[i] + 2 * r->coeffs[NTRU_N - 1]);
+    }
+}
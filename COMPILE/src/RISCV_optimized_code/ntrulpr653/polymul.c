@@ -0,0 +1,517 @@
+#include "params.h"
+#include "int8.h"
+#include "int16.h"
+#include "int32.h"
+#include "uint32.h"
+#include "uint64.h"
+#include "polymul.h"
+
+/*
+Multiplication on the NTT accelerator in the Dilithium mode
+(pq.set_dilithium): the integer product of f and g is computed with a
+negacyclic NTT of length 2048 modulo NTT_Q = 8380417, then reduced modulo
+x^p-x-1.
+
+All coefficients of the integer product are bounded by p*(q-1)/2 < NTT_Q/2
+and 2p-1 < 2048 leaves no wraparound modulo x^2048+1, so the product is
+recovered exactly from the centered residues: one prime is enough and the
+CRT step degenerates to a centered lift.
+
+pq.bf_dit/pq.bf_dif compute a full butterfly with Montgomery
+multiplication (R = 2^32) and expect and produce coefficients in
+[0, NTT_Q). The inverse transform walks the forward zetas backwards and
+negates them instead of storing a second table, and applies its final
+scaling factor up front.
+*/
+
+#define HW
+
+typedef int8 small;
+typedef int16 Fq;
+
+#define q12 ((q-1)/2)
+
+#define NTT_N 2048
+#define NTT_Q 8380417
+#define NTT_QINV 4236238847U /* -NTT_Q^(-1) mod 2^32 */
+#define NTT_F 6290560 /* 2^64/NTT_N mod NTT_Q */
+
+/* zetas[k] = 2^32 * 7901702^brv(k) mod NTT_Q; 7901702 has order 4096 */
+static const uint32 zetas[NTT_N] = {
+        0, 8354570, 7861508, 5771523, 7504169, 7913949, 8143293, 7602457,
+  3119733, 2884855, 2680103, 3111497, 2353451, 1826347,  359251, 6288512,
+  6262231, 3859737, 5102745, 6980856, 4010497, 8100412, 6623180, 8360995,
+  7300517, 4794489, 5654953, 1024112, 7260833, 7830929, 5760665, 6271868,
+  6681150, 1643818, 4558682, 3505694, 6779997, 4680821, 4873154, 6239768,
+  3900724, 2556880, 5582638, 2071892,  531354,  811944, 7426187, 3881043,
+  6718724, 3592148, 3915439, 5842901,   95776, 2706023, 5303092, 3530437,
+  3574422, 2867647, 3861115, 5336701, 8079950, 3539968, 6031717, 7841118,
+  5037034, 8115473, 3097992,  508951,  904516, 4421799, 8336129, 7280319,
+  2389356,  210977, 7063561,  759969, 8371839, 4656075, 6727353, 5130689,
+  1285669, 1584928, 6940675, 7567685, 4751448, 4540456, 3019102, 4499357,
+  3159746, 1851402, 8190869, 4827145, 8202977, 5971092, 7064828, 1341330,
+  7122806, 6441103, 7380215, 4296819, 4747489, 8253495, 3190144, 5223087,
+  4702672, 3041255, 3930395, 6851714, 3475950, 6927966, 6203962, 6795196,
+  5412772, 3693493, 5903370, 7969390, 7396998, 3412210, 6232521, 2715295,
+  8357436, 1308169,  671102, 7151892, 1349076, 7998430, 6527646, 6949987,
+  7100756, 6463336, 7005614, 5834105, 2235880, 4974386, 6880252,  777191,
+  5796124, 3724270, 4603424,  594136, 5548557, 7838005, 1671176, 6533464,
+  5196991, 8217573, 3014001, 1616392, 4686184, 1799107, 7570268, 1652634,
+  2454455,  164721, 2013608, 2432395, 3369112, 1957272, 8194886, 7173032,
+  5441381, 2235985, 6094090, 7959518, 1612842, 3545687, 8196974, 7403526,
+  3937738, 6979993, 1976782, 7534263, 3919660, 7826001,   48306, 7018208,
+  2213111,  975884,  472078, 1717735, 3523897, 5341501, 4513516,  269760,
+  6577327, 6470041,  426683, 1723600, 7276084, 6712985,  260646, 4546524,
+   900702, 6521319,  819034,  909542, 8337157,  522500, 7884926, 6767243,
+  4823422,  525098, 4784579, 7611795, 5257975, 7725090, 6348669, 3207046,
+  5037939, 6136326, 4817955, 5933984, 3407706, 2091667, 6063917, 3817976,
+  7144689, 4867236, 8113420, 2434439, 4621053, 4860065, 1197226, 5187039,
+  2842341, 5688936, 1265009, 5790267, 2486353, 6784443, 4325093, 1247620,
+  5942594, 4272102, 8038120,  286988, 5038140, 3437287, 6644538,  203044,
+  5386378, 6511298, 7329447, 1903435, 1250494, 4613401, 5744496, 4832145,
+  5062207, 1430225, 1333058, 1237275, 1312455, 7929317, 5074302, 6417775,
+  1262474, 1055322, 7168027, 5019294,  461839, 6246643, 3240809,   35433,
+  1014821, 8033308, 7581924, 5572266, 1871670,  233555, 6519180, 1054605,
+  2327698, 6585254, 7735482,  416548, 8214915, 3227153, 1352319, 2600908,
+  4285930, 4959669, 5620850, 3625072, 7746550, 7353723, 5099482, 7977254,
+  4588801, 7496785, 8176859, 5833239,  811657, 5031936, 5400605, 1298814,
+  4189384,  418712, 3577030,  201527, 4062658,  252320,  199552, 5974076,
+  4735812, 4740933, 1768340, 6278147, 8094510, 6238946, 7635902, 2010607,
+  4791573, 1335963, 2418057,  561722, 4071362, 1534242, 6499902, 6006517,
+  4695096,  246300,  125707, 5552550, 1226530, 5821084, 4612216, 6156253,
+   674148, 1981467, 2846728, 5651447, 3609089, 3700379, 4943766, 5878961,
+   308789, 7541156, 4802391, 3541590, 6609694, 3998533, 7000195, 6720938,
+  1308989, 4480308, 7599096, 3133182, 1330489,  753003,  724129,  475045,
+   944281, 5801244, 2837541, 5351718, 1316464, 6838671,  229319, 1224804,
+  2158389, 3395820, 2760046, 6245094, 7550233,  926009, 4976233,  271822,
+  2729080, 1911659, 3800145, 5557804,   73973, 5123552, 3795915, 4946365,
+  5719101, 6243085,  983732,   98128,  488847, 1104506, 6769039, 5188994,
+  5520388, 5555237, 5604027, 4087850,  677648, 1179803, 2507121, 2880006,
+   263809, 6685757, 4186464, 3146717, 4245506, 4382444, 4505386, 4622092,
+  1883706, 3970373,  696597, 2605321,  545105, 4826380, 8057726, 2146257,
+  8192520, 2753750, 2220368, 3968414, 1028573, 7239550, 3594559, 7603087,
+  3647742, 5085506, 6851222, 6803876, 4425247, 5287815, 4091627, 2591291,
+  5969070, 1061988, 4980680, 5057288, 4651558, 4960429, 1481727, 4652755,
+  1887757, 2065587, 2987654, 4720338, 4017784,  933794, 4424404, 2473529,
+  7309797, 2094277, 8058788, 7898599, 4361404,  142647, 7046720, 3966069,
+  2020342, 5985287, 4573089, 4381658, 2512993, 2789711, 6385344, 3426610,
+  1042804, 7935541, 7962683, 3189589, 4264364, 7571932, 7268052,  785240,
+   784549, 4929287, 2839840, 5083735, 2092691,  686834,  615468, 3306248,
+  2766248, 3349592, 1218518, 4294463, 5092053, 2332809, 3383924, 8151827,
+  1637081, 4190540, 4573621, 2449635, 3038914, 4759868,  587631, 5362719,
+  6170160, 3561486, 7952264, 1630049, 2518115, 5265606, 6276247, 7526147,
+  2610645, 2652482, 3595293, 6544248, 7010168, 7348250, 6821190, 3520757,
+  2162858, 2966022, 1845141, 6865441, 3474560, 2744860, 7081100, 1981674,
+  4198936, 5615201, 6701527,  529827,  341347,  170047,  728607, 7054003,
+  2451894, 3116982, 6258365, 4572835, 5869733, 7523285, 5216578,  867524,
+  3674164, 1724941, 1802088,  980989, 6296937, 1542077, 2036897, 3534283,
+  5735154, 3945373, 3647436, 1439478, 3312755, 4943252, 3254760, 6159024,
+    61637, 2413210, 4140476, 5069844, 7553243, 1242228, 5186996, 4425108,
+  1360549, 3493362, 3218745,  329046, 4763427, 5790571,  681120,  920899,
+  2886985, 4677038, 3455535, 6384155, 5865807, 3413428, 3811294,  150030,
+  7021590, 5028983, 4424717, 5983867,  508856, 1137920, 6357579, 2890210,
+  3559713, 4254130, 3279432, 3199291, 1194978, 3269221, 4819594, 2895998,
+   462609, 8081577, 8361954, 8308958, 6936480, 6277796, 2363104, 7459428,
+  2165359, 3571223, 6561280, 5059840, 5345445, 6223055, 2338942, 5321985,
+  3353827, 7325889, 3129301, 6573993, 5249509, 1829708, 6964211, 2684452,
+  7473746, 7421276, 6227429, 6841086, 4461162, 5873007, 6508982, 1197150,
+  7344266, 7962300, 1838561,  327369, 1821568, 5282678, 6012350, 4940612,
+  3955639, 2381789,  170400, 3590822, 1159605, 2952568, 4700954,  427385,
+  1183495, 5573727, 4035033, 5382537, 5502636, 6067980, 6387907, 7618795,
+  3463112, 4370916, 3862822, 2177786, 2915036, 4458342, 8206668,  269827,
+  3882508, 4880717, 4151222, 1487925, 5290773, 2884967, 8333386, 5380103,
+  8039516,  762181,  822791, 4703736, 6616558, 2637063, 5960650,  260941,
+  5557966, 5031625, 3246002, 4726651, 6551966, 3630308, 7362618, 5396605,
+  3508482, 7244063, 4895844, 4586414, 2005686, 3949998, 2221587,  691411,
+  6239004, 6344833, 2287519, 1258879, 8197997, 7925843, 4962083, 3991716,
+  7092471, 1848208, 1260815, 8072601, 1081240, 5146641, 6522267, 8258651,
+  5785103, 5453653, 6891550, 8044790, 4280666, 6433545, 7941789, 1156029,
+   302863, 7481000, 5985573, 5604979, 1469697, 5588441, 8210839, 8010951,
+  7757618, 5910481, 3613710, 1521372, 1508964, 4649236, 6692185, 8023472,
+  4955730, 3828233, 3602621, 3371684, 3542622, 2728682, 1439556, 6812614,
+  6754130, 4466322, 2457753, 6870290, 8342855, 7396678, 3879314,  947992,
+  3737241, 2563233,  391485, 6395114, 1118623, 3614155, 8145903, 3700366,
+  6374384, 5170754, 8258871, 8368429, 5580629, 7493254, 4813397, 6891781,
+  8328874, 3051818, 1282736, 8156536, 1753455, 7484657, 4185905,  813306,
+  4396271, 3084534, 6194441, 3392199, 2221241, 5003969, 1431135, 2439344,
+  6019028, 1198607,  176326, 3650978, 2449618, 1741924, 1460534, 7217894,
+  7952102, 1178696, 5966821, 3952364, 4670646,   99924, 6209432, 3722562,
+  5064503, 7206407, 5937396, 6861020, 2755221,  406471, 6078817, 5912309,
+  5175199, 8027470,  981382, 2551912, 3490100, 3208072, 7584545, 7442960,
+  1299919, 3109820, 7353793, 7657384, 5690481, 1927808, 1318454,  588408,
+  1084862, 4374499, 4164311, 3968329, 4982219, 5154933, 7542765, 6812373,
+  5265269,  422782, 5339233, 6917995, 5790993, 2620036, 4380572, 4506221,
+  7512840,  257933, 7639552,  695705, 1564488, 1049532, 4187523, 6562807,
+   760161, 8369895, 7485695, 2069705, 4550537, 4557183, 2924985, 3156472,
+  1038504,  300585, 7661593, 2045133, 4686726, 2067646, 1488566, 6170297,
+  5225811, 6261588,  744349,    9982, 5597330, 7000954, 6236178, 1264703,
+  4662496,   51132, 5443868, 3112566, 7546918,  535985, 5621134, 4105947,
+   492019, 1872078, 4574467, 7600173, 3969763, 6349101, 4316649, 6897808,
+  3864044, 1237035,   90869, 5640126, 2419138, 7142965, 3029271, 1327349,
+  4884443, 6498611, 4828139, 6062819, 6292122, 6284433,  432939, 7358966,
+  3534726, 4939496,  730756, 7299258, 2320121,  218076,  169281, 3732194,
+  8314983, 1751182, 2005648, 2292196, 2872315, 2913129, 7105770,  257912,
+   430854, 1084307, 7600140, 3248429, 3370730, 7706773, 1759761, 7361999,
+  1188533, 1297485, 6414690, 3246515, 4945419, 2569595, 3211954, 2669868,
+  3675880, 5574782, 3637306, 1461094, 5302037, 6022822, 6627466, 7886914,
+  2194359, 7703686, 2550191, 2448913, 1522490, 1053112, 7405416, 5449228,
+  4424151, 3786146, 4638543, 7031600, 1782506, 1050902, 7642805, 5879162,
+  1316499, 6160221, 6176019, 7314794, 1684232,   75930,  527696, 7070730,
+  5233906, 2587706, 4137123, 3022018, 1040766, 1947023, 1700327, 5344495,
+  6003256, 1640942, 6945650, 4512653, 4014394,  800389, 7890008,  440890,
+  3724223, 2298152, 8172199, 2782221, 4837365, 3212156, 6910752, 8157691,
+  4091500, 1461488, 5259433, 3406850, 2326596,  411081, 2474154, 7404466,
+  1027387, 2693657,  821985, 8355446, 3708911, 3401335, 2110767, 1076797,
+  8152127, 3970017,  385969, 4373413,  517473, 1711870, 3862144, 2151105,
+  5699673, 3327818, 7925825, 2925742, 4720267, 3177440, 7598581, 7130077,
+  1745230, 7692484, 6241044, 2716963, 4137007, 7665000, 2033882, 2117783,
+  1830981,    4356, 5872394, 1435393, 7965225, 7788844, 7645790,  693976,
+  6700491, 3851113, 5581638, 8286951, 8049219,  637238, 2067395, 3770337,
+  2750058, 2316939, 2813387, 6650808, 5824764, 4060254, 4075209, 8372660,
+  2095241,  342205, 5276570, 1646216, 1420009, 6204077, 6212829, 3720277,
+  1545021, 1284657, 6897698, 4998837,  465742, 3619124, 1935464, 6328553,
+  2664966,  822430, 1415672,  483542, 7338160, 1813696, 4763180, 3395275,
+  6187114, 1756569, 5670296, 1714421, 3667091, 2348917, 4444614, 8188321,
+  8182855, 4536495, 1446169, 5527790, 8233984, 5918164, 1654613, 5547935,
+   876164, 2094748, 2725878, 2922818, 4962934, 1862118, 7654112, 3394683,
+  2032517, 3436082, 2014959, 1385476, 2389033, 2880494, 7255327, 8009790,
+  5797956, 2931129, 6992466, 2102969,   12940, 6565865,  516284, 3210142,
+  5549979,  625992, 3836616, 6140155, 6591986, 2461165, 5682307, 8330251,
+  5560025, 2232656, 4695961, 6225739, 7663305, 8366916, 3850585, 1140007,
+  4853419, 4486667, 4955552, 4884231, 7850429, 1441980, 1985367, 2742498,
+   172647, 1936417, 7041164, 1522537, 1054019, 3642809, 6311800, 5550831,
+  7886335, 3398833, 4070773,  979562, 7501610, 1249822, 3150242,  513277,
+  6242311, 3298324, 5072182,  821566, 5538348, 2207765, 7836070, 4424380,
+  1193749, 4345662, 7910301,  955179, 5945457, 7437811,   33577, 4003567,
+  5905121, 2760364, 3094994, 1157323, 4084312, 1920252, 2729231, 4970644,
+    87391, 1226526,  525758, 6326998, 7253170, 4328002, 1540609, 4201158,
+   320577, 5310455, 4731288, 1448057,  322238, 5437622,  813299, 4330202,
+  5930278, 5962884, 8189188,  298854, 4540597, 4487392, 6906419, 8345631,
+  3231642, 4136828, 1492510, 7536832,  470651, 7829467, 5144130, 4493414,
+  2884775, 4417022, 3885469, 6146766, 2068077, 1325076, 1581502, 4067570,
+    39184, 4261298, 4731613, 5922986, 7306901, 6751464,  878823, 5623244,
+  1277137, 2954921, 2328452, 1547122, 1200493, 1718699, 8031714, 3545277,
+  3452863, 6699262, 2034285,  291928, 3504659, 2334827, 5427217, 6227259,
+  4577126, 2748252, 5897664, 6039096, 3615013, 4996506, 4617975, 4664775,
+  4654324, 5217604, 5729188, 3463386, 2908178, 2111899, 6674040, 4182215,
+  6753973, 5115250, 6909819, 2299181, 7769698, 7597188, 4069776, 1150456,
+  7468110, 4134082,  414754, 3095878,  539998, 5651328, 5926599, 4248323,
+  5421209, 6559412, 5149372, 8234802, 8092351, 3793129, 7153408, 1069584,
+  2379468, 1527608, 5513663,  630684, 4727999, 1751244, 3189690,  854326,
+  5291879, 6587198, 3499515, 5074196, 2904409, 5733531,  816690, 8035830,
+  2738475, 7757076, 2996291, 1314995, 4159922, 5241789, 4515432, 6228756,
+  6578752, 1594280, 5496245, 4246695, 8208029, 1423470, 3442748, 1641304,
+  4992492, 4755769, 7463027, 6888212, 3502169, 7502411,  185636, 7552452,
+  5696244, 6344805, 7159511, 4881936, 5653450, 3820240, 8021925, 6534471,
+  5011127, 7479143, 1069577, 1362699, 4809554, 5961838, 8218120, 4552246,
+  8067345, 3649594,  179321,  666354, 7379478, 3019406, 8124049, 8303696,
+  6068375, 5995810, 1702204, 6073466, 3141443, 3467267, 6344085, 3471632,
+  6577343, 4962690, 1947972, 3310393, 7227738, 7653363, 1202048,  308993,
+  5098850, 4664491, 1735518,  808671, 6869336,  471224, 8341778, 6723910,
+   249328, 1258218, 6427211, 4765169,  861812, 4941458, 4137616, 4240387,
+  4631623, 1098173, 3691388,  672279, 3411199, 1425693, 4534970, 8208954,
+  6594482, 1966085, 8351715, 4457449, 4675057, 1991617, 5017615, 3828545,
+  1943463, 3318360, 6264581, 1405953, 5398586, 4519614, 3194991, 5846446,
+  5195598, 1698215,  987017, 2266883, 3657547,  588961, 6270970, 4463209,
+  4135766, 7776850, 1888518, 5272182, 4753120, 2059991, 6956088, 6901094,
+  4916194, 7587406, 7304735, 4441337, 5679750,  430153, 4991140, 2230465,
+  3558755, 1274632, 3329288, 7707512, 6184799, 3531903, 5020964, 8348313,
+  8073078, 1464905, 2120409,  937093, 7864888, 3704366,  795504, 2084862,
+  2096694, 3304101, 6723075,  660886, 6457557, 6750432, 6852176, 3874899,
+  7059177, 3133710, 2398641, 6991463, 3213323, 7260044, 6504854, 4594526,
+  4200274,   31468, 2975304, 2281376, 6773934, 1290300, 1934492, 3620435,
+  4674940, 3062376,  702278, 7414627, 7657693, 7008904, 4510052, 3965197,
+   690831, 4232489, 3605611, 7667196, 2434269, 4759528, 7070627,  271683,
+  7525023, 1145261, 1651858, 2683128, 1416355, 1610504, 5528207, 4837013,
+  7143413, 5657536, 2021356, 7879265, 4286438, 1098464, 5734378, 5818352,
+  1393737,  670987, 5620557, 4515858,  856532, 7922685, 4937266,  184551,
+  3941769,  674083, 4461332, 1380476, 3262563, 6948151, 7808857, 6357081,
+  7845257, 4724109, 6768405, 3112202, 8012771, 6792263, 6063691, 1015610,
+  5251003,  405241, 3404826, 5241503, 4900306, 4292306, 5139818, 4274284,
+  8285618, 1102376, 7452880, 4844956, 6750611, 4439085, 6752366, 5138534,
+  7952880, 6450163, 7658402,  448660, 4414926, 1828615, 7987915, 6135490,
+  8033129, 4849371, 2694799, 5568617, 1821978, 3321133, 6235952, 6842754,
+  2768810, 3969554,  735274, 5919630, 7826171, 8348643, 1183309, 3193192,
+  4500700,  877863, 1949477, 7658711, 6179362, 7162058, 1892263, 8101785,
+  4166260, 2104429, 2698461, 5218306, 2701170, 2988778, 1456074, 6276031,
+   891802,  658300, 3119249,  294825, 5898160, 1213300, 8006126, 2711372,
+  2414288, 4183354, 3859030, 7442459, 4270229, 7617327, 2903836, 3671500,
+  5064863, 2622469, 2454522, 4851986, 1667436, 4804142, 2119111, 6942657,
+  2899765, 1175162, 5519763, 2106784, 4961316, 4493034, 5708820, 3205716,
+  2744819,  911803, 6987564, 6137353, 1751567,  982901,  662560, 6321323,
+  3032207, 5472410, 5555527, 8013408,  745961, 1086979, 2398636, 5891182,
+   705879, 7049555, 5516817, 4141578, 7247358,  860835, 4135006, 8142478,
+  1376972, 7192691, 6493037, 3795764,  184021, 4139203,   80824, 7605685,
+  6830918,  516802, 2065675, 2392438, 6779782, 7651240,  667891, 1154295,
+   904569, 1000027, 6566310, 5727482, 3985398, 2576401, 1805898, 1353411,
+  6921018, 7894217, 1943078, 2400893, 6894922, 2541100, 1324151, 3890363,
+  1282360, 5867408, 5013403,  473784, 5322036, 3855674, 2122544, 1453728,
+  3951528, 7844037, 6840239, 1810644, 2058432, 7508945,  613810, 5515333,
+  2445457, 4581779, 4423897, 1526540, 7511547, 7363778, 4645103,  788131,
+  2561974, 7498348, 5585852, 2025324,   85516, 7642001, 3999997, 2124987,
+   138806, 1853099, 3833544, 2236952, 5886483, 6081155, 6584322, 3766432,
+  6692842,   76806, 3740262,  271820,  782617,  477642, 1418263, 4132967,
+   395187, 6466634, 7811722, 8286819, 3245160, 5484588, 5635305, 8359400,
+  3410283, 6012472, 3340449, 3264329, 2268988, 1308349, 1675619, 5410455,
+  2160426, 5812115, 5260889,  324581, 2442735, 2274493, 6455085,  794277,
+  4533472, 3724946, 6699860, 4110573, 3529463, 1605178, 6813208,  215405,
+  1508093, 2377710, 7157409, 4922822, 3102889, 3754703, 8088068, 6603462,
+  4820329, 5409382, 2443666,  988557, 5175892, 2974577, 1400204, 5807876,
+  4002739,  452980, 5417320,  535134, 5498365, 1462487, 6225273, 6731521,
+  3237096, 2571545, 1523596, 4755343, 7036855, 3639659, 1303378, 6694519,
+  6103565, 6268180,  658159, 6630192, 3660776, 3843236,  591797, 3623145,
+  2459597, 7041740, 1711018, 6420319, 2497646, 4571344, 2757629, 4011613,
+  4869028,   20756, 5210467, 1999056, 7825730,  136279, 1678642, 1883071,
+  6266422, 7621568, 6039351, 8314582, 2869940, 8245925, 7036917, 7226643,
+  5532903, 2401387, 8136933, 7574664, 3716544,  302576, 2430854, 7505135,
+  1084455,  291879, 6844831, 4982591, 3069364, 1137558, 3499342, 7230475,
+  7005923, 3435968, 3892890, 8354678, 6994122, 1129855, 5346826, 3397405,
+  5520667, 4935831, 7514029, 7140078, 2977271, 6054571, 7399745, 2840484,
+  3109577, 2213260, 7075178, 7829993, 3709615, 4121227, 2004147, 3852353,
+  6391338, 3365837, 5976903,   72384, 6729605, 4576565, 2981764, 7553955,
+  5417869,  667983, 3941035, 1732922, 5613953, 4429021, 7575540, 3615291,
+  2374276,  408613, 2109777, 1112001, 3655442, 6674012, 7780170, 5734956,
+  4035331, 5592032, 3528723, 6371930, 7582567, 6277397, 4745654, 6710384,
+  6067890, 8213974, 4299305, 6684977, 3559379, 1150862, 3996640, 2549103,
+  8349889, 1542677, 5385287, 6109910,   59581, 7548431, 5594639, 6487160,
+  3124617, 1593793, 4035531, 7701187,  166460, 8132762, 6978242, 1271288,
+    99282, 6576863, 2391312, 6591804, 3797143,  297701, 6651749, 6481656,
+  5918510, 4214292, 8066798, 2280774, 6577412,   33567, 1699442, 3344349,
+  5541465, 7633080, 8268708,  857182, 5081746, 6982646, 1278475, 5751605,
+  6618981, 1162631, 2212953, 6433006, 5024467, 1502484, 6096418, 2340581,
+  2550594,  623058, 6737948, 6870202, 5140149, 5041300,  670976, 1213895,
+  3076286, 5835014, 2736709, 1284842, 4785081, 7458503, 3210799, 8297884,
+  4306626, 3648103, 8200385, 7129861, 3873918,  191784, 7642504, 3333415,
+  4321848, 7881113, 2561910, 5147335, 6066140,  234389,  278900, 3880489,
+  8299109, 6565119, 2219411, 4561139, 6840401, 2261997, 5438702, 2686782,
+  4680866, 3122532, 7899513, 5351238, 4417273, 5418996, 3299408, 2675184,
+  2622619, 2802316, 7590997,  898589, 2255794,  863295, 1102571, 1103673,
+  5803685, 3218382, 2267919, 4072114, 4700645, 2825522, 5523014,  145795,
+   118718, 4548246,  400072,  367378, 7921967, 7075373, 6292908, 6612016,
+   258323, 2885325, 1112800, 2754620, 6156411, 6691496, 6463334, 2515632,
+  4345191,  753035, 5930960, 3517623, 5718340, 3036490, 4574953,  573815,
+  5209670, 4279105, 2284181, 2511896, 3039325, 6370546, 4572746, 2650051,
+  2347916, 7356162, 5721041, 5750846, 7881724, 7778402, 7197520, 1989709,
+  1132531, 6979663, 4325376, 6536689, 4459018, 6728033, 3786264, 6457730,
+  6505449, 1441293, 7788940, 8131920,  288291, 3817431, 1145317, 8150291
+};
+
+/* x must not be close to top int16 */
+static small F3_freeze(int16 x)
+{
+  return int32_mod_uint14(x+1,3)-1;
+}
+
+/* x must not be close to top int32 */
+static Fq Fq_freeze(int32 x)
+{
+  return int32_mod_uint14(x+q12,q)-q12;
+}
+
+#ifndef HW
+/* C model of the accelerator: a*b*2^{-32} mod NTT_Q in [0, NTT_Q) */
+/* for b < NTT_Q and any uint32 a */
+static uint32 mod_mul_r(uint32 a,uint32 b)
+{
+  uint64 x = (uint64) a*b;
+  uint32 t = (uint32) x*NTT_QINV;
+
+  t = (x+(uint64) t*NTT_Q)>>32;
+  return t >= NTT_Q ? t-NTT_Q : t;
+}
+#endif
+
+/* r[i] = r[i]*c[i]*2^{-32} mod NTT_Q, c[i] < NTT_Q */
+static void pointwise(uint32 *r,const uint32 *c)
+{
+#ifdef HW
+  asm volatile(
+      "pq.set_dilithium x0,x0,x0\n"
+      "lp.setupi x0,%[n],(.end_pointwise%=)\n"
+          "lw t0,0(%[r])\n"
+          "p.lw t1,4(%[c]!)\n"
+          "nop\n"
+          "pq.mod_mul_r x0,t0,t1\n"
+          "p.sw t0,4(%[r]!)\n"
+      ".end_pointwise%=:\n"
+      : [r]"+r" (r), [c]"+r" (c)
+      : [n]"i" (NTT_N)
+      : "t0", "t1", "memory"
+  );
+#else
+  int i;
+
+  for (i = 0;i < NTT_N;++i) r[i] = mod_mul_r(r[i],c[i]);
+#endif
+}
+
+/* forward NTT in place, r[i] < NTT_Q; output in bitreversed order */
+static void ntt(uint32 *r)
+{
+#ifdef HW
+  const uint32 *zeta = &zetas[1];
+  uint32 *pa,*pb;
+  int len;
+
+  asm volatile("pq.set_dilithium x0,x0,x0\n");
+  for (len = NTT_N/2;len > 0;len >>= 1) {
+    pa = r;
+    pb = r+len;
+    asm volatile(
+        "lp.setup x1,%[nblocks],(.end_ntt_blocks%=)\n"
+            "p.lw t2,4(%[zeta]!)\n"
+            "lp.setup x0,%[len],(.end_ntt_bf%=)\n"
+                "lw t0,0(%[pa])\n"
+                "lw t1,0(%[pb])\n"
+                "nop\n"
+                "pq.bf_dit t2,t0,t1\n"   // t0 = t0 + zeta*t1, t1 = t0 - zeta*t1
+                "p.sw t0,4(%[pa]!)\n"
+                "p.sw t1,4(%[pb]!)\n"
+            ".end_ntt_bf%=:\n"
+            "add %[pa],%[pa],%[skip]\n"
+            "add %[pb],%[pb],%[skip]\n"
+        ".end_ntt_blocks%=:\n"
+        : [pa]"+r" (pa), [pb]"+r" (pb), [zeta]"+r" (zeta)
+        : [nblocks]"r" (NTT_N/(2*len)), [len]"r" (len), [skip]"r" (4*len)
+        : "t0", "t1", "t2", "memory"
+    );
+  }
+#else
+  uint32 zeta,t;
+  int len,start,j,k;
+
+  k = 1;
+  for (len = NTT_N/2;len > 0;len >>= 1) {
+    for (start = 0;start < NTT_N;start += 2*len) {
+      zeta = zetas[k++];
+      for (j = start;j < start+len;++j) {
+        t = mod_mul_r(r[j+len],zeta);
+        r[j+len] = r[j] >= t ? r[j]-t : r[j]+NTT_Q-t;
+        r[j] = r[j]+t >= NTT_Q ? r[j]+t-NTT_Q : r[j]+t;
+      }
+    }
+  }
+#endif
+}
+
+/* inverse NTT in place, times 2^64/NTT_N; any uint32 r[i], output < NTT_Q */
+static void invntt(uint32 *r)
+{
+#ifdef HW
+  const uint32 *zeta = &zetas[NTT_N-1];
+  uint32 *pa,*pb;
+  int len;
+
+  pa = r;
+  asm volatile(
+      "pq.set_dilithium x0,x0,x0\n"
+      "lp.setupi x0,%[n],(.end_mul_const%=)\n"
+          "lw t0,0(%[pa])\n"
+          "nop\n"
+          "pq.mod_mul_r x0,t0,%[f]\n"
+          "p.sw t0,4(%[pa]!)\n"
+      ".end_mul_const%=:\n"
+      : [pa]"+r" (pa)
+      : [f]"r" (NTT_F), [n]"i" (NTT_N)
+      : "t0", "memory"
+  );
+  for (len = 1;len < NTT_N;len <<= 1) {
+    pa = r;
+    pb = r+len;
+    asm volatile(
+        "lp.setup x1,%[nblocks],(.end_invntt_blocks%=)\n"
+            "p.lw t2,-4(%[zeta]!)\n"
+            "sub t2,%[nq],t2\n"
+            "lp.setup x0,%[len],(.end_invntt_bf%=)\n"
+                "lw t0,0(%[pa])\n"
+                "lw t1,0(%[pb])\n"
+                "nop\n"
+                "pq.bf_dif t2,t0,t1\n"   // t0 = t0 + t1, t1 = zeta*(t0 - t1)
+                "p.sw t0,4(%[pa]!)\n"
+                "p.sw t1,4(%[pb]!)\n"
+            ".end_invntt_bf%=:\n"
+            "add %[pa],%[pa],%[skip]\n"
+            "add %[pb],%[pb],%[skip]\n"
+        ".end_invntt_blocks%=:\n"
+        : [pa]"+r" (pa), [pb]"+r" (pb), [zeta]"+r" (zeta)
+        : [nblocks]"r" (NTT_N/(2*len)), [len]"r" (len), [skip]"r" (4*len),
+          [nq]"r" (NTT_Q)
+        : "t0", "t1", "t2", "memory"
+    );
+  }
+#else
+  uint32 zeta,t;
+  int len,start,j,k;
+
+  for (j = 0;j < NTT_N;++j) r[j] = mod_mul_r(r[j],NTT_F);
+
+  k = NTT_N-1;
+  for (len = 1;len < NTT_N;len <<= 1) {
+    for (start = 0;start < NTT_N;start += 2*len) {
+      zeta = NTT_Q-zetas[k--];
+      for (j = start;j < start+len;++j) {
+        t = r[j];
+        r[j] = t+r[j+len] >= NTT_Q ? t+r[j+len]-NTT_Q : t+r[j+len];
+        r[j+len] = mod_mul_r(t+NTT_Q-r[j+len],zeta);
+      }
+    }
+  }
+#endif
+}
+
+/* fg[0..2p-2] = f*g over the integers; f and g are zero-padded to NTT_N */
+/* with entries in [0, NTT_Q) */
+static void mult_ntt(int32 *fg,uint32 *f,uint32 *g)
+{
+  uint32 t;
+  int i;
+
+  ntt(f);
+  ntt(g);
+  pointwise(f,g);
+  invntt(f);
+
+  for (i = 0;i < p+p-1;++i) {
+    t = f[i];
+    fg[i] = t > NTT_Q/2 ? (int32) t-NTT_Q : (int32) t;
+  }
+
+  for (i = p+p-2;i >= p;--i) {
+    fg[i-p] += fg[i];
+    fg[i-p+1] += fg[i];
+  }
+}
+
+/* h = f*g in the ring Rq */
+void Rq_mult_small(Fq *h,const Fq *f,const small *g)
+{
+  uint32 ff[NTT_N];
+  uint32 gg[NTT_N];
+  int32 fg[p+p-1];
+  int i;
+
+  for (i = 0;i < p;++i) ff[i] = f[i] < 0 ? f[i]+NTT_Q : f[i];
+  for (i = 0;i < p;++i) gg[i] = g[i] < 0 ? g[i]+NTT_Q : g[i];
+  for (i = p;i < NTT_N;++i) ff[i] = gg[i] = 0;
+
+  mult_ntt(fg,ff,gg);
+
+  for (i = 0;i < p;++i) h[i] = Fq_freeze(fg[i]);
+}
+
+/* h = f*g in the ring R3 */
+void R3_mult(small *h,const small *f,const small *g)
+{
+  uint32 ff[NTT_N];
+  uint32 gg[NTT_N];
+  int32 fg[p+p-1];
+  int i;
+
+  for (i = 0;i < p;++i) ff[i] = f[i] < 0 ? f[i]+NTT_Q : f[i];
+  for (i = 0;i < p;++i) gg[i] = g[i] < 0 ? g[i]+NTT_Q : g[i];
+  for (i = p;i < NTT_N;++i) ff[i] = gg[i] = 0;
+
+  mult_ntt(fg,ff,gg);
+
+  for (i = 0;i < p;++i) h[i] = F3_freeze(fg[i]);
+}
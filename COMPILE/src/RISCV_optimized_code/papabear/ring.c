@@ -0,0 +1,199 @@
+/** Ring arithmetic implementation */
+#include "ring.h"
+
+#include <string.h>
+
+/** Return the i'th limb of the modulus */
+limb_t PQCLEAN_PAPABEAR_CLEAN_modulus(size_t i) {
+    return (i == DIGITS / 2) ? LMASK - 1 : LMASK;
+}
+
+/*
+ * The limb product a*b is computed with KARATSUBA_LEVELS levels of Karatsuba
+ * on operands zero-padded to PADDED_DIGITS limbs, followed by product-scanning
+ * schoolbook multiplications of LEAF_DIGITS limbs. The limbs of a and b are
+ * below 2^11 and grow by one bit per level, so the leaf inputs fit into the
+ * 16-bit halves of a word and pv.sdotup.h multiplies two pairs of limbs and
+ * adds both products to a 32-bit column sum in one instruction. Intermediate
+ * sums are taken modulo 2^32, which is exact for the final product.
+ */
+#define HW
+
+#define KARATSUBA_LEVELS 3
+#define LEAF_DIGITS ((((DIGITS - 1) >> KARATSUBA_LEVELS) + 2) & ~1)
+#define PADDED_DIGITS (LEAF_DIGITS << KARATSUBA_LEVELS)
+
+/** Sum of ap[i] * bp[-2i] over n pairs, multiplied halfwise */
+static inline dlimb_t column(const uint32_t *ap, const uint32_t *bp, size_t n) {
+    dlimb_t acc = 0;
+#ifdef HW
+    uint32_t x, y;
+
+    asm volatile(
+        "lp.setup x0,%[n],(.end_column%=)\n"
+            "p.lw %[x],4(%[ap]!)\n"
+            "p.lw %[y],-8(%[bp]!)\n"
+            "pv.sdotup.h %[acc],%[x],%[y]\n"
+        ".end_column%=:\n"
+        : [acc]"+r" (acc), [ap]"+r" (ap), [bp]"+r" (bp), [x]"=&r" (x), [y]"=&r" (y)
+        : [n]"r" (n)
+        : "memory"
+    );
+#else
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        acc += (ap[i] & 0xFFFF) * (bp[-2 * (int)i] & 0xFFFF) + (ap[i] >> 16) * (bp[-2 * (int)i] >> 16);
+    }
+#endif
+    return acc;
+}
+
+/** r[0 .. 2*LEAF_DIGITS) = a*b */
+static void schoolbook(dlimb_t r[2 * LEAF_DIGITS], const limb_t a[LEAF_DIGITS], const limb_t b[LEAF_DIGITS]) {
+    /* ap[i] = a[2i] | a[2i+1] << 16 and bp[m] = b[m] | b[m-1] << 16, so that
+     * ap[i] * bp[k-2i] halfwise is the contribution of a[2i] and a[2i+1] to
+     * column k */
+    uint32_t ap[LEAF_DIGITS / 2];
+    uint32_t bp[LEAF_DIGITS + 1];
+    size_t i, k, lo, hi;
+
+    for (i = 0; i < LEAF_DIGITS / 2; i++) {
+        ap[i] = a[2 * i] | (uint32_t)a[2 * i + 1] << 16;
+    }
+    bp[0] = b[0];
+    for (i = 1; i < LEAF_DIGITS; i++) {
+        bp[i] = b[i] | (uint32_t)b[i - 1] << 16;
+    }
+    bp[LEAF_DIGITS] = (uint32_t)b[LEAF_DIGITS - 1] << 16;
+
+    for (k = 0; k < 2 * LEAF_DIGITS - 1; k++) {
+        lo = k > LEAF_DIGITS ? (k - LEAF_DIGITS + 1) / 2 : 0;
+        hi = k / 2 < LEAF_DIGITS / 2 ? k / 2 : LEAF_DIGITS / 2 - 1;
+        r[k] = column(&ap[lo], &bp[k - 2 * lo], hi - lo + 1);
+    }
+    r[2 * LEAF_DIGITS - 1] = 0;
+}
+
+/** r[0 .. 2n) = a*b */
+static void karatsuba(dlimb_t *r, const limb_t *a, const limb_t *b, size_t n) {
+    limb_t sa[PADDED_DIGITS / 2], sb[PADDED_DIGITS / 2];
+    dlimb_t m[PADDED_DIGITS];
+    size_t h = n / 2, i;
+
+    if (n == LEAF_DIGITS) {
+        schoolbook(r, a, b);
+        return;
+    }
+
+    karatsuba(r, a, b, h);
+    karatsuba(r + n, a + h, b + h, h);
+    for (i = 0; i < h; i++) {
+        sa[i] = (limb_t)(a[i] + a[i + h]);
+        sb[i] = (limb_t)(b[i] + b[i + h]);
+    }
+    karatsuba(m, sa, sb, h);
+    for (i = 0; i < n; i++) {
+        m[i] -= r[i] + r[i + n];
+    }
+    for (i = 0; i < n; i++) {
+        r[i + h] += m[i];
+    }
+}
+
+/** Multiply and accumulate c += a*b */
+void PQCLEAN_PAPABEAR_CLEAN_mac(gf_t c, const gf_t a, const gf_t b) {
+    dslimb_t accum[2 * PADDED_DIGITS];
+    limb_t pa[PADDED_DIGITS] = {0}, pb[PADDED_DIGITS] = {0};
+    dslimb_t chain;
+    size_t i;
+
+    memcpy(pa, a, sizeof(gf_t));
+    memcpy(pb, b, sizeof(gf_t));
+    karatsuba((dlimb_t *)accum, pa, pb, PADDED_DIGITS);
+
+    /* Accumulate c */
+    for (i = 0; i < DIGITS; i++) {
+        accum[i + DIGITS / 2] += c[i];
+    }
+
+    /* Clarify and reduce */
+    for (i = 0; i < DIGITS / 2; i++) {
+        accum[i + DIGITS / 2] -= accum[i];
+        accum[i + DIGITS]   += accum[i];
+        accum[i + DIGITS / 2] += accum[i + 3 * DIGITS / 2];
+        accum[i + DIGITS]   += accum[i + 3 * DIGITS / 2];
+    }
+
+    /* Carry propagate */
+    chain = accum[3 * DIGITS / 2 - 1];
+    accum[3 * DIGITS / 2 - 1] = chain & LMASK;
+    chain >>= LGX;
+    accum[DIGITS] += chain;
+    for (i = DIGITS / 2; i < 3 * DIGITS / 2; i++) {
+        chain += accum[i];
+        c[i - DIGITS / 2] = chain & LMASK;
+        chain >>= LGX;
+    }
+    c[0] = (limb_t) (c[0] + chain);
+    c[DIGITS / 2] = (limb_t) (c[DIGITS / 2] + chain);
+}
+
+/** Reduce a gf_t to canonical form, i.e. strictly less than N. */
+void PQCLEAN_PAPABEAR_CLEAN_canon(gf_t c) {
+    const limb_t DELTA = (limb_t)1 << (LGX - 1);
+    slimb_t hi;
+    dslimb_t scarry;
+    dlimb_t carry;
+
+    /* Reduce to 0..2p */
+    hi = (slimb_t) (c[DIGITS - 1] - DELTA);
+    c[DIGITS - 1] = (limb_t) ((hi & LMASK) + DELTA);
+    c[DIGITS / 2] = (limb_t) (c[DIGITS / 2] + (hi >> LGX));
+
+    /* Strong reduce.  First subtract modulus */
+    scarry = hi >> LGX;
+    for (size_t i = 0; i < DIGITS; i++) {
+        scarry = scarry + (slimb_t)c[i] - PQCLEAN_PAPABEAR_CLEAN_modulus(i);
+        c[i] = scarry & LMASK;
+        scarry >>= LGX;
+    }
+
+    /* add it back */
+    carry = 0;
+    for (size_t i = 0; i < DIGITS; i++) {
+        carry = carry + c[i] + ((dlimb_t)scarry & PQCLEAN_PAPABEAR_CLEAN_modulus(i));
+        c[i] = carry & LMASK;
+        carry >>= LGX;
+    }
+}
+
+/** Serialize a gf_t to bytes */
+void PQCLEAN_PAPABEAR_CLEAN_contract(uint8_t ch[GF_BYTES], gf_t a) {
+    size_t pos;
+
+    PQCLEAN_PAPABEAR_CLEAN_canon(a);
+    for (size_t i = 0; i < GF_BYTES; i++) {
+        pos = (i * 8) / LGX;
+        ch[i] = (uint8_t)(a[pos] >> ((i * 8) % LGX));
+        if (i < GF_BYTES - 1) {
+            ch[i] |= (uint8_t)(a[pos + 1] << (LGX - ((i * 8) % LGX)));
+        }
+    }
+}
+
+/** Deserialize a gf_t from bytes */
+void PQCLEAN_PAPABEAR_CLEAN_expand(gf_t ll, const uint8_t ch[GF_BYTES]) {
+    limb_t tmp, buffer = 0;
+
+    for (size_t i = 0, j = 0, bbits = 0; i < GF_BYTES; i++) {
+        tmp = ch[i];
+        buffer |= (limb_t)(tmp << bbits);
+        bbits += 8;
+        if (bbits >= LGX) {
+            ll[j++] = buffer & LMASK;
+            buffer = (limb_t)(tmp >> (LGX - (bbits - 8)));
+            bbits = bbits - LGX;
+        }
+    }
+}
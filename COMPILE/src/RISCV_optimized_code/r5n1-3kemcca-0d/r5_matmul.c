@@ -0,0 +1,299 @@
+//  r5_matmul.c
+//  Copyright (c) 2019, PQShield Ltd. and Koninklijke Philips N.V.
+
+//  Matrix arithmetic on the ternary polynomial multiplier (multer) of the
+//  EX stage, configured with 16-bit coefficients modulo 2^16
+//  (HW_ACCEL_EX_MULTER_WIDE). A row of A is a window a[t .. t + d - 1] of
+//  a_random, so both A * S and R^T * A are correlations of a_random with a
+//  ternary vector. They are split into blocks of 256 outputs and 256
+//  ternary coefficients; each block pair is one pass of the multiplier,
+//  with the ternary block in reverse order in the lower half of the ternary
+//  operand. q is a power of two, hence the results modulo 2^16 are exact.
+
+#include "r5_parameter_sets.h"
+
+#if (PARAMS_N == 1)
+
+#include <string.h>
+
+#include "r5_matmul.h"
+#include "r5_xof.h"
+#include "r5_addsub.h"
+#include "little_endian.h"
+
+#define HW
+
+#define MULTER_N    512                 // length of the multiplier
+#define MULTER_B    256                 // outputs and ternary coefficients per pass
+#define A_LEN       (PARAM_TAU2_A_RANDOM + PARAMS_D)
+#define A_BLK       ((PARAM_TAU2_A_RANDOM + MULTER_B - 1) / MULTER_B)
+#define S_BLK       ((PARAMS_D + MULTER_B - 1) / MULTER_B)
+
+#ifndef HW
+//  C model of the multiplier
+static uint16_t multer_gen[MULTER_N];
+static uint8_t multer_ter[MULTER_N];
+static uint16_t multer_out[MULTER_N];
+#endif
+
+//  clears both operands
+
+static inline void multer_reset(void)
+{
+#ifdef HW
+    asm volatile(
+        "multer.calc x0,%[cmd],x0\n"
+        "nop\n"                         // the clear takes effect one cycle later
+        : : [cmd]"r" (4) : "memory");
+#else
+    memset(multer_gen, 0, sizeof(multer_gen));
+    memset(multer_ter, 0, sizeof(multer_ter));
+#endif
+}
+
+//  writes gen[0 .. 2 * npairs - 1] from position addr on, with the pairs of
+//  ternary codes in tc (01 = +1, 11 = -1), or zero if tc is NULL
+
+static void multer_write(const uint16_t *gen, const uint8_t *tc,
+    uint32_t addr, size_t npairs)
+{
+#ifdef HW
+    uint32_t a = addr << 20;
+    uint32_t x, y;
+
+    if (tc != NULL) {
+        uint32_t z;
+
+        asm volatile(
+            "lp.setup x0,%[n],(.end_multer_wt%=)\n"
+                "p.lhu %[x],2(%[g]!)\n"
+                "p.lhu %[y],2(%[g]!)\n"
+                "p.lbu %[z],1(%[t]!)\n"
+                "pv.pack.h %[x],%[y],%[x]\n"
+                "or %[z],%[z],%[a]\n"
+                "multer.write x0,%[x],%[z]\n"
+                "add %[a],%[a],%[inc]\n"
+            ".end_multer_wt%=:\n"
+            : [g]"+r" (gen), [t]"+r" (tc), [a]"+r" (a),
+              [x]"=&r" (x), [y]"=&r" (y), [z]"=&r" (z)
+            : [n]"r" (npairs), [inc]"r" (2 << 20)
+            : "memory");
+    } else {
+        asm volatile(
+            "lp.setup x0,%[n],(.end_multer_wg%=)\n"
+                "p.lhu %[x],2(%[g]!)\n"
+                "p.lhu %[y],2(%[g]!)\n"
+                "pv.pack.h %[x],%[y],%[x]\n"
+                "multer.write x0,%[x],%[a]\n"
+                "add %[a],%[a],%[inc]\n"
+            ".end_multer_wg%=:\n"
+            : [g]"+r" (gen), [a]"+r" (a), [x]"=&r" (x), [y]"=&r" (y)
+            : [n]"r" (npairs), [inc]"r" (2 << 20)
+            : "memory");
+    }
+#else
+    size_t i;
+
+    for (i = 0; i < 2 * npairs; i++) {
+        multer_gen[addr + i] = gen[i];
+        multer_ter[addr + i] = tc == NULL ? 0 : (tc[i >> 1] >> (2 * (i & 1))) & 3;
+    }
+#endif
+}
+
+//  out = gen * ter modulo x^512 - 1; the core stalls until it is done
+
+static inline void multer_start(void)
+{
+#ifdef HW
+    asm volatile(
+        "multer.calc x0,%[cmd],x0\n"
+        "multer.calc x0,%[cmd],x0\n"    // start is registered by the first one
+        "nop\n"
+        : : [cmd]"r" (1) : "memory");
+#else
+    size_t i, j;
+
+    memset(multer_out, 0, sizeof(multer_out));
+    for (j = 0; j < MULTER_N; j++) {
+        if (multer_ter[j] == 1) {
+            for (i = 0; i < MULTER_N; i++) {
+                multer_out[(i + j) % MULTER_N] += multer_gen[i];
+            }
+        } else if (multer_ter[j] == 3) {
+            for (i = 0; i < MULTER_N; i++) {
+                multer_out[(i + j) % MULTER_N] -= multer_gen[i];
+            }
+        }
+    }
+#endif
+}
+
+//  adds out[addr .. addr + 2 * npairs - 1] to the 16-bit lanes of acc
+
+static void multer_read(uint32_t *acc, uint32_t addr, size_t npairs)
+{
+#ifdef HW
+    uint32_t x, y;
+
+    asm volatile(
+        "lp.setup x0,%[n],(.end_multer_rd%=)\n"
+            "multer.read %[x],%[a],x0\n"
+            "lw %[y],0(%[p])\n"
+            "addi %[a],%[a],2\n"
+            "pv.add.h %[y],%[y],%[x]\n"
+            "p.sw %[y],4(%[p]!)\n"
+        ".end_multer_rd%=:\n"
+        : [p]"+r" (acc), [a]"+r" (addr), [x]"=&r" (x), [y]"=&r" (y)
+        : [n]"r" (npairs)
+        : "memory");
+#else
+    size_t i;
+    uint16_t lo, hi;
+
+    for (i = 0; i < npairs; i++) {
+        lo = (uint16_t) (acc[i] + multer_out[addr + 2 * i]);
+        hi = (uint16_t) ((acc[i] >> 16) + multer_out[addr + 2 * i + 1]);
+        acc[i] = ((uint32_t) hi << 16) | lo;
+    }
+#endif
+}
+
+//  sets the ternary code of position t in the pairs of codes rc of a
+//  vector of length len, in reverse order
+
+static inline void r5_ternary_code(uint8_t *rc, size_t len, size_t t,
+    uint8_t code)
+{
+    size_t u = len - 1 - t;
+
+    rc[u >> 1] |= (uint8_t) (code << (2 * (u & 1)));
+}
+
+//  d[j] = sum of c[t] * a[t + j] for 0 <= j < nout, 0 <= t < 256 * nblk,
+//  where rc holds the ternary codes of c in pairs, in reverse order. Every
+//  product with a nonzero c[t] and j < nout stays within a[0 .. A_LEN - 1].
+
+static void r5_matmul_multer(uint16_t *d, size_t nout,
+    const uint8_t *rc, size_t nblk, const modq_t a[A_LEN])
+{
+    uint16_t win[MULTER_N];
+    uint32_t acc[MULTER_B / 2];
+    const uint16_t *gen;
+    size_t i, b, j0, start;
+
+    for (j0 = 0; j0 < nout; j0 += MULTER_B) {
+        memset(acc, 0, sizeof(acc));
+        for (b = 0; b < nblk; b++) {
+            //  ter[m] = c[t0 + 255 - m] and gen[i] = a[t0 + j0 + i], so that
+            //  out[255 + n] is the contribution of c[t0 .. t0 + 255] to d[j0 + n]
+            start = b * MULTER_B + j0;
+            gen = &a[start];
+            if (start + MULTER_N > A_LEN) {
+                for (i = 0; i < MULTER_N; i++) {
+                    win[i] = start + i < A_LEN ? a[start + i] : 0;
+                }
+                gen = win;
+            }
+            multer_reset();
+            multer_write(gen, &rc[(nblk - 1 - b) * MULTER_B / 2], 0, MULTER_B / 2);
+            multer_write(gen + MULTER_B, NULL, MULTER_B, MULTER_B / 2);
+            multer_start();
+            multer_read(acc, MULTER_B - 1, MULTER_B / 2);
+        }
+        for (i = 0; i < MULTER_B && j0 + i < nout; i++) {
+            d[j0 + i] = (uint16_t) (acc[i >> 1] >> (16 * (i & 1)));
+        }
+    }
+}
+
+// U = A_T * R
+
+void r5_matmul_ra_q(modq_t d[PARAMS_M_BAR][PARAMS_D],
+    modq_t a[PARAM_TAU2_A_RANDOM + PARAMS_D],
+    uint16_t a_perm[PARAMS_D],
+    uint16_t r_t[PARAMS_M_BAR][PARAMS_H / 2][2])
+{
+    uint8_t rc[A_BLK * MULTER_B / 2];
+    size_t i, l;
+
+    //  d[l][j] = sum of c[t] * a[t + j], c[a_perm[k]] = r[k][l]
+    for (l = 0; l < PARAMS_M_BAR; l++) {
+        memset(rc, 0, sizeof(rc));
+        for (i = 0; i < PARAMS_H / 2; i++) {
+            r5_ternary_code(rc, A_BLK * MULTER_B, a_perm[r_t[l][i][0]], 1);
+            r5_ternary_code(rc, A_BLK * MULTER_B, a_perm[r_t[l][i][1]], 3);
+        }
+        r5_matmul_multer(d[l], PARAMS_D, rc, A_BLK, a);
+    }
+}
+
+// B = A * S
+
+void r5_matmul_as_q(modq_t d[PARAMS_D][PARAMS_N_BAR],
+    modq_t a[PARAM_TAU2_A_RANDOM + PARAMS_D],
+    uint16_t a_perm[PARAMS_D],
+    uint16_t s_t[PARAMS_N_BAR][PARAMS_H / 2][2])
+{
+    uint8_t rc[S_BLK * MULTER_B / 2];
+    uint16_t e[PARAM_TAU2_A_RANDOM];
+    size_t i, j, l;
+
+    //  d[j][l] = e[a_perm[j]] with e[t] = sum of s[k][l] * a[t + k]
+    for (l = 0; l < PARAMS_N_BAR; l++) {
+        memset(rc, 0, sizeof(rc));
+        for (i = 0; i < PARAMS_H / 2; i++) {
+            r5_ternary_code(rc, S_BLK * MULTER_B, s_t[l][i][0], 1);
+            r5_ternary_code(rc, S_BLK * MULTER_B, s_t[l][i][1], 3);
+        }
+        r5_matmul_multer(e, PARAM_TAU2_A_RANDOM, rc, S_BLK, a);
+        for (j = 0; j < PARAMS_D; j++) {
+            d[j][l] = e[a_perm[j]];
+        }
+    }
+}
+
+// X' = S_T * U
+
+void r5_matmul_us_p(modp_t d[PARAMS_MU],
+    modp_t u_t[PARAMS_M_BAR][PARAMS_D],
+    uint16_t s_t[PARAMS_N_BAR][PARAMS_H / 2][2])
+{
+    size_t i, j, k, idx;
+    modp_t t;
+
+    idx = 0;
+    for (i = 0; i < PARAMS_N_BAR && idx < PARAMS_MU; i++) {
+        for (j = 0; j < PARAMS_M_BAR && idx < PARAMS_MU; j++) {
+            t = 0;
+            for (k = 0; k < PARAMS_H / 2; k++) {
+                t += u_t[j][s_t[i][k][0]] - u_t[j][s_t[i][k][1]];
+            }
+            d[idx++] = t;
+        }
+    }
+}
+
+// X = B_T * R
+
+void r5_matmul_rb_p(modp_t d[PARAMS_MU],
+    modp_t b[PARAMS_D][PARAMS_N_BAR],
+    uint16_t r_t[PARAMS_M_BAR][PARAMS_H / 2][2])
+{
+    size_t i, j, l, idx;
+    modp_t t;
+
+    idx = 0;
+    for (l = 0; l < PARAMS_N_BAR && idx < PARAMS_MU; l++) {
+        for (j = 0; j < PARAMS_M_BAR && idx < PARAMS_MU; j++) {
+            t = 0;
+            for (i = 0; i < PARAMS_H / 2; i++) {
+                t += b[r_t[j][i][0]][l] - b[r_t[j][i][1]][l];
+            }
+            d[idx++] = t;
+        }
+    }
+}
+
+#endif
+
@@ -0,0 +1,276 @@
+//  r5_ringmul.c
+//  Copyright (c) 2019, PQShield Ltd. and Koninklijke Philips N.V.
+
+//  Ring arithmetic on the ternary polynomial multiplier (multer) of the
+//  EX stage, configured with 16-bit coefficients modulo 2^16
+//  (HW_ACCEL_EX_MULTER_WIDE). One pass of the multiplier computes the
+//  cyclic convolution of a general and a ternary polynomial of length 512.
+//  The product modulo x^(d+1) - 1 is split into blocks of 256 outputs and
+//  256 ternary coefficients. Each block pair is one pass with the upper half
+//  of the ternary operand zero, so that the upper 256 outputs do not wrap
+//  around and are the wanted partial sums. q and p are powers of two, hence
+//  the results modulo 2^16 are exact.
+
+#include "r5_parameter_sets.h"
+
+#if (PARAMS_N == PARAMS_D)
+
+#include <string.h>
+
+#include "r5_ringmul.h"
+#include "r5_xof.h"
+#include "r5_addsub.h"
+#include "little_endian.h"
+
+#define HW
+
+#define MULTER_N    512                 // length of the multiplier
+#define MULTER_B    256                 // outputs and ternary coefficients per pass
+#define RING_L      (PARAMS_D + 1)      // length of the lifted ring
+#define RING_BLK    ((RING_L + MULTER_B - 1) / MULTER_B)
+
+#ifndef HW
+//  C model of the multiplier
+static uint16_t multer_gen[MULTER_N];
+static uint8_t multer_ter[MULTER_N];
+static uint16_t multer_out[MULTER_N];
+#endif
+
+//  clears both operands
+
+static inline void multer_reset(void)
+{
+#ifdef HW
+    asm volatile(
+        "multer.calc x0,%[cmd],x0\n"
+        "nop\n"                         // the clear takes effect one cycle later
+        : : [cmd]"r" (4) : "memory");
+#else
+    memset(multer_gen, 0, sizeof(multer_gen));
+    memset(multer_ter, 0, sizeof(multer_ter));
+#endif
+}
+
+//  writes gen[0 .. 2 * npairs - 1] from position addr on, with the pairs of
+//  ternary codes in tc (01 = +1, 11 = -1), or zero if tc is NULL
+
+static void multer_write(const uint16_t *gen, const uint8_t *tc,
+    uint32_t addr, size_t npairs)
+{
+#ifdef HW
+    uint32_t a = addr << 20;
+    uint32_t x, y;
+
+    if (tc != NULL) {
+        uint32_t z;
+
+        asm volatile(
+            "lp.setup x0,%[n],(.end_multer_wt%=)\n"
+                "p.lhu %[x],2(%[g]!)\n"
+                "p.lhu %[y],2(%[g]!)\n"
+                "p.lbu %[z],1(%[t]!)\n"
+                "pv.pack.h %[x],%[y],%[x]\n"
+                "or %[z],%[z],%[a]\n"
+                "multer.write x0,%[x],%[z]\n"
+                "add %[a],%[a],%[inc]\n"
+            ".end_multer_wt%=:\n"
+            : [g]"+r" (gen), [t]"+r" (tc), [a]"+r" (a),
+              [x]"=&r" (x), [y]"=&r" (y), [z]"=&r" (z)
+            : [n]"r" (npairs), [inc]"r" (2 << 20)
+            : "memory");
+    } else {
+        asm volatile(
+            "lp.setup x0,%[n],(.end_multer_wg%=)\n"
+                "p.lhu %[x],2(%[g]!)\n"
+                "p.lhu %[y],2(%[g]!)\n"
+                "pv.pack.h %[x],%[y],%[x]\n"
+                "multer.write x0,%[x],%[a]\n"
+                "add %[a],%[a],%[inc]\n"
+            ".end_multer_wg%=:\n"
+            : [g]"+r" (gen), [a]"+r" (a), [x]"=&r" (x), [y]"=&r" (y)
+            : [n]"r" (npairs), [inc]"r" (2 << 20)
+            : "memory");
+    }
+#else
+    size_t i;
+
+    for (i = 0; i < 2 * npairs; i++) {
+        multer_gen[addr + i] = gen[i];
+        multer_ter[addr + i] = tc == NULL ? 0 : (tc[i >> 1] >> (2 * (i & 1))) & 3;
+    }
+#endif
+}
+
+//  out = gen * ter modulo x^512 - 1; the core stalls until it is done
+
+static inline void multer_start(void)
+{
+#ifdef HW
+    asm volatile(
+        "multer.calc x0,%[cmd],x0\n"
+        "multer.calc x0,%[cmd],x0\n"    // start is registered by the first one
+        "nop\n"
+        : : [cmd]"r" (1) : "memory");
+#else
+    size_t i, j;
+
+    memset(multer_out, 0, sizeof(multer_out));
+    for (j = 0; j < MULTER_N; j++) {
+        if (multer_ter[j] == 1) {
+            for (i = 0; i < MULTER_N; i++) {
+                multer_out[(i + j) % MULTER_N] += multer_gen[i];
+            }
+        } else if (multer_ter[j] == 3) {
+            for (i = 0; i < MULTER_N; i++) {
+                multer_out[(i + j) % MULTER_N] -= multer_gen[i];
+            }
+        }
+    }
+#endif
+}
+
+//  adds out[addr .. addr + 2 * npairs - 1] to the 16-bit lanes of acc
+
+static void multer_read(uint32_t *acc, uint32_t addr, size_t npairs)
+{
+#ifdef HW
+    uint32_t x, y;
+
+    asm volatile(
+        "lp.setup x0,%[n],(.end_multer_rd%=)\n"
+            "multer.read %[x],%[a],x0\n"
+            "lw %[y],0(%[p])\n"
+            "addi %[a],%[a],2\n"
+            "pv.add.h %[y],%[y],%[x]\n"
+            "p.sw %[y],4(%[p]!)\n"
+        ".end_multer_rd%=:\n"
+        : [p]"+r" (acc), [a]"+r" (addr), [x]"=&r" (x), [y]"=&r" (y)
+        : [n]"r" (npairs)
+        : "memory");
+#else
+    size_t i;
+    uint16_t lo, hi;
+
+    for (i = 0; i < npairs; i++) {
+        lo = (uint16_t) (acc[i] + multer_out[addr + 2 * i]);
+        hi = (uint16_t) ((acc[i] >> 16) + multer_out[addr + 2 * i + 1]);
+        acc[i] = ((uint32_t) hi << 16) | lo;
+    }
+#endif
+}
+
+//  d[j] = sum of s[k] * a[(j - k) mod (d + 1)] for 0 <= j < nout, where
+//  ext[i] = a[i mod (d + 1)] and s is given by the index pairs in idx
+
+static void r5_ringmul_multer(uint16_t *d, size_t nout,
+    const uint16_t ext[RING_L + MULTER_N],
+    uint16_t idx[PARAMS_H / 2][2])
+{
+    uint8_t tc[RING_BLK * MULTER_B / 2];
+    uint32_t acc[MULTER_B / 2];
+    size_t i, v, j0, off;
+
+    //  ternary codes of s in pairs
+    memset(tc, 0, sizeof(tc));
+    for (i = 0; i < PARAMS_H / 2; i++) {
+        tc[idx[i][0] >> 1] |= (uint8_t) (1 << (2 * (idx[i][0] & 1)));
+        tc[idx[i][1] >> 1] |= (uint8_t) (3 << (2 * (idx[i][1] & 1)));
+    }
+
+    for (j0 = 0; j0 < nout; j0 += MULTER_B) {
+        memset(acc, 0, sizeof(acc));
+        for (v = 0; v < RING_BLK; v++) {
+            //  gen[i] = a[j0 - k0 - 256 + i], so that out[256 + n] is the
+            //  contribution of s[k0 .. k0 + 255] to d[j0 + n]
+            off = (j0 + 2 * RING_L - (v + 1) * MULTER_B) % RING_L;
+            multer_reset();
+            multer_write(&ext[off], &tc[v * MULTER_B / 2], 0, MULTER_B / 2);
+            multer_write(&ext[off + MULTER_B], NULL, MULTER_B, MULTER_B / 2);
+            multer_start();
+            multer_read(acc, MULTER_B, MULTER_B / 2);
+        }
+        for (i = 0; i < MULTER_B && j0 + i < nout; i++) {
+            d[j0 + i] = (uint16_t) (acc[i >> 1] >> (16 * (i & 1)));
+        }
+    }
+}
+
+// multiplication mod q, result length n
+
+void r5_ringmul_q(modq_t d[PARAMS_D],
+    modq_t a[2 * (PARAMS_D + 1)],
+    uint16_t idx[PARAMS_H / 2][2])
+{
+    uint16_t ext[RING_L + MULTER_N];
+    size_t i;
+
+    //  note: order of coefficients a[1..n] is *NOT* reversed!
+    //  "lift" -- multiply by (x - 1)
+    a[PARAMS_D] = a[PARAMS_D - 1];
+    for (i = PARAMS_D - 1; i >= 1; i--) {
+        a[i] = a[i - 1] - a[i];
+    }
+    a[0] = -a[0];
+
+    //  periodic extension
+    memcpy(ext, a, RING_L * sizeof (uint16_t));
+    for (i = RING_L; i < RING_L + MULTER_N; i++) {
+        ext[i] = ext[i - RING_L];
+    }
+
+    r5_ringmul_multer(d, PARAMS_D, ext, idx);
+
+    //  "unlift"
+    d[0] = -d[0];
+    for (i = 1; i < PARAMS_D; i++) {
+        d[i] = d[i - 1] - d[i];
+    }
+}
+
+// multiplication mod p, result length mu
+
+void r5_ringmul_p(modp_t d[PARAMS_MU],
+    modp_t a[PARAMS_D + PARAMS_MU + 2],
+    uint16_t idx[PARAMS_H / 2][2])
+{
+    uint16_t ext[RING_L + MULTER_N];
+    uint16_t t[PARAMS_MU];
+    size_t i;
+
+    //  note: order of coefficients p[1..N] is *NOT* reversed!
+#if (PARAMS_XE == 0) && (PARAMS_F == 0)
+    //  without error correction we "lift" -- i.e. multiply by (x - 1)
+    a[PARAMS_D] = a[PARAMS_D - 1];
+    for (i = PARAMS_D - 1; i >= 1; i--) {
+        a[i] = a[i - 1] - a[i];
+    }
+    a[0] = -a[0];
+#else
+    a[PARAMS_D] = 0;
+    a[PARAMS_D + 1] = a[0];
+    a++;                                //  don't lift, shift!
+#endif
+
+    //  periodic extension
+    for (i = 0; i < RING_L; i++) {
+        ext[i] = a[i];
+    }
+    for (i = RING_L; i < RING_L + MULTER_N; i++) {
+        ext[i] = ext[i - RING_L];
+    }
+
+    r5_ringmul_multer(t, PARAMS_MU, ext, idx);
+    for (i = 0; i < PARAMS_MU; i++) {
+        d[i] = (modp_t) t[i];
+    }
+
+#if (PARAMS_XE == 0) && (PARAMS_F == 0)
+    //  without error correction we "lifted" so we now need to "unlift"
+    d[0] = -d[0];
+    for (i = 1; i < PARAMS_MU; ++i) {
+        d[i] = d[i - 1] - d[i];
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,315 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: portable modular arithmetic for P751
+*********************************************************************************************/
+
+#include "P751_internal.h"
+
+/* mp_mul and rdc_mont are comba loops on the 32x32+64 multiply-accumulate  */
+/* unit of the multiplier. pq.wmac adds rs1 * rs2 to a 96-bit accumulator,  */
+/* pq.wmacs adds rs1 * rs2, returns the lowest word and shifts the          */
+/* accumulator down by one word, and pq.wmacr adds rs1 * rs2, returns the   */
+/* lowest word and clears the accumulator. Every column of a product is one */
+/* hardware loop of pq.wmac followed by a single pq.wmacs. The accumulator  */
+/* is zero between calls, each kernel ends with pq.wmacr.                   */
+
+#define HW
+
+
+// Global constants
+extern const uint64_t p751[NWORDS_FIELD];
+extern const uint64_t p751p1[NWORDS_FIELD];
+extern const uint64_t p751x2[NWORDS_FIELD];
+
+
+__inline void fpadd751(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Modular addition, c = a+b mod p751.
+  // Inputs: a, b in [0, 2*p751-1]
+  // Output: c in [0, 2*p751-1]
+    unsigned int i, carry = 0;
+    digit_t mask;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(carry, a[i], b[i], carry, c[i]);
+    }
+
+    carry = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        SUBC(carry, c[i], ((digit_t*)p751x2)[i], carry, c[i]);
+    }
+    mask = 0 - (digit_t)carry;
+
+    carry = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(carry, c[i], ((digit_t*)p751x2)[i] & mask, carry, c[i]);
+    }
+}
+
+
+__inline void fpsub751(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Modular subtraction, c = a-b mod p751.
+  // Inputs: a, b in [0, 2*p751-1]
+  // Output: c in [0, 2*p751-1]
+    unsigned int i, borrow = 0;
+    digit_t mask;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        SUBC(borrow, a[i], b[i], borrow, c[i]);
+    }
+    mask = 0 - (digit_t)borrow;
+
+    borrow = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(borrow, c[i], ((digit_t*)p751x2)[i] & mask, borrow, c[i]);
+    }
+}
+
+
+__inline void fpneg751(digit_t* a)
+{ // Modular negation, a = -a mod p751.
+  // Input/output: a in [0, 2*p751-1]
+    unsigned int i, borrow = 0;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        SUBC(borrow, ((digit_t*)p751x2)[i], a[i], borrow, a[i]);
+    }
+}
+
+
+void fpdiv2_751(const digit_t* a, digit_t* c)
+{ // Modular division by two, c = a/2 mod p751.
+  // Input : a in [0, 2*p751-1]
+  // Output: c in [0, 2*p751-1]
+    unsigned int i, carry = 0;
+    digit_t mask;
+
+    mask = 0 - (digit_t)(a[0] & 1);    // If a is odd compute a+p751
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(carry, a[i], ((digit_t*)p751)[i] & mask, carry, c[i]);
+    }
+
+    mp_shiftr1(c, NWORDS_FIELD);
+}
+
+
+void fpcorrection751(digit_t* a)
+{ // Modular correction to reduce field element a in [0, 2*p751-1] to [0, p751-1].
+    unsigned int i, borrow = 0;
+    digit_t mask;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        SUBC(borrow, a[i], ((digit_t*)p751)[i], borrow, a[i]);
+    }
+    mask = 0 - (digit_t)borrow;
+
+    borrow = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(borrow, a[i], ((digit_t*)p751)[i] & mask, borrow, a[i]);
+    }
+}
+
+
+void digit_x_digit(const digit_t a, const digit_t b, digit_t* c)
+{ // Digit multiplication, digit * digit -> 2-digit result
+    register digit_t al, ah, bl, bh, temp;
+    digit_t albl, albh, ahbl, ahbh, res1, res2, res3, carry;
+    digit_t mask_low = (digit_t)(-1) >> (sizeof(digit_t)*4), mask_high = (digit_t)(-1) << (sizeof(digit_t)*4);
+
+    al = a & mask_low;                        // Low part
+    ah = a >> (sizeof(digit_t) * 4);          // High part
+    bl = b & mask_low;
+    bh = b >> (sizeof(digit_t) * 4);
+
+    albl = al*bl;
+    albh = al*bh;
+    ahbl = ah*bl;
+    ahbh = ah*bh;
+    c[0] = albl & mask_low;                   // C00
+
+    res1 = albl >> (sizeof(digit_t) * 4);
+    res2 = ahbl & mask_low;
+    res3 = albh & mask_low;
+    temp = res1 + res2 + res3;
+    carry = temp >> (sizeof(digit_t) * 4);
+    c[0] ^= temp << (sizeof(digit_t) * 4);    // C01
+
+    res1 = ahbl >> (sizeof(digit_t) * 4);
+    res2 = albh >> (sizeof(digit_t) * 4);
+    res3 = ahbh & mask_low;
+    temp = res1 + res2 + res3 + carry;
+    c[1] = temp & mask_low;                   // C10
+    carry = temp & mask_high;
+    c[1] ^= (ahbh & mask_high) + carry;       // C11
+}
+
+
+#ifndef HW
+/* C model of the accumulator: acc_hi:acc_lo */
+static uint64_t acc_lo;
+static uint32_t acc_hi;
+#endif
+
+/* acc += a * b */
+static inline void wmac(digit_t a, digit_t b)
+{
+#ifdef HW
+    asm volatile("pq.wmac x0,%[a],%[b]\n" : : [a]"r" (a), [b]"r" (b));
+#else
+    uint64_t p = (uint64_t)a * b;
+
+    acc_lo += p;
+    acc_hi += (acc_lo < p);
+#endif
+}
+
+/* acc += a * b, returns the lowest word of acc and shifts it down by one word */
+static inline digit_t wmacs(digit_t a, digit_t b)
+{
+    digit_t r;
+#ifdef HW
+    asm volatile("pq.wmacs %[r],%[a],%[b]\n" : [r]"=r" (r) : [a]"r" (a), [b]"r" (b));
+#else
+    wmac(a, b);
+    r = (digit_t)acc_lo;
+    acc_lo = (acc_lo >> 32) | ((uint64_t)acc_hi << 32);
+    acc_hi = 0;
+#endif
+    return r;
+}
+
+/* acc += a * b, returns the lowest word of acc and clears it */
+static inline digit_t wmacr(digit_t a, digit_t b)
+{
+    digit_t r;
+#ifdef HW
+    asm volatile("pq.wmacr %[r],%[a],%[b]\n" : [r]"=r" (r) : [a]"r" (a), [b]"r" (b));
+#else
+    wmac(a, b);
+    r = (digit_t)acc_lo;
+    acc_lo = 0;
+    acc_hi = 0;
+#endif
+    return r;
+}
+
+/* acc += sum of a[j] * b[-j] for 0 <= j < n */
+static inline void column(const digit_t* a, const digit_t* b, unsigned int n)
+{
+#ifdef HW
+    digit_t x, y;
+
+    if (n == 0) {
+        return;
+    }
+    asm volatile(
+        "lp.setup x0,%[n],(.end_column%=)\n"
+            "p.lw %[x],4(%[a]!)\n"
+            "p.lw %[y],-4(%[b]!)\n"
+            "pq.wmac x0,%[x],%[y]\n"
+        ".end_column%=:\n"
+        : [a]"+r" (a), [b]"+r" (b), [x]"=&r" (x), [y]"=&r" (y)
+        : [n]"r" (n)
+        : "memory"
+    );
+#else
+    unsigned int j;
+
+    for (j = 0; j < n; j++) {
+        wmac(a[j], b[-(int)j]);
+    }
+#endif
+}
+
+/* acc += 2 * sum of a[j] * b[-j] for 0 <= j < n */
+static inline void column2(const digit_t* a, const digit_t* b, unsigned int n)
+{
+#ifdef HW
+    digit_t x, y;
+
+    if (n == 0) {
+        return;
+    }
+    asm volatile(
+        "lp.setup x0,%[n],(.end_column2%=)\n"
+            "p.lw %[x],4(%[a]!)\n"
+            "p.lw %[y],-4(%[b]!)\n"
+            "pq.wmac x0,%[x],%[y]\n"
+            "pq.wmac x0,%[x],%[y]\n"
+        ".end_column2%=:\n"
+        : [a]"+r" (a), [b]"+r" (b), [x]"=&r" (x), [y]"=&r" (y)
+        : [n]"r" (n)
+        : "memory"
+    );
+#else
+    unsigned int j;
+
+    for (j = 0; j < n; j++) {
+        wmac(a[j], b[-(int)j]);
+        wmac(a[j], b[-(int)j]);
+    }
+#endif
+}
+
+
+static void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision comba squaring, c = a^2, where lng(a) = nwords.
+  // Every product a[j]*a[i-j] with j < i-j is accumulated twice, the square a[i/2]^2 once.
+    unsigned int i, lo;
+
+    for (i = 0; i < 2*nwords-1; i++) {
+        lo = (i < nwords) ? 0 : i-nwords+1;
+        column2(&a[lo], &a[i-lo], (i+1)/2 - lo);
+        if (i & 1) {
+            c[i] = wmacs(0, 0);
+        } else {
+            c[i] = wmacs(a[i/2], a[i/2]);
+        }
+    }
+    c[2*nwords-1] = wmacr(0, 0);
+}
+
+
+void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
+{ // Multiprecision comba multiply, c = a*b, where lng(a) = lng(b) = nwords.
+    unsigned int i, lo, hi;
+
+    if (a == b) {
+        mp_sqr(a, c, nwords);
+        return;
+    }
+
+    for (i = 0; i < 2*nwords-1; i++) {
+        lo = (i < nwords) ? 0 : i-nwords+1;
+        hi = (i < nwords) ? i : nwords-1;
+        column(&a[lo], &b[i-lo], hi-lo);
+        c[i] = wmacs(a[hi], b[i-hi]);
+    }
+    c[2*nwords-1] = wmacr(0, 0);
+}
+
+
+void rdc_mont(const digit_t* ma, digit_t* mc)
+{ // Efficient Montgomery reduction using comba and exploiting the special form of the prime p751.
+  // mc = ma*R^-1 mod p751x2, where R = 2^768.
+  // If ma < 2^768*p751, the output mc is in the range [0, 2*p751-1].
+  // ma is assumed to be in Montgomery representation.
+  // Products with the p751_ZERO_WORDS zero words of p751+1 are skipped; ma[i] is added as ma[i]*1.
+    unsigned int i, lo, hi;
+    const digit_t* p = (const digit_t*)p751p1;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        if (i >= p751_ZERO_WORDS) {
+            column(&mc[0], &p[i], i-p751_ZERO_WORDS+1);
+        }
+        mc[i] = wmacs(ma[i], 1);
+    }
+
+    for (i = NWORDS_FIELD; i < 2*NWORDS_FIELD-1; i++) {
+        lo = i-NWORDS_FIELD+1;
+        hi = (i < NWORDS_FIELD+p751_ZERO_WORDS-1) ? i-p751_ZERO_WORDS+1 : NWORDS_FIELD;
+        column(&mc[lo], &p[i-lo], hi-lo);
+        mc[i-NWORDS_FIELD] = wmacs(ma[i], 1);
+    }
+    mc[NWORDS_FIELD-1] = wmacr(ma[2*NWORDS_FIELD-1], 1);
+}
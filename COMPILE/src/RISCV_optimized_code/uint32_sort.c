@@ -0,0 +1,7 @@
+#include "uint32.h"
+#include "crypto_sort_int32.h"
+
+/* Replaces ref/uint32_sort.c of sntrup* and ntrulpr* in the RISQ-V builds */
+void uint32_sort(uint32 *x, int n) {
+    crypto_sort_uint32(x, n);
+}
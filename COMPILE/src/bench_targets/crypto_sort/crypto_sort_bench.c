@@ -0,0 +1,107 @@
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "gpio.h"
+#include "crypto_sort.h"
+
+
+#define MAXN 1277
+
+/* Same sizes as the NTRU and Streamlined NTRU Prime parameter sets */
+static const long long sizes[] = { 509, 653, 677, 701, 761, 821, 857, 1277 };
+
+static int32_t x[MAXN];
+
+static void fill(long long n)
+{
+    uint32_t s = 0x12345678 ^ (uint32_t)n;
+    for (long long i = 0; i < n; i++) {
+        s = s * 1664525 + 1013904223;
+        x[i] = (int32_t)s;
+    }
+}
+
+int main(void)
+{
+    int sorted = 1;
+
+    set_gpio_pin_direction(0,DIR_OUT);
+    set_gpio_pin_direction(1,DIR_OUT);
+    set_gpio_pin_direction(2,DIR_OUT);
+    set_gpio_pin_direction(3,DIR_OUT);
+    set_gpio_pin_direction(4,DIR_OUT);
+    set_gpio_pin_direction(5,DIR_OUT);
+    set_gpio_pin_direction(6,DIR_OUT);
+    set_gpio_pin_direction(7,DIR_OUT);
+
+    // Markers in a6 (x16): 0x4141/0x4242 around n = 509, 0x4343/0x4444
+    // around n = 653 and so on up to 0x4f4f/0x5050 around n = 1277
+    fill(sizes[0]);
+    asm volatile("li  a6,0x4141");
+    PQCLEAN_NTRUHPS4096821_CLEAN_crypto_sort(x, sizes[0]);
+    asm volatile("li  a6,0x4242");
+    for (long long i = 1; i < sizes[0]; i++) sorted &= x[i - 1] <= x[i];
+    set_gpio_pin_value(0,1);
+
+    fill(sizes[1]);
+    asm volatile("li  a6,0x4343");
+    PQCLEAN_NTRUHPS4096821_CLEAN_crypto_sort(x, sizes[1]);
+    asm volatile("li  a6,0x4444");
+    for (long long i = 1; i < sizes[1]; i++) sorted &= x[i - 1] <= x[i];
+    set_gpio_pin_value(1,1);
+
+    fill(sizes[2]);
+    asm volatile("li  a6,0x4545");
+    PQCLEAN_NTRUHPS4096821_CLEAN_crypto_sort(x, sizes[2]);
+    asm volatile("li  a6,0x4646");
+    for (long long i = 1; i < sizes[2]; i++) sorted &= x[i - 1] <= x[i];
+    set_gpio_pin_value(2,1);
+
+    fill(sizes[3]);
+    asm volatile("li  a6,0x4747");
+    PQCLEAN_NTRUHPS4096821_CLEAN_crypto_sort(x, sizes[3]);
+    asm volatile("li  a6,0x4848");
+    for (long long i = 1; i < sizes[3]; i++) sorted &= x[i - 1] <= x[i];
+    set_gpio_pin_value(3,1);
+
+    fill(sizes[4]);
+    asm volatile("li  a6,0x4949");
+    PQCLEAN_NTRUHPS4096821_CLEAN_crypto_sort(x, sizes[4]);
+    asm volatile("li  a6,0x4a4a");
+    for (long long i = 1; i < sizes[4]; i++) sorted &= x[i - 1] <= x[i];
+    set_gpio_pin_value(4,1);
+
+    fill(sizes[5]);
+    asm volatile("li  a6,0x4b4b");
+    PQCLEAN_NTRUHPS4096821_CLEAN_crypto_sort(x, sizes[5]);
+    asm volatile("li  a6,0x4c4c");
+    for (long long i = 1; i < sizes[5]; i++) sorted &= x[i - 1] <= x[i];
+    set_gpio_pin_value(5,1);
+
+    fill(sizes[6]);
+    asm volatile("li  a6,0x4d4d");
+    PQCLEAN_NTRUHPS4096821_CLEAN_crypto_sort(x, sizes[6]);
+    asm volatile("li  a6,0x4e4e");
+    for (long long i = 1; i < sizes[6]; i++) sorted &= x[i - 1] <= x[i];
+    set_gpio_pin_value(6,1);
+
+    fill(sizes[7]);
+    asm volatile("li  a6,0x4f4f");
+    PQCLEAN_NTRUHPS4096821_CLEAN_crypto_sort(x, sizes[7]);
+    asm volatile("li  a6,0x5050");
+    for (long long i = 1; i < sizes[7]; i++) sorted &= x[i - 1] <= x[i];
+    set_gpio_pin_value(7,1);
+
+    if (!sorted) {  // All pins low if any output was out of order
+    	set_gpio_pin_value(0,0);
+    	set_gpio_pin_value(1,0);
+    	set_gpio_pin_value(2,0);
+    	set_gpio_pin_value(3,0);
+    	set_gpio_pin_value(4,0);
+    	set_gpio_pin_value(5,0);
+    	set_gpio_pin_value(6,0);
+    	set_gpio_pin_value(7,0);
+    }
+
+    while(1) { }
+}
@@ -0,0 +1,94 @@
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "gpio.h"
+#include "api.h"
+
+
+#define DEBUG
+
+#define MLEN 32
+
+int main(void)
+{
+
+    set_gpio_pin_direction(0,DIR_OUT);
+    set_gpio_pin_direction(1,DIR_OUT);
+    set_gpio_pin_direction(2,DIR_OUT);
+    set_gpio_pin_direction(3,DIR_OUT);
+    set_gpio_pin_direction(4,DIR_OUT);
+    set_gpio_pin_direction(5,DIR_OUT);
+    set_gpio_pin_direction(6,DIR_OUT);
+    set_gpio_pin_direction(7,DIR_OUT);
+
+
+    unsigned char sig[PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_BYTES], m[MLEN];
+    unsigned char pk[PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_PUBLICKEYBYTES], sk[PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_SECRETKEYBYTES];
+    size_t siglen;
+    int ret, ret_forged;
+
+    for(int i=0; i<MLEN; i++)
+    {
+        m[i] = (unsigned char)i;
+    }
+
+    set_gpio_pin_value(0,1);
+    asm volatile("li  a6,0x4141");    // Register x16
+    PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_keypair(pk, sk);
+    asm volatile("li  a6,0x4242");
+    set_gpio_pin_value(1,1);
+    asm volatile("li  a6,0x4343");
+    PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature(sig,&siglen,m,MLEN,sk);
+    asm volatile("li  a6,0x4444");
+    set_gpio_pin_value(2,1);
+    asm volatile("li  a6,0x4545");
+    ret = PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_verify(sig,siglen,m,MLEN,pk);
+    asm volatile("li  a6,0x4646");
+    set_gpio_pin_value(3,1);
+    m[0] ^= 1;
+    ret_forged = PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_verify(sig,siglen,m,MLEN,pk);
+    if((ret != 0) || (ret_forged == 0)) {  // Valid signature rejected or forged message accepted
+    	set_gpio_pin_value(0,0);
+    	set_gpio_pin_value(1,0);
+    	set_gpio_pin_value(2,0);
+    	set_gpio_pin_value(3,0);
+    	set_gpio_pin_value(4,0);
+    	set_gpio_pin_value(5,0);
+    	set_gpio_pin_value(6,0);
+    	set_gpio_pin_value(7,0);
+    }
+    else {
+    	set_gpio_pin_value(0,1);
+    	set_gpio_pin_value(1,1);
+    	set_gpio_pin_value(2,1);
+    	set_gpio_pin_value(3,1);
+    	set_gpio_pin_value(4,1);
+    	set_gpio_pin_value(5,1);
+    	set_gpio_pin_value(6,1);
+    	set_gpio_pin_value(7,1);
+    }
+
+#ifdef DEBUG
+    #define DATA_BASE_ADDR 0x00100000
+    volatile uint32_t * debug_ptr1 = (uint32_t *) DATA_BASE_ADDR + 0x2328;
+    volatile uint32_t * debug_ptr2 = (uint32_t *) DATA_BASE_ADDR + 0x2329;
+    volatile uint32_t * debug_ptr3 = (uint32_t *) DATA_BASE_ADDR + 0x232a;
+
+    for(int i=0; i<PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_PUBLICKEYBYTES; i++)
+    {
+        *debug_ptr1 = pk[i];
+    }
+    for(int i=0; i<PQCLEAN_DILITHIUM2_CLEAN_CRYPTO_SECRETKEYBYTES; i++)
+    {
+        *debug_ptr2 = sk[i];
+    }
+    for(int i=0; i<siglen; i++)
+    {
+        *debug_ptr3 = sig[i];
+    }
+
+#endif
+
+
+    while(1) { }
+}
@@ -0,0 +1,129 @@
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "gpio.h"
+#include "api.h"
+
+
+#define DEBUG
+
+#define MLEN 32
+
+/* Stack usage check: before keygen the stack between _stack_limit, the bottom
+ * of the stack reserved in the linker script, and the current frame is filled
+ * with STACK_CANARY. After verification the lowest overwritten word gives the
+ * peak usage, and an overwritten bottom word means the stack overflowed. */
+#define STACK_CANARY 0x5aa5c33c
+
+extern uint32_t _stack_limit[], _stack_start[];
+
+static void __attribute__((noinline)) fill_stack(void)
+{
+    volatile uint32_t marker;
+    volatile uint32_t *p = _stack_limit;
+
+    while (p < &marker - 64) {
+        *p++ = STACK_CANARY;
+    }
+}
+
+static uint32_t stack_usage(void)
+{
+    const volatile uint32_t *p = _stack_limit;
+
+    while (*p == STACK_CANARY) {
+        p++;
+    }
+    return (uint32_t)((uintptr_t)_stack_start - (uintptr_t)p);
+}
+
+int main(void)
+{
+
+    set_gpio_pin_direction(0,DIR_OUT);
+    set_gpio_pin_direction(1,DIR_OUT);
+    set_gpio_pin_direction(2,DIR_OUT);
+    set_gpio_pin_direction(3,DIR_OUT);
+    set_gpio_pin_direction(4,DIR_OUT);
+    set_gpio_pin_direction(5,DIR_OUT);
+    set_gpio_pin_direction(6,DIR_OUT);
+    set_gpio_pin_direction(7,DIR_OUT);
+
+
+    unsigned char sig[PQCLEAN_QTESLAPI_CLEAN_CRYPTO_BYTES], m[MLEN];
+    unsigned char pk[PQCLEAN_QTESLAPI_CLEAN_CRYPTO_PUBLICKEYBYTES], sk[PQCLEAN_QTESLAPI_CLEAN_CRYPTO_SECRETKEYBYTES];
+    size_t siglen;
+    uint32_t stack;
+    int ret, ret_forged;
+
+    for(int i=0; i<MLEN; i++)
+    {
+        m[i] = (unsigned char)i;
+    }
+
+    fill_stack();
+
+    set_gpio_pin_value(0,1);
+    asm volatile("li  a6,0x4141");    // Register x16
+    PQCLEAN_QTESLAPI_CLEAN_crypto_sign_keypair(pk, sk);
+    asm volatile("li  a6,0x4242");
+    set_gpio_pin_value(1,1);
+    asm volatile("li  a6,0x4343");
+    PQCLEAN_QTESLAPI_CLEAN_crypto_sign_signature(sig,&siglen,m,MLEN,sk);
+    asm volatile("li  a6,0x4444");
+    set_gpio_pin_value(2,1);
+    asm volatile("li  a6,0x4545");
+    ret = PQCLEAN_QTESLAPI_CLEAN_crypto_sign_verify(sig,siglen,m,MLEN,pk);
+    asm volatile("li  a6,0x4646");
+    set_gpio_pin_value(3,1);
+    m[0] ^= 1;
+    ret_forged = PQCLEAN_QTESLAPI_CLEAN_crypto_sign_verify(sig,siglen,m,MLEN,pk);
+    stack = stack_usage();
+    if((ret != 0) || (ret_forged == 0) ||  // Valid signature rejected or forged message accepted
+       (_stack_limit[0] != STACK_CANARY)) {  // Stack overflowed the reserved region
+    	set_gpio_pin_value(0,0);
+    	set_gpio_pin_value(1,0);
+    	set_gpio_pin_value(2,0);
+    	set_gpio_pin_value(3,0);
+    	set_gpio_pin_value(4,0);
+    	set_gpio_pin_value(5,0);
+    	set_gpio_pin_value(6,0);
+    	set_gpio_pin_value(7,0);
+    }
+    else {
+    	set_gpio_pin_value(0,1);
+    	set_gpio_pin_value(1,1);
+    	set_gpio_pin_value(2,1);
+    	set_gpio_pin_value(3,1);
+    	set_gpio_pin_value(4,1);
+    	set_gpio_pin_value(5,1);
+    	set_gpio_pin_value(6,1);
+    	set_gpio_pin_value(7,1);
+    }
+
+#ifdef DEBUG
+    #define DATA_BASE_ADDR 0x00100000
+    volatile uint32_t * debug_ptr1 = (uint32_t *) DATA_BASE_ADDR + 0x2328;
+    volatile uint32_t * debug_ptr2 = (uint32_t *) DATA_BASE_ADDR + 0x2329;
+    volatile uint32_t * debug_ptr3 = (uint32_t *) DATA_BASE_ADDR + 0x232a;
+    volatile uint32_t * debug_ptr4 = (uint32_t *) DATA_BASE_ADDR + 0x232b;
+
+    for(int i=0; i<PQCLEAN_QTESLAPI_CLEAN_CRYPTO_PUBLICKEYBYTES; i++)
+    {
+        *debug_ptr1 = pk[i];
+    }
+    for(int i=0; i<PQCLEAN_QTESLAPI_CLEAN_CRYPTO_SECRETKEYBYTES; i++)
+    {
+        *debug_ptr2 = sk[i];
+    }
+    for(int i=0; i<siglen; i++)
+    {
+        *debug_ptr3 = sig[i];
+    }
+    *debug_ptr4 = stack;
+
+#endif
+
+
+    while(1) { }
+}
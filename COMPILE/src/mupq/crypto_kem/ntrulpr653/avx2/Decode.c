@@ -0,0 +1 @@
+../ref/Decode.c
\ No newline at end of file
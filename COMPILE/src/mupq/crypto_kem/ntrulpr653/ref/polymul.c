@@ -0,0 +1 @@
+../../sntrup761/ref/polymul.c
\ No newline at end of file
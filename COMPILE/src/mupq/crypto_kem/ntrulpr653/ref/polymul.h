@@ -0,0 +1 @@
+../../sntrup761/ref/polymul.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/int8.h
\ No newline at end of file
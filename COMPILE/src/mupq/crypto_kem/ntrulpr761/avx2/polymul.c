@@ -0,0 +1 @@
+../../sntrup761/avx2/polymul.c
\ No newline at end of file
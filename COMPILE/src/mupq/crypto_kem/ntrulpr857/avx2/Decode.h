@@ -0,0 +1 @@
+../ref/Decode.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/int32.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/params.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../sntrup761/avx2/uint32_sort.c
\ No newline at end of file
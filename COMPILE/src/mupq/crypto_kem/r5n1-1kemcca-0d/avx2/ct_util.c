@@ -0,0 +1 @@
+../opt/ct_util.c
\ No newline at end of file
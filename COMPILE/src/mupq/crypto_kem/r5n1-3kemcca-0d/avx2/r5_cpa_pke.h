@@ -0,0 +1 @@
+../opt/r5_cpa_pke.h
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/r5_ringmul.h
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/api.h
\ No newline at end of file
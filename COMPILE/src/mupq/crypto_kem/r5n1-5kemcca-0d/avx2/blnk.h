@@ -0,0 +1 @@
+../opt/blnk.h
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/kem.c
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/little_endian.h
\ No newline at end of file
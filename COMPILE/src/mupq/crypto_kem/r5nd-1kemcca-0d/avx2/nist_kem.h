@@ -0,0 +1 @@
+../opt/nist_kem.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../r5nd-1kemcca-5d/avx2/r5_addsub.h
\ No newline at end of file
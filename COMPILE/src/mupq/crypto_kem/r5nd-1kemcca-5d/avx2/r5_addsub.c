@@ -0,0 +1,140 @@
+//  r5_addsub.c
+//  Copyright (c) 2019, PQShield Ltd.
+
+//  Addition-subtraction loops. The right number of of combined elements
+//  depends on the register file structure of the target -- ARM allows
+//  basically any register to be used as a pointer, which is a benefit.
+
+//  AVX2: r5_modq_addsub_list takes the whole list of index pairs, so the
+//  callers no longer need the 3-pair unrolling, and sums four pairs per
+//  load and store of dst.
+
+#include <immintrin.h>
+
+#include "r5_parameter_sets.h"
+#include "r5_addsub.h"
+
+//  Basic generic C versions
+
+void r5_modq_addsub_d(modq_t *dst,
+    const modq_t *p_add, const modq_t *p_sub)
+{
+    size_t i;
+
+    for (i = 0; i < PARAMS_D; i++) {
+        dst[i] += p_add[i] - p_sub[i];
+    }
+}
+
+void r5_modq_addsub3_d(modq_t *dst,
+    const modq_t *p_add1, const modq_t *p_sub1,
+    const modq_t *p_add2, const modq_t *p_sub2,
+    const modq_t *p_add3, const modq_t *p_sub3)
+{
+    size_t i;
+
+    for (i = 0; i < PARAMS_D; i++) {
+        dst[i] += p_add1[i] - p_sub1[i]
+                + p_add2[i] - p_sub2[i]
+                + p_add3[i] - p_sub3[i];
+    }
+}
+
+void r5_modq_addsub_perm_nbar_d(modq_t *dst, const uint16_t *perm,
+    const modq_t *p_add, const modq_t *p_sub)
+{
+    size_t i, j, k;
+
+    i = 0;
+    for (j = 0; j < PARAMS_D; j++) {
+        k = perm[j];
+        dst[i] += p_add[k] - p_sub[k];
+        i += PARAMS_N_BAR;
+    }
+}
+
+void r5_modq_addsub3_perm_nbar_d(modq_t *dst, const uint16_t *perm,
+    const modq_t *p_add1, const modq_t *p_sub1,
+    const modq_t *p_add2, const modq_t *p_sub2,
+    const modq_t *p_add3, const modq_t *p_sub3)
+{
+    size_t i, j, k;
+
+    i = 0;
+    for (j = 0; j < PARAMS_D; j++) {
+        k = perm[j];
+        dst[i] += p_add1[k] - p_sub1[k]
+                + p_add2[k] - p_sub2[k]
+                + p_add3[k] - p_sub3[k];
+        i += PARAMS_N_BAR;
+    }
+}
+
+void r5_modp_addsub_mu(modp_t *dst,
+    const modp_t *p_add, const modp_t *p_sub)
+{
+    size_t i;
+
+    for (i = 0; i < PARAMS_MU; i++) {
+        dst[i] += p_add[i] - p_sub[i];
+    }
+}
+
+//  AVX2 version: all h/2 index pairs of a ternary vector at once, four
+//  pairs per pass over dst
+
+void r5_modq_addsub_list(modq_t *dst, size_t len,
+    const modq_t * const *p_add, const modq_t * const *p_sub, size_t n)
+{
+    size_t i, k;
+    __m256i x, y;
+    const modq_t *a0, *a1, *a2, *a3, *s0, *s1, *s2, *s3;
+
+    for (k = 0; k + 4 <= n; k += 4) {
+        a0 = p_add[k];
+        a1 = p_add[k + 1];
+        a2 = p_add[k + 2];
+        a3 = p_add[k + 3];
+        s0 = p_sub[k];
+        s1 = p_sub[k + 1];
+        s2 = p_sub[k + 2];
+        s3 = p_sub[k + 3];
+        for (i = 0; i + 16 <= len; i += 16) {
+            x = _mm256_add_epi16(
+                _mm256_loadu_si256((const __m256i *) &a0[i]),
+                _mm256_loadu_si256((const __m256i *) &a1[i]));
+            y = _mm256_add_epi16(
+                _mm256_loadu_si256((const __m256i *) &s0[i]),
+                _mm256_loadu_si256((const __m256i *) &s1[i]));
+            x = _mm256_add_epi16(x, _mm256_add_epi16(
+                _mm256_loadu_si256((const __m256i *) &a2[i]),
+                _mm256_loadu_si256((const __m256i *) &a3[i])));
+            y = _mm256_add_epi16(y, _mm256_add_epi16(
+                _mm256_loadu_si256((const __m256i *) &s2[i]),
+                _mm256_loadu_si256((const __m256i *) &s3[i])));
+            x = _mm256_add_epi16(x,
+                _mm256_loadu_si256((const __m256i *) &dst[i]));
+            _mm256_storeu_si256((__m256i *) &dst[i], _mm256_sub_epi16(x, y));
+        }
+        for (; i < len; i++) {
+            dst[i] += a0[i] + a1[i] + a2[i] + a3[i]
+                    - s0[i] - s1[i] - s2[i] - s3[i];
+        }
+    }
+
+    for (; k < n; k++) {
+        a0 = p_add[k];
+        s0 = p_sub[k];
+        for (i = 0; i + 16 <= len; i += 16) {
+            x = _mm256_sub_epi16(
+                _mm256_loadu_si256((const __m256i *) &a0[i]),
+                _mm256_loadu_si256((const __m256i *) &s0[i]));
+            x = _mm256_add_epi16(x,
+                _mm256_loadu_si256((const __m256i *) &dst[i]));
+            _mm256_storeu_si256((__m256i *) &dst[i], x);
+        }
+        for (; i < len; i++) {
+            dst[i] += a0[i] - s0[i];
+        }
+    }
+}
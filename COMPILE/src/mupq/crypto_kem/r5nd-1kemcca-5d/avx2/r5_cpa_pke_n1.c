@@ -0,0 +1 @@
+../opt/r5_cpa_pke_n1.c
\ No newline at end of file
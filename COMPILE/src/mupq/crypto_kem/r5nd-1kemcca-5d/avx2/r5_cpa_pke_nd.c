@@ -0,0 +1 @@
+../opt/r5_cpa_pke_nd.c
\ No newline at end of file
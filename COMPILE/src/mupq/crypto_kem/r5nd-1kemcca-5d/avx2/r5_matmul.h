@@ -0,0 +1 @@
+../opt/r5_matmul.h
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/sneik_f512_c99.c
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/sneik_param.h
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/xe5_c64.c
\ No newline at end of file
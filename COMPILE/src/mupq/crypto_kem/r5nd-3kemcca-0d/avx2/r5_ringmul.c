@@ -0,0 +1 @@
+../../r5nd-1kemcca-5d/avx2/r5_ringmul.c
\ No newline at end of file
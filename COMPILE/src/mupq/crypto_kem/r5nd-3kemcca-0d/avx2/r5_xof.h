@@ -0,0 +1 @@
+../opt/r5_xof.h
\ No newline at end of file
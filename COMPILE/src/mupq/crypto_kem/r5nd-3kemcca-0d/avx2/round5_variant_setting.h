@@ -0,0 +1 @@
+../opt/round5_variant_setting.h
\ No newline at end of file
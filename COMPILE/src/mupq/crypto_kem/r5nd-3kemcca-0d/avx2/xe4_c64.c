@@ -0,0 +1 @@
+../opt/xe4_c64.c
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/blnk.c
\ No newline at end of file
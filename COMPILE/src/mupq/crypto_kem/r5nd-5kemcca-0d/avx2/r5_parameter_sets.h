@@ -0,0 +1 @@
+../opt/r5_parameter_sets.h
\ No newline at end of file
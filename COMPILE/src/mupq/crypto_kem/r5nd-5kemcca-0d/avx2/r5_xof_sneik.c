@@ -0,0 +1 @@
+../opt/r5_xof_sneik.c
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/ct_util.h
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/r5_cca_kem.h
\ No newline at end of file
@@ -0,0 +1 @@
+../opt/xe2_c16.c
\ No newline at end of file
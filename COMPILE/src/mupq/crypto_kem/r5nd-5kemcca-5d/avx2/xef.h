@@ -0,0 +1 @@
+../opt/xef.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/ffi_poly.c
\ No newline at end of file
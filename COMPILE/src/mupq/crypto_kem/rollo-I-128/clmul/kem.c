@@ -0,0 +1 @@
+../ref/kem.c
\ No newline at end of file
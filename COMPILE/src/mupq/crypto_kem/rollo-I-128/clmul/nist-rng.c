@@ -0,0 +1 @@
+../ref/nist-rng.c
\ No newline at end of file
@@ -7,161 +7,232 @@
 #include "ffi_poly.h"
 #include "ffi_qre.h"
 
-static int init_modulus = 0;
+#define QRE_DEG (PARAM_N - 1) /**< Degree of the ffi_qre elements */
 
-static ffi_poly_sparse modulus;
-static ffi_poly modulusInv;
-static uint64_t QRE_DEG;
+/**
+ * Scratch of kar_mul_ur for a product of PARAM_N coefficients. A call on size
+ * coefficients uses 2*h ffi_elt and 2*h-1 ffi_elt_ur, h = ceil(size/2), and hands
+ * the rest to the recursive calls, which run one after the other. Summed over the
+ * levels, h is at most PARAM_N plus the number of levels (8 for PARAM_N < 256).
+ */
+#define KAR_MUL_SCRATCH (2 * (PARAM_N + 8))
 
 /**
- * \fn void ffi_qre_init_modulus(uint64_t n) {
- * \brief This function init the quotient ring modulus corresponding to PARAM_N
- *
- * \param[in] n Degree of the modulus
+ * \fn static void ffi_elt_ur_add(ffi_elt_ur o, const ffi_elt_ur e1, const ffi_elt_ur e2)
+ * \brief This function adds two unreduced finite field elements
  */
-void ffi_qre_init_modulus(uint64_t n) {
-  if(init_modulus == 0) {
-    QRE_DEG = n-1;
-    modulus = ffi_qre_get_modulus(n);
-    ffi_poly_init(&modulusInv, QRE_DEG+1);
-    ffi_poly_set_zero(modulusInv, QRE_DEG+1);
-    for(size_t i=0 ; i<modulus->coeffs_nb ; i++) {
-      ffi_elt_set_one(modulusInv->v[modulus->coeffs[i]]);
-    }
+static void ffi_elt_ur_add(ffi_elt_ur o, const ffi_elt_ur e1, const ffi_elt_ur e2) {
+  for(size_t i = 0 ; i < 2*FIELD_UINT64 ; ++i) {
+    o[i] = e1[i] ^ e2[i];
   }
-  init_modulus++;
 }
 
 
 
 /**
- * \fn void ffi_qre_init_modulus(uint64_t n) {
- * \brief This function clears the quotient ring modulus in use
+ * \fn static void kar_mul_ur(ffi_elt_ur* o, const ffi_elt* a, const ffi_elt* b, uint64_t size, ffi_elt* elts, ffi_elt_ur* urs)
+ * \brief Karatsuba multiplication of two vectors of <b>size</b> finite field elements
+ *
+ * The 2*size-1 coefficients of the product are left unreduced.
+ *
+ * \param[out] o Unreduced product of <b>a</b> and <b>b</b>
+ * \param[in] a Vector of finite field elements
+ * \param[in] b Vector of finite field elements
+ * \param[in] size Size of <b>a</b> and <b>b</b>
+ * \param[in] elts Scratch, see KAR_MUL_SCRATCH
+ * \param[in] urs Scratch, see KAR_MUL_SCRATCH
  */
-void ffi_qre_clear_modulus(void) {
-  init_modulus--;
-  if(init_modulus == 0) {
-    ffi_poly_sparse_clear(modulus);
-    ffi_poly_clear(modulusInv);
+static void kar_mul_ur(ffi_elt_ur* o, const ffi_elt* a, const ffi_elt* b, uint64_t size, ffi_elt* elts, ffi_elt_ur* urs) {
+  if(size == 1) {
+    ffi_elt_ur_set_zero(o[0]);
+    ffi_elt_ur_mul(o[0], a[0], b[0]);
+    return;
+  }
+
+  uint64_t h = (size + 1) / 2;
+  uint64_t l = size - h;
+  ffi_elt* a2 = elts;
+  ffi_elt* b2 = elts + h;
+  ffi_elt_ur* d = urs;
+  elts += 2*h;
+  urs += 2*h-1;
+
+  // a2 = a0 + a1 and b2 = b0 + b1
+  for(uint64_t i = 0 ; i < l ; ++i) {
+    ffi_elt_add(a2[i], a[i], a[i+h]);
+    ffi_elt_add(b2[i], b[i], b[i+h]);
+  }
+  if(l < h) {
+    ffi_elt_set(a2[h-1], a[h-1]);
+    ffi_elt_set(b2[h-1], b[h-1]);
+  }
+
+  // c0 = a0*b0 in the low part of o, c2 = a1*b1 in the high part of o
+  kar_mul_ur(o, a, b, h, elts, urs);
+  ffi_elt_ur_set_zero(o[2*h-1]);
+  kar_mul_ur(o+2*h, a+h, b+h, l, elts, urs);
+
+  // c1 = a2*b2 + c0 + c2
+  kar_mul_ur(d, a2, b2, h, elts, urs);
+  for(uint64_t i = 0 ; i < 2*h-1 ; ++i) {
+    ffi_elt_ur_add(d[i], d[i], o[i]);
   }
+  for(uint64_t i = 0 ; i < 2*l-1 ; ++i) {
+    ffi_elt_ur_add(d[i], d[i], o[i+2*h]);
+  }
+
+  for(uint64_t i = 0 ; i < 2*h-1 ; ++i) {
+    ffi_elt_ur_add(o[i+h], o[i+h], d[i]);
+  }
+}
+
+
+
+/**
+ * \fn void ffi_qre_workspace_init(ffi_qre_workspace* ws)
+ * \brief This function prepares a workspace for ffi_qre_init
+ *
+ * \param[out] ws Workspace
+ */
+void ffi_qre_workspace_init(ffi_qre_workspace* ws) {
+  ws->used = 0;
+  ws->overflow = 0;
+}
+
+
+
+/**
+ * \fn int ffi_qre_workspace_clear(ffi_qre_workspace* ws)
+ * \brief This function releases a workspace and reports whether it was large enough
+ *
+ * \param[in] ws Workspace
+ * \return 0 if every ffi_qre_init since ffi_qre_workspace_init got a slot of its own, -1 otherwise
+ */
+int ffi_qre_workspace_clear(ffi_qre_workspace* ws) {
+  ws->used = 0;
+  return ws->overflow ? -1 : 0;
 }
 
 
 
 /**
- * \fn ffi_poly_sparse ffi_qre_get_modulus(uint64_t n) {
- * \brief This function return the sparse polynomial used as the quotient ring modulus for PARAM_N
+ * \fn void ffi_qre_get_modulus(ffi_poly_sparse o, uint64_t n) {
+ * \brief This function sets the sparse polynomial used as the quotient ring modulus for PARAM_N
  *
+ * \param[out] o Sparse polynomial with room for FFI_QRE_MODULUS_MAX_COEFFS coefficients
  * \param[in] n Degree of the modulus
  */
-ffi_poly_sparse ffi_qre_get_modulus(uint64_t n) {
-  ffi_poly_sparse tmpmodulus;
-  uint64_t* values;
+void ffi_qre_get_modulus(ffi_poly_sparse o, uint64_t n) {
+  uint64_t* values = o->coeffs;
 
   if(n == 47) {
-    values = (uint64_t*) malloc(3 * sizeof(uint64_t));
+    o->coeffs_nb = 3;
     values[0] = 0;
     values[1] = 5;
     values[2] = 47;
-    ffi_poly_sparse_init(&tmpmodulus, 3, values);
-    free(values);
   } else if(n == 53) {
-    values = (uint64_t*) malloc(5 * sizeof(uint64_t));
+    o->coeffs_nb = 5;
     values[0] = 0;
     values[1] = 1;
     values[2] = 2;
     values[3] = 6;
     values[4] = 53;
-    ffi_poly_sparse_init(&tmpmodulus, 5, values);
-    free(values);
   } else if(n == 59) {
-    values = (uint64_t*) malloc(5 * sizeof(uint64_t));
+    o->coeffs_nb = 5;
     values[0] = 0;
     values[1] = 2;
     values[2] = 4;
     values[3] = 7;
     values[4] = 59;
-    ffi_poly_sparse_init(&tmpmodulus, 5, values);
-    free(values);
   } else if(n == 67) {
-    values = (uint64_t*) malloc(5 * sizeof(uint64_t));
+    o->coeffs_nb = 5;
     values[0] = 0;
     values[1] = 1;
     values[2] = 2;
     values[3] = 5;
     values[4] = 67;
-    ffi_poly_sparse_init(&tmpmodulus, 5, values);
-    free(values);
   } else if(n == 101) {
-    values = (uint64_t*) malloc(5 * sizeof(uint64_t));
+    o->coeffs_nb = 5;
     values[0] = 0;
     values[1] = 1;
     values[2] = 6;
     values[3] = 7;
     values[4] = 101;
-    ffi_poly_sparse_init(&tmpmodulus, 5, values);
-    free(values);
   } else if(n == 131) {
-    values = (uint64_t*) malloc(5 * sizeof(uint64_t));
+    o->coeffs_nb = 5;
     values[0] = 0;
     values[1] = 2;
     values[2] = 3;
     values[3] = 8;
     values[4] = 131;
-    ffi_poly_sparse_init(&tmpmodulus, 5, values);
-    free(values);
   } else if(n == 149) {
-    values = (uint64_t*) malloc(5 * sizeof(uint64_t));
+    o->coeffs_nb = 5;
     values[0] = 0;
     values[1] = 7;
     values[2] = 9;
     values[3] = 10;
     values[4] = 149;
-    ffi_poly_sparse_init(&tmpmodulus, 5, values);
-    free(values);
   } else if(n == 151) {
-    values = (uint64_t*) malloc(3 * sizeof(uint64_t));
+    o->coeffs_nb = 3;
     values[0] = 0;
     values[1] = 3;
     values[2] = 151;
-    ffi_poly_sparse_init(&tmpmodulus, 3, values);
-    free(values);
   } else if(n == 157) {
-    values = (uint64_t*) malloc(5 * sizeof(uint64_t));
+    o->coeffs_nb = 5;
     values[0] = 0;
     values[1] = 2;
     values[2] = 5;
     values[3] = 6;
     values[4] = 157;
-    ffi_poly_sparse_init(&tmpmodulus, 5, values);
-    free(values);
   }
-
-  return tmpmodulus;
 }
 
 
 
 /**
- * \fn void ffi_qre_init(ffi_qre* e, uint64_t degree)
- * \brief This function allocates the memory for a ffi_qre element
+ * \fn void ffi_qre_init(ffi_qre_workspace* ws, ffi_qre* e)
+ * \brief This function takes a ffi_qre element from a workspace
+ *
+ * If all slots are in use, <b>e</b> gets the spare slot, which is shared by all such
+ * elements, and ffi_qre_workspace_clear reports the failure.
  *
- * \param[out] e Pointer to the allocated ffi_qre
+ * \param[in] ws Workspace
+ * \param[out] e Pointer to the ffi_qre
  */
-void ffi_qre_init(ffi_qre* e) {
-  ffi_poly_init(e, QRE_DEG);
+void ffi_qre_init(ffi_qre_workspace* ws, ffi_qre* e) {
+  int i;
+
+  for(i = 0 ; i < FFI_QRE_WORKSPACE_SLOTS ; ++i) {
+    if(!(ws->used & ((uint32_t) 1 << i))) {
+      ws->used |= (uint32_t) 1 << i;
+      break;
+    }
+  }
+  if(i == FFI_QRE_WORKSPACE_SLOTS) {
+    ws->overflow = 1;
+  }
+
+  *e = &(ws->qre[i]);
+  (*e)->v = ws->qre_coeffs[i];
+  (*e)->size = QRE_DEG+1;
+  ffi_poly_set_zero(*e, QRE_DEG);
 }
 
 
 
 /**
- * \fn void ffi_qre_clear(ffi_qre p)
- * \brief This function clears the memory allocated for a ffi_qre element
+ * \fn void ffi_qre_clear(ffi_qre_workspace* ws, ffi_qre e)
+ * \brief This function returns a ffi_qre element to its workspace
  *
- * \param e ffi_qre
+ * \param[in] ws Workspace
+ * \param[in] e ffi_qre
  */
-void ffi_qre_clear(ffi_qre e) {
-  ffi_poly_clear(e);
+void ffi_qre_clear(ffi_qre_workspace* ws, ffi_qre e) {
+  size_t i = e - ws->qre;
+
+  if(i < FFI_QRE_WORKSPACE_SLOTS) {
+    ws->used &= ~((uint32_t) 1 << i);
+  }
 }
 
 
@@ -285,15 +356,40 @@ void ffi_qre_add(ffi_qre o, const ffi_qre e1, const ffi_qre e2) {
 
 
 /**
- * \fn void ffi_qre_add(ffi_qre o, const ffi_qre e1, const ffi_qre e2)
+ * \fn void ffi_qre_mul(ffi_qre o, const ffi_qre e1, const ffi_qre e2)
  * \brief This function multiplies two ffi_qre
  *
+ * The products of the coefficients are accumulated and folded by the sparse modulus while still
+ * unreduced, so that only the PARAM_N coefficients of the result are reduced in GF(2^m).
+ *
  * \param[out] o Product of <b>e1</b> and <b>e2</b>
  * \param[in] p1 ffi_qre
  * \param[in] p2 ffi_qre
  */
 void ffi_qre_mul(ffi_qre o, const ffi_qre e1, const ffi_qre e2) {
-  ffi_poly_mulmod_sparse(o, e1, e2, modulus);
+  ffi_elt_ur unreduced[2*QRE_DEG+1];
+  ffi_elt kar_elts[KAR_MUL_SCRATCH];
+  ffi_elt_ur kar_urs[KAR_MUL_SCRATCH];
+  uint64_t modulus_coeffs[FFI_QRE_MODULUS_MAX_COEFFS];
+  ffi_poly_sparse_struct modulus = {0, modulus_coeffs};
+
+  ffi_qre_get_modulus(&modulus, PARAM_N);
+  uint64_t modulus_degree = modulus.coeffs[modulus.coeffs_nb-1];
+
+  kar_mul_ur(unreduced, e1->v, e2->v, QRE_DEG+1, kar_elts, kar_urs);
+
+  // Modular reduction
+  for(uint64_t i = 2*QRE_DEG ; i >= modulus_degree ; i--) {
+    for(size_t j = 0 ; j < modulus.coeffs_nb-1 ; j++) {
+      ffi_elt_ur_add(unreduced[i-modulus_degree+modulus.coeffs[j]], unreduced[i-modulus_degree+modulus.coeffs[j]], unreduced[i]);
+    }
+  }
+
+  for(uint64_t i = 0 ; i <= QRE_DEG ; i++) {
+    ffi_elt_reduce(o->v[i], unreduced[i]);
+  }
+
+  ffi_poly_update_degree(o, QRE_DEG);
 }
 
 
@@ -314,15 +410,26 @@ void ffi_qre_div(ffi_qre q, ffi_qre r, const ffi_qre a, const ffi_qre b) {
 
 
 /**
- * \fn void ffi_qre_inv(ffi_qre o, const ffi_qre e, const ffi_qre modulus)
+ * \fn void ffi_qre_inv(ffi_qre o, const ffi_qre e)
  * \brief This function computes the extended euclidean algorithm to compute the inverse of e
  *
- * \param[out] o Inverse of <b>e</b> modulo <b>modulus</b>
+ * \param[out] o Inverse of <b>e</b> modulo the quotient ring modulus
  * \param[in] e ffi_qre
- * \param[in] modulus Polynomial
  */
 void ffi_qre_inv(ffi_qre o, const ffi_qre e) {
-  ffi_poly_inv(o, e, modulusInv);
+  uint64_t modulus_coeffs[FFI_QRE_MODULUS_MAX_COEFFS];
+  ffi_poly_sparse_struct modulus = {0, modulus_coeffs};
+  ffi_elt modulus_inv_coeffs[PARAM_N + 1];
+  ffi_poly_struct modulus_inv = {modulus_inv_coeffs, PARAM_N + 1, -1};
+
+  // The modulus as a dense polynomial
+  ffi_qre_get_modulus(&modulus, PARAM_N);
+  ffi_poly_set_zero(&modulus_inv, PARAM_N);
+  for(size_t i = 0 ; i < modulus.coeffs_nb ; i++) {
+    ffi_elt_set_one(modulus_inv.v[modulus.coeffs[i]]);
+  }
+
+  ffi_poly_inv(o, e, &modulus_inv);
 }
 
 
@@ -8,13 +8,34 @@
 
 #include "ffi.h"
 #include "nist-rng.h"
+#include "api.h" // parameters.h is reached through api.h in the ROLLO-II types
+#include "parameters.h"
 
-void ffi_qre_init_modulus(uint64_t n);
-void ffi_qre_clear_modulus(void);
-ffi_poly_sparse ffi_qre_get_modulus(uint64_t n);
+#define FFI_QRE_MODULUS_MAX_COEFFS 5 /**< Number of coefficients of the densest quotient ring modulus */
+#define FFI_QRE_WORKSPACE_SLOTS 12 /**< Number of ffi_qre that can be in use at the same time */
 
-void ffi_qre_init(ffi_qre* e);
-void ffi_qre_clear(ffi_qre e);
+/**
+ * \brief Caller-provided storage for the ffi_qre elements
+ *
+ * ffi_qre_init and ffi_qre_clear take and return the slots of a workspace instead of
+ * allocating each element on the heap. Every call path that uses ffi_qre owns a
+ * workspace and passes it down explicitly, so there is no shared state. The extra
+ * slot is handed out when all others are in use; ffi_qre_workspace_clear then fails.
+ */
+typedef struct {
+  ffi_poly_struct qre[FFI_QRE_WORKSPACE_SLOTS + 1];
+  ffi_elt qre_coeffs[FFI_QRE_WORKSPACE_SLOTS + 1][PARAM_N];
+  uint32_t used;
+  int overflow;
+} ffi_qre_workspace;
+
+void ffi_qre_workspace_init(ffi_qre_workspace* ws);
+int ffi_qre_workspace_clear(ffi_qre_workspace* ws);
+
+void ffi_qre_get_modulus(ffi_poly_sparse o, uint64_t n);
+
+void ffi_qre_init(ffi_qre_workspace* ws, ffi_qre* e);
+void ffi_qre_clear(ffi_qre_workspace* ws, ffi_qre e);
 
 void ffi_qre_set_zero(ffi_qre o);
 void ffi_qre_set_random(ffi_qre o, AES_XOF_struct* ctx);
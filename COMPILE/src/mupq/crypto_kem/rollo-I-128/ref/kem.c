@@ -17,30 +17,33 @@ int crypto_kem_keypair(unsigned char* pk, unsigned char* sk) {
   secretKey skTmp;
   publicKey pkTmp;
 
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
   unsigned char sk_seed[SEEDEXPANDER_SEED_BYTES];
   randombytes(sk_seed, SEEDEXPANDER_SEED_BYTES);
 
-  rolloI_secret_key_from_string(&skTmp, sk_seed);
+  rolloI_secret_key_from_string(&skTmp, sk_seed, &qre_workspace);
 
   ffi_qre invX;
-  ffi_qre_init(&invX);
+  ffi_qre_init(&qre_workspace, &invX);
   ffi_qre_inv(invX, skTmp.x);
 
-  ffi_qre_init(&(pkTmp.h));
+  ffi_qre_init(&qre_workspace, &(pkTmp.h));
   ffi_qre_mul(pkTmp.h, invX, skTmp.y);
 
   rolloI_secret_key_to_string(sk, sk_seed);
   rolloI_public_key_to_string(pk, &pkTmp);
 
-  ffi_qre_clear(invX);
+  ffi_qre_clear(&qre_workspace, invX);
   ffi_vspace_clear(skTmp.F, PARAM_D);
-  ffi_qre_clear(skTmp.x);
-  ffi_qre_clear(skTmp.y);
-  ffi_qre_clear(pkTmp.h);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, skTmp.x);
+  ffi_qre_clear(&qre_workspace, skTmp.y);
+  ffi_qre_clear(&qre_workspace, pkTmp.h);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    return -1;
+  }
 
   return 0;
 }
@@ -49,10 +52,11 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, unsigned char* pk) {
   publicKey pkTmp;
   ciphertext ctTmp;
 
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
-  rolloI_public_key_from_string(&pkTmp, pk);
+  rolloI_public_key_from_string(&pkTmp, pk, &qre_workspace);
 
   ffi_vspace E;
   ffi_vspace_init(&E, PARAM_R);
@@ -62,9 +66,9 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, unsigned char* pk) {
 
   ffi_qre E1, E2;
 
-  ffi_qre_init(&E1);
-  ffi_qre_init(&E2);
-  ffi_qre_init(&(ctTmp.syndrom));
+  ffi_qre_init(&qre_workspace, &E1);
+  ffi_qre_init(&qre_workspace, &E2);
+  ffi_qre_init(&qre_workspace, &(ctTmp.syndrom));
 
   //Random error vectors
   ffi_qre_set_random_from_support2(E1, E, PARAM_R);
@@ -82,11 +86,14 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, unsigned char* pk) {
   sha512(ss, support, FFI_VEC_R_BYTES);
 
   ffi_vspace_clear(E, PARAM_R);
-  ffi_qre_clear(E1);
-  ffi_qre_clear(E2);
-  ffi_qre_clear(pkTmp.h);
-  ffi_qre_clear(ctTmp.syndrom);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, E1);
+  ffi_qre_clear(&qre_workspace, E2);
+  ffi_qre_clear(&qre_workspace, pkTmp.h);
+  ffi_qre_clear(&qre_workspace, ctTmp.syndrom);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    memset(ss, 0, SHARED_SECRET_BYTES);
+    return -1;
+  }
 
   return 0;
 }
@@ -95,14 +102,15 @@ int crypto_kem_dec(unsigned char* ss, unsigned char* ct, unsigned char* sk) {
   secretKey skTmp;
   ciphertext ctTmp;
 
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
-  rolloI_secret_key_from_string(&skTmp, sk);
-  rolloI_ciphertext_from_string(&ctTmp, ct);
+  rolloI_secret_key_from_string(&skTmp, sk, &qre_workspace);
+  rolloI_ciphertext_from_string(&ctTmp, ct, &qre_workspace);
 
   ffi_qre xc;
-  ffi_qre_init(&xc);
+  ffi_qre_init(&qre_workspace, &xc);
 
   ffi_qre_mul(xc, skTmp.x, ctTmp.syndrom);
 
@@ -122,12 +130,15 @@ int crypto_kem_dec(unsigned char* ss, unsigned char* ct, unsigned char* sk) {
   }
 
   ffi_vspace_clear(E, PARAM_R);
-  ffi_qre_clear(xc);
+  ffi_qre_clear(&qre_workspace, xc);
   ffi_vspace_clear(skTmp.F, PARAM_D);
-  ffi_qre_clear(skTmp.x);
-  ffi_qre_clear(skTmp.y);
-  ffi_qre_clear(ctTmp.syndrom);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, skTmp.x);
+  ffi_qre_clear(&qre_workspace, skTmp.y);
+  ffi_qre_clear(&qre_workspace, ctTmp.syndrom);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    memset(ss, 0, SHARED_SECRET_BYTES);
+    return -1;
+  }
 
   if(dimE != PARAM_R) return 1;
 
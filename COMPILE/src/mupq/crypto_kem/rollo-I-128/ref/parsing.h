@@ -9,14 +9,14 @@
 #include "rolloI_types.h"
 
 void rolloI_secret_key_to_string(unsigned char* skString, const unsigned char* seed);
-void rolloI_secret_key_from_string(secretKey* sk, unsigned char* skString);
+void rolloI_secret_key_from_string(secretKey* sk, unsigned char* skString, ffi_qre_workspace* ws);
 
 
 void rolloI_public_key_to_string(unsigned char* pkString, publicKey* pk);
-void rolloI_public_key_from_string(publicKey* pk, const unsigned char* pkString);
+void rolloI_public_key_from_string(publicKey* pk, const unsigned char* pkString, ffi_qre_workspace* ws);
 
 
 void rolloI_ciphertext_to_string(unsigned char* ctString, ciphertext* ct);
-void rolloI_ciphertext_from_string(ciphertext* ct, const unsigned char* ctString);
+void rolloI_ciphertext_from_string(ciphertext* ct, const unsigned char* ctString, ffi_qre_workspace* ws);
 
 #endif
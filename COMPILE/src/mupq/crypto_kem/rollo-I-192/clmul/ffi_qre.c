@@ -0,0 +1 @@
+../ref/ffi_qre.c
\ No newline at end of file
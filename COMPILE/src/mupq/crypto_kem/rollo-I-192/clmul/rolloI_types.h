@@ -0,0 +1 @@
+../ref/rolloI_types.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/ffi.h
\ No newline at end of file
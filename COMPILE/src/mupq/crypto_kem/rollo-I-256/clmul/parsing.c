@@ -0,0 +1 @@
+../ref/parsing.c
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/rsr_algorithm.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../rollo-I-128/clmul/ffi_elt.c
\ No newline at end of file
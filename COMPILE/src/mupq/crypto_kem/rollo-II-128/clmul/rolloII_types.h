@@ -0,0 +1 @@
+../ref/rolloII_types.h
\ No newline at end of file
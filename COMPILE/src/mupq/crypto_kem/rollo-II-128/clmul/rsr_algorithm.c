@@ -0,0 +1 @@
+../ref/rsr_algorithm.c
\ No newline at end of file
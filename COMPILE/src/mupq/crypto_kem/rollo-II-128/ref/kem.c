@@ -17,31 +17,34 @@ int crypto_kem_keypair(unsigned char* pk, unsigned char* sk) {
   secretKey skTmp;
   publicKey pkTmp;
 
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
   unsigned char sk_seed[SEEDEXPANDER_SEED_BYTES];
   randombytes(sk_seed, SEEDEXPANDER_SEED_BYTES);
 
-  rolloII_secret_key_from_string(&skTmp, sk_seed);
+  rolloII_secret_key_from_string(&skTmp, sk_seed, &qre_workspace);
 
   ffi_qre invX;
-  ffi_qre_init(&invX);
+  ffi_qre_init(&qre_workspace, &invX);
   ffi_qre_inv(invX, skTmp.x);
 
-  ffi_qre_init(&(pkTmp.h));
+  ffi_qre_init(&qre_workspace, &(pkTmp.h));
   ffi_qre_mul(pkTmp.h, invX, skTmp.y);
 
   rolloII_secret_key_to_string(sk, sk_seed);
   rolloII_public_key_to_string(sk + SEEDEXPANDER_SEED_BYTES, &pkTmp);
   rolloII_public_key_to_string(pk, &pkTmp);
 
-  ffi_qre_clear(invX);
+  ffi_qre_clear(&qre_workspace, invX);
   ffi_vspace_clear(skTmp.F, PARAM_D);
-  ffi_qre_clear(skTmp.x);
-  ffi_qre_clear(skTmp.y);
-  ffi_qre_clear(pkTmp.h);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, skTmp.x);
+  ffi_qre_clear(&qre_workspace, skTmp.y);
+  ffi_qre_clear(&qre_workspace, pkTmp.h);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    return -1;
+  }
 
   return 0;
 }
@@ -50,10 +53,11 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, unsigned char* pk) {
   publicKey pkTmp;
   ciphertext ctTmp;
 
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
-  rolloII_public_key_from_string(&pkTmp, pk);
+  rolloII_public_key_from_string(&pkTmp, pk, &qre_workspace);
 
   ffi_vspace E;
   ffi_vspace_init(&E, PARAM_R);
@@ -79,9 +83,9 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, unsigned char* pk) {
 
   ffi_poly E1, E2;
 
-  ffi_qre_init(&E1);
-  ffi_qre_init(&E2);
-  ffi_qre_init(&(ctTmp.syndrom));
+  ffi_qre_init(&qre_workspace, &E1);
+  ffi_qre_init(&qre_workspace, &E2);
+  ffi_qre_init(&qre_workspace, &(ctTmp.syndrom));
 
   //Random error vectors
   ffi_qre_set_random_from_support(E1, E, PARAM_R, &encSeedexpander);
@@ -114,11 +118,14 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, unsigned char* pk) {
   rolloII_ciphertext_to_string(ct, &ctTmp);
 
   ffi_vspace_clear(E, PARAM_R);
-  ffi_qre_clear(E1);
-  ffi_qre_clear(E2);
-  ffi_qre_clear(pkTmp.h);
-  ffi_qre_clear(ctTmp.syndrom);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, E1);
+  ffi_qre_clear(&qre_workspace, E2);
+  ffi_qre_clear(&qre_workspace, pkTmp.h);
+  ffi_qre_clear(&qre_workspace, ctTmp.syndrom);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    memset(ss, 0, SHARED_SECRET_BYTES);
+    return -1;
+  }
 
   return 0;
 }
@@ -127,14 +134,15 @@ int crypto_kem_dec(unsigned char* ss, unsigned char* ct, unsigned char* sk) {
   secretKey skTmp;
   ciphertext ctTmp;
 
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
-  rolloII_secret_key_from_string(&skTmp, sk);
-  rolloII_ciphertext_from_string(&ctTmp, ct);
+  rolloII_secret_key_from_string(&skTmp, sk, &qre_workspace);
+  rolloII_ciphertext_from_string(&ctTmp, ct, &qre_workspace);
 
   ffi_qre xc;
-  ffi_qre_init(&xc);
+  ffi_qre_init(&qre_workspace, &xc);
 
   ffi_qre_mul(xc, skTmp.x, ctTmp.syndrom);
 
@@ -176,7 +184,7 @@ int crypto_kem_dec(unsigned char* ss, unsigned char* ct, unsigned char* sk) {
   /******** Re encrypt part ***********/
   publicKey pkTmp;
 
-  rolloII_public_key_from_string(&pkTmp, sk + SEEDEXPANDER_SEED_BYTES);
+  rolloII_public_key_from_string(&pkTmp, sk + SEEDEXPANDER_SEED_BYTES, &qre_workspace);
 
   ffi_vspace Eprime;
   ffi_vspace_init(&Eprime, PARAM_R);
@@ -185,9 +193,9 @@ int crypto_kem_dec(unsigned char* ss, unsigned char* ct, unsigned char* sk) {
   ffi_poly E1prime, E2prime;
   ciphertext cprime;
 
-  ffi_qre_init(&E1prime);
-  ffi_qre_init(&E2prime);
-  ffi_qre_init(&(cprime.syndrom));
+  ffi_qre_init(&qre_workspace, &E1prime);
+  ffi_qre_init(&qre_workspace, &E2prime);
+  ffi_qre_init(&qre_workspace, &(cprime.syndrom));
 
   //Random error vectors
   ffi_qre_set_random_from_support(E1prime, Eprime, PARAM_R, &encSeedexpander);
@@ -234,18 +242,21 @@ int crypto_kem_dec(unsigned char* ss, unsigned char* ct, unsigned char* sk) {
 
   ffi_vspace_clear(E, PARAM_R);
   ffi_vspace_clear(Eprime, PARAM_R);
-  ffi_qre_clear(E1prime);
-  ffi_qre_clear(E2prime);
+  ffi_qre_clear(&qre_workspace, E1prime);
+  ffi_qre_clear(&qre_workspace, E2prime);
 
-  ffi_qre_clear(xc);
+  ffi_qre_clear(&qre_workspace, xc);
 
   ffi_vspace_clear(skTmp.F, PARAM_D);
-  ffi_qre_clear(skTmp.x);
-  ffi_qre_clear(skTmp.y);
-  ffi_qre_clear(ctTmp.syndrom);
-  ffi_qre_clear(cprime.syndrom);
-  ffi_qre_clear(pkTmp.h);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, skTmp.x);
+  ffi_qre_clear(&qre_workspace, skTmp.y);
+  ffi_qre_clear(&qre_workspace, ctTmp.syndrom);
+  ffi_qre_clear(&qre_workspace, cprime.syndrom);
+  ffi_qre_clear(&qre_workspace, pkTmp.h);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    memset(ss, 0, SHARED_SECRET_BYTES);
+    return -1;
+  }
 
   return retValue;
 
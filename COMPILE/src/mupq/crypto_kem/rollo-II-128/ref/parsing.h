@@ -7,18 +7,18 @@
 #define PARSING_H
 
 #include "rolloII_types.h"
-#include "ffi_poly.h"
+#include "ffi_qre.h"
 #include "ffi_vspace.h"
 
 void rolloII_secret_key_to_string(unsigned char* skString, const unsigned char* seed);
-void rolloII_secret_key_from_string(secretKey* sk, unsigned char* skString);
+void rolloII_secret_key_from_string(secretKey* sk, unsigned char* skString, ffi_qre_workspace* ws);
 
 
 void rolloII_public_key_to_string(unsigned char* pkString, publicKey* pk);
-void rolloII_public_key_from_string(publicKey* pk, const unsigned char* pkString);
+void rolloII_public_key_from_string(publicKey* pk, const unsigned char* pkString, ffi_qre_workspace* ws);
 
 
 void rolloII_ciphertext_to_string(unsigned char* ctString, ciphertext* ct);
-void rolloII_ciphertext_from_string(ciphertext* ct, const unsigned char* ctString);
+void rolloII_ciphertext_from_string(ciphertext* ct, const unsigned char* ctString, ffi_qre_workspace* ws);
 
 #endif
@@ -0,0 +1 @@
+../ref/nist-rng.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/ffi_qre.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/ffi_elt.h
\ No newline at end of file
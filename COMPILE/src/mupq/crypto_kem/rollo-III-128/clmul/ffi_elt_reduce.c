@@ -0,0 +1 @@
+../ref/ffi_elt_reduce.c
\ No newline at end of file
@@ -13,8 +13,9 @@
 #include "randombytes.h"
 
 int crypto_kem_keypair(unsigned char* pk, unsigned char* sk) {
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
   unsigned char sk_seed[SEEDEXPANDER_SEED_BYTES];
   randombytes(sk_seed, SEEDEXPANDER_SEED_BYTES);
@@ -32,16 +33,16 @@ int crypto_kem_keypair(unsigned char* pk, unsigned char* sk) {
   ffi_vspace_set_random_full_rank_with_one(F, PARAM_W, sk_seedexpander);
 
   ffi_qre x, y;
-  ffi_qre_init(&x);
-  ffi_qre_init(&y);
+  ffi_qre_init(&qre_workspace, &x);
+  ffi_qre_init(&qre_workspace, &y);
 
   ffi_qre_set_random_from_support(x, F, PARAM_W, sk_seedexpander);
   ffi_qre_set_random_from_support(y, F, PARAM_W, sk_seedexpander);
 
   //Public key
   ffi_qre h, s;
-  ffi_qre_init(&h);
-  ffi_qre_init(&s);
+  ffi_qre_init(&qre_workspace, &h);
+  ffi_qre_init(&qre_workspace, &s);
   ffi_vec_set_random(h->v, PARAM_N, pk_seedexpander);
   ffi_qre_mul(s, h, y);
   ffi_qre_add(s, s, x);
@@ -50,11 +51,13 @@ int crypto_kem_keypair(unsigned char* pk, unsigned char* sk) {
   rolloIII_public_key_to_string(pk, s, pk_seed);
 
   ffi_vspace_clear(F, PARAM_W);
-  ffi_qre_clear(x);
-  ffi_qre_clear(y);
-  ffi_qre_clear(h);
-  ffi_qre_clear(s);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, x);
+  ffi_qre_clear(&qre_workspace, y);
+  ffi_qre_clear(&qre_workspace, h);
+  ffi_qre_clear(&qre_workspace, s);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    return -1;
+  }
 
   free(pk_seedexpander);
   free(sk_seedexpander);
@@ -63,11 +66,12 @@ int crypto_kem_keypair(unsigned char* pk, unsigned char* sk) {
 }
 
 int crypto_kem_enc(unsigned char* ct, unsigned char* ss, unsigned char* pk) {
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
   ffi_qre h, s;
-  rolloIII_public_key_from_string(&h, &s, pk);
+  rolloIII_public_key_from_string(&h, &s, pk, &qre_workspace);
 
   ffi_vspace E;
   ffi_vspace_init(&E, PARAM_W_R);
@@ -77,9 +81,9 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, unsigned char* pk) {
 
   ffi_qre r1, r2, er;
 
-  ffi_qre_init(&r1);
-  ffi_qre_init(&r2);
-  ffi_qre_init(&er);
+  ffi_qre_init(&qre_workspace, &r1);
+  ffi_qre_init(&qre_workspace, &r2);
+  ffi_qre_init(&qre_workspace, &er);
 
   //Random error vectors
   ffi_qre_set_random_from_support2(r1, E, PARAM_W_R);
@@ -87,12 +91,12 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, unsigned char* pk) {
   ffi_qre_set_random_from_support2(er, E, PARAM_W_R);
 
   ffi_qre sr;
-  ffi_qre_init(&sr);
+  ffi_qre_init(&qre_workspace, &sr);
   ffi_qre_mul(sr, h, r2);
   ffi_qre_add(sr, sr, r1);
 
   ffi_qre se;
-  ffi_qre_init(&se);
+  ffi_qre_init(&qre_workspace, &se);
   ffi_qre_mul(se, s, r2);
   ffi_qre_add(se, se, er);
 
@@ -104,32 +108,36 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, unsigned char* pk) {
   ffi_vec_to_string_compact(support, E, PARAM_W_R);
   sha512(ss, support, FFI_VEC_R_BYTES);
 
-  ffi_qre_clear(h);
-  ffi_qre_clear(s);
+  ffi_qre_clear(&qre_workspace, h);
+  ffi_qre_clear(&qre_workspace, s);
   ffi_vspace_clear(E, PARAM_W_R);
-  ffi_qre_clear(r1);
-  ffi_qre_clear(r2);
-  ffi_qre_clear(er);
-  ffi_qre_clear(sr);
-  ffi_qre_clear(se);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, r1);
+  ffi_qre_clear(&qre_workspace, r2);
+  ffi_qre_clear(&qre_workspace, er);
+  ffi_qre_clear(&qre_workspace, sr);
+  ffi_qre_clear(&qre_workspace, se);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    memset(ss, 0, SHARED_SECRET_BYTES);
+    return -1;
+  }
 
   return 0;
 }
 
 int crypto_kem_dec(unsigned char* ss, unsigned char* ct, unsigned char* sk) {
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
   ffi_qre sr, se;
-  rolloIII_ciphertext_from_string(&sr, &se, ct);
+  rolloIII_ciphertext_from_string(&sr, &se, ct, &qre_workspace);
 
   ffi_vspace F;
   ffi_qre x, y;
-  rolloIII_secret_key_from_string(&x, &y, &F, sk);
+  rolloIII_secret_key_from_string(&x, &y, &F, sk, &qre_workspace);
 
   ffi_qre ec;
-  ffi_qre_init(&ec);
+  ffi_qre_init(&qre_workspace, &ec);
   ffi_qre_mul(ec, y, sr);
   ffi_qre_add(ec, ec, se);
 
@@ -149,13 +157,16 @@ int crypto_kem_dec(unsigned char* ss, unsigned char* ct, unsigned char* sk) {
   }
 
   ffi_vspace_clear(E, PARAM_N);
-  ffi_qre_clear(sr);
-  ffi_qre_clear(se);
+  ffi_qre_clear(&qre_workspace, sr);
+  ffi_qre_clear(&qre_workspace, se);
   ffi_vspace_clear(F, PARAM_W);
-  ffi_qre_clear(x);
-  ffi_qre_clear(y);
-  ffi_qre_clear(ec);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, x);
+  ffi_qre_clear(&qre_workspace, y);
+  ffi_qre_clear(&qre_workspace, ec);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    memset(ss, 0, SHARED_SECRET_BYTES);
+    return -1;
+  }
 
   if(dimE != PARAM_W_R) return 1;
 
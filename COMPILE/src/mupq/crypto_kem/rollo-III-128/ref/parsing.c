@@ -11,13 +11,13 @@ void rolloIII_secret_key_to_string(unsigned char* skString, const unsigned char*
 	memcpy(skString, seed, SEEDEXPANDER_SEED_BYTES);
 }
 
-void rolloIII_secret_key_from_string(ffi_qre* x, ffi_qre* y, ffi_vspace* F, unsigned char* skString) {
+void rolloIII_secret_key_from_string(ffi_qre* x, ffi_qre* y, ffi_vspace* F, unsigned char* skString, ffi_qre_workspace* ws) {
   AES_XOF_struct* sk_seedexpander = (AES_XOF_struct*) malloc(sizeof(AES_XOF_struct));
   seedexpander_init(sk_seedexpander, skString, skString + 32, SEEDEXPANDER_MAX_LENGTH);
 
   ffi_vspace_init(F, PARAM_W);
-  ffi_qre_init(x);
-  ffi_qre_init(y);
+  ffi_qre_init(ws, x);
+  ffi_qre_init(ws, y);
 
   ffi_vspace_set_random_full_rank_with_one(*F, PARAM_W, sk_seedexpander);
   ffi_qre_set_random_from_support(*x, *F, PARAM_W, sk_seedexpander);
@@ -32,8 +32,8 @@ void rolloIII_public_key_to_string(unsigned char* pkString, ffi_qre s, const uns
 	memcpy(pkString + FFI_VEC_N_BYTES, seed, SEEDEXPANDER_SEED_BYTES);
 }
 
-void rolloIII_public_key_from_string(ffi_qre* h, ffi_qre* s, const unsigned char* pkString) {
-	ffi_qre_init(s);
+void rolloIII_public_key_from_string(ffi_qre* h, ffi_qre* s, const unsigned char* pkString, ffi_qre_workspace* ws) {
+	ffi_qre_init(ws, s);
 	ffi_vec_from_string_compact((*s)->v, PARAM_N, pkString);
 
 	unsigned char pk_seed[SEEDEXPANDER_SEED_BYTES];
@@ -41,7 +41,7 @@ void rolloIII_public_key_from_string(ffi_qre* h, ffi_qre* s, const unsigned char
 	AES_XOF_struct* pk_seedexpander = (AES_XOF_struct*) malloc(sizeof(AES_XOF_struct));
 	seedexpander_init(pk_seedexpander, pk_seed, pk_seed + 32, SEEDEXPANDER_MAX_LENGTH);
 
-	ffi_qre_init(h);
+	ffi_qre_init(ws, h);
 	ffi_vec_set_random((*h)->v, PARAM_N, pk_seedexpander); 
 
 	free(pk_seedexpander);
@@ -53,9 +53,9 @@ void rolloIII_ciphertext_to_string(unsigned char* ctString, ffi_qre sr, ffi_qre
 	ffi_vec_to_string_compact(ctString + FFI_VEC_N_BYTES, se->v, PARAM_N);
 }
 
-void rolloIII_ciphertext_from_string(ffi_qre* sr, ffi_qre* se, const unsigned char* ctString) {
-	ffi_qre_init(sr);
+void rolloIII_ciphertext_from_string(ffi_qre* sr, ffi_qre* se, const unsigned char* ctString, ffi_qre_workspace* ws) {
+	ffi_qre_init(ws, sr);
 	ffi_vec_from_string_compact((*sr)->v, PARAM_N, ctString);
-	ffi_qre_init(se);
+	ffi_qre_init(ws, se);
 	ffi_vec_from_string_compact((*se)->v, PARAM_N, ctString + FFI_VEC_N_BYTES);
 }
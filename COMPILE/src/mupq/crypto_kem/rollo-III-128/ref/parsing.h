@@ -10,14 +10,14 @@
 #include "ffi_vspace.h"
 
 void rolloIII_secret_key_to_string(unsigned char* skString, const unsigned char* seed);
-void rolloIII_secret_key_from_string(ffi_qre* x, ffi_qre* y, ffi_vspace* F, unsigned char* skString);
+void rolloIII_secret_key_from_string(ffi_qre* x, ffi_qre* y, ffi_vspace* F, unsigned char* skString, ffi_qre_workspace* ws);
 
 
 void rolloIII_public_key_to_string(unsigned char* pkString, ffi_qre s, const unsigned char* seed);
-void rolloIII_public_key_from_string(ffi_qre* h, ffi_qre* s, const unsigned char* pkString);
+void rolloIII_public_key_from_string(ffi_qre* h, ffi_qre* s, const unsigned char* pkString, ffi_qre_workspace* ws);
 
 
 void rolloIII_ciphertext_to_string(unsigned char* ctString, ffi_qre sr, ffi_qre se);
-void rolloIII_ciphertext_from_string(ffi_qre* sr, ffi_qre* se, const unsigned char* ctString);
+void rolloIII_ciphertext_from_string(ffi_qre* sr, ffi_qre* se, const unsigned char* ctString, ffi_qre_workspace* ws);
 
 #endif
@@ -0,0 +1 @@
+../../rollo-III-128/clmul/ffi_elt.c
\ No newline at end of file
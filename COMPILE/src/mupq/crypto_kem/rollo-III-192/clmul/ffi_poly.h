@@ -0,0 +1 @@
+../ref/ffi_poly.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/ffi_vec.c
\ No newline at end of file
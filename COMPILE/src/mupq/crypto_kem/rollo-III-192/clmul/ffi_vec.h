@@ -0,0 +1 @@
+../ref/ffi_vec.h
\ No newline at end of file
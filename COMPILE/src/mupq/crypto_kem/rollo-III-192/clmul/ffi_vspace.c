@@ -0,0 +1 @@
+../ref/ffi_vspace.c
\ No newline at end of file
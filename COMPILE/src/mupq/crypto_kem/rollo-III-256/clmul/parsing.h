@@ -0,0 +1 @@
+../ref/parsing.h
\ No newline at end of file
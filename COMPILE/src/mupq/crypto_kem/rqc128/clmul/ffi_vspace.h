@@ -0,0 +1 @@
+../ref/ffi_vspace.h
\ No newline at end of file
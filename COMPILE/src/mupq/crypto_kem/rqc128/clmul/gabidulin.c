@@ -0,0 +1 @@
+../ref/gabidulin.c
\ No newline at end of file
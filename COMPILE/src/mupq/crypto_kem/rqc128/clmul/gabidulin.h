@@ -0,0 +1 @@
+../ref/gabidulin.h
\ No newline at end of file
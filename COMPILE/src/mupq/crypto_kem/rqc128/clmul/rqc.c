@@ -0,0 +1 @@
+../ref/rqc.c
\ No newline at end of file
@@ -25,8 +25,7 @@
  * \return 0 if keygen is sucessfull
  */
 int crypto_kem_keypair(unsigned char* pk, unsigned char* sk) {
-  rqc_pke_keygen(pk, sk);
-  return 0;
+  return rqc_pke_keygen(pk, sk);
 }
 
 
@@ -42,8 +41,9 @@ int crypto_kem_keypair(unsigned char* pk, unsigned char* sk) {
  */
 int crypto_kem_enc(unsigned char* ct, unsigned char* ss, const unsigned char* pk) {
 
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
   // Computing m
   ffi_vec m;
@@ -62,10 +62,10 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, const unsigned char* pk
 
   // Encrypting m
   ffi_qre u, v;
-  ffi_qre_init(&u);
-  ffi_qre_init(&v);
+  ffi_qre_init(&qre_workspace, &u);
+  ffi_qre_init(&qre_workspace, &v);
 
-  rqc_pke_encrypt(u, v, m, theta, pk);
+  rqc_pke_encrypt(u, v, m, theta, pk, &qre_workspace);
 
   // Computing d
   unsigned char d[SHA512_BYTES];
@@ -82,9 +82,12 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, const unsigned char* pk
   sha512(ss, mc, FFI_VEC_K_BYTES + 2 * FFI_VEC_N_BYTES);
 
   ffi_vec_clear(m, PARAM_K);
-  ffi_qre_clear(u);
-  ffi_qre_clear(v);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, u);
+  ffi_qre_clear(&qre_workspace, v);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    memset(ss, 0, SHARED_SECRET_BYTES);
+    return -1;
+  }
 
   return 0;
 }
@@ -102,13 +105,14 @@ int crypto_kem_enc(unsigned char* ct, unsigned char* ss, const unsigned char* pk
  */
 int crypto_kem_dec(unsigned char* ss, const unsigned char* ct, const unsigned char* sk) {
 
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
   // Retrieving u, v and d from ciphertext
   ffi_qre u, v;
-  ffi_qre_init(&u);
-  ffi_qre_init(&v);
+  ffi_qre_init(&qre_workspace, &u);
+  ffi_qre_init(&qre_workspace, &v);
   unsigned char d[SHA512_BYTES];
   rqc_kem_ciphertext_from_string(u, v, d, ct);
 
@@ -119,7 +123,7 @@ int crypto_kem_dec(unsigned char* ss, const unsigned char* ct, const unsigned ch
   // Decrypting
   ffi_vec m;
   ffi_vec_init(&m, PARAM_K);
-  rqc_pke_decrypt(m, u, v, sk);
+  rqc_pke_decrypt(m, u, v, sk, &qre_workspace);
 
   // Generating G function
   AES_XOF_struct G_seedexpander;
@@ -133,10 +137,10 @@ int crypto_kem_dec(unsigned char* ss, const unsigned char* ct, const unsigned ch
 
   // Encrypting m'
   ffi_qre u2, v2;
-  ffi_qre_init(&u2);
-  ffi_qre_init(&v2);
+  ffi_qre_init(&qre_workspace, &u2);
+  ffi_qre_init(&qre_workspace, &v2);
 
-  rqc_pke_encrypt(u2, v2, m, theta, pk);
+  rqc_pke_encrypt(u2, v2, m, theta, pk, &qre_workspace);
 
   // Checking that c = c' and abort otherwise
   int abort = 0;
@@ -156,11 +160,11 @@ int crypto_kem_dec(unsigned char* ss, const unsigned char* ct, const unsigned ch
   if(abort == 1) {
     memset(ss, 0, SHARED_SECRET_BYTES);
     ffi_vec_clear(m, PARAM_K);
-    ffi_qre_clear(u);
-    ffi_qre_clear(v);
-    ffi_qre_clear(u2);
-    ffi_qre_clear(v2);
-    ffi_qre_clear_modulus();
+    ffi_qre_clear(&qre_workspace, u);
+    ffi_qre_clear(&qre_workspace, v);
+    ffi_qre_clear(&qre_workspace, u2);
+    ffi_qre_clear(&qre_workspace, v2);
+    ffi_qre_workspace_clear(&qre_workspace);
     return -1;
   }
 
@@ -172,11 +176,14 @@ int crypto_kem_dec(unsigned char* ss, const unsigned char* ct, const unsigned ch
   sha512(ss, mc, FFI_VEC_K_BYTES + 2 * FFI_VEC_N_BYTES);
 
   ffi_vec_clear(m, PARAM_K);
-  ffi_qre_clear(u);
-  ffi_qre_clear(v);
-  ffi_qre_clear(u2);
-  ffi_qre_clear(v2);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, u);
+  ffi_qre_clear(&qre_workspace, v);
+  ffi_qre_clear(&qre_workspace, u2);
+  ffi_qre_clear(&qre_workspace, v2);
+  if(ffi_qre_workspace_clear(&qre_workspace) != 0) {
+    memset(ss, 0, SHARED_SECRET_BYTES);
+    return -1;
+  }
 
   return 0;
 }
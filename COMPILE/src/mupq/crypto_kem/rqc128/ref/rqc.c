@@ -12,7 +12,7 @@
 #include "randombytes.h"
 
 /**
- * \fn void rqc_pke_keygen(unsigned char* pk, unsigned char* sk)
+ * \fn int rqc_pke_keygen(unsigned char* pk, unsigned char* sk)
  * \brief Keygen of the RQC_PKE IND-CPA scheme
  *
  * The public key is composed of the syndrom <b>s</b> as well as the <b>seed</b> used to generate vectors <b>g</b> and <b>h</b>.
@@ -22,11 +22,13 @@
  *
  * \param[out] pk String containing the public key
  * \param[out] sk String containing the secret key
+ * \return 0 if keygen is sucessfull, -1 if the ffi_qre workspace overflowed
  */
-void rqc_pke_keygen(unsigned char* pk, unsigned char* sk) {
+int rqc_pke_keygen(unsigned char* pk, unsigned char* sk) {
 
+  ffi_qre_workspace qre_workspace;
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
+  ffi_qre_workspace_init(&qre_workspace);
 
   // Create seed expanders for public key and secret key
   AES_XOF_struct sk_seedexpander;
@@ -45,16 +47,16 @@ void rqc_pke_keygen(unsigned char* pk, unsigned char* sk) {
   ffi_vspace_set_random_full_rank_with_one(support_w, PARAM_W, &sk_seedexpander);
 
   ffi_qre x, y;
-  ffi_qre_init(&x);
-  ffi_qre_init(&y);
+  ffi_qre_init(&qre_workspace, &x);
+  ffi_qre_init(&qre_workspace, &y);
   ffi_qre_set_random_from_support(x, support_w, PARAM_W, &sk_seedexpander);
   ffi_qre_set_random_from_support(y, support_w, PARAM_W, &sk_seedexpander);
 
   // Compute public key
   ffi_qre g, h, s;
-  ffi_qre_init(&g);
-  ffi_qre_init(&h);
-  ffi_qre_init(&s);
+  ffi_qre_init(&qre_workspace, &g);
+  ffi_qre_init(&qre_workspace, &h);
+  ffi_qre_init(&qre_workspace, &s);
 
   ffi_qre_set_random_full_rank(g, &pk_seedexpander);
   ffi_qre_set_random(h, &pk_seedexpander);
@@ -67,18 +69,18 @@ void rqc_pke_keygen(unsigned char* pk, unsigned char* sk) {
   rqc_secret_key_to_string(sk, sk_seed, pk);
 
   ffi_vspace_clear(support_w, PARAM_W);
-  ffi_qre_clear(x);
-  ffi_qre_clear(y);
-  ffi_qre_clear(g);
-  ffi_qre_clear(h);
-  ffi_qre_clear(s);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(&qre_workspace, x);
+  ffi_qre_clear(&qre_workspace, y);
+  ffi_qre_clear(&qre_workspace, g);
+  ffi_qre_clear(&qre_workspace, h);
+  ffi_qre_clear(&qre_workspace, s);
+  return ffi_qre_workspace_clear(&qre_workspace);
 }
 
 
 
 /**
- * \fn void rqc_pke_encrypt(ffi_qre u, ffi_qre v, const ffi_vec m, unsigned char* theta, const unsigned char* pk)
+ * \fn void rqc_pke_encrypt(ffi_qre u, ffi_qre v, const ffi_vec m, unsigned char* theta, const unsigned char* pk, ffi_qre_workspace* ws)
  * \brief Encryption of the RQC_PKE IND-CPA scheme
  *
  * The ciphertext is composed of the vectors <b>u</b> and <b>v</b>.
@@ -88,11 +90,11 @@ void rqc_pke_keygen(unsigned char* pk, unsigned char* sk) {
  * \param[in] m Vector representing the message to encrypt
  * \param[in] theta Seed used to derive randomness required for encryption
  * \param[in] pk String containing the public key
+ * \param[in] ws Workspace that holds the ffi_qre elements of the caller
  */
-void rqc_pke_encrypt(ffi_qre u, ffi_qre v, const ffi_vec m, unsigned char* theta, const unsigned char* pk) {
+void rqc_pke_encrypt(ffi_qre u, ffi_qre v, const ffi_vec m, unsigned char* theta, const unsigned char* pk, ffi_qre_workspace* ws) {
 
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
 
   // Create seed_expander from theta
   AES_XOF_struct seedexpander;
@@ -100,9 +102,9 @@ void rqc_pke_encrypt(ffi_qre u, ffi_qre v, const ffi_vec m, unsigned char* theta
 
   // Retrieve g, h and s from public key
   ffi_qre g, h, s;
-  ffi_qre_init(&g);
-  ffi_qre_init(&h);
-  ffi_qre_init(&s);
+  ffi_qre_init(ws, &g);
+  ffi_qre_init(ws, &h);
+  ffi_qre_init(ws, &s);
 
   rqc_public_key_from_string(g, h, s, pk);
 
@@ -112,9 +114,9 @@ void rqc_pke_encrypt(ffi_qre u, ffi_qre v, const ffi_vec m, unsigned char* theta
   ffi_vspace_set_random_full_rank(support_r, PARAM_W_R, &seedexpander);
 
   ffi_qre r1, r2, e;
-  ffi_qre_init(&r1);
-  ffi_qre_init(&r2);
-  ffi_qre_init(&e);
+  ffi_qre_init(ws, &r1);
+  ffi_qre_init(ws, &r2);
+  ffi_qre_init(ws, &e);
 
   ffi_qre_set_random_from_support(r1, support_r, PARAM_W_R, &seedexpander);
   ffi_qre_set_random_from_support(r2, support_r, PARAM_W_R, &seedexpander);
@@ -130,55 +132,54 @@ void rqc_pke_encrypt(ffi_qre u, ffi_qre v, const ffi_vec m, unsigned char* theta
 
   // Compute v = m.G + s.r2 + e
   ffi_qre tmp;
-  ffi_qre_init(&tmp);
+  ffi_qre_init(ws, &tmp);
 
   ffi_qre_mul(tmp, s, r2);
   ffi_qre_add(tmp, tmp, e);
   ffi_qre_add(v, v, tmp);
 
-  ffi_qre_clear(g);
-  ffi_qre_clear(h);
-  ffi_qre_clear(s);
+  ffi_qre_clear(ws, g);
+  ffi_qre_clear(ws, h);
+  ffi_qre_clear(ws, s);
   ffi_vspace_clear(support_r, PARAM_W_R);
-  ffi_qre_clear(r1);
-  ffi_qre_clear(r2);
-  ffi_qre_clear(e);
-  ffi_qre_clear(tmp);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(ws, r1);
+  ffi_qre_clear(ws, r2);
+  ffi_qre_clear(ws, e);
+  ffi_qre_clear(ws, tmp);
 }
 
 
 
 /**
- * \fn void rqc_pke_decrypt(ffi_vec m, const ffi_qre& u, const ffi_qre v, const unsigned char* sk)
+ * \fn void rqc_pke_decrypt(ffi_vec m, const ffi_qre& u, const ffi_qre v, const unsigned char* sk, ffi_qre_workspace* ws)
  * \brief Decryption of the RQC_PKE IND-CPA scheme
  *
  * \param[out] m Vector representing the decrypted message
  * \param[in] u Vector u (first part of the ciphertext)
  * \param[in] v Vector v (second part of the ciphertext)
  * \param[in] sk String containing the secret key
+ * \param[in] ws Workspace that holds the ffi_qre elements of the caller
  */
-void rqc_pke_decrypt(ffi_vec m, const ffi_qre u, const ffi_qre v, const unsigned char* sk) {
+void rqc_pke_decrypt(ffi_vec m, const ffi_qre u, const ffi_qre v, const unsigned char* sk, ffi_qre_workspace* ws) {
 
   ffi_field_init();
-  ffi_qre_init_modulus(PARAM_N);
 
   // Retrieve x, y, g, h and s from secret key
   unsigned char pk[PUBLIC_KEY_BYTES];
   ffi_qre x, y, g, h, s;
 
-  ffi_qre_init(&x);
-  ffi_qre_init(&y);
-  ffi_qre_init(&g);
-  ffi_qre_init(&h);
-  ffi_qre_init(&s);
+  ffi_qre_init(ws, &x);
+  ffi_qre_init(ws, &y);
+  ffi_qre_init(ws, &g);
+  ffi_qre_init(ws, &h);
+  ffi_qre_init(ws, &s);
 
   rqc_secret_key_from_string(x, y, pk, sk);
   rqc_public_key_from_string(g, h, s, pk);
 
   // Compute v - u.y
   ffi_qre tmp;
-  ffi_qre_init(&tmp);
+  ffi_qre_init(ws, &tmp);
   ffi_qre_mul(tmp, u, y);
   ffi_qre_add(tmp, v, tmp);
 
@@ -186,12 +187,11 @@ void rqc_pke_decrypt(ffi_vec m, const ffi_qre u, const ffi_qre v, const unsigned
   gabidulin_code code = gabidulin_code_init(g, PARAM_K, PARAM_N);
   gabidulin_code_decode(m, code, tmp);
 
-  ffi_qre_clear(x);
-  ffi_qre_clear(y);
-  ffi_qre_clear(g);
-  ffi_qre_clear(h);
-  ffi_qre_clear(s);
-  ffi_qre_clear(tmp);
-  ffi_qre_clear_modulus();
+  ffi_qre_clear(ws, x);
+  ffi_qre_clear(ws, y);
+  ffi_qre_clear(ws, g);
+  ffi_qre_clear(ws, h);
+  ffi_qre_clear(ws, s);
+  ffi_qre_clear(ws, tmp);
 }
 
@@ -0,0 +1 @@
+../ref/rqc.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/api.h
\ No newline at end of file
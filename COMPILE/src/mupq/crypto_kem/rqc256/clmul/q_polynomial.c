@@ -0,0 +1 @@
+../ref/q_polynomial.c
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/q_polynomial.h
\ No newline at end of file
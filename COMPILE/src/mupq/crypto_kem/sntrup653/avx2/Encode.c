@@ -0,0 +1 @@
+../ref/Encode.c
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/Encode.h
\ No newline at end of file
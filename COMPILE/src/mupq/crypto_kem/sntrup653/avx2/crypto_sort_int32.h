@@ -0,0 +1 @@
+../../sntrup761/avx2/crypto_sort_int32.h
\ No newline at end of file
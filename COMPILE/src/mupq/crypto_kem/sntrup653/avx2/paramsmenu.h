@@ -0,0 +1 @@
+../ref/paramsmenu.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/uint32.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/int32.c
\ No newline at end of file
@@ -0,0 +1,511 @@
+#include <immintrin.h>
+#include "params.h"
+#include "int8.h"
+#include "int16.h"
+#include "int32.h"
+#include "polymul.h"
+
+/*
+AVX2 multiplication: the integer product of f and g is computed with a
+negacyclic NTT of length 2048 modulo NTT_Q = 8380417 = 2^23-2^13+1, then
+reduced modulo x^p-x-1.
+
+All coefficients of the integer product are bounded by p*(q-1)/2 < NTT_Q/2
+and 2p-1 < 2048 leaves no wraparound modulo x^2048+1, so the product is
+recovered exactly from the centered residues: one prime is enough and the
+CRT step degenerates to a centered lift.
+
+Arithmetic is signed Montgomery with R = 2^32 on eight 32-bit lanes.
+The forward transform is lazy (|x| < 12*NTT_Q after 11 layers), the
+inverse reduces the sums at every layer. The last three layers work on
+groups of 16 coefficients that stay permuted between ntt and invntt.
+*/
+
+typedef int8 small;
+typedef int16 Fq;
+
+#define q12 ((q-1)/2)
+
+#define NTT_N 2048
+#define NTT_Q 8380417
+#define NTT_QINV 58728449 /* NTT_Q^(-1) mod 2^32 */
+#define NTT_F (-2089857) /* 2^64/NTT_N mod NTT_Q */
+
+/* zetas[k] = 2^32 * 7901702^brv(k) mod NTT_Q, centered; 7901702 has order 4096 */
+static const int32 zetas[NTT_N] = {
+         0,   -25847,  -518909, -2608894,  -876248,  -466468,  -237124,  -777960,
+   3119733,  2884855,  2680103,  3111497,  2353451,  1826347,   359251, -2091905,
+  -2118186,  3859737, -3277672, -1399561,  4010497,  -280005, -1757237,   -19422,
+  -1079900, -3585928, -2725464,  1024112, -1119584,  -549488, -2619752, -2108549,
+  -1699267,  1643818, -3821735,  3505694, -1600420, -3699596, -3507263, -2140649,
+   3900724,  2556880, -2797779,  2071892,   531354,   811944,  -954230,  3881043,
+  -1661693,  3592148,  3915439, -2537516,    95776,  2706023, -3077325,  3530437,
+   3574422,  2867647,  3861115, -3043716,  -300467,  3539968, -2348700,  -539299,
+  -3343383,  -264944,  3097992,   508951,   904516, -3958618,   -44288, -1100098,
+   2389356,   210977, -1316856,   759969,    -8578, -3724342, -1653064, -3249728,
+   1285669,  1584928, -1439742,  -812732, -3628969, -3839961,  3019102, -3881060,
+   3159746,  1851402,  -189548, -3553272,  -177440, -2409325, -1315589,  1341330,
+  -1257611, -1939314, -1000202, -4083598, -3632928,  -126922,  3190144, -3157330,
+  -3677745,  3041255,  3930395, -1528703,  3475950, -1452451, -2176455, -1585221,
+  -2967645,  3693493, -2477047,  -411027,  -983419,  3412210, -2147896,  2715295,
+    -22981,  1308169,   671102, -1228525,  1349076,  -381987, -1852771, -1430430,
+  -1279661, -1917081, -1374803, -2546312,  2235880, -3406031, -1500165,   777191,
+  -2584293,  3724270, -3776993,   594136, -2831860,  -542412,  1671176, -1846953,
+  -3183426,  -162844,  3014001,  1616392, -3694233,  1799107,  -810149,  1652634,
+   2454455,   164721,  2013608,  2432395,  3369112,  1957272,  -185531, -1207385,
+  -2939036,  2235985, -2286327,  -420899,  1612842,  3545687,  -183443,  -976891,
+   3937738, -1400424,  1976782,  -846154,  3919660,  -554416,    48306, -1362209,
+   2213111,   975884,   472078,  1717735,  3523897, -3038916, -3866901,   269760,
+  -1803090, -1910376,   426683,  1723600, -1104333, -1667432,   260646, -3833893,
+    900702, -1859098,   819034,   909542,   -43260,   522500,  -495491, -1613174,
+  -3556995,   525098, -3595838,  -768622, -3122442,  -655327, -2031748,  3207046,
+  -3342478, -2244091, -3562462, -2446433,  3407706,  2091667, -2316500,  3817976,
+  -1235728, -3513181,  -266997,  2434439, -3759364, -3520352,  1197226, -3193378,
+   2842341, -2691481,  1265009, -2590150,  2486353, -1595974, -4055324,  1247620,
+  -2437823, -4108315,  -342297,   286988, -3342277,  3437287, -1735879,   203044,
+  -2994039, -1869119, -1050970,  1903435,  1250494, -3767016, -2635921, -3548272,
+  -3318210,  1430225,  1333058,  1237275,  1312455,  -451100, -3306115, -1962642,
+   1262474,  1055322, -1212390, -3361123,   461839, -2133774,  3240809,    35433,
+   1014821,  -347109,  -798493, -2808151,  1871670,   233555, -1861237,  1054605,
+   2327698, -1795163,  -644935,   416548,  -165502,  3227153,  1352319,  2600908,
+  -4094487, -3420748, -2759567,  3625072,  -633867, -1026694, -3280935,  -403163,
+  -3791616,  -883632,  -203558, -2547178,   811657, -3348481, -2979812,  1298814,
+   4189384,   418712,  3577030,   201527,  4062658,   252320,   199552, -2406341,
+  -3644605, -3639484,  1768340, -2102270,  -285907, -2141471,  -744515,  2010607,
+  -3588844,  1335963,  2418057,   561722,  4071362,  1534242, -1880515, -2373900,
+  -3685321,   246300,   125707, -2827867,  1226530, -2559333, -3768201, -2224164,
+    674148,  1981467,  2846728, -2728970,  3609089,  3700379, -3436651, -2501456,
+    308789,  -839261, -3578026,  3541590, -1770723,  3998533, -1380222, -1659479,
+   1308989, -3900109,  -781321,  3133182,  1330489,   753003,   724129,   475045,
+    944281, -2579173,  2837541, -3028699,  1316464, -1541746,   229319,  1224804,
+   2158389,  3395820,  2760046, -2135323,  -830184,   926009, -3404184,   271822,
+   2729080,  1911659,  3800145, -2822613,    73973, -3256865,  3795915, -3434052,
+  -2661316, -2137332,   983732,    98128,   488847,  1104506, -1611378, -3191423,
+  -2860029, -2825180, -2776390,  4087850,   677648,  1179803,  2507121,  2880006,
+    263809, -1694660,  4186464,  3146717, -4134911, -3997973, -3875031, -3758325,
+   1883706,  3970373,   696597,  2605321,   545105, -3554037,  -322691,  2146257,
+   -187897,  2753750,  2220368,  3968414,  1028573, -1140867,  3594559,  -777330,
+   3647742, -3294911, -1529195, -1576541, -3955170, -3092602,  4091627,  2591291,
+  -2411347,  1061988, -3399737, -3323129, -3728859, -3419988,  1481727, -3727662,
+   1887757,  2065587,  2987654, -3660079,  4017784,   933794, -3956013,  2473529,
+  -1070620,  2094277,  -321629,  -481818, -4019013,   142647, -1333697,  3966069,
+   2020342, -2395130, -3807328, -3998759,  2512993,  2789711, -1995073,  3426610,
+   1042804,  -444876,  -417734,  3189589, -4116053,  -808485, -1112365,   785240,
+    784549, -3451130,  2839840, -3296682,  2092691,   686834,   615468,  3306248,
+   2766248,  3349592,  1218518, -4085954, -3288364,  2332809,  3383924,  -228590,
+   1637081, -4189877, -3806796,  2449635,  3038914, -3620549,   587631, -3017698,
+  -2210257,  3561486,  -428153,  1630049,  2518115, -3114811, -2104170,  -854270,
+   2610645,  2652482,  3595293, -1836169, -1370249, -1032167, -1559227,  3520757,
+   2162858,  2966022,  1845141, -1514976,  3474560,  2744860, -1299317,  1981674,
+  -4181481, -2765216, -1678890,   529827,   341347,   170047,   728607, -1326414,
+   2451894,  3116982, -2122052, -3807582, -2510684,  -857132, -3163839,   867524,
+   3674164,  1724941,  1802088,   980989, -2083480,  1542077,  2036897,  3534283,
+  -2645263,  3945373,  3647436,  1439478,  3312755, -3437165,  3254760, -2221393,
+     61637,  2413210,  4140476, -3310573,  -827174,  1242228, -3193421, -3955309,
+   1360549,  3493362,  3218745,   329046, -3616990, -2589846,   681120,   920899,
+   2886985, -3703379,  3455535, -1996262, -2514610,  3413428,  3811294,   150030,
+  -1358827, -3351434, -3955700, -2396550,   508856,  1137920, -2022838,  2890210,
+   3559713, -4126287,  3279432,  3199291,  1194978,  3269221, -3560823,  2895998,
+    462609,  -298840,   -18463,   -71459, -1443937, -2102621,  2363104,  -920989,
+   2165359,  3571223, -1819137, -3320577, -3034972, -2157362,  2338942, -3058432,
+   3353827, -1054528,  3129301, -1806424, -3130908,  1829708, -1416206,  2684452,
+   -906671,  -959141, -2152988, -1539331, -3919255, -2507410, -1871435,  1197150,
+  -1036151,  -418117,  1838561,   327369,  1821568, -3097739, -2368067, -3439805,
+   3955639,  2381789,   170400,  3590822,  1159605,  2952568, -3679463,   427385,
+   1183495, -2806690,  4035033, -2997880, -2877781, -2312437, -1992510,  -761622,
+   3463112, -4009501,  3862822,  2177786,  2915036, -3922075,  -173749,   269827,
+   3882508, -3499700,  4151222,  1487925, -3089644,  2884967,   -47031, -3000314,
+   -340901,   762181,   822791, -3676681, -1763859,  2637063, -2419767,   260941,
+  -2822451, -3348792,  3246002, -3653766, -1828451,  3630308, -1017799, -2983812,
+   3508482, -1136354, -3484573, -3794003,  2005686,  3949998,  2221587,   691411,
+  -2141413, -2035584,  2287519,  1258879,  -182420,  -454574, -3418334,  3991716,
+  -1287946,  1848208,  1260815,  -307816,  1081240, -3233776, -1858150,  -121766,
+  -2595314, -2926764, -1488867,  -335627, -4099751, -1946872,  -438628,  1156029,
+    302863,  -899417, -2394844, -2775438,  1469697, -2791976,  -169578,  -369466,
+   -622799, -2469936,  3613710,  1521372,  1508964, -3731181, -1688232,  -356945,
+  -3424687,  3828233,  3602621,  3371684,  3542622,  2728682,  1439556, -1567803,
+  -1626287, -3914095,  2457753, -1510127,   -37562,  -983739,  3879314,   947992,
+   3737241,  2563233,   391485, -1985303,  1118623,  3614155,  -234514,  3700366,
+  -2006033, -3209663,  -121546,   -11988, -2799788,  -887163, -3567020, -1488636,
+    -51543,  3051818,  1282736,  -223881,  1753455,  -895760,  4185905,   813306,
+  -3984146,  3084534, -2185976,  3392199,  2221241, -3376448,  1431135,  2439344,
+  -2361389,  1198607,   176326,  3650978,  2449618,  1741924,  1460534, -1162523,
+   -428315,  1178696, -2413596,  3952364, -3709771,    99924, -2170985,  3722562,
+  -3315914, -1174010, -2443021, -1519397,  2755221,   406471, -2301600, -2468108,
+  -3205218,  -352947,   981382,  2551912,  3490100,  3208072,  -795872,  -937457,
+   1299919,  3109820, -1026624,  -723033, -2689936,  1927808,  1318454,   588408,
+   1084862, -4005918,  4164311,  3968329, -3398198, -3225484,  -837652, -1568044,
+  -3115148,   422782, -3041184, -1462422, -2589424,  2620036, -3999845, -3874196,
+   -867577,   257933,  -740865,   695705,  1564488,  1049532,  4187523, -1817610,
+    760161,   -10522,  -894722,  2069705, -3829880, -3823234,  2924985,  3156472,
+   1038504,   300585,  -718824,  2045133, -3693691,  2067646,  1488566, -2210120,
+  -3154606, -2118829,   744349,     9982, -2783087, -1379463, -2144239,  1264703,
+  -3717921,    51132, -2936549,  3112566,  -833499,   535985, -2759283,  4105947,
+    492019,  1872078, -3805950,  -780244,  3969763, -2031316, -4063768, -1482609,
+   3864044,  1237035,    90869, -2740291,  2419138, -1237452,  3029271,  1327349,
+  -3495974, -1881806, -3552278, -2317598, -2088295, -2095984,   432939, -1021451,
+   3534726, -3440921,   730756, -1081159,  2320121,   218076,   169281,  3732194,
+    -65434,  1751182,  2005648,  2292196,  2872315,  2913129, -1274647,   257912,
+    430854,  1084307,  -780277,  3248429,  3370730,  -673644,  1759761, -1018418,
+   1188533,  1297485, -1965727,  3246515, -3434998,  2569595,  3211954,  2669868,
+   3675880, -2805635,  3637306,  1461094, -3078380, -2357595, -1752951,  -493503,
+   2194359,  -676731,  2550191,  2448913,  1522490,  1053112,  -975001, -2931189,
+  -3956266,  3786146, -3741874, -1348817,  1782506,  1050902,  -737612, -2501255,
+   1316499, -2220196, -2204398, -1065623,  1684232,    75930,   527696, -1309687,
+  -3146511,  2587706,  4137123,  3022018,  1040766,  1947023,  1700327, -3035922,
+  -2377161,  1640942, -1434767, -3867764,  4014394,   800389,  -490409,   440890,
+   3724223,  2298152,  -208218,  2782221, -3543052,  3212156, -1469665,  -222726,
+   4091500,  1461488, -3120984,  3406850,  2326596,   411081,  2474154,  -975951,
+   1027387,  2693657,   821985,   -24971,  3708911,  3401335,  2110767,  1076797,
+   -228290,  3970017,   385969, -4007004,   517473,  1711870,  3862144,  2151105,
+  -2680744,  3327818,  -454592,  2925742, -3660150,  3177440,  -781836, -1250340,
+   1745230,  -687933, -2139373,  2716963,  4137007,  -715417,  2033882,  2117783,
+   1830981,     4356, -2508023,  1435393,  -415192,  -591573,  -734627,   693976,
+  -1679926,  3851113, -2798779,   -93466,  -331198,   637238,  2067395,  3770337,
+   2750058,  2316939,  2813387, -1729609, -2555653,  4060254,  4075209,    -7757,
+   2095241,   342205, -3103847,  1646216,  1420009, -2176340, -2167588,  3720277,
+   1545021,  1284657, -1482719, -3381580,   465742,  3619124,  1935464, -2051864,
+   2664966,   822430,  1415672,   483542, -1042257,  1813696, -3617237,  3395275,
+  -2193303,  1756569, -2710121,  1714421,  3667091,  2348917, -3935803,  -192096,
+   -197562, -3843922,  1446169, -2852627,  -146433, -2462253,  1654613, -2832482,
+    876164,  2094748,  2725878,  2922818, -3417483,  1862118,  -726305,  3394683,
+   2032517,  3436082,  2014959,  1385476,  2389033,  2880494, -1125090,  -370627,
+  -2582461,  2931129, -1387951,  2102969,    12940, -1814552,   516284,  3210142,
+  -2830438,   625992,  3836616, -2240262, -1788431,  2461165, -2698110,   -50166,
+  -2820392,  2232656, -3684456, -2154678,  -717112,   -13501,  3850585,  1140007,
+  -3526998, -3893750, -3424865, -3496186,  -529988,  1441980,  1985367,  2742498,
+    172647,  1936417, -1339253,  1522537,  1054019,  3642809, -2068617, -2829586,
+   -494082,  3398833,  4070773,   979562,  -878807,  1249822,  3150242,   513277,
+  -2138106,  3298324, -3308235,   821566, -2842069,  2207765,  -544347, -3956037,
+   1193749, -4034755,  -470116,   955179, -2434960,  -942606,    33577,  4003567,
+  -2475296,  2760364,  3094994,  1157323,  4084312,  1920252,  2729231, -3409773,
+     87391,  1226526,   525758, -2053419, -1127247, -4052415,  1540609, -4179259,
+    320577, -3069962, -3649129,  1448057,   322238, -2942795,   813299, -4050215,
+  -2450139, -2417533,  -191229,   298854, -3839820, -3893025, -1473998,   -34786,
+   3231642,  4136828,  1492510,  -843585,   470651,  -550950, -3236287, -3887003,
+   2884775, -3963395,  3885469, -2233651,  2068077,  1325076,  1581502,  4067570,
+     39184, -4119119, -3648804, -2457431, -1073516, -1628953,   878823, -2757173,
+   1277137,  2954921,  2328452,  1547122,  1200493,  1718699,  -348703,  3545277,
+   3452863, -1681155,  2034285,   291928,  3504659,  2334827, -2953200, -2153158,
+  -3803291,  2748252, -2482753, -2341321,  3615013, -3383911, -3762442, -3715642,
+  -3726093, -3162813, -2651229,  3463386,  2908178,  2111899, -1706377,  4182215,
+  -1626444, -3265167, -1470598,  2299181,  -610719,  -783229,  4069776,  1150456,
+   -912307,  4134082,   414754,  3095878,   539998, -2729089, -2453818, -4132094,
+  -2959208, -1821005, -3231045,  -145615,  -288066,  3793129, -1227009,  1069584,
+   2379468,  1527608, -2866754,   630684, -3652418,  1751244,  3189690,   854326,
+  -3088538, -1793219,  3499515, -3306221,  2904409, -2646886,   816690,  -344587,
+   2738475,  -623341,  2996291,  1314995,  4159922, -3138628, -3864985, -2151661,
+  -1801665,  1594280, -2884172, -4133722,  -172388,  1423470,  3442748,  1641304,
+  -3387925, -3624648,  -917390, -1492205,  3502169,  -878006,   185636,  -827965,
+  -2684173, -2035612, -1220906, -3498481, -2726967,  3820240,  -358492, -1845946,
+  -3369290,  -901274,  1069577,  1362699, -3570863, -2418579,  -162297, -3828171,
+   -313072,  3649594,   179321,   666354, -1000939,  3019406,  -256368,   -76721,
+  -2312042, -2384607,  1702204, -2306951,  3141443,  3467267, -2036332,  3471632,
+  -1803074, -3417727,  1947972,  3310393, -1152679,  -727054,  1202048,   308993,
+  -3281567, -3715926,  1735518,   808671, -1511081,   471224,   -38639, -1656507,
+    249328,  1258218, -1953206, -3615248,   861812, -3438959,  4137616, -4140030,
+  -3748794,  1098173,  3691388,   672279,  3411199,  1425693, -3845447,  -171463,
+  -1785935,  1966085,   -28702, -3922968, -3705360,  1991617, -3362802,  3828545,
+   1943463,  3318360, -2115836,  1405953, -2981831, -3860803,  3194991, -2533971,
+  -3184819,  1698215,   987017,  2266883,  3657547,   588961, -2109447, -3917208,
+   4135766,  -603567,  1888518, -3108235, -3627297,  2059991, -1424329, -1479323,
+  -3464223,  -793011, -1075682, -3939080, -2700667,   430153, -3389277,  2230465,
+   3558755,  1274632,  3329288,  -672905, -2195618,  3531903, -3359453,   -32104,
+   -307339,  1464905,  2120409,   937093,  -515529,  3704366,   795504,  2084862,
+   2096694,  3304101, -1657342,   660886, -1922860, -1629985, -1528241,  3874899,
+  -1321240,  3133710,  2398641, -1388954,  3213323, -1120373, -1875563, -3785891,
+  -4180143,    31468,  2975304,  2281376, -1606483,  1290300,  1934492,  3620435,
+  -3705477,  3062376,   702278,  -965790,  -722724, -1371513, -3870365,  3965197,
+    690831, -4147928,  3605611,  -713221,  2434269, -3620889, -1309790,   271683,
+   -855394,  1145261,  1651858,  2683128,  1416355,  1610504, -2852210, -3543404,
+  -1237004, -2722881,  2021356,  -501152, -4093979,  1098464, -2646039, -2562065,
+   1393737,   670987, -2759860, -3864559,   856532,  -457732, -3443151,   184551,
+   3941769,   674083, -3919085,  1380476,  3262563, -1432266,  -571560, -2023336,
+   -535160, -3656308, -1612012,  3112202,  -367646, -1588154, -2316726,  1015610,
+  -3129414,   405241,  3404826, -3138914, -3480111, -4088111, -3240599, -4106133,
+    -94799,  1102376,  -927537, -3535461, -1629806, -3941332, -1628051, -3241883,
+   -427537, -1930254,  -722015,   448660, -3965491,  1828615,  -392502, -2244927,
+   -347288, -3531046,  2694799, -2811800,  1821978,  3321133, -2144465, -1537663,
+   2768810,  3969554,   735274, -2460787,  -554246,   -31774,  1183309,  3193192,
+  -3879717,   877863,  1949477,  -721706, -2201055, -1218359,  1892263,  -278632,
+   4166260,  2104429,  2698461, -3162111,  2701170,  2988778,  1456074, -2104386,
+    891802,   658300,  3119249,   294825, -2482257,  1213300,  -374291,  2711372,
+   2414288,  4183354,  3859030,  -937958, -4110188,  -763090,  2903836,  3671500,
+  -3315554,  2622469,  2454522, -3528431,  1667436, -3576275,  2119111, -1437760,
+   2899765,  1175162, -2860654,  2106784, -3419101, -3887383, -2671597,  3205716,
+   2744819,   911803, -1392853, -2243064,  1751567,   982901,   662560, -2059094,
+   3032207, -2908007, -2824890,  -367009,   745961,  1086979,  2398636, -2489235,
+    705879, -1330862, -2863600,  4141578, -1133059,   860835,  4135006,  -237939,
+   1376972, -1187726, -1887380,  3795764,   184021,  4139203,    80824,  -774732,
+  -1549499,   516802,  2065675,  2392438, -1600635,  -729177,   667891,  1154295,
+    904569,  1000027, -1814107, -2652935,  3985398,  2576401,  1805898,  1353411,
+  -1459399,  -486200,  1943078,  2400893, -1485495,  2541100,  1324151,  3890363,
+   1282360, -2513009, -3367014,   473784, -3058381,  3855674,  2122544,  1453728,
+   3951528,  -536380, -1540178,  1810644,  2058432,  -871472,   613810, -2865084,
+   2445457, -3798638, -3956520,  1526540,  -868870, -1016639, -3735314,   788131,
+   2561974,  -882069, -2794565,  2025324,    85516,  -738416,  3999997,  2124987,
+    138806,  1853099,  3833544,  2236952, -2493934, -2299262, -1796095,  3766432,
+  -1687575,    76806,  3740262,   271820,   782617,   477642,  1418263,  4132967,
+    395187, -1913783,  -568695,   -93598,  3245160, -2895829, -2745112,   -21017,
+   3410283, -2367945,  3340449,  3264329,  2268988,  1308349,  1675619, -2969962,
+   2160426, -2568302, -3119528,   324581,  2442735,  2274493, -1925332,   794277,
+  -3846945,  3724946, -1680557,  4110573,  3529463,  1605178, -1567209,   215405,
+   1508093,  2377710, -1223008, -3457595,  3102889,  3754703,  -292349, -1776955,
+  -3560088, -2971035,  2443666,   988557, -3204525,  2974577,  1400204, -2572541,
+   4002739,   452980, -2963097,   535134, -2882052,  1462487, -2155144, -1648896,
+   3237096,  2571545,  1523596, -3625074, -1343562,  3639659,  1303378, -1685898,
+  -2276852, -2112237,   658159, -1750225,  3660776,  3843236,   591797,  3623145,
+   2459597, -1338677,  1711018, -1960098,  2497646, -3809073,  2757629,  4011613,
+  -3511389,    20756, -3169950,  1999056,  -554687,   136279,  1678642,  1883071,
+  -2113995,  -758849, -2341066,   -65835,  2869940,  -134492, -1343500, -1153774,
+  -2847514,  2401387,  -243484,  -805753,  3716544,   302576,  2430854,  -875282,
+   1084455,   291879, -1535586, -3397826,  3069364,  1137558,  3499342, -1149942,
+  -1374494,  3435968,  3892890,   -25739, -1386295,  1129855, -3033591,  3397405,
+  -2859750, -3444586,  -866388, -1240339,  2977271, -2325846,  -980672,  2840484,
+   3109577,  2213260, -1305239,  -550424,  3709615,  4121227,  2004147,  3852353,
+  -1989079,  3365837, -2403514,    72384, -1650812, -3803852,  2981764,  -826462,
+  -2962548,   667983,  3941035,  1732922, -2766464, -3951396,  -804877,  3615291,
+   2374276,   408613,  2109777,  1112001,  3655442, -1706405,  -600247, -2645461,
+   4035331, -2788385,  3528723, -2008487,  -797850, -2103020, -3634763, -1670033,
+  -2312527,  -166443, -4081112, -1695440,  3559379,  1150862,  3996640,  2549103,
+    -30528,  1542677, -2995130, -2270507,    59581,  -831986, -2785778, -1893257,
+   3124617,  1593793,  4035531,  -679230,   166460,  -247655, -1402175,  1271288,
+     99282, -1803554,  2391312, -1788613,  3797143,   297701, -1728668, -1898761,
+  -2461907, -4166125,  -313619,  2280774, -1803005,    33567,  1699442,  3344349,
+  -2838952,  -747337,  -111709,   857182, -3298671, -1397771,  1278475, -2628812,
+  -1761436,  1162631,  2212953, -1947411, -3355950,  1502484, -2283999,  2340581,
+   2550594,   623058, -1642469, -1510215, -3240268, -3339117,   670976,  1213895,
+   3076286, -2545403,  2736709,  1284842, -3595336,  -921914,  3210799,   -82533,
+  -4073791,  3648103,  -180032, -1250556,  3873918,   191784,  -737913,  3333415,
+  -4058569,  -499304,  2561910, -3233082, -2314277,   234389,   278900,  3880489,
+    -81308, -1815298,  2219411, -3819278, -1540016,  2261997, -2941715,  2686782,
+  -3699551,  3122532,  -480904, -3029179, -3963144, -2961421,  3299408,  2675184,
+   2622619,  2802316,  -789420,   898589,  2255794,   863295,  1102571,  1103673,
+  -2576732,  3218382,  2267919,  4072114, -3679772,  2825522, -2857403,   145795,
+    118718, -3832171,   400072,   367378,  -458450, -1305044, -2087509, -1768401,
+    258323,  2885325,  1112800,  2754620, -2224006, -1688921, -1917083,  2515632,
+  -4035226,   753035, -2449457,  3517623, -2662077,  3036490, -3805464,   573815,
+  -3170747, -4101312,  2284181,  2511896,  3039325, -2009871, -3807671,  2650051,
+   2347916, -1024255, -2659376, -2629571,  -498693,  -602015, -1182897,  1989709,
+   1132531, -1400754, -4055041, -1843728, -3921399, -1652384,  3786264, -1922687,
+  -1874968,  1441293,  -591477,  -248497,   288291,  3817431,  1145317,  -230126
+};
+
+/* x must not be close to top int16 */
+static small F3_freeze(int16 x)
+{
+  return int32_mod_uint14(x+1,3)-1;
+}
+
+/* x must not be close to top int32 */
+static Fq Fq_freeze(int32 x)
+{
+  return int32_mod_uint14(x+q12,q)-q12;
+}
+
+/* a*z/2^32 mod NTT_Q in (-NTT_Q,NTT_Q); zq = z*NTT_QINV mod 2^32 */
+static inline __m256i montmul(__m256i a,__m256i z,__m256i zq)
+{
+  const __m256i nq = _mm256_set1_epi32(NTT_Q);
+  __m256i t,a1,lo,hi;
+
+  t = _mm256_mullo_epi32(a,zq);
+  a1 = _mm256_srli_epi64(a,32);
+  lo = _mm256_sub_epi64(_mm256_mul_epi32(a,z),_mm256_mul_epi32(t,nq));
+  hi = _mm256_sub_epi64(_mm256_mul_epi32(a1,_mm256_srli_epi64(z,32)),
+                        _mm256_mul_epi32(_mm256_srli_epi64(t,32),nq));
+  return _mm256_blend_epi32(_mm256_srli_epi64(lo,32),hi,0xAA);
+}
+
+static inline __m256i montmul_const(__m256i a,__m256i z)
+{
+  return montmul(a,z,_mm256_mullo_epi32(z,_mm256_set1_epi32(NTT_QINV)));
+}
+
+/* |result| <= 6283009 for |a| < 2^31-2^22 */
+static inline __m256i reduce32(__m256i a)
+{
+  __m256i t;
+
+  t = _mm256_srai_epi32(_mm256_add_epi32(a,_mm256_set1_epi32(1<<22)),23);
+  return _mm256_sub_epi32(a,_mm256_mullo_epi32(t,_mm256_set1_epi32(NTT_Q)));
+}
+
+static inline void bf_ct(__m256i *a,__m256i *b,__m256i z)
+{
+  __m256i t = montmul_const(*b,z);
+  *b = _mm256_sub_epi32(*a,t);
+  *a = _mm256_add_epi32(*a,t);
+}
+
+/* inverse butterfly with the negated zeta folded into b-a */
+static inline void bf_gs(__m256i *a,__m256i *b,__m256i z)
+{
+  __m256i t = *a;
+  *a = reduce32(_mm256_add_epi32(t,*b));
+  *b = montmul_const(_mm256_sub_epi32(*b,t),z);
+}
+
+static void ntt(int32 *r)
+{
+  const __m256i idx4 = _mm256_setr_epi32(0,0,0,0,1,1,1,1);
+  const __m256i idx2 = _mm256_setr_epi32(0,0,1,1,2,2,3,3);
+  __m256i a,b,z;
+  int len,start,j,k,g;
+
+  k = 1;
+  for (len = NTT_N/2;len >= 8;len >>= 1) {
+    for (start = 0;start < NTT_N;start += 2*len) {
+      z = _mm256_set1_epi32(zetas[k++]);
+      for (j = start;j < start+len;j += 8) {
+        a = _mm256_load_si256((__m256i *) &r[j]);
+        b = _mm256_load_si256((__m256i *) &r[j+len]);
+        bf_ct(&a,&b,z);
+        _mm256_store_si256((__m256i *) &r[j],a);
+        _mm256_store_si256((__m256i *) &r[j+len],b);
+      }
+    }
+  }
+
+  for (g = 0;g < NTT_N/16;++g) {
+    __m256i x0 = _mm256_load_si256((__m256i *) &r[16*g]);
+    __m256i x1 = _mm256_load_si256((__m256i *) &r[16*g+8]);
+
+    /* len 4: [0-3,8-11] [4-7,12-15] */
+    a = _mm256_permute2x128_si256(x0,x1,0x20);
+    b = _mm256_permute2x128_si256(x0,x1,0x31);
+    z = _mm256_castsi128_si256(_mm_loadl_epi64((__m128i *) &zetas[NTT_N/8+2*g]));
+    bf_ct(&a,&b,_mm256_permutevar8x32_epi32(z,idx4));
+
+    /* len 2: [0,1,4,5,8,9,12,13] [2,3,6,7,10,11,14,15] */
+    x0 = _mm256_unpacklo_epi64(a,b);
+    x1 = _mm256_unpackhi_epi64(a,b);
+    z = _mm256_castsi128_si256(_mm_loadu_si128((__m128i *) &zetas[NTT_N/4+4*g]));
+    bf_ct(&x0,&x1,_mm256_permutevar8x32_epi32(z,idx2));
+
+    /* len 1: even and odd coefficients */
+    a = _mm256_blend_epi32(x0,_mm256_slli_epi64(x1,32),0xAA);
+    b = _mm256_blend_epi32(_mm256_srli_epi64(x0,32),x1,0xAA);
+    z = _mm256_loadu_si256((__m256i *) &zetas[NTT_N/2+8*g]);
+    bf_ct(&a,&b,z);
+
+    _mm256_store_si256((__m256i *) &r[16*g],a);
+    _mm256_store_si256((__m256i *) &r[16*g+8],b);
+  }
+}
+
+static void invntt(int32 *r)
+{
+  const __m256i idx8 = _mm256_setr_epi32(7,6,5,4,3,2,1,0);
+  const __m256i idx4 = _mm256_setr_epi32(1,1,1,1,0,0,0,0);
+  const __m256i idx2 = _mm256_setr_epi32(3,3,2,2,1,1,0,0);
+  const __m256i f = _mm256_set1_epi32(NTT_F);
+  const __m256i nq = _mm256_set1_epi32(NTT_Q);
+  __m256i a,b,z;
+  int len,start,j,g;
+
+  for (g = 0;g < NTT_N/16;++g) {
+    __m256i x0,x1;
+
+    a = _mm256_load_si256((__m256i *) &r[16*g]);
+    b = _mm256_load_si256((__m256i *) &r[16*g+8]);
+
+    /* len 1 */
+    z = _mm256_loadu_si256((__m256i *) &zetas[NTT_N-8-8*g]);
+    bf_gs(&a,&b,_mm256_permutevar8x32_epi32(z,idx8));
+
+    /* len 2 */
+    x0 = _mm256_blend_epi32(a,_mm256_slli_epi64(b,32),0xAA);
+    x1 = _mm256_blend_epi32(_mm256_srli_epi64(a,32),b,0xAA);
+    z = _mm256_castsi128_si256(_mm_loadu_si128((__m128i *) &zetas[NTT_N/2-4-4*g]));
+    bf_gs(&x0,&x1,_mm256_permutevar8x32_epi32(z,idx2));
+
+    /* len 4 */
+    a = _mm256_unpacklo_epi64(x0,x1);
+    b = _mm256_unpackhi_epi64(x0,x1);
+    z = _mm256_castsi128_si256(_mm_loadl_epi64((__m128i *) &zetas[NTT_N/4-2-2*g]));
+    bf_gs(&a,&b,_mm256_permutevar8x32_epi32(z,idx4));
+
+    _mm256_store_si256((__m256i *) &r[16*g],_mm256_permute2x128_si256(a,b,0x20));
+    _mm256_store_si256((__m256i *) &r[16*g+8],_mm256_permute2x128_si256(a,b,0x31));
+  }
+
+  for (len = 8;len < NTT_N;len <<= 1) {
+    for (start = 0;start < NTT_N;start += 2*len) {
+      z = _mm256_set1_epi32(zetas[NTT_N/len-1-start/(2*len)]);
+      for (j = start;j < start+len;j += 8) {
+        a = _mm256_load_si256((__m256i *) &r[j]);
+        b = _mm256_load_si256((__m256i *) &r[j+len]);
+        bf_gs(&a,&b,z);
+        _mm256_store_si256((__m256i *) &r[j],a);
+        _mm256_store_si256((__m256i *) &r[j+len],b);
+      }
+    }
+  }
+
+  /* scale by 2^64/NTT_N and lift to (-NTT_Q/2,NTT_Q/2) */
+  for (j = 0;j < NTT_N;j += 8) {
+    a = montmul_const(_mm256_load_si256((__m256i *) &r[j]),f);
+    a = _mm256_add_epi32(a,_mm256_and_si256(_mm256_srai_epi32(a,31),nq));
+    b = _mm256_cmpgt_epi32(a,_mm256_set1_epi32(NTT_Q/2));
+    a = _mm256_sub_epi32(a,_mm256_and_si256(b,nq));
+    _mm256_store_si256((__m256i *) &r[j],a);
+  }
+}
+
+/* fg[0..2p-2] = f*g over the integers; f and g are zero-padded to NTT_N */
+static void mult_ntt(int32 *f,int32 *g)
+{
+  int j;
+
+  ntt(f);
+  ntt(g);
+  for (j = 0;j < NTT_N;j += 8) {
+    __m256i a = _mm256_load_si256((__m256i *) &f[j]);
+    __m256i b = _mm256_load_si256((__m256i *) &g[j]);
+    _mm256_store_si256((__m256i *) &f[j],montmul(a,b,_mm256_mullo_epi32(b,_mm256_set1_epi32(NTT_QINV))));
+  }
+  invntt(f);
+}
+
+/* h = f*g in the ring Rq */
+void Rq_mult_small(Fq *h,const Fq *f,const small *g)
+{
+  int32 fg[NTT_N] __attribute__((aligned(32)));
+  int32 gg[NTT_N] __attribute__((aligned(32)));
+  int i;
+
+  for (i = 0;i < p;++i) fg[i] = f[i];
+  for (i = 0;i < p;++i) gg[i] = g[i];
+  for (i = p;i < NTT_N;++i) fg[i] = gg[i] = 0;
+
+  mult_ntt(fg,gg);
+
+  for (i = p+p-2;i >= p;--i) {
+    fg[i-p] += fg[i];
+    fg[i-p+1] += fg[i];
+  }
+
+  for (i = 0;i < p;++i) h[i] = Fq_freeze(fg[i]);
+}
+
+/* h = f*g in the ring R3 */
+void R3_mult(small *h,const small *f,const small *g)
+{
+  int32 fg[NTT_N] __attribute__((aligned(32)));
+  int32 gg[NTT_N] __attribute__((aligned(32)));
+  int i;
+
+  for (i = 0;i < p;++i) fg[i] = f[i];
+  for (i = 0;i < p;++i) gg[i] = g[i];
+  for (i = p;i < NTT_N;++i) fg[i] = gg[i] = 0;
+
+  mult_ntt(fg,gg);
+
+  for (i = p+p-2;i >= p;--i) {
+    fg[i-p] += fg[i];
+    fg[i-p+1] += fg[i];
+  }
+
+  for (i = 0;i < p;++i) h[i] = F3_freeze(fg[i]);
+}
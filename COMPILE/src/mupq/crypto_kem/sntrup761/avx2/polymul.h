@@ -0,0 +1 @@
+../ref/polymul.h
\ No newline at end of file
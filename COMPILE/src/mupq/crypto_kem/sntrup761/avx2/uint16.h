@@ -0,0 +1 @@
+../ref/uint16.h
\ No newline at end of file
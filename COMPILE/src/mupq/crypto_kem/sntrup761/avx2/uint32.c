@@ -0,0 +1 @@
+../ref/uint32.c
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/uint64.h
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include "uint32.h"
 #include "Encode.h"
 #include "Decode.h"
+#include "polymul.h"
 
 /* ----- masks */
 
@@ -119,32 +120,6 @@ static void R3_fromRq(small *out,const Fq *r)
   for (i = 0;i < p;++i) out[i] = F3_freeze(r[i]);
 }
 
-/* h = f*g in the ring R3 */
-static void R3_mult(small *h,const small *f,const small *g)
-{
-  small fg[p+p-1];
-  small result;
-  int i,j;
-
-  for (i = 0;i < p;++i) {
-    result = 0;
-    for (j = 0;j <= i;++j) result = F3_freeze(result+f[j]*g[i-j]);
-    fg[i] = result;
-  }
-  for (i = p;i < p+p-1;++i) {
-    result = 0;
-    for (j = i-p+1;j < p;++j) result = F3_freeze(result+f[j]*g[i-j]);
-    fg[i] = result;
-  }
-
-  for (i = p+p-2;i >= p;--i) {
-    fg[i-p] = F3_freeze(fg[i-p]+fg[i]);
-    fg[i-p+1] = F3_freeze(fg[i-p+1]+fg[i]);
-  }
-
-  for (i = 0;i < p;++i) h[i] = fg[i];
-}
-
 /* returns 0 if recip succeeded; else -1 */
 static int R3_recip(small *out,const small *in)
 {
@@ -193,32 +168,6 @@ static int R3_recip(small *out,const small *in)
 
 /* ----- polynomials mod q */
 
-/* h = f*g in the ring Rq */
-static void Rq_mult_small(Fq *h,const Fq *f,const small *g)
-{
-  Fq fg[p+p-1];
-  Fq result;
-  int i,j;
-
-  for (i = 0;i < p;++i) {
-    result = 0;
-    for (j = 0;j <= i;++j) result = Fq_freeze(result+f[j]*(int32)g[i-j]);
-    fg[i] = result;
-  }
-  for (i = p;i < p+p-1;++i) {
-    result = 0;
-    for (j = i-p+1;j < p;++j) result = Fq_freeze(result+f[j]*(int32)g[i-j]);
-    fg[i] = result;
-  }
-
-  for (i = p+p-2;i >= p;--i) {
-    fg[i-p] = Fq_freeze(fg[i-p]+fg[i]);
-    fg[i-p+1] = Fq_freeze(fg[i-p+1]+fg[i]);
-  }
-
-  for (i = 0;i < p;++i) h[i] = fg[i];
-}
-
 #ifndef LPR
 
 /* h = 3f in Rq */
@@ -0,0 +1,17 @@
+#ifndef polymul_H
+#define polymul_H
+
+#include "int8.h"
+#include "int16.h"
+
+/* Rq_mult_small(h,f,g): h = f*g in the ring Rq */
+/* assumes -(q-1)/2 <= f[i] <= (q-1)/2 and -1 <= g[i] <= 1 */
+/* produces -(q-1)/2 <= h[i] <= (q-1)/2 */
+extern void Rq_mult_small(int16 *,const int16 *,const int8 *);
+
+/* R3_mult(h,f,g): h = f*g in the ring R3 */
+/* assumes -1 <= f[i],g[i] <= 1 */
+/* produces -1 <= h[i] <= 1 */
+extern void R3_mult(int8 *,const int8 *,const int8 *);
+
+#endif
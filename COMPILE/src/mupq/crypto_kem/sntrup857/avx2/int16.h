@@ -0,0 +1 @@
+../ref/int16.h
\ No newline at end of file
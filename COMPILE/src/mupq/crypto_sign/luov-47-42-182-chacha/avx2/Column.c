@@ -0,0 +1,360 @@
+/*
+	AVX2: the bitsliced kernels update four 64-bit words of columns per instruction, with the selecting bits turned into masks by variable shifts.
+*/
+
+#include "Column.h"
+
+#include <immintrin.h>
+
+#if OIL_VARS>64
+
+/*
+	Write a column to a char array
+*/
+void serialize_column(writer * W, column b) {
+	int a = 0;
+	int bits = OIL_VARS;
+	while (bits >64 ){
+		serialize_uint64_t(W, b.components[a++]  , 64);
+		bits -= 64;
+	}
+	serialize_uint64_t(W, b.components[a], bits);
+}
+
+/*
+	Read a column from a char array
+*/
+column deserialize_column(reader * R) {
+	column out;
+	int a = 0;
+	int bits = OIL_VARS;
+	while (bits >64 ){
+		out.components[a++] = deserialize_uint64_t(R, 64);
+		bits -= 64;
+	}
+	out.components[a] = deserialize_uint64_t(R, bits);
+	return out;
+}
+
+/*
+	xor two columns
+*/
+column xor(column a, column b) {
+	int i;
+	column BC;
+	for(i=0 ; i<COLUMN_COMPONENTS ; i++){
+		BC.components[i] = a.components[i] ^ b.components[i];
+	}
+	return BC;
+}
+
+/*
+	Randomize column with Keccak Sponge
+*/
+column random_column(Sponge *sponge) {
+	column BC;
+	int i;
+	for(i=0 ; i<COLUMN_COMPONENTS-1 ; i++){
+		BC.components[i] = squeezeuint64_t(sponge,8);
+	}
+	BC.components[COLUMN_COMPONENTS-1] = squeezeuint64_t(sponge,((OIL_VARS%64)+7)/8);
+	return BC;
+}
+
+/*
+	Get a bit from the column
+*/
+uint64_t getBit(column container, uint64_t bit) {
+	return (container.components[bit/64] & ((uint64_t)1) << (bit%64) );
+}
+
+/*
+	Flip a bit from the column
+*/
+void flipBit(column *container, uint64_t bit) {
+	container->components[bit/64] ^= ((uint64_t)1) << (bit%64);
+}
+
+#endif
+
+/*
+	Generates an array of columns
+
+	sponge : pointer to a Sponge object
+	arr    : the array that will receive the generated columns
+	size   : the number of columns that is generated
+*/
+void squeeze_column_array(Sponge *sponge, column *arr, int size) {
+	int i;
+	for (i = 0; i < size; i++) {
+		arr[i] = random_column(sponge);
+	}
+}
+
+#if FIELD_SIZE == 79
+#define FELT_WORD(a,w) ((a).coef[w])
+#else
+#define FELT_WORD(a,w) ((w) == 0 ? (uint64_t) (a) : 0)
+#endif
+
+/*
+	s[b] ^= c for every bit b < n of bits, where s[b] and c are columns
+
+	The bit of a lane is shifted into the sign bit, so that a signed comparison with zero gives the mask.
+	The last vector is stored under a mask if n columns do not fill it.
+*/
+static inline void xor_selected(uint64_t *s, const uint64_t *c, const uint64_t *bits, int n) {
+	__m256i vc, vb, vs, dec, zero, mask, store, t;
+	int i, b, end;
+
+#if COLUMN_WORDS == 1
+	vc = _mm256_set1_epi64x(c[0]);
+	dec = _mm256_set1_epi64x(4);
+#else
+	vc = _mm256_setr_epi64x(c[0], c[1], c[0], c[1]);
+	dec = _mm256_set1_epi64x(2);
+#endif
+	zero = _mm256_setzero_si256();
+
+	for (b = 0; b < n; b += 64) {
+		vb = _mm256_set1_epi64x(bits[b/64]);
+#if COLUMN_WORDS == 1
+		vs = _mm256_setr_epi64x(63, 62, 61, 60);
+#else
+		vs = _mm256_setr_epi64x(63, 63, 62, 62);
+#endif
+		end = ((n < b + 64) ? n : b + 64) * COLUMN_WORDS;
+		for (i = b*COLUMN_WORDS; i < end; i += 4) {
+			mask = _mm256_cmpgt_epi64(zero, _mm256_sllv_epi64(vb, vs));
+			if (i + 4 <= n*COLUMN_WORDS) {
+				t = _mm256_loadu_si256((__m256i *) &s[i]);
+				t = _mm256_xor_si256(t, _mm256_and_si256(vc, mask));
+				_mm256_storeu_si256((__m256i *) &s[i], t);
+			} else {
+				store = _mm256_cmpgt_epi64(_mm256_set1_epi64x(n*COLUMN_WORDS - i), _mm256_setr_epi64x(0, 1, 2, 3));
+				t = _mm256_maskload_epi64((long long *) &s[i], store);
+				t = _mm256_xor_si256(t, _mm256_and_si256(vc, mask));
+				_mm256_maskstore_epi64((long long *) &s[i], store, t);
+			}
+			vs = _mm256_sub_epi64(vs, dec);
+		}
+	}
+}
+
+/*
+	Adds a multiple of a column to a bitsliced vector: acc[b] ^= r for every bit b of a
+
+	acc : bitsliced vector of FIELD_SIZE columns
+	r   : the column, one bit per element of acc
+	a   : the field element r is multiplied with
+*/
+void bitsliced_add_scaled(column *acc, column r, FELT a) {
+	uint64_t bits[2] = { FELT_WORD(a, 0), FELT_WORD(a, 1) };
+
+	xor_selected((uint64_t *) acc, (const uint64_t *) &r, bits, FIELD_SIZE);
+}
+
+/*
+	Adds src to every block of acc that is selected by a column: acc[o*len + i] ^= src[i] for every bit o of sel
+
+	acc : OIL_VARS blocks of len columns
+	src : len columns
+	len : the number of columns in a block
+	sel : the column that selects the blocks of acc
+*/
+void columns_add_selected(column *acc, const column *src, int len, column sel) {
+	uint64_t *s = (uint64_t *) acc;
+	const uint64_t *c = (const uint64_t *) src;
+	const uint64_t *e = (const uint64_t *) &sel;
+	__m256i mask, t;
+	uint64_t m;
+	int o, i;
+
+	if (len == 1) {
+		xor_selected(s, c, e, OIL_VARS);
+		return;
+	}
+
+	for (o = 0; o < OIL_VARS; o++) {
+		m = -((e[o/64] >> (o%64)) & 1);
+		mask = _mm256_set1_epi64x(m);
+		for (i = 0; i + 4 <= len*COLUMN_WORDS; i += 4) {
+			t = _mm256_loadu_si256((__m256i *) &s[i]);
+			t = _mm256_xor_si256(t, _mm256_and_si256(_mm256_loadu_si256((__m256i *) &c[i]), mask));
+			_mm256_storeu_si256((__m256i *) &s[i], t);
+		}
+		for (; i < len*COLUMN_WORDS; i++) {
+			s[i] ^= c[i] & m;
+		}
+		s += len*COLUMN_WORDS;
+	}
+}
+
+/*
+	Converts a bitsliced vector to OIL_VARS field elements
+
+	out : receives the field elements
+	acc : bitsliced vector of FIELD_SIZE columns
+*/
+void bitsliced_unslice(FELT *out, const column *acc) {
+	const uint64_t *s = (const uint64_t *) acc;
+	uint64_t w[2];
+	int k, b;
+
+	for (k = 0; k < OIL_VARS; k++) {
+		w[0] = 0;
+		w[1] = 0;
+		for (b = 0; b < FIELD_SIZE; b++) {
+			w[b/64] |= ((s[b*COLUMN_WORDS + k/64] >> (k%64)) & 1) << (b%64);
+		}
+#if FIELD_SIZE == 79
+		out[k].coef[0] = w[0];
+		out[k].coef[1] = w[1];
+#else
+		out[k] = (FELT) w[0];
+#endif
+	}
+}
+
+#ifdef PRNG_KECCAK
+
+extern void KeccakP1600times4_PermuteAll_24rounds(__m256i *s);
+
+/*
+	Stream i absorbs the key followed by the byte i, in lane i%4 of state group i/4.
+*/
+void ColumnGenerator_init(ColumnGenerator * col_gen, const unsigned char* key){
+	uint64_t k;
+	int g, i, j;
+
+	for(g=0; g<STATE_GROUPS; g++){
+		for(i=0; i<25; i++){
+			col_gen->states[g][i] = _mm256_setzero_si256();
+		}
+		for(i=0; i<4; i++){
+			k = 0;
+			for(j=0; j<8; j++){
+				k |= ((uint64_t) key[8*i + j]) << (8*j);
+			}
+			col_gen->states[g][i] = _mm256_set1_epi64x(k);
+		}
+		col_gen->states[g][4] = _mm256_setr_epi64x(0x1F00 | (4*g), 0x1F00 | (4*g + 1), 0x1F00 | (4*g + 2), 0x1F00 | (4*g + 3));
+		col_gen->states[g][SHAKE_RATE/8 - 1] = _mm256_xor_si256(col_gen->states[g][SHAKE_RATE/8 - 1], _mm256_set1_epi64x(0x8000000000000000ULL));
+	}
+	col_gen->cols_used = GENERATOR_COLUMNS;
+}
+
+/*
+	Squeezes one rate block of every stream.
+	A state word holds four 16-bit pieces of each of the four streams of a group; the pieces are transposed so that every 64-bit lane holds one column.
+*/
+static void refill(ColumnGenerator *col_gen){
+	const __m256i pairs = _mm256_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+	                                       0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+	const __m256i quads = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+	__m256i t[STATE_GROUPS];
+	int g, l;
+
+	for(g=0; g<STATE_GROUPS; g++){
+		KeccakP1600times4_PermuteAll_24rounds(col_gen->states[g]);
+	}
+
+	for(l=0; l<SHAKE_RATE/8; l++){
+		for(g=0; g<STATE_GROUPS; g++){
+			t[g] = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(col_gen->states[g][l], pairs), quads);
+		}
+#if STATE_GROUPS == 1
+		_mm256_storeu_si256((__m256i *) &col_gen->cols[4*l], t[0]);
+#else
+		{
+			__m256i lo = _mm256_unpacklo_epi64(t[0], t[1]);
+			__m256i hi = _mm256_unpackhi_epi64(t[0], t[1]);
+			_mm256_storeu_si256((__m256i *) &col_gen->cols[4*l], _mm256_permute2x128_si256(lo, hi, 0x20));
+			_mm256_storeu_si256((__m256i *) &col_gen->cols[4*l + 2], _mm256_permute2x128_si256(lo, hi, 0x31));
+		}
+#endif
+	}
+}
+
+#endif
+
+#ifdef PRNG_CHACHA
+
+/*
+	The streams only differ in the first nonce word, which is the index of the stream; stream i runs in lane i.
+*/
+void ColumnGenerator_init(ColumnGenerator * col_gen, const unsigned char* key){
+	unsigned char stream[16] = {0};
+
+	PRNG_INIT(&col_gen->ctx, key, stream);
+	col_gen->cols_used = GENERATOR_COLUMNS;
+}
+
+#define ROTATE16(v) _mm256_shuffle_epi8(v, rot16)
+#define ROTATE8(v) _mm256_shuffle_epi8(v, rot8)
+#define ROTATE(v,c) _mm256_or_si256(_mm256_slli_epi32(v, c), _mm256_srli_epi32(v, 32 - (c)))
+
+#define QUARTERROUND(a,b,c,d) \
+	a = _mm256_add_epi32(a, b); d = ROTATE16(_mm256_xor_si256(d, a)); \
+	c = _mm256_add_epi32(c, d); b = ROTATE(_mm256_xor_si256(b, c), 12); \
+	a = _mm256_add_epi32(a, b); d = ROTATE8(_mm256_xor_si256(d, a)); \
+	c = _mm256_add_epi32(c, d); b = ROTATE(_mm256_xor_si256(b, c), 7);
+
+/*
+	Computes the next ChaCha8 block of all streams.
+	Word w of the streams is split into the low and high 16-bit pieces, which are the columns 2w and 2w+1.
+*/
+static void refill(ColumnGenerator *col_gen){
+	const __m256i rot16 = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+	                                       2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+	const __m256i rot8 = _mm256_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+	                                      3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+	const __m256i halves = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+	                                        0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+	uint32_t *in = col_gen->ctx.input;
+	__m256i j[16], x[16], t;
+	int i;
+
+	for(i=0; i<16; i++){
+		j[i] = _mm256_set1_epi32(in[i]);
+	}
+	j[14] = _mm256_add_epi32(j[14], _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+	for(i=0; i<16; i++){
+		x[i] = j[i];
+	}
+
+	for(i=8; i>0; i-=2){
+		QUARTERROUND(x[0], x[4], x[ 8], x[12])
+		QUARTERROUND(x[1], x[5], x[ 9], x[13])
+		QUARTERROUND(x[2], x[6], x[10], x[14])
+		QUARTERROUND(x[3], x[7], x[11], x[15])
+		QUARTERROUND(x[0], x[5], x[10], x[15])
+		QUARTERROUND(x[1], x[6], x[11], x[12])
+		QUARTERROUND(x[2], x[7], x[ 8], x[13])
+		QUARTERROUND(x[3], x[4], x[ 9], x[14])
+	}
+
+	for(i=0; i<16; i++){
+		t = _mm256_shuffle_epi8(_mm256_add_epi32(x[i], j[i]), halves);
+#if OIL_VARS <= 64
+		_mm_storeu_si128((__m128i *) &col_gen->cols[2*i], _mm256_castsi256_si128(t));
+#else
+		_mm256_storeu_si256((__m256i *) &col_gen->cols[2*i], _mm256_permute4x64_epi64(t, 0xD8));
+#endif
+	}
+
+	in[12]++;
+	if(!in[12]){
+		in[13]++;
+	}
+}
+
+#endif
+
+column Next_Column(ColumnGenerator *col_gen){
+	if(col_gen->cols_used == GENERATOR_COLUMNS){
+		refill(col_gen);
+		col_gen->cols_used = 0;
+	}
+	return col_gen->cols[col_gen->cols_used++];
+}
@@ -0,0 +1,95 @@
+/*
+	Nothing fancy here, just an implementation of a container that stores OIL_VARS bits and supports basic functionalities such as xoring, reading bits and flipping a bit
+*/
+
+#ifndef COLUMN_H
+#define COLUMN_H
+
+#include <stdint.h>
+#include <immintrin.h>
+#include "buffer.h"
+#include "prng.h"
+#include "parameters.h"
+
+#if OIL_VARS > 64
+
+#define COLUMN_COMPONENTS ((OIL_VARS+63)/64)
+#define COLUMN_WORDS COLUMN_COMPONENTS
+
+typedef struct {
+	uint64_t components[COLUMN_COMPONENTS];
+} column;
+
+static const column empty = {0};
+
+void serialize_column(writer * Buff, column b);
+column deserialize_column(reader *Buff);
+column xor(column a, column b);
+column random_column(Sponge *sponge);
+uint64_t getBit(column container, uint64_t bit);
+void flipBit(column *container, uint64_t bit);
+
+#else
+
+#define column uint64_t
+#define COLUMN_WORDS 1
+#define empty ((uint64_t) 0)
+#define xor(a,b) a^b
+#define getBit(container,bit) (container & ((uint64_t)1) << bit)
+#define flipBit(container,bit) (*container ^= ((uint64_t)1) << bit)
+#define random_column(sponge) squeezeuint64_t(sponge,((OIL_VARS+7)/8))
+#define serialize_column(W,container) serialize_uint64_t(W, container , OIL_VARS)
+#define deserialize_column(R) deserialize_uint64_t(R,OIL_VARS)
+
+#endif
+
+void squeeze_column_array(Sponge *sponge, column *arr, int size);
+
+/*
+	Bitsliced vectors of OIL_VARS field elements are arrays of FIELD_SIZE columns, where column b holds bit b of every element.
+	Adding a multiple of a column of bits to such a vector takes FIELD_SIZE column operations instead of OIL_VARS field additions.
+*/
+
+void bitsliced_add_scaled(column *acc, column r, FELT a);
+void columns_add_selected(column *acc, const column *src, int len, column sel);
+void bitsliced_unslice(FELT *out, const column *acc);
+
+#define STATES (((OIL_VARS-1)/16)+1)
+
+/*
+	The column generator runs the PRNG streams side by side in the lanes of AVX2 registers and transposes their output into columns a block at a time.
+*/
+
+#ifdef PRNG_KECCAK
+
+#define __SHAKE_RATE(NUM) SHAKE##NUM##_RATE
+#define _SHAKE_RATE(NUM) __SHAKE_RATE(NUM)
+#define SHAKE_RATE _SHAKE_RATE(SHAKENUM)
+
+#define STATE_GROUPS ((STATES+3)/4)
+#define GENERATOR_COLUMNS (SHAKE_RATE/2)
+
+typedef struct {
+	__m256i states[STATE_GROUPS][25];
+	column cols[GENERATOR_COLUMNS];
+	int cols_used;
+} ColumnGenerator;
+
+#endif
+
+#ifdef PRNG_CHACHA
+
+#define GENERATOR_COLUMNS (CHACHA_BLOCKLEN/2)
+
+typedef struct {
+	chacha_ctx ctx;
+	column cols[GENERATOR_COLUMNS];
+	int cols_used;
+} ColumnGenerator;
+
+#endif
+
+void ColumnGenerator_init(ColumnGenerator * col_gen, const unsigned char* key);
+column Next_Column(ColumnGenerator *col_gen);
+
+#endif
@@ -0,0 +1,72 @@
+/*
+	PCLMULQDQ: one carry-less multiplication per product, followed by two folds of the reduction polynomial.
+*/
+
+#include "F47Field.h"
+
+#include <wmmintrin.h>
+#include <smmintrin.h>
+
+/*
+	Write a field element to a char array
+
+	W : writer object
+	a : field element to write
+*/
+void f47serialize_FELT(writer *W, f47FELT a) {
+	serialize_uint64_t(W, a , 47);
+}
+
+/*
+	Read a field element from a char array
+
+	R : reader object
+
+	returns : a field element
+*/
+f47FELT f47deserialize_FELT(reader *R) {
+	return ((f47FELT) deserialize_uint64_t(R,47));
+}
+
+/*
+	Multiplies two field elements
+
+	a,b : reduced field element to multiply
+
+	return : the reduced product of a and b
+*/
+f47FELT f47multiply(f47FELT a, f47FELT b) {
+	__m128i p = _mm_clmulepi64_si128(_mm_cvtsi64_si128(a & 0x7fffffffffff), _mm_cvtsi64_si128(b & 0x7fffffffffff), 0x00);
+	uint64_t lo = (uint64_t) _mm_cvtsi128_si64(p);
+	uint64_t hi = (uint64_t) _mm_extract_epi64(p, 1);
+
+	// x^47 = x^5 + 1
+	uint64_t overflow = (lo >> 47) | (hi << 17);
+	uint64_t out = (lo & 0x7fffffffffff) ^ overflow ^ (overflow << 5);
+	overflow = out >> 47;
+	out ^= overflow ^ (overflow << 5);
+	return out & 0x7fffffffffff;
+}
+
+/*
+	Inverts a field element
+
+	a : field element to invert
+
+	return : the inverse of a, if a is nonzero
+*/
+f47FELT f47inverse(f47FELT a) {
+	uint64_t pow = 0x7ffffffffffe;
+	//uint64_t pow = 0x1;
+	uint64_t e = a;
+	uint64_t ans = 1;
+	while(pow != 0){
+		if((pow & 1) == 1){
+			ans = f47multiply(ans,e);
+		}
+		e = f47multiply(e,e);
+		pow >>= 1;
+	}
+	return ans;
+}
+
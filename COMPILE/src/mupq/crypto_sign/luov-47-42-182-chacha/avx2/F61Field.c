@@ -0,0 +1,80 @@
+/*
+	PCLMULQDQ: one carry-less multiplication per product and one more for the reduction.
+*/
+
+#include "F61Field.h"
+
+#include <wmmintrin.h>
+#include <smmintrin.h>
+
+/*
+	Write a field element to a char array
+
+	W : writer object
+	a : field element to write
+*/
+void f61serialize_FELT(writer *W, f61FELT a) {
+	serialize_uint64_t(W, a , 61);
+}
+
+/*
+	Read a field element from a char array
+
+	R : reader object
+
+	returns : a field element
+*/
+f61FELT f61deserialize_FELT(reader *R) {
+	return ((f61FELT) deserialize_uint64_t(R,61));
+}
+
+/*
+	takes two 32 bit values a, b and computes the carryless multiplication of a and b (a 63 bit value)
+*/
+uint64_t clmul(uint64_t a, uint64_t b){
+	return (uint64_t) _mm_cvtsi128_si64(_mm_clmulepi64_si128(_mm_cvtsi64_si128(a), _mm_cvtsi64_si128(b), 0x00));
+}
+
+/*
+	Multiplies two field elements
+
+	a,b : reduced field element to multiply
+
+	return : the reduced product of a and b
+*/
+f61FELT f61multiply(f61FELT a, f61FELT b) {
+	__m128i p = _mm_clmulepi64_si128(_mm_cvtsi64_si128(a & 0x1fffffffffffffff), _mm_cvtsi64_si128(b & 0x1fffffffffffffff), 0x00);
+	uint64_t lo = (uint64_t) _mm_cvtsi128_si64(p);
+	uint64_t hi = (uint64_t) _mm_extract_epi64(p, 1);
+
+	// x^61 = x^5 + x^2 + x + 1, the first fold can exceed 64 bits
+	uint64_t overflow = (lo >> 61) | (hi << 3);
+	__m128i q = _mm_clmulepi64_si128(_mm_cvtsi64_si128(overflow), _mm_cvtsi64_si128(0x27), 0x00);
+	uint64_t out = (lo & 0x1fffffffffffffff) ^ (uint64_t) _mm_cvtsi128_si64(q);
+	overflow = (out >> 61) | ((uint64_t) _mm_extract_epi64(q, 1) << 3);
+	out &= 0x1fffffffffffffff;
+	out ^= overflow ^ (overflow << 1) ^ (overflow << 2) ^ (overflow << 5);
+	return out;
+}
+
+/*
+	Inverts a field element
+
+	a : field element to invert
+
+	return : the inverse of a, if a is nonzero
+*/
+f61FELT f61inverse(f61FELT a) {
+	uint64_t pow = 0x1ffffffffffffffe;
+	uint64_t e = a;
+	uint64_t ans = 1;
+	while(pow != 0){
+		if((pow & 1) == 1){
+			ans = f61multiply(ans,e);
+		}
+		e = f61multiply(e,e);
+		pow >>= 1;
+	}
+	return ans;
+}
+
@@ -0,0 +1,103 @@
+/*
+	PCLMULQDQ: a product takes four carry-less multiplications of 64-bit words.
+*/
+
+#include "F79Field.h"
+
+#include <wmmintrin.h>
+#include <smmintrin.h>
+
+f79FELT f79add(f79FELT a, f79FELT b) {
+	f79FELT out;
+	out.coef[0] = a.coef[0] ^ b.coef[0];
+	out.coef[1] = a.coef[1] ^ b.coef[1];
+	return out;
+}
+
+
+void f79addInPlace(f79FELT *a, f79FELT *b){
+	(*a).coef[0] ^= (*b).coef[0];
+	(*a).coef[1] ^= (*b).coef[1];
+}
+
+int f79isEqual(f79FELT a, f79FELT b){
+	return ((a.coef[0] == b.coef[0]) && ( (a.coef[1] & 0x7fff) == (b.coef[1] & 0x7fff) ) );
+}
+
+/*
+	Write a field element to a char array
+
+	W : writer object
+	a : field element to write
+*/
+void f79serialize_FELT(writer *W, f79FELT a) {
+	serialize_uint64_t(W, a.coef[0] , 64);
+	serialize_uint64_t(W, a.coef[1] , 15);
+}
+
+/*
+	Read a field element from a char array
+
+	R : reader object
+
+	returns : a field element
+*/
+f79FELT f79deserialize_FELT(reader *R) {
+	f79FELT out;
+	out.coef[0] = deserialize_uint64_t(R,64);
+	out.coef[1] = deserialize_uint64_t(R,15);
+	return out;
+}
+
+/*
+	Multiplies two field elements
+
+	a,b : reduced field element to multiply
+
+	return : the reduced product of a and b
+*/
+f79FELT f79multiply(f79FELT a, f79FELT b) {
+	__m128i va = _mm_set_epi64x(a.coef[1] & 0x7fff, a.coef[0]);
+	__m128i vb = _mm_set_epi64x(b.coef[1] & 0x7fff, b.coef[0]);
+	__m128i p0   = _mm_clmulepi64_si128(va, vb, 0x00);
+	__m128i p64  = _mm_xor_si128(_mm_clmulepi64_si128(va, vb, 0x01), _mm_clmulepi64_si128(va, vb, 0x10));
+	__m128i p128 = _mm_clmulepi64_si128(va, vb, 0x11);
+
+	uint64_t out0   = (uint64_t) _mm_cvtsi128_si64(p0);
+	uint64_t out64  = (uint64_t) _mm_extract_epi64(p0, 1) ^ (uint64_t) _mm_cvtsi128_si64(p64);
+	uint64_t out128 = (uint64_t) _mm_extract_epi64(p64, 1) ^ (uint64_t) _mm_cvtsi128_si64(p128);
+
+	// x^79 = x^9 + 1
+	uint64_t over0 = (out64 >> 15) | (out128 << 49);
+	uint64_t over1 = out128 >> 15;
+	out64 &= 0x7fff;
+	out0  ^= over0 ^ (over0 << 9);
+	out64 ^= over1 ^ (over1 << 9) ^ (over0 >> 55);
+
+	uint64_t overflow = out64 >> 15;
+	out64 &= 0x7fff;
+	out0 ^= overflow ^ (overflow << 9);
+
+	f79FELT out = {{out0, out64}};
+	return out;
+}
+
+/*
+	Inverts a field element
+
+	a : field element to invert
+
+	return : the inverse of a, if a is nonzero
+*/
+f79FELT f79inverse(f79FELT a) {
+	f79FELT e = f79multiply(a,a);
+	f79FELT ans = f79ONE;
+	int i;
+	for (i = 0; i < 78; ++i)
+	{
+		ans = f79multiply(ans,e);
+		e = f79multiply(e,e);
+	}
+	return ans;
+}
+
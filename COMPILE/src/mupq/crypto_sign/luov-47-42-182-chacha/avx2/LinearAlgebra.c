@@ -0,0 +1,246 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "LinearAlgebra.h"
+#include "buffer.h"
+
+#if FIELD_SIZE == 7
+
+/*
+	AVX2: over F_2^7 the row operations multiply 32 entries at a time, by looking up the products of the constant with the low and the high nibble of the entries.
+*/
+
+#include <immintrin.h>
+
+/*
+	Builds the nibble product tables of a field element
+
+	lo, hi : receive a*n and a*(n<<4) for every nibble n, in both 128-bit lanes
+	a : A field element
+*/
+static void nibbleTables(__m256i *lo, __m256i *hi, FELT a) {
+	uint8_t t[32];
+	int n;
+	for (n = 0; n < 16; n++) {
+		t[n] = multiply(n, a);
+		t[16 + n] = multiply((n & 7) << 4, a);
+	}
+	*lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i *) t));
+	*hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i *) (t + 16)));
+}
+
+/*
+	Multiplies 32 field elements by the element whose nibble tables are lo and hi
+*/
+static inline __m256i multiply32(__m256i x, __m256i lo, __m256i hi) {
+	const __m256i nibble = _mm256_set1_epi8(15);
+	return _mm256_xor_si256(_mm256_shuffle_epi8(lo, _mm256_and_si256(x, nibble)),
+	                        _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble)));
+}
+
+#endif
+
+/*
+	Creates a new matrix
+
+	rows : the number of rows of the new matrix
+	cols : the number of columns of the new matrix
+
+	returns : The new matrix
+*/
+static Matrix newMatrix(unsigned int rows, unsigned int cols) {
+	unsigned int i;
+	Matrix new;
+	new.rows = rows;
+	new.cols = cols;
+	new.array = malloc(rows * sizeof(FELT*));
+	for (i = 0; i < rows; i++) {
+		new.array[i] = malloc(cols * sizeof(FELT));
+	}
+	return new;
+}
+
+/*
+	Creates a new matrix whose entries are zero
+
+	rows : the number of rows of the new matrix
+	cols : the number of columns of the new matrix
+
+	returns : The new matrix
+*/
+Matrix zeroMatrix(unsigned int rows, unsigned int cols) {
+	unsigned int i, j;
+	Matrix newMat = newMatrix(rows, cols);
+	for (i = 0; i < rows; i++) {
+		for (j = 0; j < cols; j++) {
+			newMat.array[i][j] = ZERO;
+		}
+	}
+	return newMat;
+}
+
+/*
+	Free the memory of a matrix
+
+	mat : the matrix to destroy
+*/
+void destroy_matrix(Matrix mat) {
+	int i;
+	for (i = 0; i < mat.rows; i++) {
+		free(mat.array[i]);
+	}
+	free(mat.array);
+}
+
+/*
+	Swaps two rows of a matrix
+
+	A : A matrix
+	row1 , row2 : The rows of A that have to be swapped
+*/
+static void swapRows(Matrix A, int row1, int row2) {
+	FELT *temp = A.array[row1];
+	A.array[row1] = A.array[row2];
+	A.array[row2] = temp;
+}
+
+/*
+	Multiplies all the entries of a row of a matrix by a scalar
+
+	A : A matrix
+	row : the index of the row that has to be rescaled
+	a : A field element
+*/
+static void scaleRow(Matrix A, int row, FELT a) {
+	int i = 0;
+#if FIELD_SIZE == 7
+	__m256i lo, hi, x;
+	nibbleTables(&lo, &hi, a);
+	for (; i + 32 <= A.cols; i += 32) {
+		x = _mm256_loadu_si256((__m256i *) &A.array[row][i]);
+		_mm256_storeu_si256((__m256i *) &A.array[row][i], multiply32(x, lo, hi));
+	}
+#endif
+	for (; i < A.cols; i++) {
+		A.array[row][i] = multiply(A.array[row][i], a);
+	}
+}
+
+/*
+	Add a part of the scalar multiple of one row of a matrix to another row of that matrix
+
+	A : A matrix
+	destrow : The row to add to
+	sourcerow  : The row that is multiplied by a scalar and added to destrow
+	constant : The contant that sourcerow is multiplied with
+	offset : Only the entries in columns with index larger than or equal to offset are affected
+*/
+static void rowOp(Matrix A, int destrow, int sourcerow, FELT constant, int offset)
+{
+	int j = offset;
+	FELT T;
+	if (isEqual(constant, ZERO))
+		return;
+
+#if FIELD_SIZE == 7
+	{
+		__m256i lo, hi, x, y;
+		nibbleTables(&lo, &hi, constant);
+		for (; j + 32 <= A.cols; j += 32) {
+			x = _mm256_loadu_si256((__m256i *) &A.array[sourcerow][j]);
+			y = _mm256_loadu_si256((__m256i *) &A.array[destrow][j]);
+			_mm256_storeu_si256((__m256i *) &A.array[destrow][j], _mm256_xor_si256(y, multiply32(x, lo, hi)));
+		}
+	}
+#endif
+	for (; j < A.cols; ++j)
+	{
+		T = multiply(A.array[sourcerow][j], constant);
+		A.array[destrow][j] = add(A.array[destrow][j],T);
+	}
+}
+
+/*
+	Puts the first part of an augmented matrix in row echelon form.
+
+	A : A matrix
+
+	returns : The rank ok the first part of the row echelon form of A
+*/
+static int rowEchelonAugmented(Matrix A)
+{
+	int i,col;
+	int row = 0;
+	for (col = 0; col < A.cols - 1; ++col)
+	{
+		for (i = row; i < A.rows; ++i)
+		{
+			if (!isEqual(A.array[i][col], ZERO))
+			{
+				if (i != row)
+				{
+					swapRows(A, i, row);
+				}
+				break;
+			}
+		}
+
+		if (i == A.rows)
+		{
+			continue;
+		}
+
+		scaleRow(A, row, inverse(A.array[row][col]));
+
+		for (i++; i < A.rows; ++i)
+		{
+			rowOp(A, i, row, minus(A.array[i][col]), col);
+		}
+
+		row++;
+
+		if (row == A.rows)
+		{
+			break;
+		}
+	}
+	return row;
+}
+
+/*
+	Calculates the unique solution to a linear system described by an augmented matrix
+
+	A : The augmented matrix of some linear system of equations
+	solution : Receives the unique solution if it exists
+
+	returns : 1 if a unique solution exists, 0 otherwise
+*/
+int getUniqueSolution(Matrix A, FELT *solution) {
+	int i,j,col,row;
+	FELT T;
+	int rank = rowEchelonAugmented(A);
+
+	if (rank != A.rows) {
+		return 0;
+	}
+
+	/* clear memory for solution */
+    for (i = 0 ; i< A.cols-1 ; i++){
+    	solution[i] = ZERO;
+    }
+
+	for (row = A.rows - 1; row >= 0; row--) {
+		col = row;
+		while (isEqual(A.array[row][col], ZERO))
+		{
+			col++;
+		}
+
+		solution[col] = A.array[row][A.cols - 1];
+		for (j = col + 1; j < A.cols - 1; j++) {
+			T = multiply(solution[j], A.array[row][j]);
+			solution[col] = subtract(solution[col],T);
+		}
+	}
+	return 1;
+}
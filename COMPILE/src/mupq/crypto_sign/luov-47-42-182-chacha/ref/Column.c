@@ -85,6 +85,82 @@ void squeeze_column_array(Sponge *sponge, column *arr, int size) {
 	}
 }
 
+#if FIELD_SIZE == 79
+#define FELT_WORD(a,w) ((a).coef[w])
+#else
+#define FELT_WORD(a,w) ((uint64_t) (a))
+#endif
+
+/*
+	Adds a multiple of a column to a bitsliced vector: acc[b] ^= r for every bit b of a
+
+	acc : bitsliced vector of FIELD_SIZE columns
+	r   : the column, one bit per element of acc
+	a   : the field element r is multiplied with
+*/
+void bitsliced_add_scaled(column *acc, column r, FELT a) {
+	uint64_t *s = (uint64_t *) acc;
+	const uint64_t *c = (const uint64_t *) &r;
+	uint64_t mask;
+	int b, w;
+
+	for (b = 0; b < FIELD_SIZE; b++) {
+		mask = -((FELT_WORD(a, b/64) >> (b%64)) & 1);
+		for (w = 0; w < COLUMN_WORDS; w++) {
+			s[b*COLUMN_WORDS + w] ^= c[w] & mask;
+		}
+	}
+}
+
+/*
+	Adds src to every block of acc that is selected by a column: acc[o*len + i] ^= src[i] for every bit o of sel
+
+	acc : OIL_VARS blocks of len columns
+	src : len columns
+	len : the number of columns in a block
+	sel : the column that selects the blocks of acc
+*/
+void columns_add_selected(column *acc, const column *src, int len, column sel) {
+	uint64_t *s = (uint64_t *) acc;
+	const uint64_t *c = (const uint64_t *) src;
+	const uint64_t *e = (const uint64_t *) &sel;
+	uint64_t mask;
+	int o, i;
+
+	for (o = 0; o < OIL_VARS; o++) {
+		mask = -((e[o/64] >> (o%64)) & 1);
+		for (i = 0; i < len*COLUMN_WORDS; i++) {
+			s[o*len*COLUMN_WORDS + i] ^= c[i] & mask;
+		}
+	}
+}
+
+/*
+	Converts a bitsliced vector to OIL_VARS field elements
+
+	out : receives the field elements
+	acc : bitsliced vector of FIELD_SIZE columns
+*/
+void bitsliced_unslice(FELT *out, const column *acc) {
+	const uint64_t *s = (const uint64_t *) acc;
+	uint64_t w[2];
+	int k, b;
+
+	for (k = 0; k < OIL_VARS; k++) {
+		w[0] = 0;
+		w[1] = 0;
+		for (b = 0; b < FIELD_SIZE; b++) {
+			w[b/64] |= ((s[b*COLUMN_WORDS + k/64] >> (k%64)) & 1) << (b%64);
+		}
+#if FIELD_SIZE == 79
+		out[k].coef[0] = w[0];
+		out[k].coef[1] = w[1];
+#else
+		out[k] = (FELT) w[0];
+#endif
+	}
+}
+
 void ColumnGenerator_init(ColumnGenerator * col_gen, const unsigned char* key){
 	int i;
 	unsigned char stream[16] = {0};
@@ -128,21 +204,3 @@ column Next_Column(ColumnGenerator *col_gen){
 	col_gen->cols_used ++;
 	return Out;
 }
-
-void PieceGenerator_init(PieceGenerator * col_gen, const unsigned char* key, int IV){
-	unsigned char stream[16] = {0};
-	stream[0] = IV;
-	PRNG_INIT(&col_gen->state, key, stream);
-	col_gen->cols_used = BLOCK_SIZE/2;
-}
-
-uint16_t Next_Piece(PieceGenerator *col_gen){
-	if(col_gen->cols_used == BLOCK_SIZE/2){
-		PRNG_GET_BLOCK(&col_gen->state,col_gen->block);
-		col_gen->cols_used = 0;
-	}
-
-	uint16_t Out = (((uint16_t)col_gen->block[col_gen->cols_used*2    ]) ) | (((uint16_t) col_gen->block[col_gen->cols_used*2 + 1]) << 8);
-	col_gen->cols_used ++;
-	return Out;
-}
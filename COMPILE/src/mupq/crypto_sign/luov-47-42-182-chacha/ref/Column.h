@@ -13,6 +13,7 @@
 #if OIL_VARS > 64
 
 #define COLUMN_COMPONENTS ((OIL_VARS+63)/64)
+#define COLUMN_WORDS COLUMN_COMPONENTS
 
 typedef struct {
 	uint64_t components[COLUMN_COMPONENTS];
@@ -30,6 +31,7 @@ void flipBit(column *container, uint64_t bit);
 #else
 
 #define column uint64_t
+#define COLUMN_WORDS 1
 #define empty ((uint64_t) 0)
 #define xor(a,b) a^b
 #define getBit(container,bit) (container & ((uint64_t)1) << bit)
@@ -42,6 +44,15 @@ void flipBit(column *container, uint64_t bit);
 
 void squeeze_column_array(Sponge *sponge, column *arr, int size);
 
+/*
+	Bitsliced vectors of OIL_VARS field elements are arrays of FIELD_SIZE columns, where column b holds bit b of every element.
+	Adding a multiple of a column of bits to such a vector takes FIELD_SIZE column operations instead of OIL_VARS field additions.
+*/
+
+void bitsliced_add_scaled(column *acc, column r, FELT a);
+void columns_add_selected(column *acc, const column *src, int len, column sel);
+void bitsliced_unslice(FELT *out, const column *acc);
+
 #define STATES (((OIL_VARS-1)/16)+1)
 
 typedef struct {
@@ -53,14 +64,4 @@ typedef struct {
 void ColumnGenerator_init(ColumnGenerator * col_gen, const unsigned char* key);
 column Next_Column(ColumnGenerator *col_gen);
 
-typedef struct {
-	PRNG_STATE state;
-	unsigned char block[BLOCK_SIZE];
-	int cols_used;
-} PieceGenerator;
-
-void PieceGenerator_init(PieceGenerator * col_gen, const unsigned char* key, int IV);
-uint16_t Next_Piece(PieceGenerator *col_gen);
-
-
 #endif
@@ -14,7 +14,7 @@
 	pk : the public key
 */
 static void calculateQ2(column *T , unsigned char *pk) {
-	int i, j, k;
+	int i, j;
 	column *TempMat = malloc(sizeof(column) * OIL_VARS);
 	column r;
 
@@ -23,15 +23,12 @@ static void calculateQ2(column *T , unsigned char *pk) {
 	ColumnGenerator_init(&CG, PK_SEED(pk));
 
 	// Allocate memory for temporary matrices that will store the values P_i,1 T + P_i,2 for i from 1 to OIL_VARS.
-	// These OIL_VARS matrices are bitsliced into one OIL_VARS by OIL_VARS array of columns.
+	// These OIL_VARS matrices are bitsliced into one OIL_VARS by OIL_VARS array of columns, stored row by row.
 	// All entries of the matrices are initialized to zero.
 
-	column **TempMat2 = malloc(sizeof(column*) * OIL_VARS);
-	for (i = 0; i < OIL_VARS; i++) {
-		TempMat2[i] = malloc(sizeof(column)*OIL_VARS);
-		for (j = 0; j < OIL_VARS; j++) {
-			TempMat2[i][j] = empty;
-		}
+	column *TempMat2 = malloc(sizeof(column) * OIL_VARS * OIL_VARS);
+	for (i = 0; i < OIL_VARS * OIL_VARS; i++) {
+		TempMat2[i] = empty;
 	}
 
 	// Simultaneously calculate P_i,1*T + P_i,2 for all i from 1 to OIL_VARS
@@ -43,11 +40,7 @@ static void calculateQ2(column *T , unsigned char *pk) {
 		// Calculates P_i,1*T
 		for (j = i; j <= VINEGAR_VARS; j++) {
 			r = Next_Column(&CG);
-			for (k = 0; k < OIL_VARS; k++) {
-				if (getBit(T[j], k)) {
-					TempMat[k] = xor(TempMat[k], r);
-				}
-			}
+			columns_add_selected(TempMat, &r, 1, T[j]);
 		}
 		// Add P_i,2
 		for (j = 0; j < OIL_VARS; j++) {
@@ -57,22 +50,16 @@ static void calculateQ2(column *T , unsigned char *pk) {
 
 
 		// Calculate P_i,3 = Transpose(T)*TempMat_i, and store the result in Q_2
-		for (k = 0; k < OIL_VARS; k++) {
-			for (j = 0; j < OIL_VARS; j++) {
-				if (getBit(T[i] , k ) ) {
-					TempMat2[k][j] = xor(TempMat2[k][j], TempMat[j]);
-				}
-			}
-		}
+		columns_add_selected(TempMat2, TempMat, OIL_VARS, T[i]);
 	}
 
 	// Write Q2 to the public key
 	writer W = newWriter(PK_Q2(pk));
 	for (i = 0; i < OIL_VARS; i++) {
 		for (j = i; j < OIL_VARS; j++) {
-			column col = TempMat2[i][j];
+			column col = TempMat2[i*OIL_VARS + j];
 			if (i != j)
-				col = xor(col,TempMat2[j][i]);
+				col = xor(col,TempMat2[j*OIL_VARS + i]);
 			serialize_column(&W, col);
 		}
 	}
@@ -82,9 +69,6 @@ static void calculateQ2(column *T , unsigned char *pk) {
 		writeBit(&W,0);
 
 	// Free the memory occupied by TempMat & TempMat2
-	for (i = 0; i < OIL_VARS; i++) {
-		free(TempMat2[i]);
-	}
 	free(TempMat2);
 	free(TempMat);
 }
@@ -122,98 +106,76 @@ int luov_keygen(unsigned char *pk, unsigned char *sk) {
 /*
 	Builds the augmented matrix for the system F(x) = target , after fixing the vinegar variables
 
-	A                 : Receives the augmented matrix, should be initialized to the zero matrix
+	The OIL_VARS equations are handled together: the coefficients of P that belong to one monomial are generated as one column,
+	and every sum over the equations is kept as a bitsliced vector (see Column.h). With v the vinegar variables,
+	row k of the augmented matrix is
+		v*(P_k,1 + Transpose(P_k,1))*T + v*P_k,2 | target_k - v*P_k,1*Transpose(v)
+	which is evaluated as
+		W = v*(P_k,1 + Transpose(P_k,1)),  L = W*T + v*P_k,2,  R = v*P_k,1*Transpose(v)
+
+	A                 : Receives the augmented matrix
 	vinegar_variables : An assignment to the vinegar variables
 	target            : The target vector to find a solution for
 	T                 : The V-by-M matrix that determines the secret linear transformation T
 	publicseed            : The public seed that is used to generate the first part of the secret key
 */
-static void BuildAugmentedMatrix(Matrix A, const FELT *vinegar_variables , const FELT *target, const column *T, const unsigned char *publicseed){ //Sponge *sponge) {
-	int i, j, k, x;
-	column **F2;
-	uint16_t r;
+static void BuildAugmentedMatrix(Matrix A, const FELT *vinegar_variables , const FELT *target, const column *T, const unsigned char *publicseed){
+	int i, j, k;
+	column *W, *L;
+	column R[FIELD_SIZE];
+	column r;
 	FELT prod;
+	FELT elements[OIL_VARS];
 
-	// Sets the right hand side of the Augmented matrix to the target vector
-	for (k = 0; k < OIL_VARS; k++) {
-		A.array[k][OIL_VARS] = target[k];
+	// Allocate the bitsliced vectors W_0, ..., W_VINEGAR_VARS and L_0, ..., L_OIL_VARS-1, initialized to zero
+	W = calloc((VINEGAR_VARS+1)*FIELD_SIZE, sizeof(column));
+	L = calloc(OIL_VARS*FIELD_SIZE, sizeof(column));
+	for (k = 0; k < FIELD_SIZE; k++) {
+		R[k] = empty;
 	}
 
-	// Allocate memory for the matrices F_1,2, ... , F_OIL_VARS,2.
-	// These matrices are bit sliced together and stored as a OIL_VARS by VINEGAR_VARS array of columns.
-	// All entries of these matrices are initialized to zero.
-	F2 = malloc(sizeof(column*)*16);
-	for (k = 0; k < 16; k++) {
-		F2[k] = calloc(VINEGAR_VARS+1,sizeof(column));
-	}
-
-	// loop over each set of 16 equations
-	for(x=0 ; x< 1+ (OIL_VARS-1)/16; x++){
-
-		// Initialize the PRNG to produce the first part of 16 components of the public map
-		PieceGenerator PG;
-		PieceGenerator_init(&PG,publicseed,x);
+	// Initialize the PRNG to produce the first part of the public map
+	ColumnGenerator CG;
+	ColumnGenerator_init(&CG, publicseed);
 
-		// Clear F2
-		for (i = 0; i < 16; i++) {
-			for(j=0; j<=VINEGAR_VARS; j++){
-				F2[i][j] = empty;
-			}
-		}
+	for (i = 0; i <= VINEGAR_VARS; i++) {
+		// the term in v_i*v_j goes to R, P_1 + Transpose(P_1) has a zero diagonal
+		for (j = i; j <= VINEGAR_VARS; j++) {
+			r = Next_Column(&CG);
 
-		// Computes F_i,2 = (P_i,1 + Transpose(P_i,1)*T + P_i,2 ) simultaneously for all i from 1 to OIL_VARS
-		// and subtracts the evaluation of P in the vinegar variables from the right hand side
-		for (i = 0; i <= VINEGAR_VARS; i++) {
-			for (j = i; j <= VINEGAR_VARS; j++) {
-				r = Next_Piece(&PG);
-
-				prod = multiply(vinegar_variables[i], vinegar_variables[j]);
-				for (k = 0; k < 16; k++) {
-					if (x*16 + k >= OIL_VARS)
-						break;
-					if ( r & ((uint16_t) 1 ) << k ) {
-						// subtract the term in v_i*v_j from the right hand side
-						A.array[x*16+k][OIL_VARS] = add(A.array[x*16+k][OIL_VARS],prod);
-
-						// add (P_i,1 + Transpose(P_i,1)*T part to F_i,2
-						F2[k][j] = xor(F2[k][j],T[i]);
-						F2[k][i] = xor(F2[k][i],T[j]);
-					}
-				}
-			}
-			// add P_i,2 part to F_i,2
-			for (j = 0; j < OIL_VARS; j++) {
-				r = Next_Piece(&PG);
-				for (k = 0; k < 16; k++) {
-					if (x*16 + k >= OIL_VARS)
-						break;
-					if ( r & ((uint16_t) 1 ) << k ) {
-						flipBit(&F2[k][i],j);
-					}
-				}
+			prod = multiply(vinegar_variables[i], vinegar_variables[j]);
+			bitsliced_add_scaled(R, r, prod);
+			if (j != i) {
+				bitsliced_add_scaled(&W[j*FIELD_SIZE], r, vinegar_variables[i]);
+				bitsliced_add_scaled(&W[i*FIELD_SIZE], r, vinegar_variables[j]);
 			}
 		}
-
-		// Calculate v*P_i,2 and assign to the i-th row of the LHS of the augmented matrix
-		for (k = 0; k < 16; k++)	{
-			if (16*x+k>= OIL_VARS)
-				break;
-			for (i = 0; i <= VINEGAR_VARS; i++) {
-				for (j = 0; j < OIL_VARS; j++)	{
-					if (getBit(F2[k][i],j)) {
-						A.array[16*x+k][j] = add(A.array[16*x+k][j],vinegar_variables[i]);
-					}
-				}
-			}
+		// add v*P_2
+		for (j = 0; j < OIL_VARS; j++) {
+			r = Next_Column(&CG);
+			bitsliced_add_scaled(&L[j*FIELD_SIZE], r, vinegar_variables[i]);
 		}
+	}
 
+	// add W*T
+	for (i = 1; i <= VINEGAR_VARS; i++) {
+		columns_add_selected(L, &W[i*FIELD_SIZE], FIELD_SIZE, T[i]);
 	}
 
-	// free the memory occupied by the F_i,2
-	for (k = 0; k<16; k++){
-		free(F2[k]);
+	// Write L and target - R to the augmented matrix
+	for (j = 0; j < OIL_VARS; j++) {
+		bitsliced_unslice(elements, &L[j*FIELD_SIZE]);
+		for (k = 0; k < OIL_VARS; k++) {
+			A.array[k][j] = elements[k];
+		}
+	}
+	bitsliced_unslice(elements, R);
+	for (k = 0; k < OIL_VARS; k++) {
+		A.array[k][OIL_VARS] = subtract(target[k], elements[k]);
 	}
-	free(F2);
+
+	free(W);
+	free(L);
 }
 
 /*
@@ -533,15 +495,16 @@ static void evaluatePublicMap(const unsigned char *pk, const unsigned char *sig
 	int i,j,k;
 	FELT prod;
 	column r;
+	column E[FIELD_SIZE];
 
 	// Add a homogenizing variable equal to 1
 	FELT solution[VARS+1];
 	solution[0] = ONE;
 	decompress_vec(SIG_SOL(sig), solution+1,VARS);
 
-	// initialize evaluation to zero
-	for(i = 0 ; i<OIL_VARS ; i++){
-		evaluation[i] = ZERO;
+	// initialize the bitsliced evaluation to zero
+	for(k = 0 ; k<FIELD_SIZE ; k++){
+		E[k] = empty;
 	}
 
 	// Initialise PRNG to generate the first part of the public map P
@@ -554,11 +517,7 @@ static void evaluatePublicMap(const unsigned char *pk, const unsigned char *sig
 			r = Next_Column(&CG);
 
 			prod = multiply(solution[i], solution[j]);
-			for (k = 0; k < OIL_VARS; k++) {
-				if (getBit(r,k)) {
-					evaluation[k] = add(evaluation[k],prod);
-				}
-			}
+			bitsliced_add_scaled(E, r, prod);
 		}
 	}
 
@@ -568,14 +527,12 @@ static void evaluatePublicMap(const unsigned char *pk, const unsigned char *sig
 		for (j = i; j <= VARS; j++) {
 			prod = multiply(solution[i], solution[j]);
 			column col = deserialize_column(&R);
-			for (k = 0; k < OIL_VARS; k++) {
-				if ( getBit(col , k) ) {
-					evaluation[k] = add(evaluation[k],prod);
-				}
-			}
+			bitsliced_add_scaled(E, col, prod);
 		}
 	}
 
+	bitsliced_unslice(evaluation, E);
+
 	// prints the evaluation of the public map if KAT is defined
 	//printEvaluation(evaluation);
 }
@@ -0,0 +1 @@
+../ref/F79Field.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/prng.c
\ No newline at end of file
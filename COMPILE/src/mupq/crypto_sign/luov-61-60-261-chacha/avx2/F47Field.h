@@ -0,0 +1 @@
+../ref/F47Field.h
\ No newline at end of file
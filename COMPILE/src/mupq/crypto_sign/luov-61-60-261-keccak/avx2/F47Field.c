@@ -0,0 +1 @@
+../../luov-47-42-182-chacha/avx2/F47Field.c
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/F7Field.c
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/buffer.c
\ No newline at end of file
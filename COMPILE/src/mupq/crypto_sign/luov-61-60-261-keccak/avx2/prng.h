@@ -0,0 +1 @@
+../ref/prng.h
\ No newline at end of file
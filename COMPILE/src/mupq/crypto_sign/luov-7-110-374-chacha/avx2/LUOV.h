@@ -0,0 +1 @@
+../ref/LUOV.h
\ No newline at end of file
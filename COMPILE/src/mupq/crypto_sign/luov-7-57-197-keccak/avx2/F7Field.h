@@ -0,0 +1 @@
+../ref/F7Field.h
\ No newline at end of file
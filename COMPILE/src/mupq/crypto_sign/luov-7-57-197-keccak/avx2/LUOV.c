@@ -0,0 +1 @@
+../ref/LUOV.c
\ No newline at end of file
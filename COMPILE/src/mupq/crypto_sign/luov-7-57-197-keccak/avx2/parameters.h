@@ -0,0 +1 @@
+../ref/parameters.h
\ No newline at end of file
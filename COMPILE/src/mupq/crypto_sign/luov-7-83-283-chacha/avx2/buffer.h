@@ -0,0 +1 @@
+../ref/buffer.h
\ No newline at end of file
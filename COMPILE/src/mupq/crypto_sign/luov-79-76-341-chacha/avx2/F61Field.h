@@ -0,0 +1 @@
+../ref/F61Field.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/LinearAlgebra.h
\ No newline at end of file
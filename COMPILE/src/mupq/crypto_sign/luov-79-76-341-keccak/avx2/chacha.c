@@ -0,0 +1 @@
+../ref/chacha.c
\ No newline at end of file
@@ -0,0 +1 @@
+../ref/chacha.h
\ No newline at end of file
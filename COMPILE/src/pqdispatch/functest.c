@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pqdispatch.h"
+
+#define MLEN 59
+
+static int test_kem(const pqdispatch_kem *k) {
+    uint8_t *pk = malloc(k->length_public_key);
+    uint8_t *sk = malloc(k->length_secret_key);
+    uint8_t *ct = malloc(k->length_ciphertext);
+    uint8_t *ss0 = malloc(k->length_shared_secret);
+    uint8_t *ss1 = malloc(k->length_shared_secret);
+    int r = -1;
+
+    if (pk == NULL || sk == NULL || ct == NULL || ss0 == NULL || ss1 == NULL) {
+        goto end;
+    }
+    if (k->keypair(pk, sk) != 0 || k->enc(ct, ss0, pk) != 0 ||
+            k->dec(ss1, ct, sk) != 0) {
+        goto end;
+    }
+    if (memcmp(ss0, ss1, k->length_shared_secret) != 0) {
+        goto end;
+    }
+    r = 0;
+end:
+    free(pk);
+    free(sk);
+    free(ct);
+    free(ss0);
+    free(ss1);
+    return r;
+}
+
+static int test_sign(const pqdispatch_sign *s) {
+    uint8_t m[MLEN], m2[MLEN + 1];
+    uint8_t *pk = malloc(s->length_public_key);
+    uint8_t *sk = malloc(s->length_secret_key);
+    uint8_t *sm = malloc(s->length_signature + MLEN);
+    uint8_t *m1 = malloc(s->length_signature + MLEN);
+    size_t smlen, mlen, i;
+    int r = -1;
+
+    for (i = 0; i < MLEN; i++) {
+        m[i] = (uint8_t) i;
+    }
+    if (pk == NULL || sk == NULL || sm == NULL || m1 == NULL) {
+        goto end;
+    }
+    if (s->keypair(pk, sk) != 0 || s->sign(sm, &smlen, m, MLEN, sk) != 0) {
+        goto end;
+    }
+    if (smlen > s->length_signature + MLEN) {
+        goto end;
+    }
+    if (s->open(m1, &mlen, sm, smlen, pk) != 0 || mlen != MLEN ||
+            memcmp(m, m1, MLEN) != 0) {
+        goto end;
+    }
+    sm[smlen / 2] ^= 1;
+    if (s->open(m1, &mlen, sm, smlen, pk) == 0) {
+        goto end;
+    }
+    if (s->signature != NULL) {
+        if (s->signature(sm, &smlen, m, MLEN, sk) != 0 ||
+                smlen > s->length_signature) {
+            goto end;
+        }
+        if (s->verify(sm, smlen, m, MLEN, pk) != 0) {
+            goto end;
+        }
+        memcpy(m2, m, MLEN);
+        m2[0] ^= 1;
+        if (s->verify(sm, smlen, m2, MLEN, pk) == 0) {
+            goto end;
+        }
+    }
+    r = 0;
+end:
+    free(pk);
+    free(sk);
+    free(sm);
+    free(m1);
+    return r;
+}
+
+/* with arguments, only the schemes named on the command line are tested */
+static int selected(int argc, char **argv, const char *scheme) {
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], scheme) == 0) {
+            return 1;
+        }
+    }
+    return argc == 1;
+}
+
+int main(int argc, char **argv) {
+    const char *prev = "";
+    size_t i;
+    int failed = 0, tested = 0;
+
+    printf("cpu features: 0x%02x\n", (unsigned) pqdispatch_cpu_features());
+
+    for (i = 0; i < pqdispatch_kem_count(); i++) {
+        const pqdispatch_kem *k = pqdispatch_kem_at(i);
+        if (!selected(argc, argv, k->scheme)) {
+            continue;
+        }
+        if (strcmp(prev, k->scheme) != 0) {
+            const pqdispatch_kem *best = pqdispatch_kem_get(k->scheme);
+            printf("kem  %-32s -> %s/%s\n", k->scheme,
+                   best ? best->project : "-", best ? best->implementation : "-");
+            prev = k->scheme;
+        }
+        if (!pqdispatch_usable(k->cpu_features)) {
+            continue;
+        }
+        tested++;
+        if (test_kem(k) != 0) {
+            printf("ERROR: %s/%s/%s\n", k->project, k->scheme, k->implementation);
+            failed++;
+        }
+    }
+    prev = "";
+    for (i = 0; i < pqdispatch_sign_count(); i++) {
+        const pqdispatch_sign *s = pqdispatch_sign_at(i);
+        if (!selected(argc, argv, s->scheme)) {
+            continue;
+        }
+        if (strcmp(prev, s->scheme) != 0) {
+            const pqdispatch_sign *best = pqdispatch_sign_get(s->scheme);
+            printf("sign %-32s -> %s/%s\n", s->scheme,
+                   best ? best->project : "-", best ? best->implementation : "-");
+            prev = s->scheme;
+        }
+        if (!pqdispatch_usable(s->cpu_features)) {
+            continue;
+        }
+        tested++;
+        if (test_sign(s) != 0) {
+            printf("ERROR: %s/%s/%s\n", s->project, s->scheme, s->implementation);
+            failed++;
+        }
+    }
+
+    printf("%d implementations tested, %d failed\n", tested, failed);
+    return failed != 0;
+}
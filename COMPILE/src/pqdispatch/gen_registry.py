@@ -0,0 +1,440 @@
+#!/usr/bin/env python3
+"""
+Generates the implementation registry of libpqdispatch.
+
+Walks COMPILE/src/PQClean/crypto_{kem,sign} and COMPILE/src/mupq/crypto_{kem,sign}
+and writes to the build directory given on the command line:
+
+  registry.c      the per-scheme tables, implementations in preference order
+  glue/<id>.c     one vtable definition per implementation, compiled with the
+                  include path and flags of that implementation
+  impls.mk        make rules that compile each implementation, link it with
+                  its glue into one relocatable object and keep only the
+                  vtable symbol global
+
+Sizes of PQClean schemes are taken from META.yml (and checked against api.h
+at compile time), those of mupq schemes from api.h. CPU requirements of
+PQClean implementations come from the required_flags in META.yml, those of
+mupq implementations from the intrinsics their sources use.
+"""
+
+import os
+import platform
+import re
+import subprocess
+import sys
+
+import yaml
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC = os.path.dirname(HERE)
+PQCLEAN = os.path.join(SRC, 'PQClean')
+MUPQ = os.path.join(SRC, 'mupq')
+
+#: automatic selection takes the first implementation of this list whose
+#: CPU features are present; unknown names are only used when requested
+PREFERENCE = ['avx2', 'aesni', 'clmul', 'opt', 'opt-ct', 'clean', 'ref']
+
+#: META.yml required_flags -> (feature macro, compiler flag)
+FEATURES = {
+    'aes': ('PQDISPATCH_CPU_AES', '-maes'),
+    'avx2': ('PQDISPATCH_CPU_AVX2', '-mavx2'),
+    'bmi2': ('PQDISPATCH_CPU_BMI2', '-mbmi2'),
+    'popcnt': ('PQDISPATCH_CPU_POPCNT', '-mpopcnt'),
+    'pclmulqdq': ('PQDISPATCH_CPU_PCLMULQDQ', '-mpclmul'),
+    'sse4_1': ('PQDISPATCH_CPU_SSE4_1', '-msse4.1'),
+}
+
+#: intrinsics that imply a required feature of a mupq implementation
+INTRINSICS = [
+    (re.compile(r'\b_mm256_\w+'), 'avx2'),
+    (re.compile(r'\b_mm_aes\w+_si128\b'), 'aes'),
+    (re.compile(r'\b_mm_clmulepi64_si128\b'), 'pclmulqdq'),
+    (re.compile(r'\b_(pdep|pext|bzhi)_u(32|64)\b'), 'bmi2'),
+    (re.compile(r'\b_mm_popcnt_u(32|64)\b'), 'popcnt'),
+    (re.compile(r'#include\s*<smmintrin\.h>'), 'sse4_1'),
+]
+
+#: mupq/common sources and the headers that pull them in; aes.h, sha2.h and
+#: sp800-185.h are the PQClean ones, whose code is already in the library
+#: (mupq/common/aes.c wraps the Cortex-M4 assembly)
+MUPQ_COMMON = [
+    ('fips202.h', ['fips202.c', 'keccakf1600.c']),
+]
+
+SOURCE_RE = re.compile(r'.*\.(c|s|S)$')
+
+
+def ident(*parts):
+    return '_'.join(re.sub(r'[^0-9A-Za-z]', '_', p) for p in parts)
+
+
+def rel(path):
+    return os.path.relpath(path, HERE)
+
+
+def cstr(s):
+    return '"' + s.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def make_vars(directory, names):
+    """Expanded values of variables of a PQClean implementation Makefile"""
+    # not a sub-make of the make that runs this script: with its MAKEFLAGS
+    # it would look for the jobserver and warn that it is unavailable
+    env = {k: v for k, v in os.environ.items()
+           if k not in ('MAKEFLAGS', 'MFLAGS')}
+    out = subprocess.check_output(
+        ['make', '-s', '--no-print-directory', '-C', directory,
+         '--eval=pqdispatch-print-%: ; @echo $($*)']
+        + ['pqdispatch-print-' + n for n in names],
+        env=env, universal_newlines=True)
+    return out.split('\n')[:len(names)]
+
+
+def feature_macros(features):
+    return ' | '.join(FEATURES[f][0] for f in features) or '0'
+
+
+def compile_flags(tokens):
+    """Keeps the code generation flags of an implementation Makefile"""
+    return [t for t in tokens
+            if t.startswith(('-m', '-f', '-D', '-U', '-std='))]
+
+
+class Impl:
+    def __init__(self, project, kind, scheme, name, path):
+        self.project = project
+        self.kind = kind
+        self.scheme = scheme
+        self.name = name
+        self.path = path
+        self.id = ident(kind, project.lower(), scheme, name)
+        self.symbol = 'pqdispatch_' + self.id
+        self.title = scheme
+        self.level = 0
+        self.features = []
+        self.flags = []
+        self.includes = [path]
+        self.sources = []
+        self.extra = []
+        self.lengths = {}
+
+    @property
+    def automatic(self):
+        return self.name in PREFERENCE
+
+    def rank(self):
+        if self.name in PREFERENCE:
+            return (PREFERENCE.index(self.name), self.project)
+        return (len(PREFERENCE), self.project, self.name)
+
+
+def pqclean_impls(arch):
+    impls = []
+    for kind in ('kem', 'sign'):
+        base = os.path.join(PQCLEAN, 'crypto_' + kind)
+        for scheme in sorted(os.listdir(base)):
+            with open(os.path.join(base, scheme, 'META.yml')) as f:
+                meta = yaml.safe_load(f)
+            for entry in meta['implementations']:
+                path = os.path.join(base, scheme, entry['name'])
+                if not os.path.isdir(path):
+                    continue
+                platforms = entry.get('supported_platforms')
+                features = []
+                if platforms:
+                    match = [p for p in platforms if p['architecture'] == arch]
+                    if not match:
+                        continue
+                    features = sorted(match[0].get('required_flags') or [])
+                impl = Impl('PQClean', kind, scheme, entry['name'], path)
+                impl.title = meta['name']
+                impl.level = meta.get('claimed-nist-level', 0)
+                impl.features = features
+                impl.namespace = 'PQCLEAN_{}_{}_'.format(
+                    scheme.replace('-', '').upper(),
+                    entry['name'].replace('-', '').upper())
+                for k in ('public-key', 'secret-key', 'ciphertext',
+                          'shared-secret', 'signature'):
+                    if 'length-' + k in meta:
+                        impl.lengths[k] = meta['length-' + k]
+                cflags, objects, keccak4x = make_vars(
+                    path, ['CFLAGS', 'OBJECTS', 'KECCAK4X'])
+                impl.flags = compile_flags(cflags.split())
+                impl.includes.append(os.path.join(PQCLEAN, 'common'))
+                for o in objects.split():
+                    stem = o[:-2]
+                    for ext in ('.c', '.S', '.s'):
+                        if os.path.exists(os.path.join(path, stem + ext)):
+                            if stem + ext not in impl.sources:
+                                impl.sources.append(stem + ext)
+                            break
+                    else:
+                        sys.exit('{}: no source for {}'.format(path, o))
+                if keccak4x:
+                    impl.extra.append('keccak4x')
+                impls.append(impl)
+    return impls
+
+
+def scan_features(path):
+    features = set()
+    for name in os.listdir(path):
+        if not name.endswith(('.c', '.h', '.inc')):
+            continue
+        with open(os.path.join(path, name), errors='replace') as f:
+            text = f.read()
+        for regex, feature in INTRINSICS:
+            if regex.search(text):
+                features.add(feature)
+    return sorted(features)
+
+
+def mupq_impls(arch):
+    impls = []
+    for kind in ('kem', 'sign'):
+        base = os.path.join(MUPQ, 'crypto_' + kind)
+        for scheme in sorted(os.listdir(base)):
+            if not os.path.isdir(os.path.join(base, scheme)):
+                continue
+            for name in sorted(os.listdir(os.path.join(base, scheme))):
+                path = os.path.join(base, scheme, name)
+                if not os.path.exists(os.path.join(path, 'api.h')):
+                    continue
+                # the -ephem bears link to sibling schemes that only PQClean has
+                if any(not os.path.exists(os.path.join(path, f))
+                       for f in os.listdir(path)):
+                    continue
+                impl = Impl('mupq', kind, scheme, name, path)
+                impl.sources = sorted(s for s in os.listdir(path)
+                                      if SOURCE_RE.match(s))
+                impl.features = scan_features(path)
+                if impl.features and arch != 'x86_64':
+                    continue
+                impl.flags = ['-std=gnu99'] + \
+                    [FEATURES[f][1] for f in impl.features]
+                impl.includes += [os.path.join(MUPQ, 'common'),
+                                  os.path.join(PQCLEAN, 'common')]
+                text = ''
+                for s in os.listdir(path):
+                    if s.endswith(('.c', '.h', '.inc')):
+                        with open(os.path.join(path, s), errors='replace') as f:
+                            text += f.read()
+                common = []
+                for header, sources in MUPQ_COMMON:
+                    if re.search(r'#include\s*"' + re.escape(header) + '"', text) \
+                            and not os.path.exists(os.path.join(path, header)):
+                        common += [c for c in sources if c not in common]
+                if 'KeccakP1600times4' in text:
+                    impl.includes.append(os.path.join(PQCLEAN, 'common', 'keccak4x'))
+                    impl.extra.append('keccak4x')
+                impl.extra += ['mupq_' + c for c in common]
+                if kind == 'sign':
+                    with open(os.path.join(path, 'api.h')) as f:
+                        api = f.read()
+                    m = re.search(r'crypto_sign\s*\([^)]*\*\s*\w*smlen', api, re.S)
+                    impl.smlen = 'unsigned long long' \
+                        if m and 'long long' in m.group(0) else 'size_t'
+                impls.append(impl)
+    return impls
+
+
+def glue(impl):
+    # the object list is part of the text so that changing it relinks
+    out = ['/* generated by gen_registry.py, do not edit */',
+           '/* linked with: {} */'.format(' '.join(impl.sources + impl.extra)),
+           '#include <stddef.h>',
+           '#include <stdint.h>',
+           '#include "pqdispatch.h"',
+           '#include "api.h"',
+           '']
+    if impl.project == 'PQClean':
+        ns = impl.namespace
+        names = {'public-key': 'CRYPTO_PUBLICKEYBYTES',
+                 'secret-key': 'CRYPTO_SECRETKEYBYTES',
+                 'ciphertext': 'CRYPTO_CIPHERTEXTBYTES',
+                 'shared-secret': 'CRYPTO_BYTES',
+                 'signature': 'CRYPTO_BYTES'}
+        for k, v in impl.lengths.items():
+            out.append('_Static_assert({}{} == {}, "META.yml length-{}");'.format(
+                ns, names[k], v, k))
+        if impl.lengths:
+            out.append('')
+        lengths = {k: str(v) for k, v in impl.lengths.items()}
+    else:
+        ns = ''
+        lengths = {'public-key': 'CRYPTO_PUBLICKEYBYTES',
+                   'secret-key': 'CRYPTO_SECRETKEYBYTES'}
+        if impl.kind == 'kem':
+            lengths['ciphertext'] = 'CRYPTO_CIPHERTEXTBYTES'
+            lengths['shared-secret'] = 'CRYPTO_BYTES'
+        else:
+            lengths['signature'] = 'CRYPTO_BYTES'
+            out += [
+                'static int sign_wrap(uint8_t *sm, size_t *smlen,',
+                '        const uint8_t *m, size_t mlen, const uint8_t *sk) {',
+                '    {} n;'.format(impl.smlen),
+                '    int r = crypto_sign(sm, &n, m, mlen, sk);',
+                '    *smlen = (size_t) n;',
+                '    return r;',
+                '}',
+                '',
+                'static int open_wrap(uint8_t *m, size_t *mlen,',
+                '        const uint8_t *sm, size_t smlen, const uint8_t *pk) {',
+                '    {} n;'.format(impl.smlen),
+                '    int r = crypto_sign_open(m, &n, sm, smlen, pk);',
+                '    *mlen = (size_t) n;',
+                '    return r;',
+                '}',
+                '']
+
+    out.append('const pqdispatch_{} {} = {{'.format(impl.kind, impl.symbol))
+    out.append('    {}, {}, {}, {},'.format(
+        cstr(impl.scheme), cstr(impl.name), cstr(impl.project), cstr(impl.title)))
+    out.append('    {}, {}, {},'.format(
+        impl.level, feature_macros(impl.features), 0 if impl.automatic else 1))
+    if impl.kind == 'kem':
+        out.append('    {}, {}, {}, {},'.format(
+            lengths['public-key'], lengths['secret-key'],
+            lengths['ciphertext'], lengths['shared-secret']))
+        out += ['    {}crypto_kem_keypair,'.format(ns),
+                '    {}crypto_kem_enc,'.format(ns),
+                '    {}crypto_kem_dec,'.format(ns)]
+    else:
+        out.append('    {}, {}, {},'.format(
+            lengths['public-key'], lengths['secret-key'], lengths['signature']))
+        out.append('    {}crypto_sign_keypair,'.format(ns))
+        if impl.project == 'PQClean':
+            out += ['    {}crypto_sign,'.format(ns),
+                    '    {}crypto_sign_open,'.format(ns),
+                    '    {}crypto_sign_signature,'.format(ns),
+                    '    {}crypto_sign_verify,'.format(ns)]
+        else:
+            out += ['    sign_wrap,', '    open_wrap,', '    NULL,', '    NULL,']
+    out.append('};')
+    return '\n'.join(out) + '\n'
+
+
+def registry(impls):
+    out = ['/* generated by gen_registry.py, do not edit */',
+           '#include <stddef.h>',
+           '#include "pqdispatch.h"',
+           '#include "registry.h"',
+           '']
+    for kind in ('kem', 'sign'):
+        group = [i for i in impls if i.kind == kind]
+        for i in group:
+            out.append('extern const pqdispatch_{} {};'.format(kind, i.symbol))
+        out.append('')
+        schemes = sorted(set(i.scheme for i in group))
+        out.append('const pqdispatch_{0} *const pqdispatch_{0}_impls[] = {{'.format(kind))
+        table = []
+        for s in schemes:
+            members = sorted((i for i in group if i.scheme == s), key=Impl.rank)
+            table.append((s, len(members)))
+            for i in members:
+                out.append('    &{},'.format(i.symbol))
+        out.append('};')
+        out.append('')
+        out.append('const pqdispatch_scheme pqdispatch_{}_schemes[] = {{'.format(kind))
+        first = 0
+        for s, n in table:
+            out.append('    {{{}, {}, {}}},'.format(cstr(s), first, n))
+            first += n
+        out.append('};')
+        out.append('')
+        out.append('const pqdispatch_{0} *pqdispatch_{0}_selected[{1}];'.format(
+            kind, max(len(schemes), 1)))
+        out.append('')
+        out.append('const size_t pqdispatch_{}_nimpls = {};'.format(kind, len(group)))
+        out.append('const size_t pqdispatch_{}_nschemes = {};'.format(kind, len(schemes)))
+        out.append('')
+    return '\n'.join(out)
+
+
+def makefile(impls):
+    out = ['# generated by gen_registry.py, do not edit', '']
+    objs = []
+    common = {
+        'keccak4x': (os.path.join(PQCLEAN, 'common', 'keccak4x',
+                                  'KeccakP-1600-times4-SIMD256.c'),
+                     ['-mavx2'], [os.path.join(PQCLEAN, 'common', 'keccak4x')]),
+    }
+    for _, sources in MUPQ_COMMON:
+        for c in sources:
+            common['mupq_' + c] = (os.path.join(MUPQ, 'common', c), [],
+                                   [os.path.join(MUPQ, 'common'),
+                                    os.path.join(PQCLEAN, 'common')])
+    for name, (src, flags, incs) in sorted(common.items()):
+        obj = '$(BUILD)/obj/common/{}.o'.format(ident(name))
+        out.append('{}: {}'.format(obj, rel(src)))
+        out.append('\t@mkdir -p $(@D)')
+        out.append('\t$(CC) $(CFLAGS) {} {} -MMD -MP -c -o $@ $<'.format(
+            ' '.join(flags), ' '.join('-I' + rel(i) for i in incs)))
+        out.append('')
+    for impl in impls:
+        flags = ' '.join(impl.flags)
+        incs = ' '.join('-I' + rel(i) for i in impl.includes)
+        var = 'PQD_OBJS_' + impl.id
+        srcobjs = []
+        for s in impl.sources:
+            obj = '$(BUILD)/obj/{}/{}.o'.format(impl.id, s.rsplit('.', 1)[0])
+            srcobjs.append(obj)
+            out.append('{}: {}'.format(obj, rel(os.path.join(impl.path, s))))
+            out.append('\t@mkdir -p $(@D)')
+            out.append('\t$(CC) $(CFLAGS) {} {} -MMD -MP -c -o $@ $<'.format(flags, incs))
+        obj = '$(BUILD)/obj/{}/pqdispatch_glue.o'.format(impl.id)
+        srcobjs.append(obj)
+        out.append('{}: $(BUILD)/glue/{}.c'.format(obj, impl.id))
+        out.append('\t@mkdir -p $(@D)')
+        out.append('\t$(CC) $(CFLAGS) {} -I. {} -MMD -MP -c -o $@ $<'.format(flags, incs))
+        srcobjs += ['$(BUILD)/obj/common/{}.o'.format(ident(e)) for e in impl.extra]
+        out.append('{} = {}'.format(var, ' '.join(srcobjs)))
+        target = '$(BUILD)/impl/{}.o'.format(impl.id)
+        out.append('{}: $({})'.format(target, var))
+        out.append('\t@mkdir -p $(@D)')
+        out.append('\t$(LD) -r -o $@.tmp $^')
+        out.append('\t$(OBJCOPY) --keep-global-symbol={} $@.tmp $@'.format(impl.symbol))
+        out.append('\t@rm -f $@.tmp')
+        out.append('')
+        objs.append(target)
+    out.append('PQD_IMPLS = ' + ' \\\n    '.join(objs))
+    out.append('')
+    return '\n'.join(out)
+
+
+def write(path, text):
+    """Writes only on change so that make does not rebuild everything"""
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('usage: gen_registry.py <build directory>')
+    build = sys.argv[1]
+    arch = platform.machine()
+    impls = pqclean_impls(arch) + mupq_impls(arch)
+    seen = set()
+    for i in impls:
+        if i.id in seen:
+            sys.exit('duplicate implementation ' + i.id)
+        seen.add(i.id)
+        for f in i.features:
+            if f not in FEATURES:
+                sys.exit('{}: unknown CPU feature {}'.format(i.path, f))
+    os.makedirs(os.path.join(build, 'glue'), exist_ok=True)
+    for i in impls:
+        write(os.path.join(build, 'glue', i.id + '.c'), glue(i))
+    write(os.path.join(build, 'registry.c'), registry(impls))
+    # always rewritten, it is the target that make checks for staleness
+    with open(os.path.join(build, 'impls.mk'), 'w') as f:
+        f.write(makefile(impls))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,180 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "pqdispatch.h"
+#include "registry.h"
+
+static uint32_t cpu_features;
+
+static const struct {
+    const char *name;
+    uint32_t feature;
+} feature_names[] = {
+    {"aes", PQDISPATCH_CPU_AES},
+    {"avx2", PQDISPATCH_CPU_AVX2},
+    {"bmi2", PQDISPATCH_CPU_BMI2},
+    {"popcnt", PQDISPATCH_CPU_POPCNT},
+    {"pclmulqdq", PQDISPATCH_CPU_PCLMULQDQ},
+    {"sse4_1", PQDISPATCH_CPU_SSE4_1},
+};
+
+static uint32_t detect_features(void) {
+    uint32_t f = 0;
+
+#if defined(__x86_64__) || defined(__i386__)
+    /* also checks that the OS saves the AVX state */
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("aes")) {
+        f |= PQDISPATCH_CPU_AES;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        f |= PQDISPATCH_CPU_AVX2;
+    }
+    if (__builtin_cpu_supports("bmi2")) {
+        f |= PQDISPATCH_CPU_BMI2;
+    }
+    if (__builtin_cpu_supports("popcnt")) {
+        f |= PQDISPATCH_CPU_POPCNT;
+    }
+    if (__builtin_cpu_supports("pclmul")) {
+        f |= PQDISPATCH_CPU_PCLMULQDQ;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        f |= PQDISPATCH_CPU_SSE4_1;
+    }
+#endif
+    return f;
+}
+
+/* features listed in PQDISPATCH_DISABLE */
+static uint32_t disabled_features(void) {
+    const char *s = getenv("PQDISPATCH_DISABLE");
+    uint32_t f = 0;
+    size_t i, n;
+
+    while (s != NULL && *s != '\0') {
+        n = strcspn(s, ", ");
+        for (i = 0; i < sizeof(feature_names) / sizeof(feature_names[0]); i++) {
+            if (strlen(feature_names[i].name) == n &&
+                    strncmp(feature_names[i].name, s, n) == 0) {
+                f |= feature_names[i].feature;
+            }
+        }
+        s += n;
+        s += strspn(s, ", ");
+    }
+    return f;
+}
+
+__attribute__((constructor))
+static void pqdispatch_init(void) {
+    size_t i, j;
+
+    cpu_features = detect_features() & ~disabled_features();
+
+    for (i = 0; i < pqdispatch_kem_nschemes; i++) {
+        const pqdispatch_scheme *s = &pqdispatch_kem_schemes[i];
+        pqdispatch_kem_selected[i] = NULL;
+        for (j = s->first; j < s->first + s->count; j++) {
+            const pqdispatch_kem *k = pqdispatch_kem_impls[j];
+            if (!k->explicit_only && pqdispatch_usable(k->cpu_features)) {
+                pqdispatch_kem_selected[i] = k;
+                break;
+            }
+        }
+    }
+    for (i = 0; i < pqdispatch_sign_nschemes; i++) {
+        const pqdispatch_scheme *s = &pqdispatch_sign_schemes[i];
+        pqdispatch_sign_selected[i] = NULL;
+        for (j = s->first; j < s->first + s->count; j++) {
+            const pqdispatch_sign *k = pqdispatch_sign_impls[j];
+            if (!k->explicit_only && pqdispatch_usable(k->cpu_features)) {
+                pqdispatch_sign_selected[i] = k;
+                break;
+            }
+        }
+    }
+}
+
+uint32_t pqdispatch_cpu_features(void) {
+    return cpu_features;
+}
+
+int pqdispatch_usable(uint32_t features) {
+    return (features & ~cpu_features) == 0;
+}
+
+static int compare_scheme(const void *key, const void *elem) {
+    return strcmp((const char *) key, ((const pqdispatch_scheme *) elem)->scheme);
+}
+
+/* index of scheme in the sorted table, or n if it is unknown */
+static size_t find_scheme(const pqdispatch_scheme *schemes, size_t n,
+                          const char *scheme) {
+    const pqdispatch_scheme *s;
+
+    s = bsearch(scheme, schemes, n, sizeof(*schemes), compare_scheme);
+    return s == NULL ? n : (size_t) (s - schemes);
+}
+
+const pqdispatch_kem *pqdispatch_kem_get(const char *scheme) {
+    size_t i = find_scheme(pqdispatch_kem_schemes, pqdispatch_kem_nschemes, scheme);
+
+    return i == pqdispatch_kem_nschemes ? NULL : pqdispatch_kem_selected[i];
+}
+
+const pqdispatch_sign *pqdispatch_sign_get(const char *scheme) {
+    size_t i = find_scheme(pqdispatch_sign_schemes, pqdispatch_sign_nschemes, scheme);
+
+    return i == pqdispatch_sign_nschemes ? NULL : pqdispatch_sign_selected[i];
+}
+
+const pqdispatch_kem *pqdispatch_kem_get_impl(const char *scheme,
+        const char *implementation) {
+    size_t i = find_scheme(pqdispatch_kem_schemes, pqdispatch_kem_nschemes, scheme);
+    size_t j;
+
+    if (i == pqdispatch_kem_nschemes) {
+        return NULL;
+    }
+    for (j = 0; j < pqdispatch_kem_schemes[i].count; j++) {
+        const pqdispatch_kem *k = pqdispatch_kem_impls[pqdispatch_kem_schemes[i].first + j];
+        if (strcmp(k->implementation, implementation) == 0) {
+            return pqdispatch_usable(k->cpu_features) ? k : NULL;
+        }
+    }
+    return NULL;
+}
+
+const pqdispatch_sign *pqdispatch_sign_get_impl(const char *scheme,
+        const char *implementation) {
+    size_t i = find_scheme(pqdispatch_sign_schemes, pqdispatch_sign_nschemes, scheme);
+    size_t j;
+
+    if (i == pqdispatch_sign_nschemes) {
+        return NULL;
+    }
+    for (j = 0; j < pqdispatch_sign_schemes[i].count; j++) {
+        const pqdispatch_sign *k = pqdispatch_sign_impls[pqdispatch_sign_schemes[i].first + j];
+        if (strcmp(k->implementation, implementation) == 0) {
+            return pqdispatch_usable(k->cpu_features) ? k : NULL;
+        }
+    }
+    return NULL;
+}
+
+size_t pqdispatch_kem_count(void) {
+    return pqdispatch_kem_nimpls;
+}
+
+const pqdispatch_kem *pqdispatch_kem_at(size_t i) {
+    return i < pqdispatch_kem_nimpls ? pqdispatch_kem_impls[i] : NULL;
+}
+
+size_t pqdispatch_sign_count(void) {
+    return pqdispatch_sign_nimpls;
+}
+
+const pqdispatch_sign *pqdispatch_sign_at(size_t i) {
+    return i < pqdispatch_sign_nimpls ? pqdispatch_sign_impls[i] : NULL;
+}
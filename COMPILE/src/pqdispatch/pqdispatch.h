@@ -0,0 +1,93 @@
+#ifndef PQDISPATCH_H
+#define PQDISPATCH_H
+
+/*
+ * libpqdispatch: every KEM and signature implementation of PQClean and mupq
+ * behind one table-driven API.
+ *
+ * Each implementation is described by a pqdispatch_kem or pqdispatch_sign
+ * with its sizes, the CPU features it needs and its entry points. When the
+ * library is loaded the CPU is queried once and, per scheme, the first
+ * implementation whose features are present is selected in the order
+ * avx2, aesni, clmul, opt, opt-ct, clean, ref. Implementations with other
+ * names (e.g. the variable-time leaktime ones) are never picked
+ * automatically but can be requested by name.
+ *
+ * Setting PQDISPATCH_DISABLE to a comma separated list of feature names
+ * (aes, avx2, bmi2, popcnt, pclmulqdq, sse4_1) hides those features from
+ * the selection, e.g. to run the portable code on an AVX2 machine.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PQDISPATCH_CPU_AES          0x01
+#define PQDISPATCH_CPU_AVX2         0x02
+#define PQDISPATCH_CPU_BMI2         0x04
+#define PQDISPATCH_CPU_POPCNT       0x08
+#define PQDISPATCH_CPU_PCLMULQDQ    0x10
+#define PQDISPATCH_CPU_SSE4_1       0x20
+
+typedef struct {
+    const char *scheme;             /* directory name, e.g. "kyber768" */
+    const char *implementation;     /* e.g. "avx2" */
+    const char *project;            /* "PQClean" or "mupq" */
+    const char *name;               /* META.yml name, else the scheme */
+    int claimed_nist_level;         /* 0 if not in META.yml */
+    uint32_t cpu_features;          /* PQDISPATCH_CPU_* that must be present */
+    int explicit_only;              /* never selected automatically */
+    size_t length_public_key;
+    size_t length_secret_key;
+    size_t length_ciphertext;
+    size_t length_shared_secret;
+    int (*keypair)(uint8_t *pk, uint8_t *sk);
+    int (*enc)(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
+    int (*dec)(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+} pqdispatch_kem;
+
+typedef struct {
+    const char *scheme;
+    const char *implementation;
+    const char *project;
+    const char *name;
+    int claimed_nist_level;
+    uint32_t cpu_features;
+    int explicit_only;
+    size_t length_public_key;
+    size_t length_secret_key;
+    size_t length_signature;        /* maximum length */
+    int (*keypair)(uint8_t *pk, uint8_t *sk);
+    int (*sign)(uint8_t *sm, size_t *smlen,
+                const uint8_t *m, size_t mlen, const uint8_t *sk);
+    int (*open)(uint8_t *m, size_t *mlen,
+                const uint8_t *sm, size_t smlen, const uint8_t *pk);
+    /* detached signatures, NULL for implementations without them (mupq) */
+    int (*signature)(uint8_t *sig, size_t *siglen,
+                     const uint8_t *m, size_t mlen, const uint8_t *sk);
+    int (*verify)(const uint8_t *sig, size_t siglen,
+                  const uint8_t *m, size_t mlen, const uint8_t *pk);
+} pqdispatch_sign;
+
+/* features of this CPU that the selection uses */
+uint32_t pqdispatch_cpu_features(void);
+
+/* fastest usable implementation of scheme, NULL if the scheme is unknown */
+const pqdispatch_kem *pqdispatch_kem_get(const char *scheme);
+const pqdispatch_sign *pqdispatch_sign_get(const char *scheme);
+
+/* the named implementation, NULL if unknown or not usable on this CPU */
+const pqdispatch_kem *pqdispatch_kem_get_impl(const char *scheme,
+        const char *implementation);
+const pqdispatch_sign *pqdispatch_sign_get_impl(const char *scheme,
+        const char *implementation);
+
+/* all registered implementations, usable or not, grouped by scheme */
+size_t pqdispatch_kem_count(void);
+const pqdispatch_kem *pqdispatch_kem_at(size_t i);
+size_t pqdispatch_sign_count(void);
+const pqdispatch_sign *pqdispatch_sign_at(size_t i);
+
+/* 1 if all features in cpu_features are present */
+int pqdispatch_usable(uint32_t cpu_features);
+
+#endif
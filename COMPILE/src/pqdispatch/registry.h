@@ -0,0 +1,32 @@
+#ifndef PQDISPATCH_REGISTRY_H
+#define PQDISPATCH_REGISTRY_H
+
+/* tables of the generated registry.c */
+
+#include <stddef.h>
+
+#include "pqdispatch.h"
+
+typedef struct {
+    const char *scheme;
+    size_t first;       /* index of the preferred implementation */
+    size_t count;
+} pqdispatch_scheme;
+
+/* sorted by scheme name */
+extern const pqdispatch_scheme pqdispatch_kem_schemes[];
+extern const pqdispatch_scheme pqdispatch_sign_schemes[];
+extern const size_t pqdispatch_kem_nschemes;
+extern const size_t pqdispatch_sign_nschemes;
+
+/* implementations of each scheme in preference order */
+extern const pqdispatch_kem *const pqdispatch_kem_impls[];
+extern const pqdispatch_sign *const pqdispatch_sign_impls[];
+extern const size_t pqdispatch_kem_nimpls;
+extern const size_t pqdispatch_sign_nimpls;
+
+/* per scheme, filled in when the library is loaded */
+extern const pqdispatch_kem *pqdispatch_kem_selected[];
+extern const pqdispatch_sign *pqdispatch_sign_selected[];
+
+#endif
@@ -200,6 +200,8 @@ parameter PQ_MOD_BARRETT  = 7'b0000011;
 
 parameter PQ_GF_MUL       = 7'b0000100;
 parameter PQ_GF_SYN       = 7'b0000101;
+parameter PQ_GF_CLMUL     = 7'b0010000;
+parameter PQ_GF_CLMULH    = 7'b0010001;
 
 parameter PQ_SHA256       = 7'b0000111;
 
@@ -223,6 +225,12 @@ parameter PQ_NTT_SINGLE_BFDIF_R = 5'b10000;
 
 parameter MUL_PQ     = 3'b111;
 
+// 32x32+64 multiply-accumulate (with MUL_PQ)
+parameter WMAC_NONE  = 2'b00;
+parameter WMAC_ACC   = 2'b01;
+parameter WMAC_SHIFT = 2'b10;
+parameter WMAC_RESET = 2'b11;
+
 /////////////////////////////////////////////////////////
 //    ____ ____    ____            _     _             //
 //   / ___/ ___|  |  _ \ ___  __ _(_)___| |_ ___ _ __  //
@@ -14,12 +14,15 @@
 // Set accelerators of EX stage
 `define HW_ACCEL_EX
 //`define HW_ACCEL_EX_MULTER
+//`define HW_ACCEL_EX_MULTER_WIDE
 //`define HW_ACCEL_EX_MODBARRETT
 //`define HW_ACCEL_EX_SHA256
 //`define HW_ACCEL_EX_GF
 `define HW_ACCEL_EX_BINOMSAMPLE
 //`define HW_ACCEL_EX_MODMULACC
 `define HW_ACCEL_EX_MODMULACC_REUSE
+//`define HW_ACCEL_EX_WIDEMAC
+//`define HW_ACCEL_EX_GF_CLMUL
 
 // Set accelerators of ID stage
 `define HW_ACCEL_ID
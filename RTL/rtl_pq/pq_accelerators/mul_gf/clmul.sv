@@ -0,0 +1,38 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Company: Technical University of Munich
+// Engineer: Tim Fritzmann
+// 
+// Create Date: 01/27/2020
+// Module Name: clmul
+// Project Name: Post-Quantum Cryptography
+// 
+//////////////////////////////////////////////////////////////////////////////////
+
+// Carry-less 32x32 multiplication in GF(2)[x]. The product is not reduced, so
+// that binary field elements wider than a register are multiplied word by word
+// in software. The lower (high = 0) or upper (high = 1) half of the 63-bit
+// product is returned.
+
+module clmul
+  (
+    input logic [31:0] in_1,
+    input logic [31:0] in_2,
+    input logic high,
+    output logic [31:0] out_1
+  );
+  
+  logic [63:0] prod;
+  
+  always_comb
+  begin
+    prod = 0;
+    for (int i=0; i<32; i=i+1) begin
+      if (in_2[i]) begin
+        prod = prod ^ ({32'b0, in_1} << i);
+      end
+    end
+  end
+  
+  assign out_1 = high ? prod[63:32] : prod[31:0];
+  
+endmodule
@@ -22,9 +22,9 @@ module mul_ternary #(parameter PARAM_N=512, parameter PARAM_Q=251, parameter PAR
     output logic ready
 );
 
-    logic [7:0] ff_out [PARAM_N-1:0];
-    logic [7:0] mau_out [PARAM_N-1:0];
-    logic [7:0] mau_out_0;
+    logic [PARAM_LOG_Q-1:0] ff_out [PARAM_N-1:0];
+    logic [PARAM_LOG_Q-1:0] mau_out [PARAM_N-1:0];
+    logic [PARAM_LOG_Q-1:0] mau_out_0;
 //    logic [1:0] mau_sel;
     logic [1:0] mau_sel [PARAM_N-1:0];
     logic [9:0] cntr;
@@ -178,7 +178,7 @@ module mul_ternary #(parameter PARAM_N=512, parameter PARAM_Q=251, parameter PAR
                     .q(ff_out[i])
                  );
             end else begin
-                dff dff_i (
+                dff #(.PARAM_WIDTH(PARAM_LOG_Q)) dff_i (
                     .clk(clk & enable_clk),
                     .rst(rst_ff),
                     .enable(enable_ff),
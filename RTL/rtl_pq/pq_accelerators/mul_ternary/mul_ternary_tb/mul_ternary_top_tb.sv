@@ -25,6 +25,25 @@ module mul_ternary_top_tb();
     logic [31:0] in_2;
     logic [31:0] out_1;
     logic ready;
+
+    // Second instance in the HW_ACCEL_EX_MULTER_WIDE configuration
+    // (16-bit coefficients modulo 2^16), driven by the self-checking
+    // stimulus below. Runs with iverilog -g2012:
+    //   iverilog -g2012 -o mul_ternary_tb mul_ternary_tb/mul_ternary_top_tb.sv mul_ternary_top.sv \
+    //            mul_ternary.sv mau.sv dff.sv && vvp mul_ternary_tb
+    logic rst_w;
+    logic enable_write_w;
+    logic enable_calc_w;
+    logic enable_read_w;
+    logic [31:0] in_1_w;
+    logic [31:0] in_2_w;
+    logic [31:0] out_1_w;
+    logic ready_w;
+
+    logic [15:0] gen_w [PARAM_N-1:0];
+    logic [1:0] ter_w [PARAM_N-1:0];
+    logic [15:0] exp_w [PARAM_N-1:0];
+    int errors = 0;
     
     logic [7:0] poly_gen [PARAM_N-1:0] = {104, 139, 61, 90, 180, 237, 92, 147, 131, 144, 129, 60, 141, 242, 9, 173, 91, 175, 116, 9, 202, 203, 247, 235, 222, 229, 231, 80, 114, 155, 234, 96, 52, 68, 248, 150, 238, 234, 97, 179, 132, 39, 127, 142, 233, 110, 77, 32, 133, 8, 157, 207, 187, 131, 200, 34, 160, 140, 106, 236, 146, 69, 196, 54, 25, 153, 97, 162, 51, 175, 166, 249, 209, 79, 26, 90, 169, 201, 61, 97, 133, 99, 20, 168, 54, 82, 103, 135, 120, 26, 115, 40, 137, 63, 27, 121, 66, 14, 168, 88, 54, 108, 144, 129, 177, 96, 65, 122, 134, 59, 119, 152, 193, 84, 173, 166, 147, 92, 126, 216, 132, 49, 95, 44, 198, 25, 41, 126, 61, 240, 221, 178, 242, 159, 36, 138, 189, 0, 10, 125, 115, 167, 74, 81, 189, 67, 214, 106, 108, 209, 21, 222, 33, 144, 242, 174, 139, 72, 129, 68, 236, 199, 38, 88, 31, 229, 90, 120, 35, 177, 141, 167, 233, 16, 212, 6, 207, 101, 102, 40, 96, 51, 181, 73, 103, 162, 232, 49, 191, 86, 135, 33, 157, 60, 192, 105, 223, 40, 184, 171, 105, 83, 119, 95, 170, 137, 231, 56, 200, 17, 197, 58, 43, 23, 163, 56, 232, 216, 191, 84, 131, 102, 111, 112, 119, 108, 72, 13, 40, 234, 220, 237, 55, 158, 150, 246, 43, 198, 26, 247, 56, 192, 73, 149, 95, 173, 223, 174, 232, 118, 174, 112, 245, 168, 233, 76, 23, 157, 206, 11, 238, 3, 69, 242, 244, 210, 16, 85, 239, 136, 189, 224, 148, 231, 171, 105, 113, 47, 56, 63, 225, 58, 49, 227, 84, 123, 163, 39, 101, 116, 128, 70, 213, 93, 149, 246, 162, 200, 244, 173, 10, 209, 153, 192, 194, 119, 162, 197, 241, 228, 55, 193, 125, 47, 247, 72, 43, 85, 206, 108, 65, 87, 33, 245, 225, 35, 189, 88, 66, 157, 17, 134, 144, 91, 122, 39, 54, 35, 0, 158, 173, 212, 22, 157, 49, 104, 223, 122, 8, 24, 146, 147, 228, 62, 242, 181, 3, 142, 26, 178, 212, 158, 152, 107, 180, 10, 100, 71, 233, 4, 148, 108, 243, 166, 82, 218, 14, 127, 94, 165, 71, 4, 18, 3, 217, 182, 206, 250, 94, 17, 229, 26, 35, 104, 238, 117, 125, 0, 200, 108, 78, 240, 11, 250, 1, 76, 59, 57, 235, 116, 93, 11, 158, 195, 127, 36, 115, 59, 33, 0, 5, 144, 179, 56, 64, 61, 105, 173, 143, 227, 145, 196, 204, 87, 118, 168, 12, 13, 43, 107, 227, 185, 144, 94, 198, 31, 4, 210, 144, 228, 160, 184, 33, 167, 211, 35, 246, 151, 203, 77, 85, 130, 47, 118, 119, 203, 29, 180, 147, 131, 129, 102, 65, 56, 147, 36, 183, 101, 80, 64, 21, 24, 99, 214, 137, 22, 164, 170, 30, 233, 154, 67, 24, 27, 63, 138, 132, 149, 130, 101, 97, 86, 8, 199, 153, 18, 109, 166, 216, 190, 111, 128};
     logic [1:0] poly_ter [PARAM_N-1:0] = {0, 1, 3, 3, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 1, 0, 1, 3, 0, 1, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0, 3, 0, 3, 0, 1, 3, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 3, 1, 3, 3, 0, 1, 0, 3, 0, 3, 0, 0, 3, 1, 1, 0, 1, 1, 3, 0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 1, 3, 3, 0, 3, 3, 0, 3, 0, 1, 0, 0, 0, 1, 3, 0, 3, 0, 3, 3, 1, 3, 0, 3, 0, 0, 3, 3, 1, 3, 3, 1, 3, 3, 0, 3, 1, 1, 0, 1, 3, 1, 3, 1, 0, 3, 1, 3, 3, 1, 0, 0, 1, 1, 1, 0, 3, 3, 0, 1, 3, 3, 3, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 3, 0, 0, 0, 0, 3, 0, 1, 0, 3, 0, 3, 0, 0, 1, 3, 1, 3, 1, 3, 0, 0, 3, 3, 3, 0, 0, 1, 1, 0, 3, 1, 1, 3, 0, 0, 0, 0, 3, 0, 0, 1, 3, 3, 3, 0, 1, 1, 0, 0, 0, 0, 0, 3, 1, 0, 0, 3, 0, 3, 0, 3, 0, 0, 1, 1, 3, 1, 0, 3, 0, 0, 1, 0, 0, 1, 3, 0, 3, 0, 1, 1, 0, 1, 1, 0, 1, 0, 3, 0, 3, 0, 3, 3, 0, 3, 3, 0, 3, 1, 0, 0, 0, 3, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 3, 0, 1, 0, 0, 0, 0, 1, 3, 1, 3, 0, 0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 1, 1, 1, 0, 0, 0, 3, 1, 1, 0, 1, 1, 0, 3, 3, 0, 0, 3, 0, 3, 1, 3, 0, 0, 0, 1, 1, 3, 3, 0, 1, 3, 0, 0, 1, 3, 3, 0, 3, 3, 0, 0, 3, 0, 0, 0, 0, 0, 3, 1, 1, 1, 0, 0, 3, 3, 1, 0, 0, 3, 3, 0, 0, 3, 3, 0, 0, 3, 0, 1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 3, 3, 0, 1, 1, 1, 0, 3, 3, 1, 0, 0, 3, 0, 0, 0, 0, 1, 1, 3, 1, 3, 0, 3, 0, 0, 0, 1, 3, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 3, 0, 3, 1, 0, 0, 1, 3, 1, 1, 3, 0, 1, 0, 0, 3, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 3, 0, 3, 0, 3, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 3, 0, 0, 0, 3, 0, 3, 0, 1, 0, 0, 3, 1, 3, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 1, 0, 3, 0, 0};
@@ -64,6 +83,117 @@ module mul_ternary_top_tb();
         
     end
   
+    //// Wide configuration ////
+    function automatic logic [1:0] rand_ter();
+        int unsigned r = $urandom % 3;
+        return (r == 0) ? 2'b00 : (r == 1) ? 2'b01 : 2'b11;
+    endfunction
+
+    // out = gen * ter modulo x^512 - 1 and 2^16, ter coded as 01 = +1, 11 = -1
+    task automatic model_w();
+        for (int k=0; k<PARAM_N; k=k+1) exp_w[k] = 0;
+        for (int j=0; j<PARAM_N; j=j+1) begin
+            for (int i=0; i<PARAM_N; i=i+1) begin
+                if (ter_w[j] == 2'b01) exp_w[(i+j) % PARAM_N] = exp_w[(i+j) % PARAM_N] + gen_w[i];
+                else if (ter_w[j] == 2'b11) exp_w[(i+j) % PARAM_N] = exp_w[(i+j) % PARAM_N] - gen_w[i];
+            end
+        end
+    endtask
+
+    // Same command sequence as r5_ringmul.c: clear, write two coefficients
+    // per transfer, start, wait for ready and read two results per transfer
+    task automatic run_w(string name);
+        int errors_before = errors;
+
+        enable_calc_w = 1;
+        in_1_w = 4;
+        #(`REF_CLK_PERIOD);
+        enable_calc_w = 0;
+        in_1_w = 0;
+        #(`REF_CLK_PERIOD);
+
+        enable_write_w = 1;
+        for (int i=0; i<PARAM_N; i=i+2) begin
+            in_1_w = {gen_w[i+1], gen_w[i]};
+            in_2_w = (i << 20) | (ter_w[i+1] << 2) | ter_w[i];
+            #(`REF_CLK_PERIOD);
+        end
+        enable_write_w = 0;
+        in_2_w = 0;
+
+        enable_calc_w = 1;
+        in_1_w = 1;
+        #(`REF_CLK_PERIOD);
+        #(`REF_CLK_PERIOD);
+        enable_calc_w = 0;
+        in_1_w = 0;
+        #(`REF_CLK_PERIOD);
+        wait (ready_w == 1'b1);
+        #(`REF_CLK_PERIOD);
+
+        model_w();
+        enable_read_w = 1;
+        for (int k=0; k<PARAM_N; k=k+2) begin
+            in_1_w = k;
+            #(`REF_CLK_PERIOD);
+            if (out_1_w !== {exp_w[k+1], exp_w[k]}) begin
+                errors++;
+                if (errors < 10)
+                    $display("%s failed: out[%0d..%0d] = %h, expected %h", name, k, k+1, out_1_w, {exp_w[k+1], exp_w[k]});
+            end
+        end
+        enable_read_w = 0;
+        in_1_w = 0;
+        if (errors == errors_before)
+            $display("%s passed", name);
+    endtask
+
+    initial
+    begin
+        rst_w = 1;
+        enable_write_w = 0;
+        enable_calc_w = 0;
+        enable_read_w = 0;
+        in_1_w = 0;
+        in_2_w = 0;
+        #(`REF_CLK_PERIOD);
+        rst_w = 0;
+
+        // Random operands
+        for (int i=0; i<PARAM_N; i=i+1) begin
+            gen_w[i] = $urandom;
+            ter_w[i] = rand_ter();
+        end
+        run_w("wide random");
+
+        // Every output is 512 * 0xffff, which wraps modulo 2^16
+        for (int i=0; i<PARAM_N; i=i+1) begin
+            gen_w[i] = 16'hffff;
+            ter_w[i] = 2'b01;
+        end
+        run_w("wide carry");
+
+        // All -1, subtraction below zero
+        for (int i=0; i<PARAM_N; i=i+1) begin
+            gen_w[i] = $urandom;
+            ter_w[i] = 2'b11;
+        end
+        run_w("wide negate");
+
+        // Upper half of the ternary operand zero, as used by r5_ringmul.c
+        for (int i=0; i<PARAM_N; i=i+1) begin
+            gen_w[i] = $urandom;
+            ter_w[i] = (i < PARAM_N/2) ? rand_ter() : 2'b00;
+        end
+        run_w("wide half block");
+
+        if (errors == 0)
+            $display("mul_ternary_top_tb: all wide tests passed");
+        else
+            $display("mul_ternary_top_tb: %0d errors", errors);
+        $finish;
+    end
+
   mul_ternary_top mul_ternary_top_dut
   (
       .clk(clk),
@@ -76,5 +206,18 @@ module mul_ternary_top_tb();
       .out_1(out_1),
       .ready(ready)
   );
+
+  mul_ternary_top #(.PARAM_N(PARAM_N), .PARAM_LOG_N(9), .PARAM_Q(65536), .PARAM_LOG_Q(16)) mul_ternary_top_wide_dut
+  (
+      .clk(clk),
+      .rst(rst_w),
+      .enable_write(enable_write_w),
+      .enable_calc(enable_calc_w),
+      .enable_read(enable_read_w),
+      .in_1(in_1_w),
+      .in_2(in_2_w),
+      .out_1(out_1_w),
+      .ready(ready_w)
+  );
     
 endmodule
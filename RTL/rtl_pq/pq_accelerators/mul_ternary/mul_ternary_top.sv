@@ -22,9 +22,9 @@ module mul_ternary_top #(parameter PARAM_N=512, parameter PARAM_LOG_N = 9, param
     output logic ready
 );
 
-    logic [7:0] poly_gen [PARAM_N-1:0];
+    logic [PARAM_LOG_Q-1:0] poly_gen [PARAM_N-1:0];
     logic [1:0] poly_ter [PARAM_N-1:0];
-    logic [7:0] poly_out [PARAM_N-1:0];
+    logic [PARAM_LOG_Q-1:0] poly_out [PARAM_N-1:0];
     
     logic ready_write;
     logic ready_calc;
@@ -76,6 +76,16 @@ module mul_ternary_top #(parameter PARAM_N=512, parameter PARAM_LOG_N = 9, param
     // |                 |       |       |       |       | 29:28 | 27:20 | 19:18 | 17:10 |  9:8  |  7:0  |
     // |      31:20      | 19:18 | 17:10 |  9:8  |  7:0  |       |       |       |       |       |       |
     // |_________________|_______|_______|_______|_______|_______|_______|_______|_______|_______|_______|   
+    //
+    // With PARAM_LOG_Q > 8 two coefficients are written at once:
+    //  _________________________________________________________________
+    // |      addr       |   ---   |  b_1  |  b_0  |    a_1    |    a_0    |
+    // |_________________|_________|_______|_______|___________|___________|
+    // |      63:52      |  51:36  | 35:34 | 33:32 |   31:16   |   15:0    |
+    // |_________________|_________|_______|_______|___________|___________|
+    // |                 |         |       |       |   31:16   |   15:0    |
+    // |      31:20      |  19:4   |  3:2  |  1:0  |           |           |
+    // |_________________|_________|_______|_______|___________|___________|
     
     always @(posedge clk, posedge rst)
     begin
@@ -86,7 +96,13 @@ module mul_ternary_top #(parameter PARAM_N=512, parameter PARAM_LOG_N = 9, param
             for (int i=0; i<PARAM_N; i=i+1) poly_gen[i] = 0;
             for (int i=0; i<PARAM_N; i=i+1) poly_ter[i] = 0;
         end else begin
-            if (enable_write == 1) begin
+            if ((enable_write == 1) && (PARAM_LOG_Q > 8)) begin
+                address_w = in_2[31:20];
+                poly_gen[address_w] = in_1[15:0];
+                poly_ter[address_w] = in_2[1:0];
+                poly_gen[address_w+1] = in_1[31:16];
+                poly_ter[address_w+1] = in_2[3:2];
+            end else if (enable_write == 1) begin
                 address_w = in_2[31:20];
                 if (address_w >= 510) begin
                     poly_gen[address_w] = in_1[7:0];
@@ -111,15 +127,15 @@ module mul_ternary_top #(parameter PARAM_N=512, parameter PARAM_LOG_N = 9, param
     
     
     //// Read Logic ////
-    shortint address_r; // start address read
-    always @(posedge clk)
-    begin
-        if (enable_read == 1) begin
-            address_r = in_1[PARAM_LOG_N-1:0];
-            out_1 = {poly_out[address_r+3],poly_out[address_r+2],poly_out[address_r+1],poly_out[address_r]};
+    // The result is returned in the same cycle, as for the other EX stage accelerators
+    logic [PARAM_LOG_N-1:0] address_r; // start address read
+    assign address_r = in_1[PARAM_LOG_N-1:0];
+    
+    generate
+        if (PARAM_LOG_Q > 8) begin
+            assign out_1 = (enable_read == 1) ? {poly_out[address_r+1],poly_out[address_r]} : 0;
         end else begin
-            address_r <= 0;
-            out_1 <= 0;
+            assign out_1 = (enable_read == 1) ? {poly_out[address_r+3],poly_out[address_r+2],poly_out[address_r+1],poly_out[address_r]} : 0;
         end
-    end    
+    endgenerate
 endmodule
@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////////////////
+// Company: Technical University of Munich
+// Engineer: Tim Fritzmann
+//
+// Create Date: 01/27/2020
+// Module Name: butterfly_dilithium
+// Project Name: Post-Quantum Cryptography
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+// Register operations of the Modular Arithmetic Unit for 32-bit moduli
+// (Dilithium with q = 8380417 or the modulus set by pq.set_modulus, R = 2^32).
+// In contrast to the butterfly module, which works on two 16-bit
+// coefficients packed in each register, every register holds a single 32-bit
+// coefficient. The modulus has to be odd and smaller than 2^31. All inputs
+// have to be reduced (< q), except for mod_mul that accepts any 32-bit product
+// partner as long as the other operand is smaller than q.
+
+module butterfly_dilithium
+#(
+  parameter DATA_WIDTH = 32
+)
+(
+  // Modulus and -q^-1 mod 2^32
+  input logic [DATA_WIDTH-1:0] modulus,
+  input logic [DATA_WIDTH-1:0] param_MinQinvModR,
+
+  // Data input
+  input logic [DATA_WIDTH-1:0] data1_i,  // rs1
+  input logic [DATA_WIDTH-1:0] data2_i,  // rs2
+  input logic [DATA_WIDTH-1:0] omega,    // rd
+
+  input logic mod_mul,
+  input logic mod_add,
+  input logic mod_sub,
+  input logic single_bfdit,
+  input logic single_bfdif,
+
+  // Data output
+  output logic [DATA_WIDTH-1:0] data1_o,
+  output logic [DATA_WIDTH-1:0] data2_o
+);
+
+  logic [DATA_WIDTH-1:0] res_mul;
+  logic [DATA_WIDTH-1:0] res_add;
+  logic [DATA_WIDTH-1:0] res_sub;
+
+  logic [DATA_WIDTH-1:0] mux_mul1_o;
+  logic [DATA_WIDTH-1:0] mux_mul2_o;
+  logic [DATA_WIDTH-1:0] mux_add_o;
+  logic [DATA_WIDTH-1:0] mux_sub_o;
+
+  // bf_dit: (a, b) -> (a + w*b, a - w*b)
+  // bf_dif: (a, b) -> (a + b, (a - b)*w)
+  // mod_mul/mod_add/mod_sub: a -> a*b, a + b, a - b
+  assign mux_mul1_o = (single_bfdif == 1'b1) ? res_sub : data2_i;
+  assign mux_mul2_o = ((single_bfdit | single_bfdif) == 1'b1) ? omega : data1_i;
+  assign mux_add_o = (single_bfdit == 1'b1) ? res_mul : data2_i;
+  assign mux_sub_o = (single_bfdit == 1'b1) ? res_mul : data2_i;
+
+  multiplier #(.PARAM_RLOG(32), .DATA_WIDTH(DATA_WIDTH)) multiplier_inst
+  (
+    .modulus(modulus),
+    .param_MinQinvModR(param_MinQinvModR),
+    .in1(mux_mul1_o),
+    .in2(mux_mul2_o),
+    .result(res_mul)
+  );
+
+  adder #(.DATA_WIDTH(DATA_WIDTH)) adder_inst
+  (
+    .modulus(modulus),
+    .in1(data1_i),
+    .in2(mux_add_o),
+    .result(res_add)
+  );
+
+  subtractor #(.DATA_WIDTH(DATA_WIDTH)) subtractor_inst
+  (
+    .modulus(modulus),
+    .in1(data1_i),
+    .in2(mux_sub_o),
+    .result(res_sub)
+  );
+
+  assign data1_o = (mod_mul == 1'b1) ? res_mul : (mod_sub == 1'b1) ? res_sub : res_add;
+  assign data2_o = (single_bfdif == 1'b1) ? res_mul : res_sub;
+
+endmodule
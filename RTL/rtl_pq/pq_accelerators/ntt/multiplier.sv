@@ -21,27 +21,28 @@
 
 
 module multiplier
-  # (PARAM_RLOG = 18)
+  # (PARAM_RLOG = 18,
+     DATA_WIDTH = 16)
   ( 
-    input logic [15:0] modulus,
-    input logic [17:0] param_MinQinvModR,
-    input logic [15:0] in1,
-    input logic [15:0] in2,
-    output logic [15:0] result
+    input logic [DATA_WIDTH-1:0] modulus,
+    input logic [PARAM_RLOG-1:0] param_MinQinvModR,
+    input logic [DATA_WIDTH-1:0] in1,
+    input logic [DATA_WIDTH-1:0] in2,
+    output logic [DATA_WIDTH-1:0] result
   );
   
-  logic [31:0] a;
-  logic [50:0] ap;
-  logic [49:0] u;
+  logic [2*DATA_WIDTH-1:0] a;
+  logic [2*DATA_WIDTH+PARAM_RLOG:0] ap;
+  logic [2*DATA_WIDTH+PARAM_RLOG-1:0] u;
   
-  logic [15:0] result_int;  
+  logic [DATA_WIDTH-1:0] result_int;  
   
   always_comb
   begin
     a = in1 * in2;
     u = a * param_MinQinvModR;
     ap = a + (u[PARAM_RLOG-1:0] * modulus);
-    result_int = ap[PARAM_RLOG+15:PARAM_RLOG];
+    result_int = ap[PARAM_RLOG+DATA_WIDTH-1:PARAM_RLOG];
     if (modulus <= result_int) begin
       result_int -= modulus;
     end
@@ -25,6 +25,9 @@ module ntt_closely_top
     input logic [17:0] param_MinQinvModR,
     input logic fwd_ntt,
     input logic ntt_first_rounds,
+    input logic dilithium_mode,
+    input logic [DATA_WIDTH-1:0] modulus_32,
+    input logic [DATA_WIDTH-1:0] param_MinQinvModR_32,
     
     input logic ntt_start,
     input logic single_bf,
@@ -88,6 +91,10 @@ module ntt_closely_top
   logic [DATA_WIDTH/2-1:0] omega;
   logic [DATA_WIDTH/2-1:0] omega_mux_o;
   logic [DATA_WIDTH/2-1:0] omega_prev;
+  
+  // Signals - Butterfly Dilithium
+  logic [DATA_WIDTH-1:0] data1_dilithium_o;
+  logic [DATA_WIDTH-1:0] data2_dilithium_o;
  
   
   // Multiplexer 
@@ -178,6 +185,24 @@ module ntt_closely_top
     .data2_o(data2_o)
   );
 
+  //// BUTTERFLY DILITHIUM ////
+  // Register operations only, one 32-bit coefficient per register
+  butterfly_dilithium butterfly_dilithium_inst
+  (
+    .modulus(modulus_32),
+    .param_MinQinvModR(param_MinQinvModR_32),
+    .data1_i(alu_operand_a),
+    .data2_i(alu_operand_b),
+    .omega(alu_operand_c),
+    .mod_mul(pq_operator_id[0]),
+    .mod_add(pq_operator_id[1]),
+    .mod_sub(pq_operator_id[2]),
+    .single_bfdit(pq_operator_id[3]),
+    .single_bfdif(pq_operator_id[4]),
+    .data1_o(data1_dilithium_o),
+    .data2_o(data2_dilithium_o)
+  );
+
   //// Input/Output logic ////
   assign data1_i = ((pq_operator_id[3]|pq_operator_id[4])== 1'b1) ? {alu_operand_b[15:0],alu_operand_a[15:0]} : (pq_en_id == 1'b1) ? alu_operand_a  : rdata_pq_i[raddr1];
   assign data2_i = ((pq_operator_id[3]|pq_operator_id[4])== 1'b1) ? {alu_operand_b[31:16],alu_operand_a[31:16]} : (pq_en_id == 1'b1) ? alu_operand_b : rdata_pq_i[raddr2];
@@ -233,6 +258,6 @@ module ntt_closely_top
   assign pq_id_alu_we1 = (pq_en_id == 1'b1) ? 1'b1 : 1'b0;
   assign pq_id_alu_we2 = ((pq_en_id == 1'b1) && ((pq_operator_id[3] | pq_operator_id[4]) == 1'b1)) ? 1'b1 : 1'b0;
   assign omega_mux_o = (pq_en_id == 1'b1) ? alu_operand_c[DATA_WIDTH/2-1:0] : omega;
-  assign pq_id_alu_res1 = data1_o;
-  assign pq_id_alu_res2 = data2_o;
+  assign pq_id_alu_res1 = (dilithium_mode == 1'b1) ? data1_dilithium_o : data1_o;
+  assign pq_id_alu_res2 = (dilithium_mode == 1'b1) ? data2_dilithium_o : data2_o;
 endmodule
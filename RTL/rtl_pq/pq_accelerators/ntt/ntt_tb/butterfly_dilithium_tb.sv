@@ -0,0 +1,145 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// Company: Technical University of Munich
+// Engineer: Tim Fritzmann
+//
+// Create Date: 01/27/2020
+// Module Name: butterfly_dilithium_tb
+// Project Name: Post-Quantum Cryptography
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+// Self-checking testbench for the 32-bit register operations with the
+// Dilithium and the qTESLA-p-I/p-III moduli. Runs with
+// iverilog -g2012 or verilator --binary:
+//   iverilog -g2012 -o bf_dil_tb ntt_tb/butterfly_dilithium_tb.sv butterfly_dilithium.sv \
+//            multiplier.sv adder.sv subtractor.sv && vvp bf_dil_tb
+
+`define CLK_PERIOD       40.00ns      // 25 MHz
+
+module butterfly_dilithium_tb;
+  localparam DATA_WIDTH = 32;
+  localparam int NTESTS = 10000;
+  localparam int NMODULI = 3;
+
+  // q, -q^-1 mod 2^32, 2^-32 mod q and 2^32 mod q
+  localparam longint unsigned MODULI [NMODULI][4] = '{
+    '{8380417,   32'hfc7fdfff, 8265825,   4193792},    // Dilithium
+    '{343576577, 32'h837a8fff, 176457118, 172048372},  // qTESLA-p-I
+    '{856145921, 32'h2307bfff, 117152444, 14237691}    // qTESLA-p-III
+  };
+
+  longint unsigned Q, RINV, MONT;
+
+  logic [DATA_WIDTH-1:0] modulus;
+  logic [DATA_WIDTH-1:0] param_MinQinvModR;
+
+  logic [DATA_WIDTH-1:0] data1_i;
+  logic [DATA_WIDTH-1:0] data2_i;
+  logic [DATA_WIDTH-1:0] omega;
+  logic mod_mul;
+  logic mod_add;
+  logic mod_sub;
+  logic single_bfdit;
+  logic single_bfdif;
+  logic [DATA_WIDTH-1:0] data1_o;
+  logic [DATA_WIDTH-1:0] data2_o;
+
+  int errors = 0;
+
+  butterfly_dilithium butterfly_dilithium_inst
+  (
+    .modulus(modulus),
+    .param_MinQinvModR(param_MinQinvModR),
+    .data1_i(data1_i),
+    .data2_i(data2_i),
+    .omega(omega),
+    .mod_mul(mod_mul),
+    .mod_add(mod_add),
+    .mod_sub(mod_sub),
+    .single_bfdit(single_bfdit),
+    .single_bfdif(single_bfdif),
+    .data1_o(data1_o),
+    .data2_o(data2_o)
+  );
+
+  function automatic longint unsigned mont(longint unsigned a, longint unsigned b);
+    return (((a * b) % Q) * RINV) % Q;
+  endfunction
+
+  function automatic longint unsigned rand_q();
+    return {$urandom} % Q;
+  endfunction
+
+  task automatic check(string op, longint unsigned exp1, longint unsigned exp2, bit check2);
+    #(`CLK_PERIOD);
+    if (data1_o != exp1 || (check2 && data2_o != exp2)) begin
+      errors++;
+      if (errors < 10)
+        $display("%s failed: a=%0d b=%0d w=%0d -> %0d %0d, expected %0d %0d",
+                 op, data1_i, data2_i, omega, data1_o, data2_o, exp1, exp2);
+    end
+  endtask
+
+  task automatic set_op(bit mul, bit add, bit sub, bit dit, bit dif);
+    mod_mul = mul;
+    mod_add = add;
+    mod_sub = sub;
+    single_bfdit = dit;
+    single_bfdif = dif;
+  endtask
+
+  initial
+  begin
+    longint unsigned a, b, w, t;
+
+    for (int m = 0; m < NMODULI; m++) begin
+      Q = MODULI[m][0];
+      RINV = MODULI[m][2];
+      MONT = MODULI[m][3];
+      modulus = Q;
+      param_MinQinvModR = MODULI[m][1];
+
+      for (int i = 0; i < NTESTS; i++) begin
+        a = rand_q();
+        b = rand_q();
+        w = rand_q();
+        // Border cases
+        if (i == 0) begin a = 0; b = 0; w = 0; end
+        if (i == 1) begin a = Q-1; b = Q-1; w = Q-1; end
+        if (i == 2) begin a = 0; b = Q-1; w = 1; end
+        data1_i = a;
+        data2_i = b;
+        omega = w;
+
+        set_op(1'b1, 1'b0, 1'b0, 1'b0, 1'b0);
+        check("mod_mul", mont(a, b), 0, 1'b0);
+
+        set_op(1'b0, 1'b1, 1'b0, 1'b0, 1'b0);
+        check("mod_add", (a + b) % Q, 0, 1'b0);
+
+        set_op(1'b0, 1'b0, 1'b1, 1'b0, 1'b0);
+        check("mod_sub", (a + Q - b) % Q, 0, 1'b0);
+
+        t = mont(w, b);
+        set_op(1'b0, 1'b0, 1'b0, 1'b1, 1'b0);
+        check("bf_dit", (a + t) % Q, (a + Q - t) % Q, 1'b1);
+
+        set_op(1'b0, 1'b0, 1'b0, 1'b0, 1'b1);
+        check("bf_dif", (a + b) % Q, mont((a + Q - b) % Q, w), 1'b1);
+
+        // mod_mul with MONT reduces any 32-bit value
+        data1_i = $urandom;
+        data2_i = MONT;
+        set_op(1'b1, 1'b0, 1'b0, 1'b0, 1'b0);
+        check("mod_mul reduce", data1_i % Q, 0, 1'b0);
+      end
+    end
+
+    if (errors == 0)
+      $display("butterfly_dilithium_tb: all %0d tests passed for %0d moduli", NTESTS, NMODULI);
+    else
+      $display("butterfly_dilithium_tb: %0d errors", errors);
+    $finish;
+  end
+endmodule
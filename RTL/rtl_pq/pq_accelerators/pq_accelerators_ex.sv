@@ -32,7 +32,7 @@ module pq_accelerators_ex
   input  logic        ex_ready_i
 );
 
-    logic [8:0] enable;
+    logic [9:0] enable;
     
     `ifdef HW_ACCEL_EX_MULTER
       logic [31:0] result_o_mul_ternary;
@@ -64,6 +64,11 @@ module pq_accelerators_ex
       logic [31:0] result_o_mod_mul_acc;    
     `endif
 
+    `ifdef HW_ACCEL_EX_GF_CLMUL
+      logic high_clmul;
+      logic [31:0] result_o_clmul;
+    `endif
+
     // Function selection
     always_comb
     begin
@@ -71,10 +76,14 @@ module pq_accelerators_ex
         `ifdef HW_ACCEL_EX_BINOMSAMPLE
           mode_binom_sample = 3'b000;
         `endif
-        case (operator_i) 
-            PQ_MULTER_READ: enable[0] = 1;
+        `ifdef HW_ACCEL_EX_GF_CLMUL
+          high_clmul = 1'b0;
+        `endif
+        // operator_i is zero (PQ_MULTER_WRITE) while no PQ instruction is in EX
+        if (enable_i) case (operator_i) 
+            PQ_MULTER_WRITE: enable[0] = 1;
             PQ_MULTER_CALC: enable[1] = 1;
-            PQ_MULTER_WRITE: enable[2] = 1;
+            PQ_MULTER_READ: enable[2] = 1;
             PQ_MOD_BARRETT: enable[3] = 1;
             PQ_GF_MUL: enable[4] = 1;
             PQ_GF_SYN: enable[5] = 1;
@@ -112,6 +121,15 @@ module pq_accelerators_ex
             PQ_MOD_MULACC: begin
               enable[8] = 1;
             end                    
+            PQ_GF_CLMUL: begin
+              enable[9] = 1;
+            end
+            PQ_GF_CLMULH: begin
+              enable[9] = 1;
+              `ifdef HW_ACCEL_EX_GF_CLMUL
+                high_clmul = 1'b1;
+              `endif
+            end
             default: begin
               enable = 0;
               `ifdef HW_ACCEL_EX_BINOMSAMPLE
@@ -156,39 +174,44 @@ module pq_accelerators_ex
     begin
       unique case (enable)
         `ifdef HW_ACCEL_EX_MULTER
-          9'b000000010: begin
+          10'b0000000100: begin
             result_o = result_o_mul_ternary;
           end
         `endif
         `ifdef HW_ACCEL_EX_MODBARRETT
-          9'b000000100:  begin
+          10'b0000001000:  begin
             result_o = result_o_mod_barrett;
           end
         `endif
         `ifdef HW_ACCEL_EX_GF
-          9'b000001000:  begin 
+          10'b0000010000:  begin 
             result_o[31:9] = 0;   
             result_o[9-1:0] = result_o_gf_mul;
           end
-          9'b000010000:  begin 
+          10'b0000100000:  begin 
             result_o[31:0] = result_o_gf_chien;
           end
         `endif
         `ifdef HW_ACCEL_EX_SHA256
-          9'b001000000:  begin 
+          10'b0001000000:  begin 
             result_o = result_o_sha256;
           end
         `endif
         `ifdef HW_ACCEL_EX_BINOMSAMPLE
-          9'b010000000:  begin 
+          10'b0010000000:  begin 
             result_o = result_o_binom_sample;
           end
         `endif
         `ifdef HW_ACCEL_EX_MODMULACC
-          9'b100000000:  begin 
+          10'b0100000000:  begin 
             result_o = result_o_mod_mul_acc;
           end
         `endif
+        `ifdef HW_ACCEL_EX_GF_CLMUL
+          10'b1000000000:  begin 
+            result_o = result_o_clmul;
+          end
+        `endif
         default: begin
           result_o = 0;
         end
@@ -226,7 +249,15 @@ module pq_accelerators_ex
  
     //// Poly Ternary Multiplier ////
     `ifdef HW_ACCEL_EX_MULTER
-      mul_ternary_top #(.PARAM_N(512), .PARAM_LOG_N(9), .PARAM_Q(251), .PARAM_LOG_Q(8)) mul_ternary_top_i
+      `ifdef HW_ACCEL_EX_MULTER_WIDE
+        // 16-bit coefficients modulo 2^16, e.g. for Round5 with q = 2^10 ... 2^13
+        localparam MULTER_Q = 65536;
+        localparam MULTER_LOG_Q = 16;
+      `else
+        localparam MULTER_Q = 251;
+        localparam MULTER_LOG_Q = 8;
+      `endif
+      mul_ternary_top #(.PARAM_N(512), .PARAM_LOG_N(9), .PARAM_Q(MULTER_Q), .PARAM_LOG_Q(MULTER_LOG_Q)) mul_ternary_top_i
       (
         .clk(clk),
         .rst(~rst_n),
@@ -287,6 +318,17 @@ module pq_accelerators_ex
       );
     `endif
     
+    //// Carry-less Multiplication GF(2)[x] ////
+    `ifdef HW_ACCEL_EX_GF_CLMUL
+      clmul clmul_i
+      (
+        .in_1(op_a_i),
+        .in_2(op_b_i),
+        .high(high_clmul),
+        .out_1(result_o_clmul)
+      );
+    `endif
+    
        
     assign multicycle_o = ~ready_o;
     
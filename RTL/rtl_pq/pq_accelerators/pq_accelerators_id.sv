@@ -25,6 +25,8 @@ module pq_accelerators_id
       input logic set_n_256,
       input logic set_n_512,
       input logic set_n_1024,
+      input logic set_dilithium,
+      input logic set_modulus,
       input logic set_fwd_ntt,
       input logic set_inv_ntt,
       input logic set_ntt_first_rounds,
@@ -79,6 +81,9 @@ module pq_accelerators_id
     logic [17:0] param_MinQinvModR;  
     logic fwd_ntt_reg;
     logic ntt_first_rounds_reg;
+    logic dilithium_mode_reg;
+    logic [31:0] modulus_32;
+    logic [31:0] param_MinQinvModR_32;
     logic [DATA_WIDTH-1:0] wdata_pq_ntt [31:0];
     logic [2**(ADDR_WIDTH-1)-1:0] we_pq_ntt;
   `endif
@@ -138,6 +143,35 @@ module pq_accelerators_id
       end
     end
   
+    // Dilithium uses the register operations with one 32-bit coefficient per
+    // register (q = 8380417), the other schemes two packed 16-bit coefficients
+    always_ff @(posedge clk, negedge rst_n)
+    begin
+      if (rst_n == 1'b0) begin
+        dilithium_mode_reg <= 1'b0;
+      end else if ((set_dilithium | set_modulus) == 1'b1) begin
+        dilithium_mode_reg <= 1'b1;
+      end else if ((set_n_256 | set_n_512 | set_n_1024) == 1'b1) begin
+        dilithium_mode_reg <= 1'b0;
+      end
+    end
+  
+    // Modulus of the 32-bit mode. pq.set_modulus takes any odd q < 2^31
+    // (rs1) together with -q^-1 mod 2^32 (rs2), e.g. for qTESLA
+    always_ff @(posedge clk, negedge rst_n)
+    begin
+      if (rst_n == 1'b0) begin
+        modulus_32 <= 32'd8380417;
+        param_MinQinvModR_32 <= 32'hfc7fdfff;
+      end else if (set_dilithium == 1'b1) begin
+        modulus_32 <= 32'd8380417;
+        param_MinQinvModR_32 <= 32'hfc7fdfff;
+      end else if (set_modulus == 1'b1) begin
+        modulus_32 <= alu_operand_a;
+        param_MinQinvModR_32 <= alu_operand_b;
+      end
+    end
+  
     // NTT Module instantiation
     ntt_closely_top ntt_closely_top_i
     ( 
@@ -151,6 +185,9 @@ module pq_accelerators_id
       .param_MinQinvModR(param_MinQinvModR),
       .fwd_ntt(fwd_ntt_reg),
       .ntt_first_rounds(ntt_first_rounds_reg),
+      .dilithium_mode(dilithium_mode_reg),
+      .modulus_32(modulus_32),
+      .param_MinQinvModR_32(param_MinQinvModR_32),
   
       // NTT operations
       .ntt_start(ntt_multiple_bf),
@@ -194,6 +194,9 @@ module riscv_core
   logic [31:0] mult_dot_op_b_ex;
   logic [31:0] mult_dot_op_c_ex;
   logic [ 1:0] mult_dot_signed_ex;
+  `ifdef HW_ACCEL_EX_WIDEMAC
+    logic [ 1:0] mult_wide_op_ex;
+  `endif
 
   `ifdef HW_ACCEL_EX_OR_HW_BITREV
     // PQ Control
@@ -649,6 +652,9 @@ module riscv_core
     .mult_dot_op_b_ex_o           ( mult_dot_op_b_ex     ), // from ID to EX stage
     .mult_dot_op_c_ex_o           ( mult_dot_op_c_ex     ), // from ID to EX stage
     .mult_dot_signed_ex_o         ( mult_dot_signed_ex   ), // from ID to EX stage
+    `ifdef HW_ACCEL_EX_WIDEMAC
+      .mult_wide_op_ex_o            ( mult_wide_op_ex      ), // from ID to EX stage
+    `endif
 
     // FPU
     .fpu_op_ex_o                  ( fpu_op_ex               ),
@@ -807,6 +813,9 @@ module riscv_core
     .mult_dot_op_b_i            ( mult_dot_op_b_ex             ), // from ID/EX pipe registers
     .mult_dot_op_c_i            ( mult_dot_op_c_ex             ), // from ID/EX pipe registers
     .mult_dot_signed_i          ( mult_dot_signed_ex           ), // from ID/EX pipe registers
+    `ifdef HW_ACCEL_EX_WIDEMAC
+      .mult_wide_op_i             ( mult_wide_op_ex              ), // from ID/EX pipe registers
+    `endif
 
     .mult_multicycle_o          ( mult_multicycle              ), // to ID/EX pipe registers
 
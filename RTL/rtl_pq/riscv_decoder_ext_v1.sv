@@ -100,6 +100,8 @@ module riscv_decoder
     output logic set_n_256_o,
     output logic set_n_512_o,
     output logic set_n_1024_o,
+    output logic set_dilithium_o,
+    output logic set_modulus_o,
     output logic set_fwd_ntt_o,
     output logic set_inv_ntt_o,
     output logic set_ntt_first_rounds_o,
@@ -137,6 +139,9 @@ module riscv_decoder
   output logic        mult_sel_subword_o,      // Select subwords for 16x16 bit of multiplier
   output logic [1:0]  mult_signed_mode_o,      // Multiplication in signed mode
   output logic [1:0]  mult_dot_signed_o,       // Dot product in signed mode
+  `ifdef HW_ACCEL_EX_WIDEMAC
+    output logic [1:0]  mult_wide_op_o,        // 32x32+64 multiply-accumulate operation
+  `endif
 
   // FPU
   output logic [C_CMD-1:0]    fpu_op_o,
@@ -240,6 +245,8 @@ module riscv_decoder
       set_n_256_o                 = 1'b0;
       set_n_512_o                 = 1'b0;
       set_n_1024_o                = 1'b0;
+      set_dilithium_o             = 1'b0;
+      set_modulus_o               = 1'b0;
       set_fwd_ntt_o               = 1'b0;
       set_inv_ntt_o               = 1'b0;
       set_ntt_first_rounds_o      = 1'b0;
@@ -274,6 +281,9 @@ module riscv_decoder
     mult_signed_mode_o          = 2'b00;
     mult_sel_subword_o          = 1'b0;
     mult_dot_signed_o           = 2'b00;
+    `ifdef HW_ACCEL_EX_WIDEMAC
+      mult_wide_op_o              = WMAC_NONE;
+    `endif
 
     apu_en                      = 1'b0;
     apu_type_o                  = '0;
@@ -612,6 +622,9 @@ module riscv_decoder
                   3'b110: begin
                     set_ntt_last_round_o = 1'b1;
                   end
+                  3'b111: begin
+                    set_dilithium_o = 1'b1;
+                  end
                   default: begin
                     illegal_insn_o = 1'b1;
                   end
@@ -647,6 +660,11 @@ module riscv_decoder
                     ntt_single_bf_o = 1'b1;
                     update_psi_o = 1'b1;          
                   end
+                  3'b111: begin
+                    rega_used_o   = 1'b1;
+                    regb_used_o   = 1'b1;
+                    set_modulus_o = 1'b1;
+                  end
                   default: begin
                     illegal_insn_o = 1'b1;
                   end
@@ -835,6 +853,34 @@ module riscv_decoder
                     pq_operator_o  = PQ_MOD_MULACC;
                     end
                   `endif
+                `ifdef HW_ACCEL_EX_WIDEMAC
+                  // pq.wmac: acc += rs1 * rs2, no result
+                  3'b001: begin
+                    rega_used_o       = 1'b1;
+                    regb_used_o       = 1'b1;
+                    mult_int_en_o     = 1'b1;
+                    mult_operator_o   = MUL_PQ;
+                    mult_wide_op_o    = WMAC_ACC;
+                  end
+                  // pq.wmacs: rd = (acc + rs1 * rs2)[31:0], acc = (acc + rs1 * rs2) >> 32
+                  3'b010: begin
+                    regfile_alu_we    = 1'b1;
+                    rega_used_o       = 1'b1;
+                    regb_used_o       = 1'b1;
+                    mult_int_en_o     = 1'b1;
+                    mult_operator_o   = MUL_PQ;
+                    mult_wide_op_o    = WMAC_SHIFT;
+                  end
+                  // pq.wmacr: rd = (acc + rs1 * rs2)[31:0], acc = 0
+                  3'b011: begin
+                    regfile_alu_we    = 1'b1;
+                    rega_used_o       = 1'b1;
+                    regb_used_o       = 1'b1;
+                    mult_int_en_o     = 1'b1;
+                    mult_operator_o   = MUL_PQ;
+                    mult_wide_op_o    = WMAC_RESET;
+                  end
+                `endif
                 default:begin
                   illegal_insn_o = 1'b1;
                 end
@@ -848,21 +894,21 @@ module riscv_decoder
                   regc_used_o    = 1'b1;
                   rega_used_o    = 1'b1;
                   regb_used_o    = 1'b1;
-                  pq_operator_o  = PQ_MULTER_CALC;                 
+                  pq_operator_o  = PQ_MULTER_WRITE;                 
                 end
                 3'b001: begin
                   regfile_alu_we = 1'b1;
                   regc_used_o    = 1'b1;
                   rega_used_o    = 1'b1;
                   regb_used_o    = 1'b1;
-                  pq_operator_o  = PQ_MULTER_READ;                 
+                  pq_operator_o  = PQ_MULTER_CALC;                 
                 end
                 3'b010: begin
                   regfile_alu_we = 1'b1;
                   regc_used_o    = 1'b1;
                   rega_used_o    = 1'b1;
                   regb_used_o    = 1'b1;
-                  pq_operator_o  = PQ_MULTER_WRITE;                 
+                  pq_operator_o  = PQ_MULTER_READ;                 
                 end
                 default: begin
                   illegal_insn_o = 1'b1;
@@ -886,6 +932,22 @@ module riscv_decoder
                   regb_used_o    = 1'b1;
                   pq_operator_o  = PQ_GF_SYN;
                 end
+                `ifdef HW_ACCEL_EX_GF_CLMUL
+                3'b011: begin
+                  regfile_alu_we = 1'b1;
+                  regc_used_o    = 1'b1;
+                  rega_used_o    = 1'b1;
+                  regb_used_o    = 1'b1;
+                  pq_operator_o  = PQ_GF_CLMUL;
+                end
+                3'b100: begin
+                  regfile_alu_we = 1'b1;
+                  regc_used_o    = 1'b1;
+                  rega_used_o    = 1'b1;
+                  regb_used_o    = 1'b1;
+                  pq_operator_o  = PQ_GF_CLMULH;
+                end
+                `endif
                 default: begin
                   illegal_insn_o = 1'b1;
                 end
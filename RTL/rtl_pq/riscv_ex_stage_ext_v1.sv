@@ -80,6 +80,9 @@ module riscv_ex_stage
   input  logic [31:0] mult_dot_op_b_i,
   input  logic [31:0] mult_dot_op_c_i,
   input  logic [ 1:0] mult_dot_signed_i,
+  `ifdef HW_ACCEL_EX_WIDEMAC
+    input  logic [ 1:0] mult_wide_op_i,
+  `endif
 
   output logic        mult_multicycle_o,
 
@@ -335,6 +338,9 @@ module riscv_ex_stage
     .dot_op_b_i      ( mult_dot_op_b_i      ),
     .dot_op_c_i      ( mult_dot_op_c_i      ),
     .dot_signed_i    ( mult_dot_signed_i    ),
+    `ifdef HW_ACCEL_EX_WIDEMAC
+      .wide_op_i       ( mult_wide_op_i       ),
+    `endif
 
     .result_o        ( mult_result          ),
 
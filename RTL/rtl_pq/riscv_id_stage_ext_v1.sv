@@ -151,6 +151,9 @@ module riscv_id_stage
     output logic [31:0] mult_dot_op_b_ex_o,
     output logic [31:0] mult_dot_op_c_ex_o,
     output logic [ 1:0] mult_dot_signed_ex_o,
+    `ifdef HW_ACCEL_EX_WIDEMAC
+      output logic [ 1:0] mult_wide_op_ex_o,
+    `endif
 
     // FPU
     output logic [C_CMD-1:0]           fpu_op_ex_o,
@@ -371,6 +374,8 @@ module riscv_id_stage
     logic set_n_256;
     logic set_n_512;
     logic set_n_1024;
+    logic set_dilithium;
+    logic set_modulus;
     logic set_fwd_ntt;
     logic set_inv_ntt;
     logic set_ntt_first_rounds;
@@ -413,6 +418,9 @@ module riscv_id_stage
   logic [1:0]  mult_signed_mode; // Signed mode multiplication at the output of the controller, and before the pipe registers
   logic        mult_dot_en;      // use dot product
   logic [1:0]  mult_dot_signed;  // Signed mode dot products (can be mixed types)
+  `ifdef HW_ACCEL_EX_WIDEMAC
+    logic [1:0]  mult_wide_op;   // 32x32+64 multiply-accumulate operation
+  `endif
 
   // FPU signals
   logic [C_CMD-1:0]           fpu_op;
@@ -1092,6 +1100,8 @@ module riscv_id_stage
         .set_n_256(set_n_256),
         .set_n_512(set_n_512),
         .set_n_1024(set_n_1024),
+        .set_dilithium(set_dilithium),
+        .set_modulus(set_modulus),
         .set_fwd_ntt(set_fwd_ntt),
         .set_inv_ntt(set_inv_ntt),
         .set_ntt_first_rounds(set_ntt_first_rounds),
@@ -1220,6 +1230,8 @@ module riscv_id_stage
       .set_n_256_o                     ( set_n_256                 ),
       .set_n_512_o                     ( set_n_512                 ),
       .set_n_1024_o                    ( set_n_1024                ),
+      .set_dilithium_o                 ( set_dilithium             ),
+      .set_modulus_o                   ( set_modulus               ),
       .set_fwd_ntt_o                   ( set_fwd_ntt               ),
       .set_inv_ntt_o                   ( set_inv_ntt               ),
       .set_ntt_first_rounds_o          ( set_ntt_first_rounds      ),
@@ -1257,6 +1269,9 @@ module riscv_id_stage
     .mult_imm_mux_o                  ( mult_imm_mux              ),
     .mult_dot_en_o                   ( mult_dot_en               ),
     .mult_dot_signed_o               ( mult_dot_signed           ),
+    `ifdef HW_ACCEL_EX_WIDEMAC
+      .mult_wide_op_o                  ( mult_wide_op              ),
+    `endif
 
     .fpu_op_o                        ( fpu_op                    ),
     .apu_en_o                        ( apu_en                    ),
@@ -1565,6 +1580,9 @@ module riscv_id_stage
       mult_dot_op_b_ex_o          <= '0;
       mult_dot_op_c_ex_o          <= '0;
       mult_dot_signed_ex_o        <= '0;
+      `ifdef HW_ACCEL_EX_WIDEMAC
+        mult_wide_op_ex_o           <= WMAC_NONE;
+      `endif
 
       `ifdef HW_ACCEL_EX_OR_HW_BITREV
         pq_en_ex_o                  <= 1'b0;
@@ -1676,6 +1694,10 @@ module riscv_id_stage
           end
        `endif
         mult_en_ex_o                <= mult_en;
+        `ifdef HW_ACCEL_EX_WIDEMAC
+          // the accumulator must only be updated once per instruction
+          mult_wide_op_ex_o         <= mult_wide_op;
+        `endif
         if (mult_int_en) begin
           mult_operator_ex_o        <= mult_operator;
           mult_sel_subword_ex_o     <= mult_sel_subword;
@@ -1747,6 +1769,10 @@ module riscv_id_stage
 
         regfile_alu_we_ex_o         <= 1'b0;
 
+        `ifdef HW_ACCEL_EX_WIDEMAC
+          mult_wide_op_ex_o         <= WMAC_NONE;
+        `endif
+
         csr_op_ex_o                 <= CSR_OP_NONE;
 
         data_req_ex_o               <= 1'b0;
@@ -58,6 +58,11 @@ module riscv_mult
   input  logic [31:0] dot_op_b_i,
   input  logic [31:0] dot_op_c_i,
 
+  `ifdef HW_ACCEL_EX_WIDEMAC
+    // 32x32+64 multiply-accumulate
+    input  logic [ 1:0] wide_op_i,
+  `endif
+
   output logic [31:0] result_o,
 
   output logic        multicycle_o,
@@ -300,6 +305,54 @@ module riscv_mult
      end
   endgenerate
 
+  `ifdef HW_ACCEL_EX_WIDEMAC
+    ////////////////////////////////////////////////////////////
+    //  32x32+64 multiply-accumulate for multi-precision      //
+    //  (comba) products. The 96-bit accumulator is kept in   //
+    //  carry-save form; only pq.wmacs and pq.wmacr resolve   //
+    //  the carries, so a column of pq.wmac instructions is   //
+    //  one multiplier and one 3:2 compressor per cycle.      //
+    ////////////////////////////////////////////////////////////
+
+    logic [63:0] wide_prod;
+    logic [95:0] wide_sum_q, wide_carry_q;
+    logic [95:0] wide_csa_sum, wide_csa_carry;
+    logic [95:0] wide_full;
+
+    assign wide_prod      = {32'b0, op_a_i} * {32'b0, op_b_i};
+
+    assign wide_csa_sum   = wide_sum_q ^ wide_carry_q ^ {32'b0, wide_prod};
+    assign wide_csa_carry = {(wide_sum_q[94:0] & wide_carry_q[94:0]) |
+                             (wide_sum_q[94:0] & {31'b0, wide_prod}) |
+                             (wide_carry_q[94:0] & {31'b0, wide_prod}), 1'b0};
+
+    assign wide_full      = wide_csa_sum + wide_csa_carry;
+
+    always_ff @(posedge clk, negedge rst_n)
+    begin
+      if (~rst_n) begin
+        wide_sum_q   <= '0;
+        wide_carry_q <= '0;
+      end else if (enable_i && ex_ready_i && (operator_i == MUL_PQ)) begin
+        unique case (wide_op_i)
+          WMAC_ACC: begin
+            wide_sum_q   <= wide_csa_sum;
+            wide_carry_q <= wide_csa_carry;
+          end
+          WMAC_SHIFT: begin
+            wide_sum_q   <= {32'b0, wide_full[95:32]};
+            wide_carry_q <= '0;
+          end
+          WMAC_RESET: begin
+            wide_sum_q   <= '0;
+            wide_carry_q <= '0;
+          end
+          default: ;
+        endcase
+      end
+    end
+  `endif
+
   ////////////////////////////////////////////////////////
   //   ____                 _ _     __  __              //
   //  |  _ \ ___  ___ _   _| | |_  |  \/  |_   ___  __  //
@@ -322,7 +375,13 @@ module riscv_mult
       MUL_DOT8:  result_o = dot_char_result[31:0];
       MUL_DOT16: result_o = dot_short_result[31:0];
       
-      `ifdef HW_ACCEL_EX_MODMULACC_REUSE
+      `ifdef HW_ACCEL_EX_WIDEMAC
+        `ifdef HW_ACCEL_EX_MODMULACC_REUSE
+          MUL_PQ:  result_o = (wide_op_i == WMAC_NONE) ? {pq_res1,pq_res0} : wide_full[31:0];
+        `else
+          MUL_PQ:  result_o = wide_full[31:0];
+        `endif
+      `elsif HW_ACCEL_EX_MODMULACC_REUSE
         MUL_PQ:  result_o = {pq_res1,pq_res0}; 
       `endif
 